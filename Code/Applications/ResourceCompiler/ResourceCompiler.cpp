@@ -1,5 +1,6 @@
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompilerRegistry.h"
+#include "EngineTools/Resource/ResourceCompiler.h"
 #include "System/Application/ApplicationGlobalState.h"
 #include "System/ThirdParty/cmdParser/cmdParser.h"
 #include "System/Resource/ResourceSettings.h"
@@ -9,6 +10,8 @@
 
 #include <windows.h>
 #include <iostream>
+#include <string>
+#include <filesystem>
 
 //-------------------------------------------------------------------------
 
@@ -29,11 +32,22 @@ namespace EE
             cmdParser.set_optional<std::string>( "compile", "compile", "", "Compile resource" );
             cmdParser.set_optional<bool>( "debug", "debug", false, "Trigger debug break before execution." );
             cmdParser.set_optional<bool>( "package", "package", false, "Compile resource for packaged build." );
+            cmdParser.set_optional<bool>( "worker", "worker", false, "Run as a persistent worker, reading compilation requests from stdin." );
+            cmdParser.set_optional<bool>( "cachereport", "cachereport", false, "Print a summary of the compiled resource cache contents." );
 
             if ( cmdParser.run() )
             {
                 m_triggerDebugBreak = cmdParser.get<bool>( "debug" );
                 m_isForPackagedBuild = cmdParser.get<bool>( "package" );
+                m_isWorker = cmdParser.get<bool>( "worker" );
+                m_printCacheReport = cmdParser.get<bool>( "cachereport" );
+
+                // Workers receive their requests via stdin
+                if ( m_isWorker || m_printCacheReport )
+                {
+                    m_isValid = true;
+                    return;
+                }
 
                 // Get compile argument
                 ResourcePath const resourcePath( cmdParser.get<std::string>( "compile" ).c_str() );
@@ -62,6 +76,8 @@ namespace EE
         ResourceID          m_resourceID;
         bool                m_triggerDebugBreak = false;
         bool                m_isForPackagedBuild = false;
+        bool                m_isWorker = false;
+        bool                m_printCacheReport = false;
         bool                m_isValid = false;
     };
 }
@@ -97,9 +113,13 @@ int main( int argc, char* argv[] )
 
     CommandLineArgumentParser argParser( argc, argv );
 
-    for ( int i = 0; i < argc; i++ )
+    // Worker output is only the compilation logs
+    if ( !argParser.m_isWorker && !argParser.m_printCacheReport )
     {
-        std::cout << argv[i] << std::endl;
+        for ( int i = 0; i < argc; i++ )
+        {
+            std::cout << argv[i] << std::endl;
+        }
     }
 
     if ( !argParser.IsValid() )
@@ -108,17 +128,67 @@ int main( int argc, char* argv[] )
         return 1;
     }
 
-    // File Paths
+    // Cache report
     //-------------------------------------------------------------------------
 
-    if ( argParser.m_isForPackagedBuild )
+    if ( argParser.m_printCacheReport )
     {
-        settings.m_compiledResourcePath = settings.m_packagedBuildCompiledResourcePath;
+        if ( !settings.m_compiledResourceCachePath.IsValid() || !settings.m_compiledResourceCachePath.Exists() )
+        {
+            std::cout << "Compiled resource cache is disabled or empty" << std::endl;
+            return 0;
+        }
+
+        struct TypeEntry
+        {
+            TInlineString<6>    m_extension;
+            int32_t             m_numEntries = 0;
+            uint64_t            m_totalSize = 0;
+        };
+
+        TVector<FileSystem::Path> cacheEntries;
+        FileSystem::GetDirectoryContents( settings.m_compiledResourceCachePath, cacheEntries, FileSystem::DirectoryReaderOutput::OnlyFiles );
+
+        TVector<TypeEntry> typeEntries;
+        uint64_t totalSize = 0;
+        for ( auto const& entryPath : cacheEntries )
+        {
+            std::error_code errorCode;
+            uint64_t const fileSize = std::filesystem::file_size( entryPath.c_str(), errorCode );
+            totalSize += fileSize;
+
+            auto const extension = entryPath.GetExtensionAsString();
+            auto iter = eastl::find_if( typeEntries.begin(), typeEntries.end(), [&extension] ( TypeEntry const& entry ) { return entry.m_extension == extension; } );
+            if ( iter == typeEntries.end() )
+            {
+                iter = &typeEntries.emplace_back();
+                iter->m_extension = extension;
+            }
+
+            iter->m_numEntries++;
+            iter->m_totalSize += fileSize;
+        }
+
+        printf( "Compiled Resource Cache: %s\n", settings.m_compiledResourceCachePath.c_str() );
+        for ( auto const& typeEntry : typeEntries )
+        {
+            printf( "    %-6s %8d entries %10.2fMB\n", typeEntry.m_extension.c_str(), typeEntry.m_numEntries, typeEntry.m_totalSize / ( 1024.0f * 1024.0f ) );
+        }
+        printf( "Total: %d entries, %.2fMB\n", (int32_t) cacheEntries.size(), totalSize / ( 1024.0f * 1024.0f ) );
+        return 0;
     }
 
+    // File Paths
+    //-------------------------------------------------------------------------
+
     settings.m_rawResourcePath.EnsureDirectoryExists();
     settings.m_compiledResourcePath.EnsureDirectoryExists();
 
+    if ( argParser.m_isForPackagedBuild || argParser.m_isWorker )
+    {
+        settings.m_packagedBuildCompiledResourcePath.EnsureDirectoryExists();
+    }
+
     // Create tools modules and register compilers
     //-------------------------------------------------------------------------
 
@@ -137,10 +207,11 @@ int main( int argc, char* argv[] )
         EE_HALT();
     }
 
-    auto CompileResource = [&] ()
+    auto CompileResource = [&] ( ResourceID const& resourceID, bool isForPackagedBuild )
     {
         // Try create compilation context
-        Resource::CompileContext compileContext( settings.m_rawResourcePath, settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild );
+        FileSystem::Path const& compiledResourcePath = isForPackagedBuild ? settings.m_packagedBuildCompiledResourcePath : settings.m_compiledResourcePath;
+        Resource::CompileContext compileContext( settings.m_rawResourcePath, compiledResourcePath, resourceID, isForPackagedBuild );
         if ( !compileContext.IsValid() )
         {
             return -1;
@@ -166,7 +237,50 @@ int main( int argc, char* argv[] )
         return (int32_t) result;
     };
 
-    int32_t const result = CompileResource();
+    int32_t result = 0;
+
+    if ( argParser.m_isWorker )
+    {
+        // Process requests until we are told to exit or the server closes our input
+        std::string command;
+        while ( std::getline( std::cin, command ) )
+        {
+            size_t const separatorIdx = command.find( ' ' );
+            std::string const commandName = command.substr( 0, separatorIdx );
+            if ( commandName == Resource::CompilerWorkerProtocol::s_exitCommand )
+            {
+                break;
+            }
+
+            int32_t compilationResult = (int32_t) Resource::CompilationResult::Failure;
+            bool const isForPackagedBuild = ( commandName == Resource::CompilerWorkerProtocol::s_packageCommand );
+            if ( separatorIdx != std::string::npos && ( isForPackagedBuild || commandName == Resource::CompilerWorkerProtocol::s_compileCommand ) )
+            {
+                ResourcePath const resourcePath( command.substr( separatorIdx + 1 ).c_str() );
+                ResourceID const resourceID = resourcePath.IsValid() ? ResourceID( resourcePath ) : ResourceID();
+                if ( resourceID.IsValid() )
+                {
+                    compilationResult = CompileResource( resourceID, isForPackagedBuild );
+                }
+                else
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Compiler", "Invalid compile request: %s\n", command.c_str() );
+                }
+            }
+            else
+            {
+                EE_LOG_ERROR( "Resource", "Resource Compiler", "Unknown worker command: %s\n", command.c_str() );
+            }
+
+            // The result marker must start on its own line
+            std::cout << std::endl << Resource::CompilerWorkerProtocol::s_resultMarker << compilationResult << std::endl;
+            fflush( stdout );
+        }
+    }
+    else
+    {
+        result = CompileResource( argParser.m_resourceID, argParser.m_isForPackagedBuild );
+    }
 
     // Unregister all types
     //-------------------------------------------------------------------------
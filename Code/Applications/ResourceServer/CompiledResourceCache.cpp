@@ -0,0 +1,235 @@
+#include "CompiledResourceCache.h"
+#include "CompiledResourceDatabase.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/Algorithm/Hash.h"
+#include "System/Log.h"
+#include <filesystem>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    void CompiledResourceCache::Initialize( FileSystem::Path const& cachePath )
+    {
+        EE_ASSERT( !m_cachePath.IsValid() );
+
+        if ( cachePath.IsValid() )
+        {
+            EE_ASSERT( cachePath.IsDirectoryPath() );
+            if ( cachePath.EnsureDirectoryExists() )
+            {
+                m_cachePath = cachePath;
+            }
+            else
+            {
+                EE_LOG_WARNING( "Resource", "Compiled Resource Cache", "Failed to create compiled resource cache directory (%s), caching is disabled!", cachePath.c_str() );
+            }
+        }
+    }
+
+    void CompiledResourceCache::Shutdown()
+    {
+        Threading::ScopeLock lock( m_mutex );
+        EE_ASSERT( m_numUnpersistedFileHashes == 0 );
+        m_fileHashes.clear();
+        m_cachePath.Clear();
+    }
+
+    CompiledResourceCache::Stats CompiledResourceCache::GetStats() const
+    {
+        Threading::ScopeLock lock( m_mutex );
+        return m_stats;
+    }
+
+    void CompiledResourceCache::LogReport() const
+    {
+        Stats const stats = GetStats();
+        int32_t const numLookups = stats.m_numHits + stats.m_numMisses;
+        float const hitRate = ( numLookups > 0 ) ? ( 100.0f * stats.m_numHits / numLookups ) : 0.0f;
+        EE_LOG_MESSAGE( "Resource", "Compiled Resource Cache", "Hits: %d, Misses: %d (%.1f%% hit rate), Stores: %d (%d failed), Restored: %.2fMB", stats.m_numHits, stats.m_numMisses, hitRate, stats.m_numStores, stats.m_numFailedStores, stats.m_numBytesRestored / ( 1024.0f * 1024.0f ) );
+        EE_LOG_MESSAGE( "Resource", "Compiled Resource Cache", "Hashed Files: %d (%.2fMB), Memoized Hash Lookups: %d", stats.m_numHashedFiles, stats.m_numBytesHashed / ( 1024.0f * 1024.0f ), stats.m_numMemoizedFileHashes );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CompiledResourceCache::LoadFileHashes( CompiledResourceDatabase const& database )
+    {
+        EE_ASSERT( database.IsConnected() );
+
+        TVector<FileHashRecord> records;
+        if ( !database.GetAllFileHashRecords( records ) )
+        {
+            EE_LOG_WARNING( "Resource", "Compiled Resource Cache", "Failed to load memoized file hashes: %s", database.GetError().c_str() );
+            return;
+        }
+
+        Threading::ScopeLock lock( m_mutex );
+        for ( auto const& record : records )
+        {
+            m_fileHashes[record.m_filePath] = FileHashEntry{ record.m_modifiedTime, record.m_fileSize, record.m_contentHash, true };
+        }
+    }
+
+    void CompiledResourceCache::SaveFileHashes( CompiledResourceDatabase& database )
+    {
+        EE_ASSERT( database.IsConnected() );
+
+        TVector<FileHashRecord> records;
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            if ( m_numUnpersistedFileHashes == 0 )
+            {
+                return;
+            }
+
+            records.reserve( m_numUnpersistedFileHashes );
+            for ( auto& entryPair : m_fileHashes )
+            {
+                if ( !entryPair.second.m_isPersisted )
+                {
+                    records.emplace_back( FileHashRecord{ entryPair.first, entryPair.second.m_modifiedTime, entryPair.second.m_fileSize, entryPair.second.m_contentHash } );
+                    entryPair.second.m_isPersisted = true;
+                }
+            }
+
+            m_numUnpersistedFileHashes = 0;
+        }
+
+        // A failed write only costs us a rehash on the next run
+        if ( !database.WriteFileHashRecords( records ) )
+        {
+            EE_LOG_WARNING( "Resource", "Compiled Resource Cache", "Failed to save memoized file hashes: %s", database.GetError().c_str() );
+        }
+    }
+
+    uint64_t CompiledResourceCache::GetFileContentHash( FileSystem::Path const& filePath, uint64_t fileModifiedTime )
+    {
+        EE_ASSERT( filePath.IsValid() );
+
+        // Some tools restore the modified time when rewriting files, so the size is also checked to catch those changes
+        std::error_code errorCode;
+        uint64_t const fileSize = std::filesystem::file_size( filePath.c_str(), errorCode );
+        if ( errorCode )
+        {
+            return 0;
+        }
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            auto iter = m_fileHashes.find( filePath );
+            if ( iter != m_fileHashes.end() && iter->second.m_modifiedTime == fileModifiedTime && iter->second.m_fileSize == fileSize )
+            {
+                m_stats.m_numMemoizedFileHashes++;
+                return iter->second.m_contentHash;
+            }
+        }
+
+        // Hash outside of the lock, worst case two tasks hash the same file
+        //-------------------------------------------------------------------------
+
+        Blob fileData;
+        if ( !FileSystem::LoadFile( filePath, fileData ) )
+        {
+            return 0;
+        }
+
+        uint64_t const contentHash = Hash::XXHash::GetHash64( fileData );
+
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock lock( m_mutex );
+        auto iter = m_fileHashes.find( filePath );
+        if ( iter == m_fileHashes.end() || iter->second.m_isPersisted )
+        {
+            m_numUnpersistedFileHashes++;
+        }
+
+        m_fileHashes[filePath] = FileHashEntry{ fileModifiedTime, fileSize, contentHash, false };
+        m_stats.m_numHashedFiles++;
+        m_stats.m_numBytesHashed += fileData.size();
+        return contentHash;
+    }
+
+    //-------------------------------------------------------------------------
+
+    FileSystem::Path CompiledResourceCache::GetEntryPath( uint64_t cacheKey, ResourceID const& resourceID ) const
+    {
+        EE_ASSERT( IsStorageEnabled() );
+
+        // Use the top byte of the key as a sub-directory to keep the directory sizes reasonable
+        InlineString entryName;
+        entryName.sprintf( "%02llx%c%016llx.%s", cacheKey >> 56, FileSystem::Settings::s_pathDelimiter, cacheKey, resourceID.GetResourceTypeID().ToString().c_str() );
+        return m_cachePath + entryName.c_str();
+    }
+
+    bool CompiledResourceCache::TryRestore( uint64_t cacheKey, ResourceID const& resourceID, FileSystem::Path const& destinationPath )
+    {
+        EE_ASSERT( IsStorageEnabled() && cacheKey != 0 );
+
+        // We always copy rather than link, since the compilers overwrite their outputs in place which would corrupt the cache entry
+        FileSystem::Path const entryPath = GetEntryPath( cacheKey, resourceID );
+
+        std::error_code errorCode;
+        bool const wasRestored = std::filesystem::copy_file( entryPath.c_str(), destinationPath.c_str(), std::filesystem::copy_options::overwrite_existing, errorCode );
+        uint64_t const fileSize = wasRestored ? std::filesystem::file_size( destinationPath.c_str(), errorCode ) : 0;
+
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock lock( m_mutex );
+        if ( wasRestored )
+        {
+            m_stats.m_numHits++;
+            m_stats.m_numBytesRestored += fileSize;
+        }
+        else
+        {
+            m_stats.m_numMisses++;
+        }
+
+        return wasRestored;
+    }
+
+    bool CompiledResourceCache::Store( uint64_t cacheKey, ResourceID const& resourceID, FileSystem::Path const& compiledResourcePath )
+    {
+        EE_ASSERT( IsStorageEnabled() && cacheKey != 0 );
+
+        static std::atomic<uint32_t> s_tempFileIdx = 0;
+
+        FileSystem::Path const entryPath = GetEntryPath( cacheKey, resourceID );
+        bool wasStored = entryPath.EnsureDirectoryExists();
+        if ( wasStored )
+        {
+            // Copy to a temporary file first, so that a concurrent restore never sees a partially written entry
+            InlineString tempFileSuffix;
+            tempFileSuffix.sprintf( ".%u.tmp", s_tempFileIdx++ );
+            FileSystem::Path const tempPath = entryPath + tempFileSuffix.c_str();
+
+            std::error_code errorCode;
+            wasStored = std::filesystem::copy_file( compiledResourcePath.c_str(), tempPath.c_str(), std::filesystem::copy_options::overwrite_existing, errorCode );
+            if ( wasStored )
+            {
+                std::filesystem::rename( tempPath.c_str(), entryPath.c_str(), errorCode );
+                wasStored = !errorCode;
+                if ( !wasStored )
+                {
+                    std::filesystem::remove( tempPath.c_str(), errorCode );
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock lock( m_mutex );
+        if ( wasStored )
+        {
+            m_stats.m_numStores++;
+        }
+        else
+        {
+            m_stats.m_numFailedStores++;
+        }
+
+        return wasStored;
+    }
+}
\ No newline at end of file
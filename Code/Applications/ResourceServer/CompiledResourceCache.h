@@ -0,0 +1,91 @@
+#pragma once
+
+#include "System/Resource/ResourceID.h"
+#include "System/FileSystem/FileSystemPath.h"
+#include "System/Threading/Threading.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Compiled Resource Cache
+//-------------------------------------------------------------------------
+// A content-addressed store of compiled resources
+// Each compiled output is stored under a key derived from the content hashes of all of the compilation inputs (descriptor,
+// source assets, compiler version and dependencies), so any identical set of inputs can be restored via a copy instead of being recompiled
+//
+// This also memoizes the content hashes of the files used by the up-to-date checks, so files are only rehashed when they are modified
+// The memoized hashes are persisted in the compiled resource database so they survive server restarts
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    class CompiledResourceDatabase;
+
+    //-------------------------------------------------------------------------
+
+    class CompiledResourceCache
+    {
+        struct FileHashEntry
+        {
+            uint64_t                                        m_modifiedTime = 0;
+            uint64_t                                        m_fileSize = 0;
+            uint64_t                                        m_contentHash = 0;
+            bool                                            m_isPersisted = false;
+        };
+
+    public:
+
+        struct Stats
+        {
+            int32_t                                         m_numHits = 0;
+            int32_t                                         m_numMisses = 0;
+            int32_t                                         m_numStores = 0;
+            int32_t                                         m_numFailedStores = 0;
+            int32_t                                         m_numHashedFiles = 0;
+            int32_t                                         m_numMemoizedFileHashes = 0;
+            uint64_t                                        m_numBytesRestored = 0;
+            uint64_t                                        m_numBytesHashed = 0;
+        };
+
+    public:
+
+        // Initialize the cache, if the cache path is not valid only the file hashing is available
+        void Initialize( FileSystem::Path const& cachePath );
+        void Shutdown();
+
+        // Is storing/restoring of compiled resources enabled
+        inline bool IsStorageEnabled() const { return m_cachePath.IsValid(); }
+
+        // Load the memoized file hashes from the database, this must be called before any hashes are requested
+        void LoadFileHashes( CompiledResourceDatabase const& database );
+
+        // Write any new or changed memoized file hashes to the database - this is thread-safe
+        void SaveFileHashes( CompiledResourceDatabase& database );
+
+        // Get the content hash for a file, the result is memoized by the file path, modified time and size - this is thread-safe
+        // Returns 0 if the file could not be read
+        uint64_t GetFileContentHash( FileSystem::Path const& filePath, uint64_t fileModifiedTime );
+
+        // Try to restore the compiled resource for the specified key to the destination path - this is thread-safe
+        bool TryRestore( uint64_t cacheKey, ResourceID const& resourceID, FileSystem::Path const& destinationPath );
+
+        // Store a compiled resource in the cache under the specified key - this is thread-safe
+        bool Store( uint64_t cacheKey, ResourceID const& resourceID, FileSystem::Path const& compiledResourcePath );
+
+        Stats GetStats() const;
+
+        // Write a summary of the cache usage to the log
+        void LogReport() const;
+
+    private:
+
+        FileSystem::Path GetEntryPath( uint64_t cacheKey, ResourceID const& resourceID ) const;
+
+    private:
+
+        FileSystem::Path                                    m_cachePath;
+        THashMap<FileSystem::Path, FileHashEntry>           m_fileHashes;
+        int32_t                                             m_numUnpersistedFileHashes = 0;
+        mutable Threading::Mutex                            m_mutex;
+        Stats                                               m_stats;
+    };
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "CompiledResourceDatabase.h"
 #include "System/FileSystem/FileSystem.h"
+#include "System/Types/HashMap.h"
 #include <sqlite3.h>
 
 //-------------------------------------------------------------------------
@@ -17,6 +18,14 @@ namespace EE
                 return false;
             }
 
+            if ( GetSchemaVersion() != s_schemaVersion )
+            {
+                if ( !DropTables() || !SetSchemaVersion( s_schemaVersion ) )
+                {
+                    return false;
+                }
+            }
+
             if ( !CreateTables() )
             {
                 return false;
@@ -48,7 +57,22 @@ namespace EE
         {
             EE_ASSERT( m_pDatabase != nullptr );
 
-            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceTimestampHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );" ) )
+            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompileDependencyNodes` ( `ResourcePath` TEXT PRIMARY KEY, `DescriptorHash` INTEGER );" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompileDependencies` ( `ResourcePath` TEXT, `DependencyPath` TEXT );" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `FileHashes` ( `FilePath` TEXT PRIMARY KEY, `ModifiedTime` INTEGER, `FileSize` INTEGER, `ContentHash` INTEGER );" ) )
             {
                 return false;
             }
@@ -65,9 +89,50 @@ namespace EE
                 return false;
             }
 
+            if ( !ExecuteSimpleQuery( "DROP TABLE IF EXISTS `CompileDependencyNodes`;" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "DROP TABLE IF EXISTS `CompileDependencies`;" ) )
+            {
+                return false;
+            }
+
+            if ( !ExecuteSimpleQuery( "DROP TABLE IF EXISTS `FileHashes`;" ) )
+            {
+                return false;
+            }
+
             return true;
         }
 
+        int32_t CompiledResourceDatabase::GetSchemaVersion() const
+        {
+            EE_ASSERT( m_pDatabase != nullptr );
+
+            int32_t version = -1;
+
+            sqlite3_stmt* pStatement = nullptr;
+            if ( IsValidSQLiteResult( sqlite3_prepare_v2( m_pDatabase, "PRAGMA user_version;", -1, &pStatement, nullptr ) ) )
+            {
+                if ( sqlite3_step( pStatement ) == SQLITE_ROW )
+                {
+                    version = sqlite3_column_int( pStatement, 0 );
+                }
+
+                IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
+            }
+
+            return version;
+        }
+
+        bool CompiledResourceDatabase::SetSchemaVersion( int32_t version )
+        {
+            EE_ASSERT( m_pDatabase != nullptr );
+            return ExecuteSimpleQuery( "PRAGMA user_version = %d;", version );
+        }
+
         //-------------------------------------------------------------------------
 
         CompiledResourceRecord CompiledResourceDatabase::GetRecord( ResourceID resourceID ) const
@@ -92,7 +157,7 @@ namespace EE
 
                     record.m_compilerVersion = sqlite3_column_int( pStatement, 2 );
                     record.m_fileTimestamp = sqlite3_column_int64( pStatement, 3 );
-                    record.m_sourceTimestampHash = sqlite3_column_int64( pStatement, 4 );
+                    record.m_sourceHash = sqlite3_column_int64( pStatement, 4 );
                 }
 
                 IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
@@ -105,7 +170,145 @@ namespace EE
         {
             Threading::ScopeLock const lock( m_mutex );
 
-            return ExecuteSimpleQuery( "INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceTimestampHash` ) VALUES ( \"%s\", %d, %d, %llu, %llu );", record.m_resourceID.GetResourcePath().c_str(), (uint32_t) record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, record.m_sourceTimestampHash  );
+            return ExecuteSimpleQuery( "INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceHash` ) VALUES ( \"%s\", %d, %d, %llu, %llu );", record.m_resourceID.GetResourcePath().c_str(), (uint32_t) record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, record.m_sourceHash );
+        }
+
+        //-------------------------------------------------------------------------
+
+        bool CompiledResourceDatabase::GetAllCompileDependencyRecords( TVector<CompileDependencyRecord>& outRecords ) const
+        {
+            Threading::ScopeLock const lock( m_mutex );
+
+            outRecords.clear();
+            THashMap<ResourceID, int32_t> recordIndices;
+
+            // Nodes
+            //-------------------------------------------------------------------------
+
+            sqlite3_stmt* pStatement = nullptr;
+            if ( !IsValidSQLiteResult( sqlite3_prepare_v2( m_pDatabase, "SELECT * FROM `CompileDependencyNodes`;", -1, &pStatement, nullptr ) ) )
+            {
+                return false;
+            }
+
+            while ( sqlite3_step( pStatement ) == SQLITE_ROW )
+            {
+                ResourceID const resourceID( String( (char const*) sqlite3_column_text( pStatement, 0 ) ) );
+                if ( !resourceID.IsValid() )
+                {
+                    continue;
+                }
+
+                recordIndices[resourceID] = (int32_t) outRecords.size();
+                auto& record = outRecords.emplace_back();
+                record.m_resourceID = resourceID;
+                record.m_descriptorHash = sqlite3_column_int64( pStatement, 1 );
+            }
+
+            IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
+
+            // Dependencies
+            //-------------------------------------------------------------------------
+
+            pStatement = nullptr;
+            if ( !IsValidSQLiteResult( sqlite3_prepare_v2( m_pDatabase, "SELECT * FROM `CompileDependencies`;", -1, &pStatement, nullptr ) ) )
+            {
+                return false;
+            }
+
+            while ( sqlite3_step( pStatement ) == SQLITE_ROW )
+            {
+                ResourceID const resourceID( String( (char const*) sqlite3_column_text( pStatement, 0 ) ) );
+                ResourceID const dependencyID( String( (char const*) sqlite3_column_text( pStatement, 1 ) ) );
+                if ( !resourceID.IsValid() || !dependencyID.IsValid() )
+                {
+                    continue;
+                }
+
+                auto iter = recordIndices.find( resourceID );
+                if ( iter != recordIndices.end() )
+                {
+                    outRecords[iter->second].m_dependencies.emplace_back( dependencyID );
+                }
+            }
+
+            IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
+
+            return true;
+        }
+
+        bool CompiledResourceDatabase::WriteCompileDependencyRecord( CompileDependencyRecord const& record )
+        {
+            EE_ASSERT( record.IsValid() );
+
+            Threading::ScopeLock const lock( m_mutex );
+
+            char const* const pResourcePath = record.m_resourceID.GetResourcePath().c_str();
+
+            bool result = BeginTransaction();
+            result &= ExecuteSimpleQuery( "INSERT OR REPLACE INTO `CompileDependencyNodes` ( `ResourcePath`, `DescriptorHash` ) VALUES ( \"%s\", %llu );", pResourcePath, record.m_descriptorHash );
+            result &= ExecuteSimpleQuery( "DELETE FROM `CompileDependencies` WHERE `ResourcePath` = \"%s\";", pResourcePath );
+            for ( auto const& dependencyID : record.m_dependencies )
+            {
+                result &= ExecuteSimpleQuery( "INSERT INTO `CompileDependencies` ( `ResourcePath`, `DependencyPath` ) VALUES ( \"%s\", \"%s\" );", pResourcePath, dependencyID.GetResourcePath().c_str() );
+            }
+            result &= EndTransaction();
+
+            return result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        bool CompiledResourceDatabase::GetAllFileHashRecords( TVector<FileHashRecord>& outRecords ) const
+        {
+            Threading::ScopeLock const lock( m_mutex );
+
+            outRecords.clear();
+
+            sqlite3_stmt* pStatement = nullptr;
+            if ( !IsValidSQLiteResult( sqlite3_prepare_v2( m_pDatabase, "SELECT * FROM `FileHashes`;", -1, &pStatement, nullptr ) ) )
+            {
+                return false;
+            }
+
+            while ( sqlite3_step( pStatement ) == SQLITE_ROW )
+            {
+                FileSystem::Path const filePath( (char const*) sqlite3_column_text( pStatement, 0 ) );
+                if ( !filePath.IsValid() )
+                {
+                    continue;
+                }
+
+                auto& record = outRecords.emplace_back();
+                record.m_filePath = filePath;
+                record.m_modifiedTime = sqlite3_column_int64( pStatement, 1 );
+                record.m_fileSize = sqlite3_column_int64( pStatement, 2 );
+                record.m_contentHash = sqlite3_column_int64( pStatement, 3 );
+            }
+
+            IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
+
+            return true;
+        }
+
+        bool CompiledResourceDatabase::WriteFileHashRecords( TVector<FileHashRecord> const& records )
+        {
+            if ( records.empty() )
+            {
+                return true;
+            }
+
+            Threading::ScopeLock const lock( m_mutex );
+
+            bool result = BeginTransaction();
+            for ( auto const& record : records )
+            {
+                EE_ASSERT( record.m_filePath.IsValid() );
+                result &= ExecuteSimpleQuery( "INSERT OR REPLACE INTO `FileHashes` ( `FilePath`, `ModifiedTime`, `FileSize`, `ContentHash` ) VALUES ( \"%s\", %llu, %llu, %llu );", record.m_filePath.c_str(), record.m_modifiedTime, record.m_fileSize, record.m_contentHash );
+            }
+            result &= EndTransaction();
+
+            return result;
         }
     }
 }
\ No newline at end of file
@@ -19,13 +19,39 @@ namespace EE
             ResourceID            m_resourceID;
             int32_t               m_compilerVersion = -1;         // The compiler version used for the last compilation
             uint64_t              m_fileTimestamp = 0;            // The timestamp of the resource file
-            uint64_t              m_sourceTimestampHash = 0;      // The timestamp hash of any source assets used in the compilation
+            uint64_t              m_sourceHash = 0;               // The combined content hash of the resource file, any source assets and all compile dependencies
+        };
+
+        //-------------------------------------------------------------------------
+
+        // The compile dependencies read from a resource descriptor, this allows us to skip reading unchanged descriptors
+        struct CompileDependencyRecord final
+        {
+            inline bool IsValid() const { return m_resourceID.IsValid(); }
+
+            ResourceID            m_resourceID;
+            uint64_t              m_descriptorHash = 0;           // The content hash of the descriptor the dependencies were read from
+            TVector<ResourceID>   m_dependencies;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // A memoized file content hash, only valid as long as the file's modified time and size are unchanged
+        struct FileHashRecord final
+        {
+            FileSystem::Path      m_filePath;
+            uint64_t              m_modifiedTime = 0;
+            uint64_t              m_fileSize = 0;
+            uint64_t              m_contentHash = 0;
         };
 
         //-------------------------------------------------------------------------
 
         class CompiledResourceDatabase final : public SQLite::SQLiteDatabase
         {
+            // Increment this whenever the table layout changes, out of date tables are dropped since they are only a cache of the compilation state
+            constexpr static int32_t const s_schemaVersion = 3;
+
         public:
 
             bool TryConnect( FileSystem::Path const& databasePath );
@@ -36,11 +62,20 @@ namespace EE
             CompiledResourceRecord GetRecord( ResourceID resourceID ) const;
             bool WriteRecord( CompiledResourceRecord const& record );
 
+            bool GetAllCompileDependencyRecords( TVector<CompileDependencyRecord>& outRecords ) const;
+            bool WriteCompileDependencyRecord( CompileDependencyRecord const& record );
+
+            bool GetAllFileHashRecords( TVector<FileHashRecord>& outRecords ) const;
+            bool WriteFileHashRecords( TVector<FileHashRecord> const& records );
+
         private:
 
             bool CreateTables();
             bool DropTables();
 
+            int32_t GetSchemaVersion() const;
+            bool SetSchemaVersion( int32_t version );
+
         private:
 
             mutable Threading::Mutex m_mutex;
@@ -0,0 +1,511 @@
+#include "ResourceCompileDependencyGraph.h"
+#include "ResourceServerContext.h"
+#include "CompiledResourceCache.h"
+#include "EngineTools/Resource/ResourceDescriptor.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/Algorithm/Hash.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ShouldCheckCompileDependenciesForResourceType( ResourceID const& resourceID )
+    {
+        if ( resourceID.GetResourceTypeID() == ResourceTypeID( "map" ) )
+        {
+            return false;
+        }
+
+        if ( resourceID.GetResourceTypeID() == ResourceTypeID( "nav" ) )
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CompileDependencyGraph::Node::ResetSourceInfo()
+    {
+        m_sourcePath.Clear();
+        m_targetPath.Clear();
+        m_timestamp = m_contentHash = 0;
+        m_compilerVersion = -1;
+        m_sourceExists = m_targetExists = false;
+        m_dependenciesChecked = false;
+        m_errorOccurredReadingDependencies = false;
+        m_forceRecompile = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompileDependencyGraph::CompileDependencyGraph( ResourceServerContext const& context, CompiledResourceDatabase& database )
+        : m_context( context )
+        , m_database( database )
+    {}
+
+    CompileDependencyGraph::~CompileDependencyGraph()
+    {
+        EE_ASSERT( m_nodes.empty() );
+    }
+
+    void CompileDependencyGraph::Initialize()
+    {
+        EE_ASSERT( m_context.IsValid() );
+        EE_ASSERT( m_database.IsConnected() );
+
+        TVector<CompileDependencyRecord> records;
+        if ( !m_database.GetAllCompileDependencyRecords( records ) )
+        {
+            return;
+        }
+
+        Threading::ScopeLock lock( m_mutex );
+
+        for ( auto const& record : records )
+        {
+            Node* pNode = FindOrCreateNode( record.m_resourceID );
+            pNode->m_persistedDescriptorHash = record.m_descriptorHash;
+            SetDependencies( pNode, record.m_dependencies );
+        }
+    }
+
+    void CompileDependencyGraph::Shutdown()
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        for ( auto& nodePair : m_nodes )
+        {
+            EE::Delete( nodePair.second );
+        }
+
+        m_nodes.clear();
+    }
+
+    CompileDependencyGraph::Stats CompileDependencyGraph::GetStats() const
+    {
+        Threading::ScopeLock lock( m_mutex );
+        return m_stats;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompileDependencyGraph::Node* CompileDependencyGraph::FindOrCreateNode( ResourceID const& resourceID )
+    {
+        EE_ASSERT( resourceID.IsValid() );
+
+        auto iter = m_nodes.find( resourceID );
+        if ( iter != m_nodes.end() )
+        {
+            return iter->second;
+        }
+
+        Node* pNode = EE::New<Node>();
+        pNode->m_ID = resourceID;
+        m_nodes.insert( eastl::make_pair( resourceID, pNode ) );
+        m_stats.m_numNodes++;
+        return pNode;
+    }
+
+    void CompileDependencyGraph::InvalidateState( Node* pNode )
+    {
+        EE_ASSERT( pNode != nullptr );
+
+        // A dirty node's dependents are always dirty, since a node can only be refreshed once all of its dependencies have been
+        if ( pNode->m_isStateDirty )
+        {
+            return;
+        }
+
+        pNode->m_isStateDirty = true;
+        m_stats.m_numInvalidations++;
+
+        for ( auto const& dependentID : pNode->m_dependents )
+        {
+            InvalidateState( FindOrCreateNode( dependentID ) );
+        }
+    }
+
+    void CompileDependencyGraph::SetDependencies( Node* pNode, TVector<ResourceID> const& dependencies )
+    {
+        EE_ASSERT( pNode != nullptr );
+
+        // Remove reverse edges
+        for ( auto const& dependencyID : pNode->m_dependencies )
+        {
+            Node* pDependencyNode = FindOrCreateNode( dependencyID );
+            pDependencyNode->m_dependents.erase_first_unsorted( pNode->m_ID );
+        }
+
+        pNode->m_dependencies.clear();
+
+        // Add new edges
+        for ( auto const& dependencyID : dependencies )
+        {
+            if ( !dependencyID.IsValid() || VectorContains( pNode->m_dependencies, dependencyID ) )
+            {
+                continue;
+            }
+
+            pNode->m_dependencies.emplace_back( dependencyID );
+            FindOrCreateNode( dependencyID )->m_dependents.emplace_back( pNode->m_ID );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CompileDependencyGraph::ReadSourceFileInfo( SourceFileInfo& info ) const
+    {
+        EE_ASSERT( info.m_ID.IsValid() );
+
+        info.m_sourcePath = ResourcePath::ToFileSystemPath( m_context.m_rawResourcePath, info.m_ID.GetResourcePath() );
+        info.m_sourceExists = FileSystem::Exists( info.m_sourcePath );
+        info.m_timestamp = info.m_sourceExists ? FileSystem::GetFileModifiedTime( info.m_sourcePath ) : 0;
+
+        // Up-to-date checks are based on the file contents rather than timestamps, since timestamps change on branch switches and fresh checkouts
+        info.m_contentHash = info.m_sourceExists ? m_context.m_pCompiledResourceCache->GetFileContentHash( info.m_sourcePath, info.m_timestamp ) : 0;
+    }
+
+    bool CompileDependencyGraph::RefreshSourceInfo( Node* pNode )
+    {
+        EE_ASSERT( pNode != nullptr && pNode->m_isSourceDirty && pNode->m_hasPendingSourceInfo );
+
+        m_stats.m_numNodeSourceRefreshes++;
+        pNode->ResetSourceInfo();
+
+        // Basic resource info
+        //-------------------------------------------------------------------------
+
+        ResourceID const& resourceID = pNode->m_ID;
+        pNode->m_sourcePath = pNode->m_pendingSourceInfo.m_sourcePath;
+        pNode->m_sourceExists = pNode->m_pendingSourceInfo.m_sourceExists;
+        pNode->m_timestamp = pNode->m_pendingSourceInfo.m_timestamp;
+        pNode->m_contentHash = pNode->m_pendingSourceInfo.m_contentHash;
+        pNode->m_hasPendingSourceInfo = false;
+
+        // Handle compilable resources
+        //-------------------------------------------------------------------------
+
+        auto pCompiler = m_context.m_pCompilerRegistry->GetCompilerForResourceType( resourceID.GetResourceTypeID() );
+        bool const isCompilableResource = pCompiler != nullptr;
+        bool skipDependencyCheck = !isCompilableResource || !ShouldCheckCompileDependenciesForResourceType( resourceID );
+        if ( isCompilableResource )
+        {
+            pNode->m_targetPath = ResourcePath::ToFileSystemPath( m_context.m_compiledResourcePath, resourceID.GetResourcePath() );
+            pNode->m_compilerVersion = pCompiler->GetVersion();
+
+            // Some compilers dont require an input file to run - these resources should always be recompiled!
+            if ( !pNode->m_sourceExists && !pCompiler->IsInputFileRequired() )
+            {
+                pNode->m_forceRecompile = true;
+                skipDependencyCheck = true;
+            }
+        }
+
+        // Update dependencies
+        //-------------------------------------------------------------------------
+
+        if ( skipDependencyCheck )
+        {
+            SetDependencies( pNode, {} );
+        }
+        else
+        {
+            pNode->m_dependenciesChecked = true;
+
+            // Reuse the persisted dependencies if the descriptor hasnt changed
+            if ( pNode->m_contentHash != 0 && pNode->m_persistedDescriptorHash == pNode->m_contentHash )
+            {
+                m_stats.m_numPersistedDescriptorReuses++;
+            }
+            else
+            {
+                m_stats.m_numDescriptorReads++;
+
+                auto pDescriptor = ResourceDescriptor::TryReadFromFile( *m_context.m_pTypeRegistry, pNode->m_sourcePath );
+                if ( pDescriptor == nullptr )
+                {
+                    pNode->m_errorOccurredReadingDependencies = true;
+                    return false;
+                }
+
+                CompileDependencyRecord record;
+                record.m_resourceID = resourceID;
+                record.m_descriptorHash = pNode->m_contentHash;
+                pDescriptor->GetCompileDependencies( record.m_dependencies );
+                EE::Delete( pDescriptor );
+
+                SetDependencies( pNode, record.m_dependencies );
+                pNode->m_persistedDescriptorHash = record.m_descriptorHash;
+                m_database.WriteCompileDependencyRecord( record );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        pNode->m_isSourceDirty = false;
+        return true;
+    }
+
+    void CompileDependencyGraph::RefreshState( Node* pNode )
+    {
+        EE_ASSERT( pNode != nullptr && !pNode->m_isSourceDirty );
+
+        m_stats.m_numNodeStateRefreshes++;
+
+        bool const isCompilableResource = pNode->m_compilerVersion >= 0;
+        if ( isCompilableResource )
+        {
+            pNode->m_targetExists = FileSystem::Exists( pNode->m_targetPath );
+
+            if ( pNode->m_isRecordDirty )
+            {
+                pNode->m_compiledRecord = m_database.GetRecord( pNode->m_ID );
+                pNode->m_isRecordDirty = false;
+            }
+        }
+
+        // Generate combined hash
+        //-------------------------------------------------------------------------
+
+        TInlineVector<uint64_t, 16> hashInputs;
+        hashInputs.emplace_back( Hash::XXHash::GetHash64( pNode->m_ID.GetResourcePath().c_str() ) );
+        hashInputs.emplace_back( (uint32_t) pNode->m_ID.GetResourceTypeID() );
+        hashInputs.emplace_back( (uint64_t) pNode->m_compilerVersion );
+        hashInputs.emplace_back( pNode->m_contentHash );
+
+        bool areAllDependenciesUpToDate = true;
+        bool areAllDependenciesCacheable = true;
+        for ( auto const& dependencyID : pNode->m_dependencies )
+        {
+            Node const* pDependencyNode = FindOrCreateNode( dependencyID );
+            EE_ASSERT( !pDependencyNode->m_isStateDirty );
+            hashInputs.emplace_back( pDependencyNode->m_combinedHash );
+            areAllDependenciesUpToDate &= pDependencyNode->m_isUpToDate;
+            areAllDependenciesCacheable &= pDependencyNode->m_isCacheable;
+        }
+
+        pNode->m_combinedHash = Hash::XXHash::GetHash64( hashInputs.data(), hashInputs.size() * sizeof( uint64_t ) );
+
+        // Up-to-date state
+        //-------------------------------------------------------------------------
+
+        pNode->m_isUpToDate = areAllDependenciesUpToDate && !pNode->m_forceRecompile && pNode->m_sourceExists;
+        if ( pNode->m_isUpToDate && isCompilableResource )
+        {
+            CompiledResourceRecord const& record = pNode->m_compiledRecord;
+            pNode->m_isUpToDate = pNode->m_targetExists && record.IsValid() && record.m_compilerVersion == pNode->m_compilerVersion && record.m_sourceHash == pNode->m_combinedHash;
+        }
+
+        // The combined hash is only a complete description of the inputs if we know all the dependencies
+        pNode->m_isCacheable = areAllDependenciesCacheable && !pNode->m_forceRecompile && pNode->m_sourceExists && pNode->m_contentHash != 0;
+        if ( isCompilableResource && !pNode->m_dependenciesChecked )
+        {
+            pNode->m_isCacheable = false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        pNode->m_isStateDirty = false;
+    }
+
+    bool CompileDependencyGraph::EvaluateNode( Node* pNode, TVector<SourceFileInfo>& outPendingSourceInfo, String& outErrorMessage )
+    {
+        EE_ASSERT( pNode != nullptr );
+
+        if ( pNode->m_isBeingEvaluated )
+        {
+            outErrorMessage = "Circular dependency detected!";
+            return false;
+        }
+
+        if ( !pNode->m_isStateDirty )
+        {
+            return true;
+        }
+
+        //-------------------------------------------------------------------------
+
+        // We cant know the dependencies until the source has been refreshed, so request the source file info and stop here
+        if ( pNode->m_isSourceDirty && !pNode->m_hasPendingSourceInfo )
+        {
+            if ( !VectorContains( outPendingSourceInfo, pNode->m_ID, [] ( SourceFileInfo const& info, ResourceID const& ID ) { return info.m_ID == ID; } ) )
+            {
+                auto& info = outPendingSourceInfo.emplace_back();
+                info.m_ID = pNode->m_ID;
+                info.m_sourceVersion = pNode->m_sourceVersion;
+            }
+
+            return true;
+        }
+
+        //-------------------------------------------------------------------------
+
+        pNode->m_isBeingEvaluated = true;
+
+        if ( pNode->m_isSourceDirty && !RefreshSourceInfo( pNode ) )
+        {
+            outErrorMessage.sprintf( "Failed to read compile dependencies from: %s", pNode->m_sourcePath.c_str() );
+            pNode->m_isBeingEvaluated = false;
+            return false;
+        }
+
+        // Dependencies are stored by ID, so we can safely create nodes while iterating
+        size_t const numPendingSourceInfo = outPendingSourceInfo.size();
+        for ( int32_t i = 0; i < (int32_t) pNode->m_dependencies.size(); i++ )
+        {
+            if ( !EvaluateNode( FindOrCreateNode( pNode->m_dependencies[i] ), outPendingSourceInfo, outErrorMessage ) )
+            {
+                pNode->m_isBeingEvaluated = false;
+                return false;
+            }
+        }
+
+        // Keep going through the remaining dependencies so we gather as much source file info as possible in a single pass
+        if ( outPendingSourceInfo.size() == numPendingSourceInfo )
+        {
+            RefreshState( pNode );
+        }
+
+        pNode->m_isBeingEvaluated = false;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompileDependencyGraph::Evaluate( ResourceID const& resourceID, Result& outResult, String& outErrorMessage )
+    {
+        EE_ASSERT( resourceID.IsValid() );
+
+        Threading::Lock lock( m_mutex );
+        m_stats.m_numEvaluations++;
+
+        Node* pNode = FindOrCreateNode( resourceID );
+
+        // Compiled resources can be deleted without us being notified, so always validate the requested target
+        if ( !pNode->m_isStateDirty && pNode->m_compilerVersion >= 0 && pNode->m_targetExists != FileSystem::Exists( pNode->m_targetPath ) )
+        {
+            InvalidateState( pNode );
+        }
+
+        // Each pass evaluates as far as it can, the source files it still needs are then read and hashed without holding the lock
+        // Reading a source can reveal new dependencies, so we keep going until a pass completes without requesting any source file info
+        TVector<SourceFileInfo> pendingSourceInfo;
+        while ( true )
+        {
+            pendingSourceInfo.clear();
+            if ( !EvaluateNode( pNode, pendingSourceInfo, outErrorMessage ) )
+            {
+                return false;
+            }
+
+            if ( pendingSourceInfo.empty() )
+            {
+                break;
+            }
+
+            //-------------------------------------------------------------------------
+
+            lock.unlock();
+
+            for ( auto& info : pendingSourceInfo )
+            {
+                ReadSourceFileInfo( info );
+            }
+
+            lock.lock();
+
+            // Discard any info for sources that were modified or refreshed by another evaluation while we were unlocked
+            for ( auto& info : pendingSourceInfo )
+            {
+                Node* pPendingNode = FindOrCreateNode( info.m_ID );
+                if ( pPendingNode->m_isSourceDirty && pPendingNode->m_sourceVersion == info.m_sourceVersion )
+                {
+                    pPendingNode->m_pendingSourceInfo = eastl::move( info );
+                    pPendingNode->m_hasPendingSourceInfo = true;
+                }
+            }
+        }
+
+        outResult.m_compilerVersion = pNode->m_compilerVersion;
+        outResult.m_timestamp = pNode->m_timestamp;
+        outResult.m_combinedHash = pNode->m_combinedHash;
+        outResult.m_isUpToDate = pNode->m_isUpToDate;
+        outResult.m_isCacheable = pNode->m_isCacheable;
+        return true;
+    }
+
+    void CompileDependencyGraph::OnSourceFileModified( ResourceID const& resourceID, TVector<ResourceID>& outAffectedResources )
+    {
+        EE_ASSERT( resourceID.IsValid() );
+
+        Threading::ScopeLock lock( m_mutex );
+
+        auto iter = m_nodes.find( resourceID );
+        if ( iter == m_nodes.end() )
+        {
+            return;
+        }
+
+        Node* pNode = iter->second;
+        pNode->m_isSourceDirty = true;
+        pNode->m_hasPendingSourceInfo = false;
+        pNode->m_sourceVersion++;
+        InvalidateState( pNode );
+
+        // Collect all the previously compiled dependents
+        //-------------------------------------------------------------------------
+
+        TVector<Node*> nodesToVisit = { pNode };
+        TVector<ResourceID> visitedNodes = { resourceID };
+        while ( !nodesToVisit.empty() )
+        {
+            Node* pNodeToVisit = nodesToVisit.back();
+            nodesToVisit.pop_back();
+
+            for ( auto const& dependentID : pNodeToVisit->m_dependents )
+            {
+                if ( VectorContains( visitedNodes, dependentID ) )
+                {
+                    continue;
+                }
+
+                visitedNodes.emplace_back( dependentID );
+                Node* pDependentNode = FindOrCreateNode( dependentID );
+                nodesToVisit.emplace_back( pDependentNode );
+
+                if ( m_context.m_pCompilerRegistry->GetCompilerForResourceType( dependentID.GetResourceTypeID() ) == nullptr )
+                {
+                    continue;
+                }
+
+                bool const wasPreviouslyCompiled = pDependentNode->m_isRecordDirty ? m_database.GetRecord( dependentID ).IsValid() : pDependentNode->m_compiledRecord.IsValid();
+                if ( wasPreviouslyCompiled )
+                {
+                    outAffectedResources.emplace_back( dependentID );
+                }
+            }
+        }
+    }
+
+    void CompileDependencyGraph::OnResourceCompiled( CompiledResourceRecord const& record )
+    {
+        EE_ASSERT( record.IsValid() );
+
+        Threading::ScopeLock lock( m_mutex );
+
+        Node* pNode = FindOrCreateNode( record.m_resourceID );
+
+        // Nothing to do if the record hasnt changed (e.g. for up-to-date requests)
+        CompiledResourceRecord const& currentRecord = pNode->m_compiledRecord;
+        if ( !pNode->m_isRecordDirty && currentRecord.m_compilerVersion == record.m_compilerVersion && currentRecord.m_sourceHash == record.m_sourceHash && currentRecord.m_fileTimestamp == record.m_fileTimestamp )
+        {
+            return;
+        }
+
+        pNode->m_compiledRecord = record;
+        pNode->m_isRecordDirty = false;
+        InvalidateState( pNode );
+    }
+}
\ No newline at end of file
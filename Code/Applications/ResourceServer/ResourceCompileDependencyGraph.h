@@ -0,0 +1,139 @@
+#pragma once
+
+#include "CompiledResourceDatabase.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Compile Dependency Graph
+//-------------------------------------------------------------------------
+// A persistent graph of the compile dependencies for all resources the server has seen
+// Each node caches its source info, its combined input hash and its up-to-date state, these are only recalculated when the node is
+// invalidated (i.e. one of its inputs changes or it gets recompiled). Invalidations are propagated to all dependents via the reverse edges.
+//
+// The dependencies read from each descriptor are persisted in the compiled resource database along with the descriptor's content hash,
+// so unchanged descriptors do not need to be re-read when the server restarts
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    struct ResourceServerContext;
+
+    //-------------------------------------------------------------------------
+
+    bool ShouldCheckCompileDependenciesForResourceType( ResourceID const& resourceID );
+
+    //-------------------------------------------------------------------------
+
+    class CompileDependencyGraph
+    {
+        // The info read from a node's source file, this is gathered without holding the graph lock since it requires hashing the file
+        struct SourceFileInfo
+        {
+            ResourceID                              m_ID;
+            FileSystem::Path                        m_sourcePath;
+            uint64_t                                m_timestamp = 0;
+            uint64_t                                m_contentHash = 0;
+            uint32_t                                m_sourceVersion = 0;
+            bool                                    m_sourceExists = false;
+        };
+
+        struct Node
+        {
+            // Clear all the info read from the source file and the compiler, the persisted dependencies are kept
+            void ResetSourceInfo();
+
+        public:
+
+            ResourceID                              m_ID;
+            FileSystem::Path                        m_sourcePath;
+            FileSystem::Path                        m_targetPath;
+            TVector<ResourceID>                     m_dependencies;
+            TVector<ResourceID>                     m_dependents;
+            CompiledResourceRecord                  m_compiledRecord;
+            SourceFileInfo                          m_pendingSourceInfo;                    // The source file info gathered for the next source refresh
+            uint64_t                                m_timestamp = 0;
+            uint64_t                                m_contentHash = 0;                      // The hash of the source file contents
+            uint64_t                                m_combinedHash = 0;                     // The hash of the source file contents, the compiler version and all dependencies
+            uint64_t                                m_persistedDescriptorHash = 0;          // The descriptor hash for the persisted dependencies, 0 if we have none
+            int32_t                                 m_compilerVersion = -1;
+            uint32_t                                m_sourceVersion = 0;                    // Incremented whenever the source is modified, used to discard stale source file info
+            bool                                    m_sourceExists = false;
+            bool                                    m_targetExists = false;
+            bool                                    m_dependenciesChecked = false;
+            bool                                    m_errorOccurredReadingDependencies = false;
+            bool                                    m_forceRecompile = false;
+            bool                                    m_isUpToDate = false;
+            bool                                    m_isCacheable = false;
+
+            bool                                    m_isSourceDirty = true;                 // Do we need to re-read the source file info and dependencies
+            bool                                    m_isRecordDirty = true;                 // Do we need to re-read the compiled record from the database
+            bool                                    m_isStateDirty = true;                  // Do we need to recalculate the combined hash and up-to-date state
+            bool                                    m_isBeingEvaluated = false;             // Used to detect circular dependencies
+            bool                                    m_hasPendingSourceInfo = false;         // Has the source file info been gathered for the next source refresh
+        };
+
+    public:
+
+        struct Result
+        {
+            int32_t                                 m_compilerVersion = -1;
+            uint64_t                                m_timestamp = 0;
+            uint64_t                                m_combinedHash = 0;
+            bool                                    m_isUpToDate = false;
+            bool                                    m_isCacheable = false;
+        };
+
+        struct Stats
+        {
+            int32_t                                 m_numNodes = 0;
+            int32_t                                 m_numEvaluations = 0;
+            int32_t                                 m_numNodeSourceRefreshes = 0;
+            int32_t                                 m_numNodeStateRefreshes = 0;
+            int32_t                                 m_numDescriptorReads = 0;
+            int32_t                                 m_numPersistedDescriptorReuses = 0;
+            int32_t                                 m_numInvalidations = 0;
+        };
+
+    public:
+
+        CompileDependencyGraph( ResourceServerContext const& context, CompiledResourceDatabase& database );
+        ~CompileDependencyGraph();
+
+        // Load the persisted dependencies from the database
+        void Initialize();
+        void Shutdown();
+
+        // Evaluate the up-to-date state of a resource, only nodes that have been invalidated are refreshed - this is thread-safe
+        // The source files of invalidated nodes are hashed without holding the graph lock, so concurrent evaluations dont serialize on file IO
+        bool Evaluate( ResourceID const& resourceID, Result& outResult, String& outErrorMessage );
+
+        // A source file has changed, invalidate it and all of its dependents
+        // Returns the compilable resources that were previously compiled and are affected by this change
+        void OnSourceFileModified( ResourceID const& resourceID, TVector<ResourceID>& outAffectedResources );
+
+        // A resource has been compiled and its compiled record updated, invalidate its up-to-date state and that of its dependents
+        void OnResourceCompiled( CompiledResourceRecord const& record );
+
+        Stats GetStats() const;
+
+    private:
+
+        Node* FindOrCreateNode( ResourceID const& resourceID );
+        void InvalidateState( Node* pNode );
+        void SetDependencies( Node* pNode, TVector<ResourceID> const& dependencies );
+
+        // Evaluate a node and its dependencies, any source dirty nodes without gathered source file info are added to the pending list and their dependents are left dirty
+        bool EvaluateNode( Node* pNode, TVector<SourceFileInfo>& outPendingSourceInfo, String& outErrorMessage );
+        void ReadSourceFileInfo( SourceFileInfo& info ) const;
+        bool RefreshSourceInfo( Node* pNode );
+        void RefreshState( Node* pNode );
+
+    private:
+
+        ResourceServerContext const&                m_context;
+        CompiledResourceDatabase&                   m_database;
+        THashMap<ResourceID, Node*>                 m_nodes;
+        mutable Threading::Mutex                    m_mutex;
+        Stats                                       m_stats;
+    };
+}
\ No newline at end of file
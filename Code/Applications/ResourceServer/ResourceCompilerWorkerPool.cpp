@@ -0,0 +1,277 @@
+#include "ResourceCompilerWorkerPool.h"
+#include "EngineTools/Resource/ResourceCompiler.h"
+#include "System/Time/Timers.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool CompileInNewProcess( FileSystem::Path const& compilerExecutablePath, String const& resourcePath, bool isForPackagedBuild, int32_t& outResultCode, String& outLog )
+    {
+        EE_ASSERT( compilerExecutablePath.IsValid() && !resourcePath.empty() );
+
+        char const* processCommandLineArgs[5] = { compilerExecutablePath.c_str(), "-compile", resourcePath.c_str(), isForPackagedBuild ? "-package" : nullptr, nullptr };
+
+        // Start compiler process
+        //-------------------------------------------------------------------------
+
+        subprocess_s subProcess;
+        Memory::MemsetZero( &subProcess );
+
+        int32_t result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, &subProcess );
+        if ( result != 0 )
+        {
+            outLog = "Resource compiler failed to start!";
+            return false;
+        }
+
+        // Wait for compilation to complete
+        //-------------------------------------------------------------------------
+
+        int32_t exitCode;
+        result = subprocess_join( &subProcess, &exitCode );
+        if ( result != 0 )
+        {
+            outLog = "Resource compiler failed to complete!";
+            subprocess_destroy( &subProcess );
+            return false;
+        }
+
+        outResultCode = exitCode;
+
+        // Read error and output of process
+        //-------------------------------------------------------------------------
+
+        char readBuffer[512];
+        while ( fgets( readBuffer, 512, subprocess_stdout( &subProcess ) ) )
+        {
+            outLog += readBuffer;
+        }
+
+        subprocess_destroy( &subProcess );
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompilerWorkerPool::~CompilerWorkerPool()
+    {
+        EE_ASSERT( m_workers.empty() );
+    }
+
+    void CompilerWorkerPool::Initialize( FileSystem::Path const& compilerExecutablePath, int32_t numWorkers )
+    {
+        EE_ASSERT( !IsInitialized() );
+        EE_ASSERT( compilerExecutablePath.IsValid() && numWorkers > 0 );
+
+        m_compilerExecutablePath = compilerExecutablePath;
+
+        for ( int32_t i = 0; i < numWorkers; i++ )
+        {
+            m_workers.emplace_back( EE::New<Worker>() );
+        }
+    }
+
+    void CompilerWorkerPool::Shutdown()
+    {
+        // All compilations must have completed before shutting down, so no need to lock here
+        for ( auto& pWorker : m_workers )
+        {
+            EE_ASSERT( !pWorker->m_isInUse );
+            StopWorker( pWorker, false );
+            EE::Delete( pWorker );
+        }
+
+        m_workers.clear();
+    }
+
+    CompilerWorkerPool::Stats CompilerWorkerPool::GetStats() const
+    {
+        Threading::ScopeLock lock( m_mutex );
+        return m_stats;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompilerWorkerPool::Worker* CompilerWorkerPool::AcquireWorker()
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        // Prefer workers that are already running
+        Worker* pFreeWorker = nullptr;
+        for ( auto pWorker : m_workers )
+        {
+            if ( pWorker->m_isInUse )
+            {
+                continue;
+            }
+
+            if ( pWorker->m_isRunning )
+            {
+                pFreeWorker = pWorker;
+                break;
+            }
+
+            if ( pFreeWorker == nullptr )
+            {
+                pFreeWorker = pWorker;
+            }
+        }
+
+        if ( pFreeWorker != nullptr )
+        {
+            pFreeWorker->m_isInUse = true;
+        }
+
+        return pFreeWorker;
+    }
+
+    void CompilerWorkerPool::ReleaseWorker( Worker* pWorker )
+    {
+        Threading::ScopeLock lock( m_mutex );
+        EE_ASSERT( pWorker != nullptr && pWorker->m_isInUse );
+        pWorker->m_isInUse = false;
+    }
+
+    bool CompilerWorkerPool::StartWorker( Worker* pWorker )
+    {
+        EE_ASSERT( !pWorker->m_isRunning );
+
+        char const* processCommandLineArgs[3] = { m_compilerExecutablePath.c_str(), "-worker", nullptr };
+        int32_t const result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, &pWorker->m_subProcess );
+        if ( result != 0 )
+        {
+            EE_LOG_ERROR( "Resource", "Compiler Worker Pool", "Failed to start resource compiler worker!" );
+            return false;
+        }
+
+        pWorker->m_numCompiles = 0;
+        pWorker->m_isRunning = true;
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_stats.m_numRunningWorkers++;
+            m_stats.m_numWorkerStarts++;
+        }
+
+        return true;
+    }
+
+    void CompilerWorkerPool::StopWorker( Worker* pWorker, bool forceTerminate )
+    {
+        if ( !pWorker->m_isRunning )
+        {
+            return;
+        }
+
+        // Ask the worker to exit, if it's still alive
+        if ( forceTerminate )
+        {
+            subprocess_terminate( &pWorker->m_subProcess );
+        }
+        else
+        {
+            FILE* pStdIn = subprocess_stdin( &pWorker->m_subProcess );
+            fprintf( pStdIn, "%s\n", CompilerWorkerProtocol::s_exitCommand );
+            fflush( pStdIn );
+        }
+
+        int32_t exitCode = 0;
+        subprocess_join( &pWorker->m_subProcess, &exitCode );
+        subprocess_destroy( &pWorker->m_subProcess );
+        Memory::MemsetZero( &pWorker->m_subProcess );
+
+        pWorker->m_isRunning = false;
+        pWorker->m_numCompiles = 0;
+
+        Threading::ScopeLock lock( m_mutex );
+        m_stats.m_numRunningWorkers--;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompilerWorkerPool::TryCompile( String const& resourcePath, bool isForPackagedBuild, int32_t& outResultCode, String& outLog )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_ASSERT( !resourcePath.empty() );
+
+        Worker* pWorker = AcquireWorker();
+        if ( pWorker == nullptr )
+        {
+            return false;
+        }
+
+        if ( !pWorker->m_isRunning && !StartWorker( pWorker ) )
+        {
+            ReleaseWorker( pWorker );
+            return false;
+        }
+
+        Milliseconds compilationTime = 0;
+        bool receivedResult = false;
+        {
+            ScopedTimer<PlatformClock> timer( compilationTime );
+
+            // Send request
+            //-------------------------------------------------------------------------
+
+            FILE* pStdIn = subprocess_stdin( &pWorker->m_subProcess );
+            char const* pCommand = isForPackagedBuild ? CompilerWorkerProtocol::s_packageCommand : CompilerWorkerProtocol::s_compileCommand;
+            bool const wasRequestSent = ( fprintf( pStdIn, "%s %s\n", pCommand, resourcePath.c_str() ) > 0 ) && ( fflush( pStdIn ) == 0 );
+
+            // Read the log until we get the result
+            //-------------------------------------------------------------------------
+
+            if ( wasRequestSent )
+            {
+                size_t const resultMarkerLength = strlen( CompilerWorkerProtocol::s_resultMarker );
+                FILE* pStdOut = subprocess_stdout( &pWorker->m_subProcess );
+
+                char readBuffer[512];
+                bool isStartOfLine = true;
+                while ( fgets( readBuffer, 512, pStdOut ) )
+                {
+                    if ( isStartOfLine && strncmp( readBuffer, CompilerWorkerProtocol::s_resultMarker, resultMarkerLength ) == 0 )
+                    {
+                        outResultCode = atoi( readBuffer + resultMarkerLength );
+                        receivedResult = true;
+                        break;
+                    }
+
+                    outLog += readBuffer;
+
+                    size_t const readLength = strlen( readBuffer );
+                    isStartOfLine = readLength > 0 && readBuffer[readLength - 1] == '\n';
+                }
+            }
+        }
+
+        // Handle result
+        //-------------------------------------------------------------------------
+
+        if ( receivedResult )
+        {
+            pWorker->m_numCompiles++;
+            if ( pWorker->m_numCompiles >= s_maxCompilesPerWorker )
+            {
+                StopWorker( pWorker, false );
+            }
+        }
+        else // The worker died during the compilation
+        {
+            outResultCode = (int32_t) CompilationResult::Failure;
+            outLog += "Resource compiler worker terminated unexpectedly!";
+            StopWorker( pWorker, true );
+        }
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_stats.m_numCompiles++;
+            m_stats.m_totalCompilationTime += compilationTime;
+        }
+
+        ReleaseWorker( pWorker );
+        return true;
+    }
+}
\ No newline at end of file
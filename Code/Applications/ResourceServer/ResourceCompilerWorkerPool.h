@@ -0,0 +1,84 @@
+#pragma once
+
+#include "EngineTools/ThirdParty/subprocess/subprocess.h"
+#include "System/FileSystem/FileSystemPath.h"
+#include "System/Threading/Threading.h"
+#include "System/Time/Time.h"
+#include "System/Memory/Memory.h"
+
+//-------------------------------------------------------------------------
+// Resource Compiler Worker Pool
+//-------------------------------------------------------------------------
+// A pool of long-lived resource compiler processes running in worker mode
+// Spawning a compiler process per request means that every compile pays for the process start-up and the type/compiler registry creation
+// Workers receive their requests on their stdin and stream back the compilation log followed by the compilation result
+//
+// Workers are started on demand and are recycled after a set number of compiles to bound any memory growth (e.g. the log history)
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    // Compile a resource by spawning a dedicated compiler process, this is the path used when no worker is available
+    // Returns false if the process failed to start or complete, in which case the log contains the error
+    bool CompileInNewProcess( FileSystem::Path const& compilerExecutablePath, String const& resourcePath, bool isForPackagedBuild, int32_t& outResultCode, String& outLog );
+
+    //-------------------------------------------------------------------------
+
+    class CompilerWorkerPool
+    {
+        constexpr static int32_t const s_maxCompilesPerWorker = 200;
+
+        struct Worker
+        {
+            Worker() { Memory::MemsetZero( &m_subProcess ); }
+
+            subprocess_s                                    m_subProcess;
+            int32_t                                         m_numCompiles = 0;
+            bool                                            m_isRunning = false;
+            bool                                            m_isInUse = false;
+        };
+
+    public:
+
+        struct Stats
+        {
+            int32_t                                         m_numRunningWorkers = 0;
+            int32_t                                         m_numWorkerStarts = 0;
+            int32_t                                         m_numCompiles = 0;
+            Milliseconds                                    m_totalCompilationTime = 0;
+        };
+
+    public:
+
+        CompilerWorkerPool() = default;
+        CompilerWorkerPool( CompilerWorkerPool const& ) = delete;
+        CompilerWorkerPool& operator=( CompilerWorkerPool const& ) = delete;
+        ~CompilerWorkerPool();
+
+        void Initialize( FileSystem::Path const& compilerExecutablePath, int32_t numWorkers );
+        void Shutdown();
+        inline bool IsInitialized() const { return !m_workers.empty(); }
+
+        // Try to compile a resource using one of the workers - this is thread-safe
+        // Returns false if no worker was able to take the request, in which case no output is set
+        // If the worker dies during the compilation, this returns true and the result code is set to failed
+        bool TryCompile( String const& resourcePath, bool isForPackagedBuild, int32_t& outResultCode, String& outLog );
+
+        Stats GetStats() const;
+
+    private:
+
+        Worker* AcquireWorker();
+        void ReleaseWorker( Worker* pWorker );
+
+        bool StartWorker( Worker* pWorker );
+        void StopWorker( Worker* pWorker, bool forceTerminate );
+
+    private:
+
+        FileSystem::Path                                    m_compilerExecutablePath;
+        TVector<Worker*>                                    m_workers;
+        mutable Threading::Mutex                            m_mutex;
+        Stats                                               m_stats;
+    };
+}
\ No newline at end of file
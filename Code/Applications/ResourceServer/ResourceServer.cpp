@@ -1,14 +1,18 @@
 #include "ResourceServer.h"
-#include "ResourceCompileDependencyTree.h"
+#include "ResourceCompileDependencyGraph.h"
+#include "CompiledResourceCache.h"
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompiler.h"
-#include "EngineTools/ThirdParty/subprocess/subprocess.h"
 #include "Engine/Entity/EntityDescriptors.h"
 #include "Engine/Entity/EntitySerialization.h"
 #include "System/Resource/ResourceProviders/ResourceNetworkMessages.h"
+#include "System/Resource/ResourcePackage.h"
+#include "System/Log.h"
+#include "System/Algorithm/Hash.h"
 #include "System/IniFile.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/FileSystem/FileSystemUtils.h"
+#include "System/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
@@ -26,14 +30,6 @@ namespace EE::Resource
             , m_pRequest( pRequest )
         {
             EE_ASSERT( m_context.IsValid() );
-
-            // No default ctor for subprocess struct, so zero-init
-            Memory::MemsetZero( &m_subProcess );
-        }
-
-        ~CompilationTask()
-        {
-            EE_ASSERT( !subprocess_alive( &m_subProcess ) );
         }
 
         inline CompilationRequest* GetRequest() const { return m_pRequest; }
@@ -46,9 +42,10 @@ namespace EE::Resource
             // Note: we enqueue failed requests as well just to have a uniform code flow
             if ( !m_context.m_isExiting && !m_pRequest->IsComplete() )
             {
-                if ( !IsUpToDate() )
+                if ( !IsUpToDate() && !TryRestoreFromCache() )
                 {
                     Compile();
+                    TryStoreInCache();
                 }
             }
 
@@ -106,19 +103,29 @@ namespace EE::Resource
 
             // Check compile dependency and if this resource needs compilation
             m_pRequest->m_upToDateCheckTimeStarted = PlatformClock::GetTime();
-            CompileDependencyTree compileDependencyTree( m_context );
-            if ( compileDependencyTree.BuildTree( m_pRequest->m_resourceID ) )
-            {
-                CompileDependencyNode const* pRoot = compileDependencyTree.GetRoot();
-                m_pRequest->m_compilerVersion = pRoot->m_compilerVersion;
-                m_pRequest->m_fileTimestamp = pRoot->m_timestamp;
-                m_pRequest->m_sourceTimestampHash = pRoot->m_combinedHash;
-                m_pRequest->m_status = pRoot->IsUpToDate() ? CompilationRequest::Status::SucceededUpToDate : CompilationRequest::Status::Pending;
-            }
-            else // Failed to generate dependency tree
+            if ( m_pRequest->m_status != CompilationRequest::Status::Failed )
             {
-                m_pRequest->m_log.sprintf( compileDependencyTree.GetErrorMessage().c_str() );
-                m_pRequest->m_status = CompilationRequest::Status::Failed;
+                CompileDependencyGraph::Result result;
+                String errorMessage;
+                if ( m_context.m_pCompileDependencyGraph->Evaluate( m_pRequest->m_resourceID, result, errorMessage ) )
+                {
+                    m_pRequest->m_compilerVersion = result.m_compilerVersion;
+                    m_pRequest->m_fileTimestamp = result.m_timestamp;
+                    m_pRequest->m_sourceHash = result.m_combinedHash;
+                    m_pRequest->m_status = result.m_isUpToDate ? CompilationRequest::Status::SucceededUpToDate : CompilationRequest::Status::Pending;
+
+                    // Forced recompiles explicitly request that the compiler is run, so they skip the cache
+                    if ( m_context.m_pCompiledResourceCache->IsStorageEnabled() && m_pRequest->m_origin != CompilationRequest::Origin::ManualCompileForced && result.m_isCacheable )
+                    {
+                        uint64_t const cacheKeyInputs[2] = { result.m_combinedHash, m_pRequest->m_origin == CompilationRequest::Origin::Package ? 1ull : 0ull };
+                        m_pRequest->m_cacheKey = Hash::XXHash::GetHash64( cacheKeyInputs, sizeof( cacheKeyInputs ) );
+                    }
+                }
+                else // Failed to evaluate the dependencies
+                {
+                    m_pRequest->m_log = errorMessage;
+                    m_pRequest->m_status = CompilationRequest::Status::Failed;
+                }
             }
             m_pRequest->m_upToDateCheckTimeFinished = PlatformClock::GetTime();
 
@@ -133,51 +140,74 @@ namespace EE::Resource
             return m_pRequest->IsComplete();
         }
 
-        void Compile()
+        bool TryRestoreFromCache()
         {
-            EE_ASSERT( !m_pRequest->m_compilerArgs.empty() );
-            char const* processCommandLineArgs[5] = { m_context.m_compilerExecutablePath.c_str(), "-compile", m_pRequest->m_compilerArgs.c_str(), nullptr, nullptr };
-
-            // Set package flag for packing request
-            if ( m_pRequest->m_origin == CompilationRequest::Origin::Package )
+            if ( m_pRequest->IsComplete() || m_pRequest->m_cacheKey == 0 )
             {
-                processCommandLineArgs[3] = "-package";
+                return false;
             }
 
-            // Start compiler process
-            //-------------------------------------------------------------------------
-
             m_pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
+            bool const wasRestored = m_context.m_pCompiledResourceCache->TryRestore( m_pRequest->m_cacheKey, m_pRequest->m_resourceID, m_pRequest->m_destinationFile );
+            m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
 
-            int32_t result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, &m_subProcess );
-            if ( result != 0 )
+            if ( wasRestored )
+            {
+                m_pRequest->m_log.sprintf( "Restored from compiled resource cache (%016llx)", m_pRequest->m_cacheKey );
+                m_pRequest->m_status = CompilationRequest::Status::SucceededFromCache;
+            }
+
+            return wasRestored;
+        }
+
+        void TryStoreInCache()
+        {
+            if ( m_pRequest->m_cacheKey == 0 )
             {
-                m_pRequest->m_status = CompilationRequest::Status::Failed;
-                m_pRequest->m_log = "Resource compiler failed to start!";
-                m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
                 return;
             }
 
-            // Wait for compilation to complete
+            // Only cache clean compilations, so that we never hide warnings
+            if ( m_pRequest->m_status == CompilationRequest::Status::Succeeded )
+            {
+                m_context.m_pCompiledResourceCache->Store( m_pRequest->m_cacheKey, m_pRequest->m_resourceID, m_pRequest->m_destinationFile );
+            }
+        }
+
+        void Compile()
+        {
+            EE_ASSERT( !m_pRequest->m_compilerArgs.empty() );
+
+            bool const isForPackagedBuild = m_pRequest->m_origin == CompilationRequest::Origin::Package;
+            int32_t resultCode = 0;
+
+            m_pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
+
+            // Try to use a persistent compiler worker, otherwise fall back to a compiler process for this request
             //-------------------------------------------------------------------------
 
-            int32_t exitCode;
-            result = subprocess_join( &m_subProcess, &exitCode );
-            if ( result != 0 )
+            bool wasCompiled = false;
+            if ( m_context.m_pCompilerWorkerPool != nullptr )
+            {
+                wasCompiled = m_context.m_pCompilerWorkerPool->TryCompile( m_pRequest->m_compilerArgs, isForPackagedBuild, resultCode, m_pRequest->m_log );
+            }
+
+            if ( !wasCompiled && !CompileInNewProcess( m_context.m_compilerExecutablePath, m_pRequest->m_compilerArgs, isForPackagedBuild, resultCode, m_pRequest->m_log ) )
             {
                 m_pRequest->m_status = CompilationRequest::Status::Failed;
-                m_pRequest->m_log = "Resource compiler failed to complete!";
                 m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-                subprocess_destroy( &m_subProcess );
                 return;
             }
 
-            // Handle completed compilation
             //-------------------------------------------------------------------------
 
             m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
+            SetStatusFromCompilerResult( resultCode );
+        }
 
-            switch ( exitCode )
+        void SetStatusFromCompilerResult( int32_t resultCode )
+        {
+            switch ( resultCode )
             {
                 case 0:
                 {
@@ -197,19 +227,6 @@ namespace EE::Resource
                 }
                 break;
             }
-
-            // Read error and output of process
-            //-------------------------------------------------------------------------
-
-            char readBuffer[512];
-            while ( fgets( readBuffer, 512, subprocess_stdout( &m_subProcess ) ) )
-            {
-                m_pRequest->m_log += readBuffer;
-            }
-
-            //-------------------------------------------------------------------------
-
-            subprocess_destroy( &m_subProcess );
         }
 
     private:
@@ -217,7 +234,6 @@ namespace EE::Resource
         ResourceServerContext const&                        m_context;
         Threading::LockFreeQueue<CompilationTask*>&         m_completedTaskQueue;
         CompilationRequest*                                 m_pRequest = nullptr;
-        subprocess_s                                        m_subProcess;
     };
 
     //-------------------------------------------------------------------------
@@ -287,6 +303,10 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    ResourceServer::ResourceServer()
+        : m_compileDependencyGraph( m_context, m_compiledResourceDatabase )
+    {}
+
     ResourceServer::~ResourceServer()
     {
         EE_ASSERT( m_pCompilerRegistry == nullptr );
@@ -353,6 +373,19 @@ namespace EE::Resource
         m_context.m_pCompilerRegistry = m_pCompilerRegistry;
         m_context.m_pCompiledResourceDB = &m_compiledResourceDatabase;
 
+        m_compiledResourceCache.Initialize( m_settings.m_compiledResourceCachePath );
+        m_compiledResourceCache.LoadFileHashes( m_compiledResourceDatabase );
+        m_context.m_pCompiledResourceCache = &m_compiledResourceCache;
+
+        m_context.m_pCompileDependencyGraph = &m_compileDependencyGraph;
+        m_compileDependencyGraph.Initialize();
+
+        if ( m_settings.m_useResourceCompilerWorkers )
+        {
+            m_compilerWorkerPool.Initialize( m_settings.m_resourceCompilerExecutablePath, (int32_t) m_taskSystem.GetNumThreads() );
+            m_context.m_pCompilerWorkerPool = &m_compilerWorkerPool;
+        }
+
         // Packaging
         //-------------------------------------------------------------------------
 
@@ -372,6 +405,20 @@ namespace EE::Resource
         ProcessCompletedRequests();
         m_taskSystem.Shutdown();
 
+        if ( m_compilerWorkerPool.IsInitialized() )
+        {
+            m_compilerWorkerPool.Shutdown();
+            m_context.m_pCompilerWorkerPool = nullptr;
+        }
+
+        m_compileDependencyGraph.Shutdown();
+        m_context.m_pCompileDependencyGraph = nullptr;
+
+        m_compiledResourceCache.SaveFileHashes( m_compiledResourceDatabase );
+        m_compiledResourceCache.LogReport();
+        m_compiledResourceCache.Shutdown();
+        m_context.m_pCompiledResourceCache = nullptr;
+
         EE_ASSERT( m_numScheduledTasks == 0 );
 
         // Packaging
@@ -469,6 +516,7 @@ namespace EE::Resource
 
             if ( isComplete )
             {
+                WriteResourcePackage();
                 m_packagingRequests.clear();
                 m_packagingStage = PackagingStage::Complete;
             }
@@ -505,6 +553,99 @@ namespace EE::Resource
         }
     }
 
+    ResourceServer::CompilerBenchmarkResult ResourceServer::RunCompilerBenchmark( int32_t maxNumResources )
+    {
+        EE_ASSERT( maxNumResources > 0 && !IsBusy() );
+
+        CompilerBenchmarkResult result;
+
+        if ( !m_compilerWorkerPool.IsInitialized() )
+        {
+            return result;
+        }
+
+        // Gather the batch, we only use resources that compiled successfully so both modes do the same work
+        //-------------------------------------------------------------------------
+
+        TVector<String> resourcePaths;
+        for ( int32_t i = (int32_t) m_requests.size() - 1; i >= 0 && (int32_t) resourcePaths.size() < maxNumResources; i-- )
+        {
+            CompilationRequest const* pRequest = m_requests[i];
+            bool const wasCompiled = pRequest->m_status == CompilationRequest::Status::Succeeded || pRequest->m_status == CompilationRequest::Status::SucceededWithWarnings;
+            if ( wasCompiled && pRequest->m_origin != CompilationRequest::Origin::Package && !VectorContains( resourcePaths, pRequest->m_compilerArgs ) )
+            {
+                resourcePaths.emplace_back( pRequest->m_compilerArgs );
+            }
+        }
+
+        result.m_numResources = (int32_t) resourcePaths.size();
+        if ( resourcePaths.empty() )
+        {
+            return result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct BenchmarkTask final : public ITaskSet
+        {
+            BenchmarkTask( TVector<String> const& resourcePaths, FileSystem::Path const& compilerExecutablePath, CompilerWorkerPool* pWorkerPool )
+                : m_resourcePaths( resourcePaths )
+                , m_compilerExecutablePath( compilerExecutablePath )
+                , m_pWorkerPool( pWorkerPool )
+            {
+                m_SetSize = (uint32_t) resourcePaths.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    int32_t resultCode = 0;
+                    String log;
+
+                    bool wasCompiled = false;
+                    if ( m_pWorkerPool != nullptr )
+                    {
+                        wasCompiled = m_pWorkerPool->TryCompile( m_resourcePaths[i], false, resultCode, log );
+                    }
+                    else
+                    {
+                        wasCompiled = CompileInNewProcess( m_compilerExecutablePath, m_resourcePaths[i], false, resultCode, log );
+                    }
+
+                    if ( !wasCompiled || resultCode > 1 )
+                    {
+                        m_numFailures++;
+                    }
+                }
+            }
+
+            TVector<String> const&          m_resourcePaths;
+            FileSystem::Path const&         m_compilerExecutablePath;
+            CompilerWorkerPool*             m_pWorkerPool = nullptr;
+            std::atomic<int32_t>            m_numFailures = 0;
+        };
+
+        // The worker pool is run first, so the worker start-up cost is included if the workers are not running yet
+        {
+            BenchmarkTask workerPoolTask( resourcePaths, m_settings.m_resourceCompilerExecutablePath, &m_compilerWorkerPool );
+            ScopedTimer<PlatformClock> timer( result.m_workerPoolTime );
+            m_taskSystem.ScheduleTask( &workerPoolTask );
+            m_taskSystem.WaitForTask( &workerPoolTask );
+            result.m_numWorkerFailures = workerPoolTask.m_numFailures;
+        }
+
+        {
+            BenchmarkTask perProcessTask( resourcePaths, m_settings.m_resourceCompilerExecutablePath, nullptr );
+            ScopedTimer<PlatformClock> timer( result.m_perProcessTime );
+            m_taskSystem.ScheduleTask( &perProcessTask );
+            m_taskSystem.WaitForTask( &perProcessTask );
+            result.m_numPerProcessFailures = perProcessTask.m_numFailures;
+        }
+
+        return result;
+    }
+
     bool ResourceServer::IsBusy() const
     {
         return IsPackaging() || m_numScheduledTasks != 0;
@@ -526,8 +667,20 @@ namespace EE::Resource
             return;
         }
 
-        // If we have a record, then schedule a recompile task
-        CreateResourceRequest( resourceID, 0, CompilationRequest::Origin::FileWatcher );
+        // Invalidate the file and get all the previously compiled resources that depend on it
+        TVector<ResourceID> affectedResources;
+        m_compileDependencyGraph.OnSourceFileModified( resourceID, affectedResources );
+
+        // Schedule recompile tasks for the file (if it's compilable) and all affected dependents
+        if ( m_pCompilerRegistry->GetCompilerForResourceType( resourceID.GetResourceTypeID() ) != nullptr )
+        {
+            CreateResourceRequest( resourceID, 0, CompilationRequest::Origin::FileWatcher );
+        }
+
+        for ( auto const& affectedResourceID : affectedResources )
+        {
+            CreateResourceRequest( affectedResourceID, 0, CompilationRequest::Origin::FileWatcher );
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -605,8 +758,9 @@ namespace EE::Resource
                     record.m_resourceID = pRequest->m_resourceID;
                     record.m_compilerVersion = pRequest->m_compilerVersion;
                     record.m_fileTimestamp = pRequest->m_fileTimestamp;
-                    record.m_sourceTimestampHash = pRequest->m_sourceTimestampHash;
+                    record.m_sourceHash = pRequest->m_sourceHash;
                     m_compiledResourceDatabase.WriteRecord( record );
+                    m_compileDependencyGraph.OnResourceCompiled( record );
                 }
 
                 // Send network response
@@ -624,6 +778,12 @@ namespace EE::Resource
 
             numDequeuedTasks = m_completedTasks.try_dequeue_bulk( dequeuedTasks, 100 );
         }
+
+        // Only persist the file hashes once we are idle, so we don't hit the database while a large batch of requests is in flight
+        if ( m_numScheduledTasks == 0 )
+        {
+            m_compiledResourceCache.SaveFileHashes( m_compiledResourceDatabase );
+        }
     }
 
     void ResourceServer::NotifyClientOnCompletedRequest( CompilationRequest* pRequest )
@@ -705,6 +865,27 @@ namespace EE::Resource
         m_packagingStage = PackagingStage::Preparing;
     }
 
+    bool ResourceServer::WriteResourcePackage() const
+    {
+        ResourcePackageWriter packageWriter;
+        for ( auto pRequest : m_packagingRequests )
+        {
+            if ( pRequest->HasSucceeded() )
+            {
+                packageWriter.AddResource( pRequest->GetResourceID(), pRequest->GetDestinationFilePath() );
+            }
+        }
+
+        FileSystem::Path const packagePath = m_settings.m_packagedBuildCompiledResourcePath + ResourcePackageFormat::s_defaultFileName;
+        if ( !packageWriter.Write( packagePath ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Server", "Failed to write resource package: %s", packagePath.c_str() );
+            return false;
+        }
+
+        return true;
+    }
+
     float ResourceServer::GetPackagingProgress() const
     {
         switch ( m_packagingStage )
@@ -2,6 +2,9 @@
 
 #include "ResourceServerContext.h"
 #include "ResourceCompilationRequest.h"
+#include "ResourceCompilerWorkerPool.h"
+#include "CompiledResourceCache.h"
+#include "ResourceCompileDependencyGraph.h"
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
 #include "System/Network/IPC/IPCMessageServer.h"
 #include "System/Resource/ResourceSettings.h"
@@ -34,6 +37,16 @@ namespace EE::Resource
             bool        m_isBusy = false;
         };
 
+        // The time taken to compile the same batch of resources via the compiler workers and via a compiler process per resource
+        struct CompilerBenchmarkResult
+        {
+            int32_t         m_numResources = 0;
+            int32_t         m_numWorkerFailures = 0;
+            int32_t         m_numPerProcessFailures = 0;
+            Milliseconds    m_workerPoolTime = 0;
+            Milliseconds    m_perProcessTime = 0;
+        };
+
         enum class PackagingStage
         {
             None, // Not Packaging
@@ -44,7 +57,7 @@ namespace EE::Resource
 
     public:
 
-        ResourceServer() = default;
+        ResourceServer();
         ~ResourceServer();
 
         bool Initialize( IniFile const& iniFile );
@@ -66,6 +79,17 @@ namespace EE::Resource
         inline void CompileResource( ResourceID const& resourceID, bool forceRecompile = true ) { CreateResourceRequest( resourceID, 0, forceRecompile ? CompilationRequest::Origin::ManualCompileForced : CompilationRequest::Origin::ManualCompile ); }
         inline void PackageResource( ResourceID const& resourceID ) { CreateResourceRequest( resourceID, 0, CompilationRequest::Origin::Package ); }
 
+        inline bool IsUsingCompilerWorkers() const { return m_compilerWorkerPool.IsInitialized(); }
+        inline CompilerWorkerPool::Stats GetCompilerWorkerStats() const { return m_compilerWorkerPool.GetStats(); }
+
+        // Recompile the most recently compiled resources with the compiler workers and then with a process per resource
+        // Both batches are spread across all task system threads, this blocks until both have completed so should only be run while idle
+        CompilerBenchmarkResult RunCompilerBenchmark( int32_t maxNumResources );
+
+        inline bool IsCompiledResourceCacheEnabled() const { return m_compiledResourceCache.IsStorageEnabled(); }
+        inline CompiledResourceCache::Stats GetCompiledResourceCacheStats() const { return m_compiledResourceCache.GetStats(); }
+        inline CompileDependencyGraph::Stats GetCompileDependencyGraphStats() const { return m_compileDependencyGraph.GetStats(); }
+
         // Requests
         //-------------------------------------------------------------------------
 
@@ -121,6 +145,12 @@ namespace EE::Resource
         void ProcessCompletedRequests();
         void NotifyClientOnCompletedRequest( CompilationRequest* pRequest );
 
+        // Packaging
+        //-------------------------------------------------------------------------
+
+        // Write all the successfully compiled packaging requests into the resource package
+        bool WriteResourcePackage() const;
+
         // File system listener
         //-------------------------------------------------------------------------
 
@@ -146,6 +176,9 @@ namespace EE::Resource
 
         // Workers
         ResourceServerContext                                       m_context;
+        CompilerWorkerPool                                          m_compilerWorkerPool;
+        CompiledResourceCache                                       m_compiledResourceCache;
+        CompileDependencyGraph                                      m_compileDependencyGraph;
 
         // Packaging
         TVector<ResourceID>                                         m_allMaps;
@@ -27,6 +27,11 @@ namespace EE::Resource
             return false;
         }
 
+        if ( m_pCompiledResourceCache == nullptr || m_pCompileDependencyGraph == nullptr )
+        {
+            return false;
+        }
+
         return true;
     }
 }
\ No newline at end of file
@@ -4,6 +4,15 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE::Resource
+{
+    class CompilerWorkerPool;
+    class CompiledResourceCache;
+    class CompileDependencyGraph;
+}
+
+//-------------------------------------------------------------------------
+
 namespace EE::Resource
 {
     struct ResourceServerContext
@@ -18,6 +27,9 @@ namespace EE::Resource
         TypeSystem::TypeRegistry const*         m_pTypeRegistry = nullptr;
         CompilerRegistry const*                 m_pCompilerRegistry = nullptr;
         CompiledResourceDatabase const*         m_pCompiledResourceDB = nullptr;
+        CompiledResourceCache*                  m_pCompiledResourceCache = nullptr;
+        CompileDependencyGraph*                 m_pCompileDependencyGraph = nullptr;
+        CompilerWorkerPool*                     m_pCompilerWorkerPool = nullptr; // Optional, only set if we use persistent compiler workers
 
         // Set when we shutdown the server to skip processing of any scheduled tasks
         bool                                    m_isExiting = false;
@@ -208,6 +208,14 @@ namespace EE::Resource
                             }
                             break;
 
+                            case CompilationRequest::Status::SucceededFromCache:
+                            {
+                                itemColor = Colors::Lime.ToFloat4();
+                                ImGui::TextColored( itemColor, EE_ICON_DATABASE_CHECK );
+                                ImGuiX::TextTooltip( "Restored From Cache" );
+                            }
+                            break;
+
                             case CompilationRequest::Status::Failed:
                             {
                                 itemColor = Colors::Red.ToFloat4();
@@ -380,6 +388,34 @@ namespace EE::Resource
             ImGui::Text( "Compiled Resource Path: %s", m_resourceServer.GetCompiledResourceDir().c_str() );
             ImGui::Text( "IP Address: %s:%d", m_resourceServer.GetNetworkAddress().c_str(), m_resourceServer.GetNetworkPort() );
 
+            if ( m_resourceServer.IsUsingCompilerWorkers() )
+            {
+                auto const workerStats = m_resourceServer.GetCompilerWorkerStats();
+                float const averageCompilationTime = ( workerStats.m_numCompiles > 0 ) ? workerStats.m_totalCompilationTime.ToFloat() / workerStats.m_numCompiles : 0.0f;
+                ImGui::Text( "Compiler Workers: %d running, %d started, %d compiles (avg: %.2fms)", workerStats.m_numRunningWorkers, workerStats.m_numWorkerStarts, workerStats.m_numCompiles, averageCompilationTime );
+            }
+            else
+            {
+                ImGui::Text( "Compiler Workers: Disabled" );
+            }
+
+            if ( m_resourceServer.IsCompiledResourceCacheEnabled() )
+            {
+                auto const cacheStats = m_resourceServer.GetCompiledResourceCacheStats();
+                int32_t const numLookups = cacheStats.m_numHits + cacheStats.m_numMisses;
+                float const hitRate = ( numLookups > 0 ) ? ( 100.0f * cacheStats.m_numHits / numLookups ) : 0.0f;
+                ImGui::Text( "Compiled Resource Cache: %d hits, %d misses (%.1f%%), %d stored", cacheStats.m_numHits, cacheStats.m_numMisses, hitRate, cacheStats.m_numStores );
+                ImGuiX::TextTooltip( "Restored: %.2fMB, Failed Stores: %d, Hashed Files: %d, Memoized Hashes: %d", cacheStats.m_numBytesRestored / ( 1024.0f * 1024.0f ), cacheStats.m_numFailedStores, cacheStats.m_numHashedFiles, cacheStats.m_numMemoizedFileHashes );
+            }
+            else
+            {
+                ImGui::Text( "Compiled Resource Cache: Disabled" );
+            }
+
+            auto const graphStats = m_resourceServer.GetCompileDependencyGraphStats();
+            ImGui::Text( "Compile Dependency Graph: %d nodes, %d evaluations, %d node refreshes", graphStats.m_numNodes, graphStats.m_numEvaluations, graphStats.m_numNodeStateRefreshes );
+            ImGuiX::TextTooltip( "Source Refreshes: %d, Descriptor Reads: %d, Persisted Descriptor Reuses: %d, Invalidations: %d", graphStats.m_numNodeSourceRefreshes, graphStats.m_numDescriptorReads, graphStats.m_numPersistedDescriptorReuses, graphStats.m_numInvalidations );
+
             //-------------------------------------------------------------------------
 
             ImGuiX::TextSeparator( "Tools" );
@@ -402,6 +438,21 @@ namespace EE::Resource
             }
             ImGui::EndDisabled();
 
+            ImGui::BeginDisabled( !m_resourceServer.IsUsingCompilerWorkers() || m_resourceServer.IsBusy() );
+            if ( ImGui::Button( "Benchmark Compiler Workers (Last 100 Compiled Resources)" ) )
+            {
+                m_compilerBenchmarkResult = m_resourceServer.RunCompilerBenchmark( 100 );
+            }
+            ImGui::EndDisabled();
+
+            if ( m_compilerBenchmarkResult.m_numResources > 0 )
+            {
+                auto const& result = m_compilerBenchmarkResult;
+                float const workerThroughput = ( result.m_workerPoolTime > 0.0f ) ? result.m_numResources / result.m_workerPoolTime.ToSeconds().ToFloat() : 0.0f;
+                float const perProcessThroughput = ( result.m_perProcessTime > 0.0f ) ? result.m_numResources / result.m_perProcessTime.ToSeconds().ToFloat() : 0.0f;
+                ImGui::Text( "%d Resources - Workers: %.2fms (%.1f/s, %d failed), Per Process: %.2fms (%.1f/s, %d failed)", result.m_numResources, result.m_workerPoolTime.ToFloat(), workerThroughput, result.m_numWorkerFailures, result.m_perProcessTime.ToFloat(), perProcessThroughput, result.m_numPerProcessFailures );
+            }
+
             //-------------------------------------------------------------------------
 
             ImGuiX::TextSeparator( "Registered Compilers" );
@@ -1,4 +1,5 @@
 #pragma once
+#include "ResourceServer.h"
 #include "System/Math/Rectangle.h"
 #include "System/Imgui/ImguiX.h"
 
@@ -10,7 +11,6 @@ namespace EE::ImGuiX { class ImageCache; }
 
 namespace EE::Resource
 {
-    class ResourceServer;
     class CompilationRequest;
 
     //-------------------------------------------------------------------------
@@ -44,6 +44,7 @@ namespace EE::Resource
 
         char                                            m_resourcePathbuffer[255] = { 0 };
         bool                                            m_forceRecompilation = false;
+        ResourceServer::CompilerBenchmarkResult         m_compilerBenchmarkResult;
 
         ImGuiX::ImageCache*                             m_pImageCache = nullptr;
         ImGuiX::ImageInfo                               m_resourceServerIcon;
@@ -44,6 +44,12 @@ namespace EE::AI
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccessList const& AIManager::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( ReadsComponent<AISpawnComponent>(), WritesEntityMaps() );
+        return accessList;
+    }
+
     void AIManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.IsGameWorld() && !m_hasSpawnedAI )
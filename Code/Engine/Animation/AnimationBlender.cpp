@@ -1,4 +1,5 @@
 #include "AnimationBlender.h"
+#include "AnimationPoseKernels.h"
 
 //-------------------------------------------------------------------------
 
@@ -189,7 +190,11 @@ namespace EE::Animation
     {
         pResultPose->ClearGlobalTransforms();
 
-        if ( pBoneMask != nullptr )
+        if ( PoseKernels::IsEnabled() )
+        {
+            BlendBatched( pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose );
+        }
+        else if ( pBoneMask != nullptr )
         {
             BlenderLocal<InterpolativeBlender>( pSourcePose, pTargetPose, blendWeight, pBoneMask, pResultPose, true );
         }
@@ -199,6 +204,47 @@ namespace EE::Animation
         }
     }
 
+    void Blender::BlendBatched( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose )
+    {
+        EE_ASSERT( blendWeight >= 0.0f && blendWeight <= 1.0f );
+        EE_ASSERT( pSourcePose != nullptr && pTargetPose != nullptr && pResultPose != nullptr );
+
+        int32_t const numBones = pResultPose->GetNumBones();
+        Transform const* pSourceTransforms = pSourcePose->m_localTransforms.data();
+        Transform const* pTargetTransforms = pTargetPose->m_localTransforms.data();
+        Transform* pResultTransforms = pResultPose->m_localTransforms.data();
+
+        if ( pBoneMask != nullptr )
+        {
+            EE_ASSERT( pBoneMask->GetNumWeights() == pSourcePose->GetSkeleton()->GetNumBones() );
+
+            TInlineVector<float, 256> boneBlendWeights;
+            boneBlendWeights.resize( numBones );
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                boneBlendWeights[boneIdx] = blendWeight * pBoneMask->GetWeight( boneIdx );
+            }
+
+            PoseKernels::BlendLocal( pSourceTransforms, pTargetTransforms, boneBlendWeights.data(), pResultTransforms, numBones );
+        }
+        else
+        {
+            // Fully in source or target
+            if ( blendWeight == 0.0f || blendWeight == 1.0f )
+            {
+                Pose const* pPoseToCopy = ( blendWeight == 0.0f ) ? pSourcePose : pTargetPose;
+                if ( pPoseToCopy != pResultPose )
+                {
+                    pResultPose->CopyFrom( pPoseToCopy );
+                }
+            }
+            else // Blend
+            {
+                PoseKernels::BlendLocal( pSourceTransforms, pTargetTransforms, blendWeight, pResultTransforms, numBones );
+            }
+        }
+    }
+
     void Blender::BlendAdditive( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose )
     {
         pResultPose->ClearGlobalTransforms();
@@ -85,6 +85,9 @@ namespace EE::Animation
             }
         };
 
+        // Interpolative local blend using the batched SIMD pose kernels
+        static void BlendBatched( Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose );
+
     public:
 
         // Local Interpolative Blend
@@ -1,13 +1,16 @@
 #include "AnimationClip.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationPoseKernels.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
-    void AnimationClip::GetPose( FrameTime const& frameTime, Pose* pOutPose ) const
+    void AnimationClip::GetPose( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod ) const
     {
+        EE_PROFILE_FUNCTION_ANIMATION();
         EE_ASSERT( IsValid() );
         EE_ASSERT( pOutPose != nullptr && pOutPose->GetSkeleton() == m_skeleton.GetPtr() );
         EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
@@ -16,26 +19,102 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
-        Transform boneTransform;
-        uint16_t const* pTrackData = m_compressedPoseData.data();
+        auto const numBones = m_skeleton->GetNumBones();
 
-        // Read exact key frame
-        if ( frameTime.IsExactlyAtKeyFrame() )
+        // Set all the skipped bones to the reference pose (or the zero pose for additives)
+        if ( !m_skeleton->HasHighLODBones() )
         {
-            auto const numBones = m_skeleton->GetNumBones();
+            lod = Skeleton::LOD::High;
+        }
+        else if ( lod == Skeleton::LOD::Low )
+        {
+            auto const& referencePose = m_skeleton->GetLocalReferencePose();
             for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
             {
-                pTrackData = ReadCompressedTrackKeyFrame( pTrackData, m_trackCompressionSettings[boneIdx], frameTime.GetFrameIndex(), boneTransform );
-                pOutPose->m_localTransforms[boneIdx] = boneTransform;
+                if ( m_skeleton->IsHighLODBone( boneIdx ) )
+                {
+                    pOutPose->m_localTransforms[boneIdx] = m_isAdditive ? Transform::Identity : referencePose[boneIdx];
+                }
             }
         }
-        else // Read interpolated anim pose
+
+        //-------------------------------------------------------------------------
+
+        if ( PoseKernels::IsEnabled() )
         {
-            auto const numBones = m_skeleton->GetNumBones();
-            for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            GetPoseBatched( frameTime, pOutPose, lod );
+        }
+        else if ( m_dataLayout == DataLayout::FrameMajor )
+        {
+            // All the animated data for a frame is contiguous, so we just walk forward through the frame(s)
+            Transform boneTransform;
+            uint16_t const* pFrameData0 = GetCompressedFrameData( frameTime.GetFrameIndex() );
+
+            // Read exact key frame
+            if ( frameTime.IsExactlyAtKeyFrame() )
+            {
+                for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    if ( ShouldSkipBone( boneIdx, lod ) )
+                    {
+                        pFrameData0 += GetCompressedTrackDataSize( m_trackCompressionSettings[boneIdx] );
+                        continue;
+                    }
+
+                    pFrameData0 = ReadCompressedFrameKeyFrame( pFrameData0, m_trackCompressionSettings[boneIdx], boneTransform );
+                    pOutPose->m_localTransforms[boneIdx] = boneTransform;
+                }
+            }
+            else // Read interpolated anim pose
             {
-                pTrackData = ReadCompressedTrackTransform( pTrackData, m_trackCompressionSettings[boneIdx], frameTime, boneTransform );
-                pOutPose->m_localTransforms[boneIdx] = boneTransform;
+                Percentage const percentageThrough = frameTime.GetPercentageThrough();
+                for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    if ( ShouldSkipBone( boneIdx, lod ) )
+                    {
+                        pFrameData0 += GetCompressedTrackDataSize( m_trackCompressionSettings[boneIdx] );
+                        continue;
+                    }
+
+                    uint16_t const* pFrameData1 = pFrameData0 + m_frameDataStride;
+                    pFrameData0 = ReadCompressedFrameTransform( pFrameData0, pFrameData1, m_trackCompressionSettings[boneIdx], percentageThrough, boneTransform );
+                    pOutPose->m_localTransforms[boneIdx] = boneTransform;
+                }
+            }
+        }
+        else // Track Major
+        {
+            Transform boneTransform;
+            uint16_t const* pTrackData = m_compressedPoseData.data();
+
+            // Read exact key frame
+            if ( frameTime.IsExactlyAtKeyFrame() )
+            {
+                for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    if ( ShouldSkipBone( boneIdx, lod ) )
+                    {
+                        pTrackData += GetCompressedTrackDataSize( m_trackCompressionSettings[boneIdx] );
+                        continue;
+                    }
+
+                    pTrackData = ReadCompressedTrackKeyFrame( pTrackData, m_trackCompressionSettings[boneIdx], frameTime.GetFrameIndex(), boneTransform );
+                    pOutPose->m_localTransforms[boneIdx] = boneTransform;
+                }
+            }
+            else // Read interpolated anim pose
+            {
+                for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    if ( ShouldSkipBone( boneIdx, lod ) )
+                    {
+                        pTrackData += GetCompressedTrackDataSize( m_trackCompressionSettings[boneIdx] );
+                        continue;
+                    }
+
+                    pTrackData = ReadCompressedTrackTransform( pTrackData, m_trackCompressionSettings[boneIdx], frameTime, boneTransform );
+                    pOutPose->m_localTransforms[boneIdx] = boneTransform;
+                }
             }
         }
 
@@ -43,39 +122,214 @@ namespace EE::Animation
         pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::Pose;
     }
 
-    Transform AnimationClip::GetLocalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const
+    void AnimationClip::GetPoseBatched( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod ) const
     {
-        EE_ASSERT( IsValid() && m_skeleton->IsValidBoneIndex( boneIdx ) );
+        // Gather the encoded data pointers for a batch of tracks and then decode the whole batch at once
+        static constexpr int32_t const s_batchSize = 16;
+        PoseKernels::EncodedTrackSample samples[s_batchSize];
+        int32_t sampleBoneIndices[s_batchSize];
+        int32_t numSamples = 0;
 
-        uint32_t frameIdx = frameTime.GetFrameIndex();
-        EE_ASSERT( frameIdx < m_numFrames );
+        uint32_t const frameIdx = frameTime.GetFrameIndex();
+        bool const shouldInterpolate = !frameTime.IsExactlyAtKeyFrame();
+        Percentage const percentageThrough = shouldInterpolate ? frameTime.GetPercentageThrough() : Percentage( 0.0f );
+        int32_t const numBones = m_skeleton->GetNumBones();
 
-        //-------------------------------------------------------------------------
+        // Decode the current batch, contiguous batches are decoded straight into the pose, otherwise we need to scatter the results
+        auto FlushBatch = [&] ()
+        {
+            if ( numSamples == 0 )
+            {
+                return;
+            }
+
+            int32_t const firstBoneIdx = sampleBoneIndices[0];
+            if ( sampleBoneIndices[numSamples - 1] - firstBoneIdx == numSamples - 1 )
+            {
+                PoseKernels::DecodeTracks( samples, numSamples, percentageThrough, shouldInterpolate, &pOutPose->m_localTransforms[firstBoneIdx] );
+            }
+            else
+            {
+                Transform decodedTransforms[s_batchSize];
+                PoseKernels::DecodeTracks( samples, numSamples, percentageThrough, shouldInterpolate, decodedTransforms );
+                for ( int32_t i = 0; i < numSamples; i++ )
+                {
+                    pOutPose->m_localTransforms[sampleBoneIndices[i]] = decodedTransforms[i];
+                }
+            }
 
-        auto const& trackSettings = m_trackCompressionSettings[boneIdx];
-        uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
+            numSamples = 0;
+        };
 
         //-------------------------------------------------------------------------
 
+        if ( m_dataLayout == DataLayout::FrameMajor )
+        {
+            uint16_t const* pFrameData0 = GetCompressedFrameData( frameIdx );
+            uint16_t const* pFrameData1 = shouldInterpolate ? pFrameData0 + m_frameDataStride : pFrameData0;
+
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                auto const& trackSettings = m_trackCompressionSettings[boneIdx];
+
+                if ( ShouldSkipBone( boneIdx, lod ) )
+                {
+                    uint32_t const trackDataSize = GetCompressedTrackDataSize( trackSettings );
+                    pFrameData0 += trackDataSize;
+                    pFrameData1 += trackDataSize;
+                    continue;
+                }
+
+                auto& sample = samples[numSamples];
+                sample.m_pSettings = &trackSettings;
+                sampleBoneIndices[numSamples] = boneIdx;
+
+                // Rotation is always animated
+                sample.m_pRotation0 = pFrameData0;
+                sample.m_pRotation1 = pFrameData1;
+                uint32_t frameDataOffset = 3;
+
+                uint16_t const* pStaticData = m_compressedPoseData.data() + trackSettings.m_staticDataStartIndex;
+
+                if ( trackSettings.IsTranslationTrackStatic() )
+                {
+                    sample.m_pTranslation0 = sample.m_pTranslation1 = pStaticData;
+                    pStaticData += 3;
+                }
+                else
+                {
+                    sample.m_pTranslation0 = pFrameData0 + frameDataOffset;
+                    sample.m_pTranslation1 = pFrameData1 + frameDataOffset;
+                    frameDataOffset += 3;
+                }
+
+                if ( trackSettings.IsScaleTrackStatic() )
+                {
+                    sample.m_pScale0 = sample.m_pScale1 = pStaticData;
+                }
+                else
+                {
+                    sample.m_pScale0 = pFrameData0 + frameDataOffset;
+                    sample.m_pScale1 = pFrameData1 + frameDataOffset;
+                    frameDataOffset += 1;
+                }
+
+                pFrameData0 += frameDataOffset;
+                pFrameData1 += frameDataOffset;
+
+                if ( ++numSamples == s_batchSize )
+                {
+                    FlushBatch();
+                }
+            }
+        }
+        else // Track Major
+        {
+            // Rotations and translations are 48bits (3 x uint16_t), scales are 16bits (1 x uint16_t)
+            uint32_t const frameOffset0 = frameIdx;
+            uint32_t const frameOffset1 = shouldInterpolate ? frameIdx + 1 : frameIdx;
+            EE_ASSERT( frameOffset1 < m_numFrames );
+
+            uint16_t const* pTrackData = m_compressedPoseData.data();
+
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                auto const& trackSettings = m_trackCompressionSettings[boneIdx];
+
+                if ( ShouldSkipBone( boneIdx, lod ) )
+                {
+                    pTrackData += GetCompressedTrackDataSize( trackSettings );
+                    continue;
+                }
+
+                auto& sample = samples[numSamples];
+                sample.m_pSettings = &trackSettings;
+                sampleBoneIndices[numSamples] = boneIdx;
+
+                sample.m_pRotation0 = pTrackData + ( frameOffset0 * 3 );
+                sample.m_pRotation1 = pTrackData + ( frameOffset1 * 3 );
+                pTrackData += ( m_numFrames * 3 );
+
+                if ( trackSettings.IsTranslationTrackStatic() )
+                {
+                    sample.m_pTranslation0 = sample.m_pTranslation1 = pTrackData;
+                    pTrackData += 3;
+                }
+                else
+                {
+                    sample.m_pTranslation0 = pTrackData + ( frameOffset0 * 3 );
+                    sample.m_pTranslation1 = pTrackData + ( frameOffset1 * 3 );
+                    pTrackData += ( m_numFrames * 3 );
+                }
+
+                if ( trackSettings.IsScaleTrackStatic() )
+                {
+                    sample.m_pScale0 = sample.m_pScale1 = pTrackData;
+                    pTrackData += 1;
+                }
+                else
+                {
+                    sample.m_pScale0 = pTrackData + frameOffset0;
+                    sample.m_pScale1 = pTrackData + frameOffset1;
+                    pTrackData += m_numFrames;
+                }
+
+                if ( ++numSamples == s_batchSize )
+                {
+                    FlushBatch();
+                }
+            }
+        }
+
+        FlushBatch();
+    }
+
+    Transform AnimationClip::ReadTrackTransform( int32_t trackIdx, FrameTime const& frameTime ) const
+    {
+        auto const& trackSettings = m_trackCompressionSettings[trackIdx];
+        uint32_t const frameIdx = frameTime.GetFrameIndex();
+
         Transform boneLocalTransform;
 
-        if ( frameTime.IsExactlyAtKeyFrame() )
+        if ( m_dataLayout == DataLayout::FrameMajor )
         {
-            ReadCompressedTrackKeyFrame( pTrackData, trackSettings, frameIdx, boneLocalTransform );
+            uint16_t const* pFrameData0 = GetCompressedFrameData( frameIdx ) + trackSettings.m_trackStartIndex;
+            if ( frameTime.IsExactlyAtKeyFrame() )
+            {
+                ReadCompressedFrameKeyFrame( pFrameData0, trackSettings, boneLocalTransform );
+            }
+            else
+            {
+                ReadCompressedFrameTransform( pFrameData0, pFrameData0 + m_frameDataStride, trackSettings, frameTime.GetPercentageThrough(), boneLocalTransform );
+            }
         }
-        else
+        else // Track Major
         {
-            ReadCompressedTrackTransform( pTrackData, trackSettings, frameTime, boneLocalTransform );
+            uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
+            if ( frameTime.IsExactlyAtKeyFrame() )
+            {
+                ReadCompressedTrackKeyFrame( pTrackData, trackSettings, frameIdx, boneLocalTransform );
+            }
+            else
+            {
+                ReadCompressedTrackTransform( pTrackData, trackSettings, frameTime, boneLocalTransform );
+            }
         }
+
         return boneLocalTransform;
     }
 
-    Transform AnimationClip::GetGlobalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const
+    Transform AnimationClip::GetLocalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const
     {
         EE_ASSERT( IsValid() && m_skeleton->IsValidBoneIndex( boneIdx ) );
+        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
+        return ReadTrackTransform( boneIdx, frameTime );
+    }
 
-        uint32_t frameIdx = frameTime.GetFrameIndex();
-        EE_ASSERT( frameIdx < m_numFrames );
+    Transform AnimationClip::GetGlobalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const
+    {
+        EE_ASSERT( IsValid() && m_skeleton->IsValidBoneIndex( boneIdx ) );
+        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
 
         // Find all parent bones
         //-------------------------------------------------------------------------
@@ -93,49 +347,14 @@ namespace EE::Animation
         // Calculate the global transform
         //-------------------------------------------------------------------------
 
-        Transform globalTransform;
+        // Read root transform
+        Transform globalTransform = ReadTrackTransform( boneHierarchy.back(), frameTime );
 
-        if ( frameTime.IsExactlyAtKeyFrame() )
+        // Read and multiply out all the transforms moving down the hierarchy
+        for ( int32_t i = (int32_t) boneHierarchy.size() - 2; i >= 0; i-- )
         {
-            // Read root transform
-            {
-                auto const& trackSettings = m_trackCompressionSettings[boneHierarchy.back()];
-                uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
-                ReadCompressedTrackKeyFrame( pTrackData, trackSettings, frameIdx, globalTransform );
-            }
-
-            // Read and multiply out all the transforms moving down the hierarchy
-            Transform localTransform;
-            for ( int32_t i = (int32_t) boneHierarchy.size() - 2; i >= 0; i-- )
-            {
-                int32_t const trackIdx = boneHierarchy[i];
-                auto const& trackSettings = m_trackCompressionSettings[trackIdx];
-                uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
-                ReadCompressedTrackKeyFrame( pTrackData, trackSettings, frameIdx, localTransform );
-
-                globalTransform = localTransform * globalTransform;
-            }
-        }
-        else // Interpolate key-frames
-        {
-            // Read root transform
-            {
-                auto const& trackSettings = m_trackCompressionSettings[boneHierarchy.back()];
-                uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
-                ReadCompressedTrackTransform( pTrackData, trackSettings, frameTime, globalTransform );
-            }
-
-            // Read and multiply out all the transforms moving down the hierarchy
-            Transform localTransform;
-            for ( int32_t i = (int32_t) boneHierarchy.size() - 2; i >= 0; i-- )
-            {
-                int32_t const trackIdx = boneHierarchy[i];
-                auto const& trackSettings = m_trackCompressionSettings[trackIdx];
-                uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
-                ReadCompressedTrackTransform( pTrackData, trackSettings, frameTime, localTransform );
-
-                globalTransform = localTransform * globalTransform;
-            }
+            Transform const localTransform = ReadTrackTransform( boneHierarchy[i], frameTime );
+            globalTransform = localTransform * globalTransform;
         }
 
         return globalTransform;
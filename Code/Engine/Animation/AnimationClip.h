@@ -42,9 +42,10 @@ namespace EE::Animation
 
     struct TrackCompressionSettings
     {
-        EE_SERIALIZE( m_translationRangeX, m_translationRangeY, m_translationRangeZ, m_scaleRange, m_trackStartIndex, m_isTranslationStatic, m_isScaleStatic );
+        EE_SERIALIZE( m_translationRangeX, m_translationRangeY, m_translationRangeZ, m_scaleRange, m_trackStartIndex, m_staticDataStartIndex, m_isTranslationStatic, m_isScaleStatic );
 
         friend class AnimationClipCompiler;
+        friend class AnimationDebugView;
 
     public:
 
@@ -62,7 +63,8 @@ namespace EE::Animation
         QuantizationRange                       m_translationRangeY;
         QuantizationRange                       m_translationRangeZ;
         QuantizationRange                       m_scaleRange;
-        uint32_t                                m_trackStartIndex = 0; // The start offset for this track in the compressed data block (in number of uint16s)
+        uint32_t                                m_trackStartIndex = 0; // The start offset for this track in the compressed data block (in number of uint16s) - for frame major data, this is the offset within each frame
+        uint32_t                                m_staticDataStartIndex = 0; // Frame major data only: the offset of the static translation/scale values for this track in the compressed data block
 
     private:
 
@@ -75,10 +77,36 @@ namespace EE::Animation
     class EE_ENGINE_API AnimationClip : public Resource::IResource
     {
         EE_REGISTER_RESOURCE( 'anim', "Animation Clip" );
-        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_compressedPoseData, m_trackCompressionSettings, m_rootMotion, m_isAdditive );
+        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_dataLayout, m_frameDataStartIndex, m_frameDataStride, m_compressedPoseData, m_trackCompressionSettings, m_rootMotion, m_isAdditive );
 
         friend class AnimationClipCompiler;
         friend class AnimationClipLoader;
+        friend class AnimationDebugView;
+
+    public:
+
+        // How the compressed pose data is laid out
+        enum class DataLayout : uint8_t
+        {
+            EE_REGISTER_ENUM
+
+            TrackMajor = 0, // All key-frames for a track are stored together: [Track0: Rotations, Translations, Scales][Track1: ...]
+            FrameMajor,     // All tracks for a key-frame are stored together: [Static Values][Frame0: Track0, Track1, ...][Frame1: ...]
+        };
+
+        // Lookup tables for the events, generated by the compiler for the sorted event order
+        struct EventIndex
+        {
+            EE_SERIALIZE( m_maxEndTimes, m_typeFirstEventIndices, m_typeEventBits );
+
+            inline int32_t GetNumBitWords() const { return ( (int32_t) m_maxEndTimes.size() + 63 ) / 64; }
+
+        public:
+
+            TVector<float>                      m_maxEndTimes;              // The running max of the event end times, used to skip all events that end before a queried range
+            TVector<int32_t>                    m_typeFirstEventIndices;    // The first event for each of the event types in this clip
+            TVector<uint64_t>                   m_typeEventBits;            // A bitset of all the events per event type, 'GetNumBitWords()' words per type
+        };
 
     private:
 
@@ -115,6 +143,7 @@ namespace EE::Animation
 
         inline bool IsSingleFrameAnimation() const { return m_numFrames == 1; }
         inline bool IsAdditive() const { return m_isAdditive; }
+        inline DataLayout GetDataLayout() const { return m_dataLayout; }
         inline float GetFPS() const { return float( m_numFrames - 1 ) / m_duration; }
         inline uint32_t GetNumFrames() const { return m_numFrames; }
         inline Seconds GetDuration() const { return m_duration; }
@@ -128,8 +157,9 @@ namespace EE::Animation
         // Pose
         //-------------------------------------------------------------------------
 
-        void GetPose( FrameTime const& frameTime, Pose* pOutPose ) const;
-        inline void GetPose( Percentage percentageThrough, Pose* pOutPose ) const { GetPose( GetFrameTime( percentageThrough ), pOutPose ); }
+        // Sample the pose, at the low LOD the high LOD bones are not decoded and are set to the reference pose (or zero pose for additives)
+        void GetPose( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod = Skeleton::LOD::High ) const;
+        inline void GetPose( Percentage percentageThrough, Pose* pOutPose, Skeleton::LOD lod = Skeleton::LOD::High ) const { GetPose( GetFrameTime( percentageThrough ), pOutPose, lod ); }
 
         Transform GetLocalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const;
         inline Transform GetLocalSpaceTransform( int32_t boneIdx, Percentage percentageThrough ) const{ return GetLocalSpaceTransform( boneIdx, GetFrameTime( percentageThrough ) ); }
@@ -144,6 +174,59 @@ namespace EE::Animation
         // Get all the events for this animation
         inline TVector<Event*> const& GetEvents() const { return m_events; }
 
+        // Get the first event of the specified type (or derived from it), returns nullptr if there are no events of this type
+        template<typename T>
+        inline T const* GetFirstEventOfType() const
+        {
+            int32_t firstEventIdx = InvalidIndex;
+            for ( int32_t const typeFirstEventIdx : m_eventIndex.m_typeFirstEventIndices )
+            {
+                if ( ( firstEventIdx == InvalidIndex || typeFirstEventIdx < firstEventIdx ) && IsOfType<T>( m_events[typeFirstEventIdx] ) )
+                {
+                    firstEventIdx = typeFirstEventIdx;
+                }
+            }
+
+            return ( firstEventIdx != InvalidIndex ) ? Cast<T>( m_events[firstEventIdx] ) : nullptr;
+        }
+
+        // Does this animation have any events of the specified type (or derived from it)
+        template<typename T>
+        inline bool HasEventsOfType() const { return GetFirstEventOfType<T>() != nullptr; }
+
+        // Get all the events of the specified type (or derived from it) sorted by start time. This function will append the results to the output array.
+        template<typename T, eastl_size_t N>
+        inline void GetEventsOfType( TInlineVector<T const*, N>& outEvents ) const
+        {
+            int32_t const numWords = m_eventIndex.GetNumBitWords();
+            TInlineVector<uint64_t, 4> eventBits;
+            eventBits.resize( numWords, 0 );
+
+            // Combine the sets of all matching types to keep the events sorted
+            int32_t const numTypes = (int32_t) m_eventIndex.m_typeFirstEventIndices.size();
+            for ( int32_t typeIdx = 0; typeIdx < numTypes; typeIdx++ )
+            {
+                if ( IsOfType<T>( m_events[m_eventIndex.m_typeFirstEventIndices[typeIdx]] ) )
+                {
+                    for ( int32_t wordIdx = 0; wordIdx < numWords; wordIdx++ )
+                    {
+                        eventBits[wordIdx] |= m_eventIndex.m_typeEventBits[typeIdx * numWords + wordIdx];
+                    }
+                }
+            }
+
+            for ( int32_t wordIdx = 0; wordIdx < numWords; wordIdx++ )
+            {
+                for ( int32_t bitIdx = 0; eventBits[wordIdx] != 0; bitIdx++, eventBits[wordIdx] >>= 1 )
+                {
+                    if ( eventBits[wordIdx] & 1 )
+                    {
+                        outEvents.emplace_back( Cast<T>( m_events[wordIdx * 64 + bitIdx] ) );
+                    }
+                }
+            }
+        }
+
         // Get all the events for the specified range. This function will append the results to the output array. Handle's looping but assumes only a single loop occurred!
         inline void GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const;
 
@@ -197,14 +280,52 @@ namespace EE::Animation
         inline uint16_t const* ReadCompressedTrackTransform( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, FrameTime const& frameTime, Transform& outTransform ) const;
         inline uint16_t const* ReadCompressedTrackKeyFrame( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, uint32_t frameIdx, Transform& outTransform ) const;
 
+        // Read a compressed transform from frame major data and return a pointer to the data for the next track in the same frame
+        inline uint16_t const* ReadCompressedFrameTransform( uint16_t const* pFrameData0, uint16_t const* pFrameData1, TrackCompressionSettings const& trackSettings, Percentage percentageThrough, Transform& outTransform ) const;
+        inline uint16_t const* ReadCompressedFrameKeyFrame( uint16_t const* pFrameData, TrackCompressionSettings const& trackSettings, Transform& outTransform ) const;
+
+        // Get the start of the frame major data for the specified frame
+        EE_FORCE_INLINE uint16_t const* GetCompressedFrameData( uint32_t frameIdx ) const
+        {
+            EE_ASSERT( m_dataLayout == DataLayout::FrameMajor && frameIdx < m_numFrames );
+            return m_compressedPoseData.data() + m_frameDataStartIndex + ( frameIdx * m_frameDataStride );
+        }
+
+        // Get the size of a track's animated data (in number of uint16s): for frame major data this is the size within a single frame
+        EE_FORCE_INLINE uint32_t GetCompressedTrackDataSize( TrackCompressionSettings const& trackSettings ) const
+        {
+            if ( m_dataLayout == DataLayout::FrameMajor )
+            {
+                return 3 + ( trackSettings.IsTranslationTrackStatic() ? 0 : 3 ) + ( trackSettings.IsScaleTrackStatic() ? 0 : 1 );
+            }
+
+            return ( m_numFrames * 3 ) + ( trackSettings.IsTranslationTrackStatic() ? 3 : m_numFrames * 3 ) + ( trackSettings.IsScaleTrackStatic() ? 1 : m_numFrames );
+        }
+
+        // Should we skip decoding this bone for the specified LOD
+        EE_FORCE_INLINE bool ShouldSkipBone( int32_t boneIdx, Skeleton::LOD lod ) const
+        {
+            return lod == Skeleton::LOD::Low && m_skeleton->IsHighLODBone( boneIdx );
+        }
+
+        // Sample the pose using the batched SIMD decode kernels
+        void GetPoseBatched( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod ) const;
+
+        // Sample a single track for the specified frame time
+        Transform ReadTrackTransform( int32_t trackIdx, FrameTime const& frameTime ) const;
+
     private:
 
         TResourcePtr<Skeleton>                  m_skeleton;
         uint32_t                                m_numFrames = 0;
         Seconds                                 m_duration = 0.0f;
+        DataLayout                              m_dataLayout = DataLayout::TrackMajor;
+        uint32_t                                m_frameDataStartIndex = 0;      // Frame major data only: the offset of the first frame in the compressed data block (in number of uint16s)
+        uint32_t                                m_frameDataStride = 0;          // Frame major data only: the size of a single frame (in number of uint16s)
         TVector<uint16_t>                       m_compressedPoseData;
         TVector<TrackCompressionSettings>       m_trackCompressionSettings;
         TVector<Event*>                         m_events;
+        EventIndex                              m_eventIndex;
         SyncTrack                               m_syncTrack;
         RootMotionData                          m_rootMotion;
         bool                                    m_isAdditive = false;
@@ -396,12 +517,111 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    inline uint16_t const* AnimationClip::ReadCompressedFrameTransform( uint16_t const* pFrameData0, uint16_t const* pFrameData1, TrackCompressionSettings const& trackSettings, Percentage percentageThrough, Transform& outTransform ) const
+    {
+        EE_ASSERT( pFrameData0 != nullptr && pFrameData1 != nullptr );
+
+        Transform transform0;
+        Transform transform1;
+
+        // Rotation is always animated
+        transform0.SetRotation( DecodeRotation( pFrameData0 ) );
+        transform1.SetRotation( DecodeRotation( pFrameData1 ) );
+        uint32_t frameDataOffset = 3;
+
+        //-------------------------------------------------------------------------
+
+        uint16_t const* pStaticData = m_compressedPoseData.data() + trackSettings.m_staticDataStartIndex;
+
+        if ( trackSettings.IsTranslationTrackStatic() )
+        {
+            Vector const translation = DecodeTranslation( pStaticData, trackSettings );
+            transform0.SetTranslation( translation );
+            transform1.SetTranslation( translation );
+            pStaticData += 3;
+        }
+        else
+        {
+            transform0.SetTranslation( DecodeTranslation( pFrameData0 + frameDataOffset, trackSettings ) );
+            transform1.SetTranslation( DecodeTranslation( pFrameData1 + frameDataOffset, trackSettings ) );
+            frameDataOffset += 3;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( trackSettings.IsScaleTrackStatic() )
+        {
+            float const scale = DecodeScale( pStaticData, trackSettings );
+            transform0.SetScale( scale );
+            transform1.SetScale( scale );
+        }
+        else
+        {
+            transform0.SetScale( DecodeScale( pFrameData0 + frameDataOffset, trackSettings ) );
+            transform1.SetScale( DecodeScale( pFrameData1 + frameDataOffset, trackSettings ) );
+            frameDataOffset += 1;
+        }
+
+        //-------------------------------------------------------------------------
+
+        outTransform = Transform::Slerp( transform0, transform1, percentageThrough );
+        return pFrameData0 + frameDataOffset;
+    }
+
+    inline uint16_t const* AnimationClip::ReadCompressedFrameKeyFrame( uint16_t const* pFrameData, TrackCompressionSettings const& trackSettings, Transform& outTransform ) const
+    {
+        EE_ASSERT( pFrameData != nullptr );
+
+        // Rotation is always animated
+        outTransform.SetRotation( DecodeRotation( pFrameData ) );
+        pFrameData += 3;
+
+        //-------------------------------------------------------------------------
+
+        uint16_t const* pStaticData = m_compressedPoseData.data() + trackSettings.m_staticDataStartIndex;
+
+        if ( trackSettings.IsTranslationTrackStatic() )
+        {
+            outTransform.SetTranslation( DecodeTranslation( pStaticData, trackSettings ) );
+            pStaticData += 3;
+        }
+        else
+        {
+            outTransform.SetTranslation( DecodeTranslation( pFrameData, trackSettings ) );
+            pFrameData += 3;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( trackSettings.IsScaleTrackStatic() )
+        {
+            outTransform.SetScale( DecodeScale( pStaticData, trackSettings ) );
+        }
+        else
+        {
+            outTransform.SetScale( DecodeScale( pFrameData, trackSettings ) );
+            pFrameData += 1;
+        }
+
+        //-------------------------------------------------------------------------
+
+        return pFrameData;
+    }
+
+    //-------------------------------------------------------------------------
+
     inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
     {
         EE_ASSERT( toTime >= fromTime );
+        EE_ASSERT( m_eventIndex.m_maxEndTimes.size() == m_events.size() );
 
-        for ( auto const& pEvent : m_events )
+        // Skip all the events that end before the time range, the running max end times are sorted so we can binary search them
+        auto const firstEventIter = eastl::lower_bound( m_eventIndex.m_maxEndTimes.begin(), m_eventIndex.m_maxEndTimes.end(), fromTime.ToFloat() );
+        int32_t const numEvents = (int32_t) m_events.size();
+        for ( int32_t i = (int32_t) ( firstEventIter - m_eventIndex.m_maxEndTimes.begin() ); i < numEvents; i++ )
         {
+            Event const* pEvent = m_events[i];
+
             // Events are stored sorted by time so as soon as we reach an event after the end of the time range, we're done
             if ( pEvent->GetStartTime() > toTime )
             {
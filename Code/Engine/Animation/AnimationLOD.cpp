@@ -0,0 +1,160 @@
+#include "AnimationLOD.h"
+#include "AnimationBlender.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    namespace LOD
+    {
+        static bool g_isEnabled = true;
+
+        static LODTierSettings const g_tierSettings[(int32_t) LODTier::NumTiers] =
+        {
+            { 15.0f, 1, Skeleton::LOD::High },
+            { 40.0f, 2, Skeleton::LOD::Low },
+            { FLT_MAX, 4, Skeleton::LOD::Low },
+            { FLT_MAX, 8, Skeleton::LOD::Low },
+        };
+
+        bool IsEnabled()
+        {
+            return g_isEnabled;
+        }
+
+        void SetEnabled( bool isEnabled )
+        {
+            g_isEnabled = isEnabled;
+        }
+
+        LODTierSettings const& GetTierSettings( LODTier tier )
+        {
+            EE_ASSERT( tier < LODTier::NumTiers );
+            return g_tierSettings[(int32_t) tier];
+        }
+
+        LODTier SelectTier( float distanceFromViewer, bool isInView )
+        {
+            if ( !g_isEnabled )
+            {
+                return LODTier::High;
+            }
+
+            if ( !isInView )
+            {
+                return LODTier::Offscreen;
+            }
+
+            if ( distanceFromViewer < g_tierSettings[(int32_t) LODTier::High].m_maxDistance )
+            {
+                return LODTier::High;
+            }
+
+            if ( distanceFromViewer < g_tierSettings[(int32_t) LODTier::Medium].m_maxDistance )
+            {
+                return LODTier::Medium;
+            }
+
+            return LODTier::Low;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        char const* GetTierName( LODTier tier )
+        {
+            static char const* const tierNames[] = { "High", "Medium", "Low", "Offscreen" };
+            EE_ASSERT( tier < LODTier::NumTiers );
+            return tierNames[(int32_t) tier];
+        }
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
+    LODUpdateState::~LODUpdateState()
+    {
+        EE::Delete( m_pFromPose );
+        EE::Delete( m_pInterpolatedPose );
+    }
+
+    void LODUpdateState::SetTier( LODTier tier )
+    {
+        if ( tier == m_tier )
+        {
+            return;
+        }
+
+        m_tier = tier;
+
+        // Offset the next evaluation based on the seed, so that characters changing tier at the same time don't all update on the same frame
+        uint32_t const updateInterval = (uint32_t) LOD::GetTierSettings( m_tier ).m_updateInterval;
+        m_framesUntilEvaluation = int32_t( m_staggerSeed % updateInterval );
+    }
+
+    bool LODUpdateState::AdvanceFrame( Seconds deltaTime, Seconds& outEvaluationDeltaTime )
+    {
+        m_accumulatedTime += deltaTime;
+        m_wasEvaluatedThisFrame = ( m_framesUntilEvaluation <= 0 );
+
+        if ( m_wasEvaluatedThisFrame )
+        {
+            outEvaluationDeltaTime = m_accumulatedTime;
+            m_accumulatedTime = 0.0f;
+            m_framesUntilEvaluation = LOD::GetTierSettings( m_tier ).m_updateInterval - 1;
+        }
+        else
+        {
+            m_framesUntilEvaluation--;
+        }
+
+        return m_wasEvaluatedThisFrame;
+    }
+
+    void LODUpdateState::UpdatePose( Pose const* pEvaluatedPose )
+    {
+        EE_ASSERT( pEvaluatedPose != nullptr );
+
+        int32_t const updateInterval = LOD::GetTierSettings( m_tier ).m_updateInterval;
+
+        // Full rate characters use the evaluated pose directly
+        if ( updateInterval == 1 )
+        {
+            m_isInterpolating = false;
+            return;
+        }
+
+        // When switching to a reduced rate, the previous frame's pose was a full rate one, so we can start from the evaluated pose
+        if ( !m_isInterpolating )
+        {
+            if ( m_pInterpolatedPose == nullptr )
+            {
+                m_pFromPose = EE::New<Pose>( pEvaluatedPose->GetSkeleton() );
+                m_pInterpolatedPose = EE::New<Pose>( pEvaluatedPose->GetSkeleton() );
+            }
+
+            EE_ASSERT( pEvaluatedPose->GetSkeleton() == m_pInterpolatedPose->GetSkeleton() );
+            m_pInterpolatedPose->CopyFrom( pEvaluatedPose );
+            m_interpolationFrameIdx = m_interpolationLength = 1;
+            m_isInterpolating = true;
+            return;
+        }
+
+        // Start a new interpolation from the currently displayed pose
+        if ( m_wasEvaluatedThisFrame )
+        {
+            m_pFromPose->CopyFrom( m_pInterpolatedPose );
+            m_interpolationFrameIdx = 0;
+            m_interpolationLength = updateInterval;
+        }
+
+        // Nothing to do once we've reached the evaluated pose
+        if ( m_interpolationFrameIdx >= m_interpolationLength )
+        {
+            return;
+        }
+
+        m_interpolationFrameIdx++;
+        float const blendWeight = float( m_interpolationFrameIdx ) / m_interpolationLength;
+        Blender::Blend( m_pFromPose, pEvaluatedPose, blendWeight, nullptr, m_pInterpolatedPose );
+        m_pInterpolatedPose->CalculateGlobalTransforms();
+    }
+}
\ No newline at end of file
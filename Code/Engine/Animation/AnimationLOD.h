@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Engine/Animation/AnimationPose.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Animation LOD
+//-------------------------------------------------------------------------
+// Characters are bucketed into tiers based on their distance from the viewer and whether any of their meshes were in view.
+// Each tier defines how often the graph is evaluated and which skeleton LOD is sampled. For tiers that do not evaluate the
+// graph every frame, the pose for the in-between frames is interpolated from the previous displayed pose to the latest
+// evaluated pose, so reduced rate characters trail their graph by up to one update interval but move smoothly.
+
+namespace EE::Animation
+{
+    enum class LODTier : uint8_t
+    {
+        High = 0,
+        Medium,
+        Low,
+        Offscreen,
+
+        NumTiers
+    };
+
+    struct LODTierSettings
+    {
+        float                                   m_maxDistance = FLT_MAX;                // The max distance from the viewer for this tier (ignored for the offscreen tier)
+        int32_t                                 m_updateInterval = 1;                   // The graph is evaluated once every N frames
+        Skeleton::LOD                           m_skeletonLOD = Skeleton::LOD::High;    // The set of bones we sample
+    };
+
+    //-------------------------------------------------------------------------
+
+    namespace LOD
+    {
+        // Is the animation LOD enabled, if not all characters use the high tier
+        EE_ENGINE_API bool IsEnabled();
+
+        // Enable/disable the animation LOD
+        EE_ENGINE_API void SetEnabled( bool isEnabled );
+
+        // Get the settings for the specified tier
+        EE_ENGINE_API LODTierSettings const& GetTierSettings( LODTier tier );
+
+        // Select the tier for a character
+        EE_ENGINE_API LODTier SelectTier( float distanceFromViewer, bool isInView );
+
+        #if EE_DEVELOPMENT_TOOLS
+        EE_ENGINE_API char const* GetTierName( LODTier tier );
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Tracks the reduced rate graph evaluation for a single character and generates the interpolated pose for the frames in between
+    class EE_ENGINE_API LODUpdateState
+    {
+    public:
+
+        // The stagger seed is used to spread the updates of reduced rate characters across frames
+        LODUpdateState( uint32_t staggerSeed ) : m_staggerSeed( staggerSeed ) {}
+        LODUpdateState( LODUpdateState const& ) = delete;
+        LODUpdateState& operator=( LODUpdateState const& ) = delete;
+        ~LODUpdateState();
+
+        inline LODTier GetTier() const { return m_tier; }
+        void SetTier( LODTier tier );
+
+        inline Skeleton::LOD GetSkeletonLOD() const { return LOD::GetTierSettings( m_tier ).m_skeletonLOD; }
+
+        // Advance the schedule by a frame, returns whether the graph needs to be evaluated this frame.
+        // If so, the delta time to evaluate with (i.e. the time since the last evaluation) is returned
+        bool AdvanceFrame( Seconds deltaTime, Seconds& outEvaluationDeltaTime );
+
+        // Was the graph evaluated this frame
+        inline bool WasEvaluatedThisFrame() const { return m_wasEvaluatedThisFrame; }
+
+        // Update the interpolated pose, needs to be called each frame once the latest evaluated pose is available
+        // The interpolation poses are only allocated once the character first drops below the full rate tier
+        void UpdatePose( Pose const* pEvaluatedPose );
+
+        // Do we have an interpolated pose, if not the evaluated pose should be used as is
+        inline bool HasInterpolatedPose() const { return m_isInterpolating; }
+        inline Pose const* GetInterpolatedPose() const { EE_ASSERT( m_isInterpolating ); return m_pInterpolatedPose; }
+
+    private:
+
+        Pose*                                   m_pFromPose = nullptr;
+        Pose*                                   m_pInterpolatedPose = nullptr;
+        Seconds                                 m_accumulatedTime = 0.0f;
+        uint32_t                                m_staggerSeed = 0;
+        int32_t                                 m_framesUntilEvaluation = 0;
+        int32_t                                 m_interpolationFrameIdx = 0;
+        int32_t                                 m_interpolationLength = 1;
+        LODTier                                 m_tier = LODTier::High;
+        bool                                    m_wasEvaluatedThisFrame = false;
+        bool                                    m_isInterpolating = false;
+    };
+}
\ No newline at end of file
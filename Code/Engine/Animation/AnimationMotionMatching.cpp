@@ -0,0 +1,336 @@
+#include "AnimationMotionMatching.h"
+#include "Engine/Animation/AnimationSkeleton.h"
+#include "System/Math/Math.h"
+#include <eastl/sort.h>
+#include <xmmintrin.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    namespace
+    {
+        struct FeatureRange
+        {
+            int32_t     m_offset;
+            int32_t     m_numDimensions;
+        };
+
+        static FeatureRange const g_featureRanges[(int32_t) MotionMatchingFeature::NumFeatures] =
+        {
+            { MotionMatchingDatabase::s_trajectoryPositionOffset, MotionMatchingDatabase::s_numTrajectorySamples * 2 },
+            { MotionMatchingDatabase::s_trajectoryFacingOffset, MotionMatchingDatabase::s_numTrajectorySamples * 2 },
+            { MotionMatchingDatabase::s_footPositionOffset, 6 },
+            { MotionMatchingDatabase::s_footVelocityOffset, 6 },
+            { MotionMatchingDatabase::s_hipVelocityOffset, 3 },
+        };
+
+        EE_FORCE_INLINE float HorizontalSum( __m128 v )
+        {
+            __m128 const shuffled = _mm_shuffle_ps( v, v, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+            __m128 const sums = _mm_add_ps( v, shuffled );
+            __m128 const highSums = _mm_movehl_ps( sums, sums );
+            return _mm_cvtss_f32( _mm_add_ss( sums, highSums ) );
+        }
+
+        // Squared distance between two rows, the stride is always a multiple of 4
+        EE_FORCE_INLINE float CalculateSquaredDistance( float const* pA, float const* pB, int32_t stride )
+        {
+            __m128 sum = _mm_setzero_ps();
+            for ( int32_t i = 0; i < stride; i += 4 )
+            {
+                __m128 const delta = _mm_sub_ps( _mm_loadu_ps( pA + i ), _mm_loadu_ps( pB + i ) );
+                sum = _mm_add_ps( sum, _mm_mul_ps( delta, delta ) );
+            }
+
+            return HorizontalSum( sum );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool MotionMatchingDatabase::IsValid() const
+    {
+        if ( !m_skeleton.IsLoaded() || m_entries.empty() || m_stride == 0 )
+        {
+            return false;
+        }
+
+        for ( auto const& clip : m_clips )
+        {
+            if ( !clip.IsLoaded() )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    int32_t MotionMatchingDatabase::GetEntryIndex( int32_t clipIdx, Percentage percentageThrough ) const
+    {
+        EE_ASSERT( clipIdx >= 0 && clipIdx < m_clipFirstEntryIndices.size() );
+
+        // The last frames of each clip are not part of the database, so clamp to the last entry for the clip
+        int32_t const firstEntryIdx = m_clipFirstEntryIndices[clipIdx];
+        int32_t const endEntryIdx = ( clipIdx + 1 < (int32_t) m_clipFirstEntryIndices.size() ) ? m_clipFirstEntryIndices[clipIdx + 1] : (int32_t) m_entries.size();
+        EE_ASSERT( endEntryIdx > firstEntryIdx );
+
+        int32_t const frameIdx = (int32_t) GetClip( clipIdx )->GetFrameTime( percentageThrough.GetClamped( false ) ).GetNearestFrameIndex();
+        return Math::Min( firstEntryIdx + frameIdx, endEntryIdx - 1 );
+    }
+
+    Percentage MotionMatchingDatabase::GetEntryTime( int32_t entryIdx ) const
+    {
+        Entry const& entry = GetEntry( entryIdx );
+        AnimationClip const* pClip = GetClip( entry.m_clipIdx );
+        if ( pClip->IsSingleFrameAnimation() )
+        {
+            return Percentage( 0.0f );
+        }
+
+        return Percentage( float( entry.m_frameIdx ) / ( pClip->GetNumFrames() - 1 ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MotionMatchingDatabase::BuildQuery( int32_t currentEntryIdx, Trajectory const& desiredTrajectory, float* pOutQuery ) const
+    {
+        EE_ASSERT( pOutQuery != nullptr && m_stride > 0 );
+
+        // Pose features come from the current entry, without a current entry we use the mean pose (i.e. zero in normalized space)
+        if ( currentEntryIdx != InvalidIndex )
+        {
+            memcpy( pOutQuery, GetEntryFeatures( currentEntryIdx ), sizeof( float ) * m_stride );
+        }
+        else
+        {
+            memset( pOutQuery, 0, sizeof( float ) * m_stride );
+        }
+
+        // Replace the trajectory with the desired trajectory
+        for ( int32_t i = 0; i < s_numTrajectorySamples; i++ )
+        {
+            int32_t const positionDimIdx = s_trajectoryPositionOffset + ( i * 2 );
+            pOutQuery[positionDimIdx] = ( desiredTrajectory.m_positions[i].GetX() - m_featureMeans[positionDimIdx] ) * m_featureScales[positionDimIdx];
+            pOutQuery[positionDimIdx + 1] = ( desiredTrajectory.m_positions[i].GetY() - m_featureMeans[positionDimIdx + 1] ) * m_featureScales[positionDimIdx + 1];
+
+            int32_t const facingDimIdx = s_trajectoryFacingOffset + ( i * 2 );
+            pOutQuery[facingDimIdx] = ( desiredTrajectory.m_facingDirections[i].GetX() - m_featureMeans[facingDimIdx] ) * m_featureScales[facingDimIdx];
+            pOutQuery[facingDimIdx + 1] = ( desiredTrajectory.m_facingDirections[i].GetY() - m_featureMeans[facingDimIdx + 1] ) * m_featureScales[facingDimIdx + 1];
+        }
+    }
+
+    float MotionMatchingDatabase::CalculateCost( float const* pQuery, int32_t entryIdx ) const
+    {
+        EE_ASSERT( entryIdx >= 0 && entryIdx < m_entries.size() );
+        return CalculateSquaredDistance( pQuery, GetEntryFeatures( entryIdx ), m_stride );
+    }
+
+    float MotionMatchingDatabase::CalculateBlockLowerBoundCost( float const* pQuery, int32_t blockIdx ) const
+    {
+        float const* pMin = &m_blockBoundsMin[blockIdx * m_stride];
+        float const* pMax = &m_blockBoundsMax[blockIdx * m_stride];
+
+        // Distance from the query to the closest point in the block's bounds
+        __m128 const zero = _mm_setzero_ps();
+        __m128 sum = zero;
+        for ( int32_t i = 0; i < m_stride; i += 4 )
+        {
+            __m128 const query = _mm_loadu_ps( pQuery + i );
+            __m128 const below = _mm_sub_ps( _mm_loadu_ps( pMin + i ), query );
+            __m128 const above = _mm_sub_ps( query, _mm_loadu_ps( pMax + i ) );
+            __m128 const delta = _mm_max_ps( _mm_max_ps( below, above ), zero );
+            sum = _mm_add_ps( sum, _mm_mul_ps( delta, delta ) );
+        }
+
+        return HorizontalSum( sum );
+    }
+
+    MotionMatchingDatabase::SearchResult MotionMatchingDatabase::FindBestMatchBruteForce( float const* pQuery ) const
+    {
+        EE_ASSERT( pQuery != nullptr );
+
+        SearchResult result;
+        int32_t const numEntries = (int32_t) m_entries.size();
+        float const* pFeatures = m_features.data();
+        for ( int32_t i = 0; i < numEntries; i++ )
+        {
+            float const cost = CalculateSquaredDistance( pQuery, pFeatures, m_stride );
+            if ( cost < result.m_cost )
+            {
+                result.m_cost = cost;
+                result.m_entryIdx = i;
+            }
+
+            pFeatures += m_stride;
+        }
+
+        result.m_numEvaluatedEntries = numEntries;
+        return result;
+    }
+
+    MotionMatchingDatabase::SearchResult MotionMatchingDatabase::FindBestMatch( float const* pQuery, SearchResult const& initialResult, int32_t maxEvaluatedEntries, TVector<SearchBlock>& searchScratch ) const
+    {
+        EE_ASSERT( pQuery != nullptr && maxEvaluatedEntries > 0 );
+
+        SearchResult result = initialResult;
+        result.m_numEvaluatedEntries = 0;
+
+        // Gather all blocks that could contain a better match and sort them so the most promising blocks are evaluated first
+        //-------------------------------------------------------------------------
+
+        searchScratch.clear();
+
+        int32_t const numBlocks = GetNumBlocks();
+        for ( int32_t i = 0; i < numBlocks; i++ )
+        {
+            float const lowerBoundCost = CalculateBlockLowerBoundCost( pQuery, i );
+            if ( lowerBoundCost < result.m_cost )
+            {
+                searchScratch.push_back( { lowerBoundCost, i } );
+            }
+        }
+
+        eastl::sort( searchScratch.begin(), searchScratch.end(), [] ( SearchBlock const& a, SearchBlock const& b ) { return a.m_lowerBoundCost < b.m_lowerBoundCost; } );
+
+        // Evaluate the blocks until we run out of budget or no remaining block can beat the current best match
+        //-------------------------------------------------------------------------
+
+        int32_t const numEntries = (int32_t) m_entries.size();
+        for ( SearchBlock const& block : searchScratch )
+        {
+            if ( block.m_lowerBoundCost >= result.m_cost || result.m_numEvaluatedEntries >= maxEvaluatedEntries )
+            {
+                break;
+            }
+
+            int32_t const firstEntryIdx = block.m_blockIdx * s_blockSize;
+            int32_t const endEntryIdx = Math::Min( firstEntryIdx + s_blockSize, numEntries );
+            float const* pFeatures = GetEntryFeatures( firstEntryIdx );
+            for ( int32_t i = firstEntryIdx; i < endEntryIdx; i++ )
+            {
+                float const cost = CalculateSquaredDistance( pQuery, pFeatures, m_stride );
+                if ( cost < result.m_cost )
+                {
+                    result.m_cost = cost;
+                    result.m_entryIdx = i;
+                }
+
+                pFeatures += m_stride;
+            }
+
+            result.m_numEvaluatedEntries += ( endEntryIdx - firstEntryIdx );
+        }
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    void MotionMatchingDatabase::Build( TVector<Entry> const& entries, TVector<int32_t> const& clipFirstEntryIndices, TVector<float> const& rawFeatures, float const featureWeights[(int32_t) MotionMatchingFeature::NumFeatures] )
+    {
+        int32_t const numEntries = (int32_t) entries.size();
+        EE_ASSERT( numEntries > 0 && rawFeatures.size() == numEntries * s_numFeatureDimensions );
+
+        m_entries = entries;
+        m_clipFirstEntryIndices = clipFirstEntryIndices;
+        m_stride = ( s_numFeatureDimensions + 3 ) & ~3;
+
+        // Calculate the per-dimension mean and variance
+        //-------------------------------------------------------------------------
+
+        TVector<double> means( s_numFeatureDimensions, 0.0 );
+        TVector<double> variances( s_numFeatureDimensions, 0.0 );
+
+        for ( int32_t i = 0; i < numEntries; i++ )
+        {
+            for ( int32_t d = 0; d < s_numFeatureDimensions; d++ )
+            {
+                means[d] += rawFeatures[i * s_numFeatureDimensions + d];
+            }
+        }
+
+        for ( int32_t d = 0; d < s_numFeatureDimensions; d++ )
+        {
+            means[d] /= numEntries;
+        }
+
+        for ( int32_t i = 0; i < numEntries; i++ )
+        {
+            for ( int32_t d = 0; d < s_numFeatureDimensions; d++ )
+            {
+                double const delta = rawFeatures[i * s_numFeatureDimensions + d] - means[d];
+                variances[d] += delta * delta;
+            }
+        }
+
+        // Each feature group is scaled by the average standard deviation of its dimensions so that the relative scale within a group (i.e. x vs y) is preserved
+        //-------------------------------------------------------------------------
+
+        m_featureMeans.clear();
+        m_featureMeans.resize( m_stride, 0.0f );
+        m_featureScales.clear();
+        m_featureScales.resize( m_stride, 0.0f );
+
+        for ( int32_t d = 0; d < s_numFeatureDimensions; d++ )
+        {
+            m_featureMeans[d] = (float) means[d];
+        }
+
+        for ( int32_t f = 0; f < (int32_t) MotionMatchingFeature::NumFeatures; f++ )
+        {
+            FeatureRange const& range = g_featureRanges[f];
+
+            double groupVariance = 0.0;
+            for ( int32_t d = range.m_offset; d < range.m_offset + range.m_numDimensions; d++ )
+            {
+                groupVariance += variances[d] / numEntries;
+            }
+            groupVariance /= range.m_numDimensions;
+
+            float const groupStandardDeviation = Math::Sqrt( (float) groupVariance );
+            float const scale = ( groupStandardDeviation > Math::Epsilon ) ? featureWeights[f] / groupStandardDeviation : 0.0f;
+            for ( int32_t d = range.m_offset; d < range.m_offset + range.m_numDimensions; d++ )
+            {
+                m_featureScales[d] = scale;
+            }
+        }
+
+        // Normalize features
+        //-------------------------------------------------------------------------
+
+        m_features.clear();
+        m_features.resize( numEntries * m_stride, 0.0f );
+
+        for ( int32_t i = 0; i < numEntries; i++ )
+        {
+            for ( int32_t d = 0; d < s_numFeatureDimensions; d++ )
+            {
+                m_features[i * m_stride + d] = ( rawFeatures[i * s_numFeatureDimensions + d] - m_featureMeans[d] ) * m_featureScales[d];
+            }
+        }
+
+        // Calculate block bounds
+        //-------------------------------------------------------------------------
+
+        int32_t const numBlocks = GetNumBlocks();
+        m_blockBoundsMin.clear();
+        m_blockBoundsMin.resize( numBlocks * m_stride, FLT_MAX );
+        m_blockBoundsMax.clear();
+        m_blockBoundsMax.resize( numBlocks * m_stride, -FLT_MAX );
+
+        for ( int32_t i = 0; i < numEntries; i++ )
+        {
+            int32_t const blockIdx = i / s_blockSize;
+            for ( int32_t d = 0; d < m_stride; d++ )
+            {
+                float const value = m_features[i * m_stride + d];
+                m_blockBoundsMin[blockIdx * m_stride + d] = Math::Min( m_blockBoundsMin[blockIdx * m_stride + d], value );
+                m_blockBoundsMax[blockIdx * m_stride + d] = Math::Max( m_blockBoundsMax[blockIdx * m_stride + d], value );
+            }
+        }
+    }
+    #endif
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "System/Resource/IResource.h"
+#include "System/Resource/ResourcePtr.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/Math/Vector.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Motion Matching Database
+//-------------------------------------------------------------------------
+// A per-frame feature database built from a set of animation clips. Each frame of each clip is described by a fixed set of character space features
+// (the future root trajectory, the foot positions and velocities and the hip velocity) that are normalized per feature group and scaled by the feature weights.
+//
+// The normalized features are stored as a flat array of rows, each row is padded to a multiple of 4 floats so the cost can be evaluated 4 dimensions at a time.
+// Rows are grouped in fixed size blocks that store per-dimension bounds, the search uses the bounds to calculate a lower bound cost for each block and skips
+// any blocks that cannot contain a better match than the current best match.
+
+namespace EE::Animation
+{
+    enum class MotionMatchingFeature : uint8_t
+    {
+        TrajectoryPosition = 0,
+        TrajectoryFacing,
+        FootPosition,
+        FootVelocity,
+        HipVelocity,
+
+        NumFeatures
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API MotionMatchingDatabase : public Resource::IResource
+    {
+        EE_REGISTER_RESOURCE( 'mmdb', "Motion Matching Database" );
+        EE_SERIALIZE( m_skeleton, m_clips, m_clipFirstEntryIndices, m_entries, m_features, m_featureMeans, m_featureScales, m_blockBoundsMin, m_blockBoundsMax, m_stride );
+
+        friend class MotionMatchingDatabaseCompiler;
+        friend class MotionMatchingDatabaseLoader;
+
+    public:
+
+        constexpr static int32_t const s_numTrajectorySamples = 3;
+        constexpr static float const s_trajectorySampleTimes[s_numTrajectorySamples] = { 0.33f, 0.66f, 1.0f };
+        constexpr static int32_t const s_blockSize = 16;
+
+        // Raw feature layout
+        constexpr static int32_t const s_trajectoryPositionOffset = 0;
+        constexpr static int32_t const s_trajectoryFacingOffset = s_trajectoryPositionOffset + ( s_numTrajectorySamples * 2 );
+        constexpr static int32_t const s_footPositionOffset = s_trajectoryFacingOffset + ( s_numTrajectorySamples * 2 );
+        constexpr static int32_t const s_footVelocityOffset = s_footPositionOffset + 6;
+        constexpr static int32_t const s_hipVelocityOffset = s_footVelocityOffset + 6;
+        constexpr static int32_t const s_numFeatureDimensions = s_hipVelocityOffset + 3;
+
+        // A single frame in the database
+        struct Entry
+        {
+            EE_SERIALIZE( m_clipIdx, m_frameIdx );
+
+            Entry() = default;
+            Entry( int32_t clipIdx, int32_t frameIdx ) : m_clipIdx( clipIdx ), m_frameIdx( frameIdx ) {}
+
+            int32_t                                 m_clipIdx = InvalidIndex;
+            int32_t                                 m_frameIdx = InvalidIndex;
+        };
+
+        // The desired character space trajectory, only the horizontal components are used
+        struct Trajectory
+        {
+            Vector                                  m_positions[s_numTrajectorySamples];
+            Vector                                  m_facingDirections[s_numTrajectorySamples];
+        };
+
+        struct SearchResult
+        {
+            inline bool IsValid() const { return m_entryIdx != InvalidIndex; }
+
+            int32_t                                 m_entryIdx = InvalidIndex;
+            float                                   m_cost = FLT_MAX;
+            int32_t                                 m_numEvaluatedEntries = 0;
+        };
+
+        // Scratch memory used to order the blocks for a search, owned by the caller so that the database can be searched from multiple threads
+        struct SearchBlock
+        {
+            float                                   m_lowerBoundCost;
+            int32_t                                 m_blockIdx;
+        };
+
+    public:
+
+        virtual bool IsValid() const override;
+
+        inline Skeleton const* GetSkeleton() const { return m_skeleton.GetPtr(); }
+        inline int32_t GetNumClips() const { return (int32_t) m_clips.size(); }
+        inline AnimationClip const* GetClip( int32_t clipIdx ) const { EE_ASSERT( clipIdx >= 0 && clipIdx < m_clips.size() ); return m_clips[clipIdx].GetPtr(); }
+
+        inline int32_t GetNumEntries() const { return (int32_t) m_entries.size(); }
+        inline Entry const& GetEntry( int32_t entryIdx ) const { EE_ASSERT( entryIdx >= 0 && entryIdx < m_entries.size() ); return m_entries[entryIdx]; }
+        inline int32_t GetFeatureStride() const { return m_stride; }
+        inline int32_t GetNumBlocks() const { return (int32_t) ( m_entries.size() + s_blockSize - 1 ) / s_blockSize; }
+
+        // Get the entry for the frame closest to the specified time in a clip
+        int32_t GetEntryIndex( int32_t clipIdx, Percentage percentageThrough ) const;
+
+        // Get the clip time for an entry
+        Percentage GetEntryTime( int32_t entryIdx ) const;
+
+        // Search
+        //-------------------------------------------------------------------------
+
+        // Build a normalized query from the pose features of the current entry and a desired trajectory, the query needs space for 'GetFeatureStride()' floats
+        void BuildQuery( int32_t currentEntryIdx, Trajectory const& desiredTrajectory, float* pOutQuery ) const;
+
+        // Calculate the cost of a single entry for the supplied normalized query
+        float CalculateCost( float const* pQuery, int32_t entryIdx ) const;
+
+        // Evaluate every entry in the database
+        SearchResult FindBestMatchBruteForce( float const* pQuery ) const;
+
+        // Evaluate the blocks in order of their lower bound cost, skipping blocks that cannot beat the current best match.
+        // The search stops once 'maxEvaluatedEntries' entries have been evaluated and returns the best match found so far.
+        // The initial result (usually the currently playing entry) is returned if no better match is found.
+        SearchResult FindBestMatch( float const* pQuery, SearchResult const& initialResult, int32_t maxEvaluatedEntries, TVector<SearchBlock>& searchScratch ) const;
+
+        // Build
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Normalize the raw features (s_numFeatureDimensions floats per entry) and build the search data, the clips and skeleton are set separately
+        void Build( TVector<Entry> const& entries, TVector<int32_t> const& clipFirstEntryIndices, TVector<float> const& rawFeatures, float const featureWeights[(int32_t) MotionMatchingFeature::NumFeatures] );
+        #endif
+
+    private:
+
+        inline float const* GetEntryFeatures( int32_t entryIdx ) const { return &m_features[entryIdx * m_stride]; }
+        float CalculateBlockLowerBoundCost( float const* pQuery, int32_t blockIdx ) const;
+
+    private:
+
+        TResourcePtr<Skeleton>                      m_skeleton;
+        TVector<TResourcePtr<AnimationClip>>        m_clips;
+        TVector<int32_t>                            m_clipFirstEntryIndices;
+        TVector<Entry>                              m_entries;
+        TVector<float>                              m_features;         // Normalized features, 'm_stride' floats per entry
+        TVector<float>                              m_featureMeans;     // Per-dimension mean of the raw features
+        TVector<float>                              m_featureScales;    // Per-dimension scale (feature weight / group standard deviation), zero for padding
+        TVector<float>                              m_blockBoundsMin;   // Per-dimension normalized bounds, 'm_stride' floats per block
+        TVector<float>                              m_blockBoundsMax;
+        int32_t                                     m_stride = 0;
+    };
+}
@@ -1,4 +1,5 @@
 #include "AnimationPose.h"
+#include "AnimationPoseKernels.h"
 #include "System/Drawing/DebugDrawing.h"
 
 //-------------------------------------------------------------------------
@@ -104,6 +105,12 @@ namespace EE::Animation
         int32_t const numBones = m_pSkeleton->GetNumBones();
         m_globalTransforms.resize( numBones );
 
+        if ( PoseKernels::IsEnabled() )
+        {
+            PoseKernels::CalculateGlobalTransforms( m_pSkeleton->GetParentBoneIndices().data(), m_pSkeleton->GetDepthOrderedBoneIndices().data(), m_pSkeleton->GetDepthLevelOffsets().data(), m_pSkeleton->GetNumDepthLevels(), m_localTransforms.data(), m_globalTransforms.data() );
+            return;
+        }
+
         m_globalTransforms[0] = m_localTransforms[0];
         for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
         {
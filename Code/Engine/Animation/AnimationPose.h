@@ -16,6 +16,7 @@ namespace EE::Animation
     {
         friend class Blender;
         friend class AnimationClip;
+        friend class PoseBufferArena;
 
     public:
 
@@ -0,0 +1,578 @@
+#include "AnimationPoseKernels.h"
+#include "AnimationClip.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::PoseKernels
+{
+    // Toggled from the debug UI while the animation tasks are reading it on the workers
+    // No ordering is needed, both paths produce the same results (within tolerance) so a task switching mid-update is fine
+    static std::atomic<bool> g_isEnabled = true;
+
+    bool IsEnabled()
+    {
+        return g_isEnabled.load( std::memory_order_relaxed );
+    }
+
+    void SetEnabled( bool isEnabled )
+    {
+        g_isEnabled.store( isEnabled, std::memory_order_relaxed );
+    }
+
+    //-------------------------------------------------------------------------
+    // SoA Helpers
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct QuaternionSoA
+        {
+            __m128                              m_x;
+            __m128                              m_y;
+            __m128                              m_z;
+            __m128                              m_w;
+        };
+
+        // Per lane select: returns v1 where the mask is set, v0 otherwise
+        EE_FORCE_INLINE __m128 Select( __m128 v0, __m128 v1, __m128 mask )
+        {
+            return _mm_or_ps( _mm_andnot_ps( mask, v0 ), _mm_and_ps( mask, v1 ) );
+        }
+
+        EE_FORCE_INLINE __m128 Lerp( __m128 from, __m128 to, __m128 t )
+        {
+            return _mm_add_ps( _mm_mul_ps( _mm_sub_ps( to, from ), t ), from );
+        }
+
+        EE_FORCE_INLINE QuaternionSoA LoadRotations( Transform const* pTransforms[4] )
+        {
+            QuaternionSoA result = { pTransforms[0]->GetRotation(), pTransforms[1]->GetRotation(), pTransforms[2]->GetRotation(), pTransforms[3]->GetRotation() };
+            _MM_TRANSPOSE4_PS( result.m_x, result.m_y, result.m_z, result.m_w );
+            return result;
+        }
+
+        EE_FORCE_INLINE void StoreRotations( QuaternionSoA rotations, Quaternion outRotations[4] )
+        {
+            _MM_TRANSPOSE4_PS( rotations.m_x, rotations.m_y, rotations.m_z, rotations.m_w );
+            outRotations[0] = Quaternion( Vector( rotations.m_x ) );
+            outRotations[1] = Quaternion( Vector( rotations.m_y ) );
+            outRotations[2] = Quaternion( Vector( rotations.m_z ) );
+            outRotations[3] = Quaternion( Vector( rotations.m_w ) );
+        }
+
+        // Matches Quantization::EncodedQuaternion::ToQuaternion
+        EE_FORCE_INLINE QuaternionSoA DecodeRotations( uint16_t const* pData[4] )
+        {
+            static constexpr float const valueRangeMin = -Math::OneDivSqrtTwo;
+            static constexpr float const valueRangeLength = Math::OneDivSqrtTwo - valueRangeMin;
+            static constexpr float const rangeMultiplier15Bit = valueRangeLength / float( 0x7FFF );
+
+            __m128i const data0 = _mm_setr_epi32( pData[0][0], pData[1][0], pData[2][0], pData[3][0] );
+            __m128i const data1 = _mm_setr_epi32( pData[0][1], pData[1][1], pData[2][1], pData[3][1] );
+            __m128i const data2 = _mm_setr_epi32( pData[0][2], pData[1][2], pData[2][2], pData[3][2] );
+
+            __m128i const largestValueIndex = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( data0, 14 ), _mm_set1_epi32( 0x0002 ) ), _mm_srli_epi32( data1, 15 ) );
+
+            __m128i const valueMask = _mm_set1_epi32( 0x7FFF );
+            __m128 const multiplier = _mm_set1_ps( rangeMultiplier15Bit );
+            __m128 const rangeMin = _mm_set1_ps( valueRangeMin );
+            __m128 const a = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( data0, valueMask ) ), multiplier ), rangeMin );
+            __m128 const b = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( data1, valueMask ) ), multiplier ), rangeMin );
+            __m128 const c = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( data2 ), multiplier ), rangeMin );
+
+            __m128 const sum = _mm_add_ps( _mm_add_ps( _mm_mul_ps( a, a ), _mm_mul_ps( b, b ) ), _mm_mul_ps( c, c ) );
+            __m128 const d = _mm_sqrt_ps( _mm_max_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), sum ), _mm_setzero_ps() ) );
+
+            // Insert the reconstructed component at the largest value index
+            __m128 const isIndex0 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 0 ) ) );
+            __m128 const isIndex1 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 1 ) ) );
+            __m128 const isIndex2 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 2 ) ) );
+            __m128 const isIndex3 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 3 ) ) );
+
+            QuaternionSoA result;
+            result.m_x = Select( a, d, isIndex0 );
+            result.m_y = Select( Select( b, d, isIndex1 ), a, isIndex0 );
+            result.m_z = Select( Select( c, d, isIndex2 ), b, _mm_or_ps( isIndex0, isIndex1 ) );
+            result.m_w = Select( c, d, isIndex3 );
+            return result;
+        }
+
+        // Matches Quantization::DecodeFloat
+        EE_FORCE_INLINE __m128 DecodeFloats( __m128i encodedValues, __m128 rangeStart, __m128 rangeLength )
+        {
+            __m128 const normalizedValues = _mm_div_ps( _mm_cvtepi32_ps( encodedValues ), _mm_set1_ps( 65535.0f ) );
+            return _mm_add_ps( _mm_mul_ps( normalizedValues, rangeLength ), rangeStart );
+        }
+
+        // Matches Quaternion::SLerp
+        EE_FORCE_INLINE QuaternionSoA SLerp( QuaternionSoA const& from, QuaternionSoA const& to, __m128 t )
+        {
+            __m128 const one = _mm_set1_ps( 1.0f );
+            __m128 const oneMinusEpsilon = _mm_set1_ps( 1.0f - 0.00001f );
+
+            __m128 cosOmega = _mm_mul_ps( from.m_x, to.m_x );
+            cosOmega = _mm_add_ps( cosOmega, _mm_mul_ps( from.m_y, to.m_y ) );
+            cosOmega = _mm_add_ps( cosOmega, _mm_mul_ps( from.m_z, to.m_z ) );
+            cosOmega = _mm_add_ps( cosOmega, _mm_mul_ps( from.m_w, to.m_w ) );
+
+            // Ensure that we take the shortest path
+            __m128 const sign = Select( one, _mm_set1_ps( -1.0f ), _mm_cmplt_ps( cosOmega, _mm_setzero_ps() ) );
+            cosOmega = _mm_mul_ps( cosOmega, sign );
+
+            // Only slerp if the rotations are sufficiently different, otherwise lerp
+            __m128 const shouldSlerp = _mm_cmplt_ps( cosOmega, oneMinusEpsilon );
+
+            __m128 const sinOmega = _mm_sqrt_ps( _mm_sub_ps( one, _mm_mul_ps( cosOmega, cosOmega ) ) );
+            Vector const omega = Vector::ATan2( sinOmega, cosOmega );
+
+            __m128 const oneMinusT = _mm_sub_ps( one, t );
+            __m128 S0 = _mm_div_ps( Vector::Sin( _mm_mul_ps( oneMinusT, omega ) ), sinOmega );
+            __m128 S1 = _mm_div_ps( Vector::Sin( _mm_mul_ps( t, omega ) ), sinOmega );
+            S0 = Select( oneMinusT, S0, shouldSlerp );
+            S1 = _mm_mul_ps( Select( t, S1, shouldSlerp ), sign );
+
+            QuaternionSoA result;
+            result.m_x = _mm_add_ps( _mm_mul_ps( from.m_x, S0 ), _mm_mul_ps( to.m_x, S1 ) );
+            result.m_y = _mm_add_ps( _mm_mul_ps( from.m_y, S0 ), _mm_mul_ps( to.m_y, S1 ) );
+            result.m_z = _mm_add_ps( _mm_mul_ps( from.m_z, S0 ), _mm_mul_ps( to.m_z, S1 ) );
+            result.m_w = _mm_add_ps( _mm_mul_ps( from.m_w, S0 ), _mm_mul_ps( to.m_w, S1 ) );
+            return result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct TransformSoA
+        {
+            QuaternionSoA                       m_rotations;
+            __m128                              m_translationX;
+            __m128                              m_translationY;
+            __m128                              m_translationZ;
+            __m128                              m_scale;
+        };
+
+        EE_FORCE_INLINE TransformSoA LoadTransforms( Transform const* pTransforms[4] )
+        {
+            TransformSoA result;
+            result.m_rotations = LoadRotations( pTransforms );
+
+            __m128 translationW = pTransforms[3]->GetTranslation();
+            result.m_translationX = pTransforms[0]->GetTranslation();
+            result.m_translationY = pTransforms[1]->GetTranslation();
+            result.m_translationZ = pTransforms[2]->GetTranslation();
+            _MM_TRANSPOSE4_PS( result.m_translationX, result.m_translationY, result.m_translationZ, translationW );
+
+            result.m_scale = _mm_setr_ps( pTransforms[0]->GetScale(), pTransforms[1]->GetScale(), pTransforms[2]->GetScale(), pTransforms[3]->GetScale() );
+            return result;
+        }
+
+        EE_FORCE_INLINE void StoreTransforms( TransformSoA const& transforms, Transform* pOutTransforms[4], int32_t numLanes )
+        {
+            Quaternion rotations[4];
+            StoreRotations( transforms.m_rotations, rotations );
+
+            __m128 translation0 = transforms.m_translationX;
+            __m128 translation1 = transforms.m_translationY;
+            __m128 translation2 = transforms.m_translationZ;
+            __m128 translation3 = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS( translation0, translation1, translation2, translation3 );
+            Vector const translations[4] = { translation0, translation1, translation2, translation3 };
+
+            alignas( 16 ) float scales[4];
+            _mm_store_ps( scales, transforms.m_scale );
+
+            for ( int32_t i = 0; i < numLanes; i++ )
+            {
+                *pOutTransforms[i] = Transform( rotations[i], translations[i], scales[i] );
+            }
+        }
+
+        // Does any lane of the batch have a negative scale
+        EE_FORCE_INLINE bool HasNegativeScale( TransformSoA const& lhs, TransformSoA const& rhs )
+        {
+            return _mm_movemask_ps( _mm_cmplt_ps( _mm_min_ps( lhs.m_scale, rhs.m_scale ), _mm_setzero_ps() ) ) != 0;
+        }
+
+        // Matches the normal (i.e. non-negative scale) case of Transform::operator*=
+        EE_FORCE_INLINE TransformSoA Multiply( TransformSoA const& lhs, TransformSoA const& rhs )
+        {
+            QuaternionSoA const& L = lhs.m_rotations;
+            QuaternionSoA const& R = rhs.m_rotations;
+
+            TransformSoA result;
+
+            // Rotation - equivalent to Quaternion::operator*, i.e. the lhs rotation followed by the rhs rotation
+            QuaternionSoA& Q = result.m_rotations;
+            Q.m_x = _mm_sub_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( R.m_w, L.m_x ), _mm_mul_ps( R.m_x, L.m_w ) ), _mm_mul_ps( R.m_y, L.m_z ) ), _mm_mul_ps( R.m_z, L.m_y ) );
+            Q.m_y = _mm_add_ps( _mm_add_ps( _mm_sub_ps( _mm_mul_ps( R.m_w, L.m_y ), _mm_mul_ps( R.m_x, L.m_z ) ), _mm_mul_ps( R.m_y, L.m_w ) ), _mm_mul_ps( R.m_z, L.m_x ) );
+            Q.m_z = _mm_add_ps( _mm_sub_ps( _mm_add_ps( _mm_mul_ps( R.m_w, L.m_z ), _mm_mul_ps( R.m_x, L.m_y ) ), _mm_mul_ps( R.m_y, L.m_x ) ), _mm_mul_ps( R.m_z, L.m_w ) );
+            Q.m_w = _mm_sub_ps( _mm_sub_ps( _mm_sub_ps( _mm_mul_ps( R.m_w, L.m_w ), _mm_mul_ps( R.m_x, L.m_x ) ), _mm_mul_ps( R.m_y, L.m_y ) ), _mm_mul_ps( R.m_z, L.m_z ) );
+
+            __m128 lengthSq = _mm_mul_ps( Q.m_x, Q.m_x );
+            lengthSq = _mm_add_ps( lengthSq, _mm_mul_ps( Q.m_y, Q.m_y ) );
+            lengthSq = _mm_add_ps( lengthSq, _mm_mul_ps( Q.m_z, Q.m_z ) );
+            lengthSq = _mm_add_ps( lengthSq, _mm_mul_ps( Q.m_w, Q.m_w ) );
+            __m128 const invLength = _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( lengthSq ) );
+            Q.m_x = _mm_mul_ps( Q.m_x, invLength );
+            Q.m_y = _mm_mul_ps( Q.m_y, invLength );
+            Q.m_z = _mm_mul_ps( Q.m_z, invLength );
+            Q.m_w = _mm_mul_ps( Q.m_w, invLength );
+
+            // Translation - rotate the scaled lhs translation by the rhs rotation: v' = v + w*t + u x t, where t = 2 * ( u x v )
+            __m128 const vx = _mm_mul_ps( lhs.m_translationX, rhs.m_scale );
+            __m128 const vy = _mm_mul_ps( lhs.m_translationY, rhs.m_scale );
+            __m128 const vz = _mm_mul_ps( lhs.m_translationZ, rhs.m_scale );
+
+            __m128 tx = _mm_sub_ps( _mm_mul_ps( R.m_y, vz ), _mm_mul_ps( R.m_z, vy ) );
+            __m128 ty = _mm_sub_ps( _mm_mul_ps( R.m_z, vx ), _mm_mul_ps( R.m_x, vz ) );
+            __m128 tz = _mm_sub_ps( _mm_mul_ps( R.m_x, vy ), _mm_mul_ps( R.m_y, vx ) );
+            tx = _mm_add_ps( tx, tx );
+            ty = _mm_add_ps( ty, ty );
+            tz = _mm_add_ps( tz, tz );
+
+            result.m_translationX = _mm_add_ps( _mm_add_ps( vx, _mm_mul_ps( R.m_w, tx ) ), _mm_sub_ps( _mm_mul_ps( R.m_y, tz ), _mm_mul_ps( R.m_z, ty ) ) );
+            result.m_translationY = _mm_add_ps( _mm_add_ps( vy, _mm_mul_ps( R.m_w, ty ) ), _mm_sub_ps( _mm_mul_ps( R.m_z, tx ), _mm_mul_ps( R.m_x, tz ) ) );
+            result.m_translationZ = _mm_add_ps( _mm_add_ps( vz, _mm_mul_ps( R.m_w, tz ) ), _mm_sub_ps( _mm_mul_ps( R.m_x, ty ), _mm_mul_ps( R.m_y, tx ) ) );
+            result.m_translationX = _mm_add_ps( result.m_translationX, rhs.m_translationX );
+            result.m_translationY = _mm_add_ps( result.m_translationY, rhs.m_translationY );
+            result.m_translationZ = _mm_add_ps( result.m_translationZ, rhs.m_translationZ );
+
+            // Scale
+            result.m_scale = _mm_mul_ps( lhs.m_scale, rhs.m_scale );
+            return result;
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct DecodedTracks
+        {
+            QuaternionSoA                       m_rotations;
+            __m128                              m_translationX;
+            __m128                              m_translationY;
+            __m128                              m_translationZ;
+            __m128                              m_scale;
+        };
+
+        EE_FORCE_INLINE void DecodeFrame( EncodedTrackSample const* pSamples[4], bool useFrame1, DecodedTracks& outTracks )
+        {
+            uint16_t const* pRotations[4];
+            uint16_t const* pTranslations[4];
+            uint16_t const* pScales[4];
+            for ( int32_t i = 0; i < 4; i++ )
+            {
+                pRotations[i] = useFrame1 ? pSamples[i]->m_pRotation1 : pSamples[i]->m_pRotation0;
+                pTranslations[i] = useFrame1 ? pSamples[i]->m_pTranslation1 : pSamples[i]->m_pTranslation0;
+                pScales[i] = useFrame1 ? pSamples[i]->m_pScale1 : pSamples[i]->m_pScale0;
+            }
+
+            outTracks.m_rotations = DecodeRotations( pRotations );
+
+            #define EE_GATHER_SETTING( member ) _mm_setr_ps( pSamples[0]->m_pSettings->member, pSamples[1]->m_pSettings->member, pSamples[2]->m_pSettings->member, pSamples[3]->m_pSettings->member )
+            outTracks.m_translationX = DecodeFloats( _mm_setr_epi32( pTranslations[0][0], pTranslations[1][0], pTranslations[2][0], pTranslations[3][0] ), EE_GATHER_SETTING( m_translationRangeX.m_rangeStart ), EE_GATHER_SETTING( m_translationRangeX.m_rangeLength ) );
+            outTracks.m_translationY = DecodeFloats( _mm_setr_epi32( pTranslations[0][1], pTranslations[1][1], pTranslations[2][1], pTranslations[3][1] ), EE_GATHER_SETTING( m_translationRangeY.m_rangeStart ), EE_GATHER_SETTING( m_translationRangeY.m_rangeLength ) );
+            outTracks.m_translationZ = DecodeFloats( _mm_setr_epi32( pTranslations[0][2], pTranslations[1][2], pTranslations[2][2], pTranslations[3][2] ), EE_GATHER_SETTING( m_translationRangeZ.m_rangeStart ), EE_GATHER_SETTING( m_translationRangeZ.m_rangeLength ) );
+            outTracks.m_scale = DecodeFloats( _mm_setr_epi32( pScales[0][0], pScales[1][0], pScales[2][0], pScales[3][0] ), EE_GATHER_SETTING( m_scaleRange.m_rangeStart ), EE_GATHER_SETTING( m_scaleRange.m_rangeLength ) );
+            #undef EE_GATHER_SETTING
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Decoding
+    //-------------------------------------------------------------------------
+
+    void DecodeTracks( EncodedTrackSample const* pSamples, int32_t numSamples, float percentageThrough, bool interpolate, Transform* pOutTransforms )
+    {
+        EE_ASSERT( pSamples != nullptr && pOutTransforms != nullptr );
+        EE_ASSERT( percentageThrough >= 0.0f && percentageThrough <= 1.0f );
+
+        __m128 const t = _mm_set1_ps( percentageThrough );
+
+        for ( int32_t sampleIdx = 0; sampleIdx < numSamples; sampleIdx += 4 )
+        {
+            // Pad incomplete batches by repeating the last sample
+            int32_t const numLanes = Math::Min( 4, numSamples - sampleIdx );
+            EncodedTrackSample const* pLaneSamples[4];
+            for ( int32_t i = 0; i < 4; i++ )
+            {
+                pLaneSamples[i] = &pSamples[sampleIdx + Math::Min( i, numLanes - 1 )];
+            }
+
+            //-------------------------------------------------------------------------
+
+            DecodedTracks result;
+            DecodeFrame( pLaneSamples, false, result );
+
+            if ( interpolate )
+            {
+                DecodedTracks frame1;
+                DecodeFrame( pLaneSamples, true, frame1 );
+
+                result.m_rotations = SLerp( result.m_rotations, frame1.m_rotations, t );
+                result.m_translationX = Lerp( result.m_translationX, frame1.m_translationX, t );
+                result.m_translationY = Lerp( result.m_translationY, frame1.m_translationY, t );
+                result.m_translationZ = Lerp( result.m_translationZ, frame1.m_translationZ, t );
+                result.m_scale = Lerp( result.m_scale, frame1.m_scale, t );
+            }
+
+            //-------------------------------------------------------------------------
+
+            Quaternion rotations[4];
+            StoreRotations( result.m_rotations, rotations );
+
+            alignas( 16 ) float translationX[4], translationY[4], translationZ[4], scales[4];
+            _mm_store_ps( translationX, result.m_translationX );
+            _mm_store_ps( translationY, result.m_translationY );
+            _mm_store_ps( translationZ, result.m_translationZ );
+            _mm_store_ps( scales, result.m_scale );
+
+            for ( int32_t i = 0; i < numLanes; i++ )
+            {
+                pOutTransforms[sampleIdx + i] = Transform( rotations[i], Vector( translationX[i], translationY[i], translationZ[i], 0.0f ), scales[i] );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Blending
+    //-------------------------------------------------------------------------
+
+    static void BlendLocalBatch( Transform const* pSource, Transform const* pTarget, __m128 blendWeights, Transform* pResult, int32_t numTransforms )
+    {
+        EE_ASSERT( numTransforms > 0 && numTransforms <= 4 );
+
+        // Pad incomplete batches by repeating the last transform
+        Transform const* pSourceLanes[4];
+        Transform const* pTargetLanes[4];
+        for ( int32_t i = 0; i < 4; i++ )
+        {
+            int32_t const laneIdx = Math::Min( i, numTransforms - 1 );
+            pSourceLanes[i] = &pSource[laneIdx];
+            pTargetLanes[i] = &pTarget[laneIdx];
+        }
+
+        Quaternion rotations[4];
+        StoreRotations( SLerp( LoadRotations( pSourceLanes ), LoadRotations( pTargetLanes ), blendWeights ), rotations );
+
+        // Translation and scale are already 4-wide per transform, so blend them in place
+        alignas( 16 ) float weights[4];
+        _mm_store_ps( weights, blendWeights );
+
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            // Match the scalar blender and copy fully weighted transforms as is
+            if ( weights[i] == 0.0f )
+            {
+                pResult[i] = pSource[i];
+                continue;
+            }
+
+            if ( weights[i] == 1.0f )
+            {
+                pResult[i] = pTarget[i];
+                continue;
+            }
+
+            Vector const translation = Vector::Lerp( pSource[i].GetTranslation(), pTarget[i].GetTranslation(), weights[i] );
+            float const scale = Math::Lerp( pSource[i].GetScale(), pTarget[i].GetScale(), weights[i] );
+            pResult[i] = Transform( rotations[i], translation, scale );
+        }
+    }
+
+    void BlendLocal( Transform const* pSource, Transform const* pTarget, float blendWeight, Transform* pResult, int32_t numTransforms )
+    {
+        EE_ASSERT( pSource != nullptr && pTarget != nullptr && pResult != nullptr );
+        EE_ASSERT( blendWeight >= 0.0f && blendWeight <= 1.0f );
+
+        __m128 const blendWeights = _mm_set1_ps( blendWeight );
+        for ( int32_t i = 0; i < numTransforms; i += 4 )
+        {
+            BlendLocalBatch( &pSource[i], &pTarget[i], blendWeights, &pResult[i], Math::Min( 4, numTransforms - i ) );
+        }
+    }
+
+    void BlendLocal( Transform const* pSource, Transform const* pTarget, float const* pBlendWeights, Transform* pResult, int32_t numTransforms )
+    {
+        EE_ASSERT( pSource != nullptr && pTarget != nullptr && pResult != nullptr && pBlendWeights != nullptr );
+
+        for ( int32_t i = 0; i < numTransforms; i += 4 )
+        {
+            int32_t const numLanes = Math::Min( 4, numTransforms - i );
+            __m128 const blendWeights = _mm_setr_ps( pBlendWeights[i], pBlendWeights[i + Math::Min( 1, numLanes - 1 )], pBlendWeights[i + Math::Min( 2, numLanes - 1 )], pBlendWeights[i + Math::Min( 3, numLanes - 1 )] );
+            BlendLocalBatch( &pSource[i], &pTarget[i], blendWeights, &pResult[i], numLanes );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Hierarchy
+    //-------------------------------------------------------------------------
+
+    void CalculateDepthOrdering( TVector<int32_t> const& parentIndices, TVector<int32_t>& outBoneIndices, TVector<int32_t>& outLevelOffsets )
+    {
+        int32_t const numBones = (int32_t) parentIndices.size();
+
+        // Calculate the depth of each bone and the number of bones per level
+        TInlineVector<int32_t, 256> boneDepths;
+        boneDepths.resize( numBones );
+
+        outLevelOffsets.clear();
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = parentIndices[boneIdx];
+            EE_ASSERT( parentIdx < boneIdx );
+            boneDepths[boneIdx] = ( parentIdx == InvalidIndex ) ? 0 : boneDepths[parentIdx] + 1;
+
+            if ( boneDepths[boneIdx] >= (int32_t) outLevelOffsets.size() )
+            {
+                outLevelOffsets.emplace_back( 0 );
+            }
+            outLevelOffsets[boneDepths[boneIdx]]++;
+        }
+
+        // Convert the counts to offsets and add the end entry
+        int32_t offset = 0;
+        for ( int32_t& levelOffset : outLevelOffsets )
+        {
+            int32_t const numBonesInLevel = levelOffset;
+            levelOffset = offset;
+            offset += numBonesInLevel;
+        }
+        outLevelOffsets.emplace_back( offset );
+
+        // Bucket the bones, this keeps the original bone order within each level
+        TInlineVector<int32_t, 32> nextLevelEntry( outLevelOffsets.begin(), outLevelOffsets.end() - 1 );
+        outBoneIndices.resize( numBones );
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            outBoneIndices[nextLevelEntry[boneDepths[boneIdx]]++] = boneIdx;
+        }
+    }
+
+    void CalculateGlobalTransforms( int32_t const* pParentIndices, int32_t const* pDepthOrderedBoneIndices, int32_t const* pLevelOffsets, int32_t numLevels, Transform const* pLocalTransforms, Transform* pGlobalTransforms )
+    {
+        EE_ASSERT( pParentIndices != nullptr && pDepthOrderedBoneIndices != nullptr && pLevelOffsets != nullptr );
+        EE_ASSERT( pLocalTransforms != nullptr && pGlobalTransforms != nullptr && pLocalTransforms != pGlobalTransforms );
+
+        if ( numLevels == 0 )
+        {
+            return;
+        }
+
+        // The root level has no parents
+        for ( int32_t i = pLevelOffsets[0]; i < pLevelOffsets[1]; i++ )
+        {
+            int32_t const boneIdx = pDepthOrderedBoneIndices[i];
+            pGlobalTransforms[boneIdx] = pLocalTransforms[boneIdx];
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t levelIdx = 1; levelIdx < numLevels; levelIdx++ )
+        {
+            int32_t const levelEnd = pLevelOffsets[levelIdx + 1];
+            for ( int32_t i = pLevelOffsets[levelIdx]; i < levelEnd; i += 4 )
+            {
+                // Pad incomplete batches by repeating the last bone
+                int32_t const numLanes = Math::Min( 4, levelEnd - i );
+                Transform const* pLocalLanes[4];
+                Transform const* pParentLanes[4];
+                Transform* pResultLanes[4];
+                for ( int32_t lane = 0; lane < 4; lane++ )
+                {
+                    int32_t const boneIdx = pDepthOrderedBoneIndices[i + Math::Min( lane, numLanes - 1 )];
+                    EE_ASSERT( pParentIndices[boneIdx] != InvalidIndex );
+                    pLocalLanes[lane] = &pLocalTransforms[boneIdx];
+                    pParentLanes[lane] = &pGlobalTransforms[pParentIndices[boneIdx]];
+                    pResultLanes[lane] = &pGlobalTransforms[boneIdx];
+                }
+
+                TransformSoA const local = LoadTransforms( pLocalLanes );
+                TransformSoA const parent = LoadTransforms( pParentLanes );
+
+                if ( HasNegativeScale( local, parent ) )
+                {
+                    for ( int32_t lane = 0; lane < numLanes; lane++ )
+                    {
+                        *pResultLanes[lane] = *pLocalLanes[lane] * *pParentLanes[lane];
+                    }
+                }
+                else
+                {
+                    StoreTransforms( Multiply( local, parent ), pResultLanes, numLanes );
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Skinning
+    //-------------------------------------------------------------------------
+
+    void CalculateSkinningTransforms( Transform const* pInverseBindPose, Transform const* pBoneTransforms, Matrix* pOutSkinningTransforms, int32_t numBones )
+    {
+        EE_ASSERT( pInverseBindPose != nullptr && pBoneTransforms != nullptr && pOutSkinningTransforms != nullptr );
+
+        __m128 const one = _mm_set1_ps( 1.0f );
+
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx += 4 )
+        {
+            // Pad incomplete batches by repeating the last bone
+            int32_t const numLanes = Math::Min( 4, numBones - boneIdx );
+            Transform const* pInverseBindLanes[4];
+            Transform const* pBoneLanes[4];
+            for ( int32_t lane = 0; lane < 4; lane++ )
+            {
+                int32_t const laneBoneIdx = boneIdx + Math::Min( lane, numLanes - 1 );
+                pInverseBindLanes[lane] = &pInverseBindPose[laneBoneIdx];
+                pBoneLanes[lane] = &pBoneTransforms[laneBoneIdx];
+            }
+
+            TransformSoA const inverseBind = LoadTransforms( pInverseBindLanes );
+            TransformSoA const bone = LoadTransforms( pBoneLanes );
+
+            if ( HasNegativeScale( inverseBind, bone ) )
+            {
+                for ( int32_t lane = 0; lane < numLanes; lane++ )
+                {
+                    pOutSkinningTransforms[boneIdx + lane] = ( pInverseBindPose[boneIdx + lane] * pBoneTransforms[boneIdx + lane] ).ToMatrix();
+                }
+                continue;
+            }
+
+            TransformSoA const skinning = Multiply( inverseBind, bone );
+
+            // Convert to matrices, matches Matrix::SetRotation followed by the per row scale
+            QuaternionSoA const& Q = skinning.m_rotations;
+            __m128 const x2 = _mm_add_ps( Q.m_x, Q.m_x );
+            __m128 const y2 = _mm_add_ps( Q.m_y, Q.m_y );
+            __m128 const z2 = _mm_add_ps( Q.m_z, Q.m_z );
+            __m128 const xx = _mm_mul_ps( Q.m_x, x2 );
+            __m128 const yy = _mm_mul_ps( Q.m_y, y2 );
+            __m128 const zz = _mm_mul_ps( Q.m_z, z2 );
+            __m128 const xy = _mm_mul_ps( Q.m_x, y2 );
+            __m128 const xz = _mm_mul_ps( Q.m_x, z2 );
+            __m128 const yz = _mm_mul_ps( Q.m_y, z2 );
+            __m128 const wx = _mm_mul_ps( Q.m_w, x2 );
+            __m128 const wy = _mm_mul_ps( Q.m_w, y2 );
+            __m128 const wz = _mm_mul_ps( Q.m_w, z2 );
+            __m128 const s = skinning.m_scale;
+
+            __m128 rows[4][4] =
+            {
+                { _mm_mul_ps( _mm_sub_ps( one, _mm_add_ps( yy, zz ) ), s ), _mm_mul_ps( _mm_add_ps( xy, wz ), s ), _mm_mul_ps( _mm_sub_ps( xz, wy ), s ), _mm_setzero_ps() },
+                { _mm_mul_ps( _mm_sub_ps( xy, wz ), s ), _mm_mul_ps( _mm_sub_ps( one, _mm_add_ps( xx, zz ) ), s ), _mm_mul_ps( _mm_add_ps( yz, wx ), s ), _mm_setzero_ps() },
+                { _mm_mul_ps( _mm_add_ps( xz, wy ), s ), _mm_mul_ps( _mm_sub_ps( yz, wx ), s ), _mm_mul_ps( _mm_sub_ps( one, _mm_add_ps( xx, yy ) ), s ), _mm_setzero_ps() },
+                { skinning.m_translationX, skinning.m_translationY, skinning.m_translationZ, one },
+            };
+
+            // Each row is stored per component, so transpose to get that row for each of the 4 matrices
+            for ( int32_t rowIdx = 0; rowIdx < 4; rowIdx++ )
+            {
+                _MM_TRANSPOSE4_PS( rows[rowIdx][0], rows[rowIdx][1], rows[rowIdx][2], rows[rowIdx][3] );
+                for ( int32_t lane = 0; lane < numLanes; lane++ )
+                {
+                    pOutSkinningTransforms[boneIdx + lane][rowIdx] = rows[rowIdx][lane];
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Math/Transform.h"
+#include "System/Math/SIMD.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Pose Kernels
+//-------------------------------------------------------------------------
+// Batched SIMD kernels for the hot parts of pose sampling and blending.
+// These process 4 bones per iteration in a SoA layout (i.e. all X components in one register, all Y in another, etc...)
+//
+// The scalar code paths (AnimationClip::ReadCompressed* and the templated Blender functions) are kept as the reference
+// implementation, and can be switched to at runtime to validate the results of these kernels.
+
+namespace EE::Animation
+{
+    struct TrackCompressionSettings;
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::PoseKernels
+{
+    // Are the SIMD kernels enabled, if not we use the scalar reference implementations
+    EE_ENGINE_API bool IsEnabled();
+
+    // Switch between the SIMD kernels and the scalar reference implementations
+    EE_ENGINE_API void SetEnabled( bool isEnabled );
+
+    //-------------------------------------------------------------------------
+
+    // Pointers to the encoded data needed to sample a single track, for static tracks both frames point to the same data
+    struct EncodedTrackSample
+    {
+        uint16_t const*                         m_pRotation0 = nullptr;
+        uint16_t const*                         m_pRotation1 = nullptr;
+        uint16_t const*                         m_pTranslation0 = nullptr;
+        uint16_t const*                         m_pTranslation1 = nullptr;
+        uint16_t const*                         m_pScale0 = nullptr;
+        uint16_t const*                         m_pScale1 = nullptr;
+        TrackCompressionSettings const*         m_pSettings = nullptr;
+    };
+
+    // Decode a set of track samples and interpolate between the two frames, if 'interpolate' is false only frame 0 is decoded
+    EE_ENGINE_API void DecodeTracks( EncodedTrackSample const* pSamples, int32_t numSamples, float percentageThrough, bool interpolate, Transform* pOutTransforms );
+
+    // Local space interpolative blend for a set of transforms, using either a single weight or per-transform weights
+    // Transforms with a weight of exactly 0 or 1 are copied from the source or target. The result may alias either input.
+    EE_ENGINE_API void BlendLocal( Transform const* pSource, Transform const* pTarget, float blendWeight, Transform* pResult, int32_t numTransforms );
+    EE_ENGINE_API void BlendLocal( Transform const* pSource, Transform const* pTarget, float const* pBlendWeights, Transform* pResult, int32_t numTransforms );
+
+    //-------------------------------------------------------------------------
+
+    // Sort a bone hierarchy by depth so that all the parents of a level are in the previous levels, the parent indices need to be topologically sorted
+    // 'outLevelOffsets' contains the first entry of each level in 'outBoneIndices' followed by an end entry (i.e. it has numLevels + 1 entries)
+    EE_ENGINE_API void CalculateDepthOrdering( TVector<int32_t> const& parentIndices, TVector<int32_t>& outBoneIndices, TVector<int32_t>& outLevelOffsets );
+
+    // Calculate the global transforms for a local pose, each depth level is processed in batches since all the parents are already calculated
+    // Batches containing a negative scale use the scalar transform multiplication
+    EE_ENGINE_API void CalculateGlobalTransforms( int32_t const* pParentIndices, int32_t const* pDepthOrderedBoneIndices, int32_t const* pLevelOffsets, int32_t numLevels, Transform const* pLocalTransforms, Transform* pGlobalTransforms );
+
+    // Calculate the skinning matrices (inverse bind pose * bone transform) for a set of bones into a contiguous matrix palette
+    EE_ENGINE_API void CalculateSkinningTransforms( Transform const* pInverseBindPose, Transform const* pBoneTransforms, Matrix* pOutSkinningTransforms, int32_t numBones );
+}
\ No newline at end of file
@@ -7,7 +7,7 @@ namespace EE::Animation
 {
     bool Skeleton::IsValid() const
     {
-        return !m_boneIDs.empty() && ( m_boneIDs.size() == m_parentIndices.size() ) && ( m_boneIDs.size() == m_localReferencePose.size() );
+        return !m_boneIDs.empty() && ( m_boneIDs.size() == m_parentIndices.size() ) && ( m_boneIDs.size() == m_localReferencePose.size() ) && ( m_boneIDs.size() == m_boneFlags.size() );
     }
 
     Transform Skeleton::GetBoneGlobalTransform( int32_t idx ) const
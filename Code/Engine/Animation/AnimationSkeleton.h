@@ -18,6 +18,7 @@ namespace EE::Animation
     enum class BoneFlags
     {
         None,
+        HighLOD,    // Only sampled at the high LOD (e.g. fingers, facial bones), at lower LODs the reference pose is used
     };
 
     //-------------------------------------------------------------------------
@@ -30,6 +31,15 @@ namespace EE::Animation
         friend class SkeletonCompiler;
         friend class SkeletonLoader;
 
+    public:
+
+        // The set of bones that should be sampled
+        enum class LOD : uint8_t
+        {
+            Low = 0,    // Skip all bones flagged as high LOD
+            High,       // All bones
+        };
+
     public:
 
         virtual bool IsValid() const final;
@@ -72,6 +82,24 @@ namespace EE::Animation
             return m_boneIDs[idx];
         }
 
+        // Is this bone only sampled at the high LOD
+        EE_FORCE_INLINE bool IsHighLODBone( int32_t idx ) const
+        {
+            EE_ASSERT( IsValidBoneIndex( idx ) );
+            return m_boneFlags[idx].IsFlagSet( BoneFlags::HighLOD );
+        }
+
+        // Does this skeleton have any bones that are skipped at the low LOD
+        inline bool HasHighLODBones() const { return m_numHighLODBones > 0; }
+
+        // Get the bone indices sorted by hierarchy depth, all the parents of the bones in a level are in the previous levels
+        inline TVector<int32_t> const& GetDepthOrderedBoneIndices() const { return m_depthOrderedBoneIndices; }
+
+        // Get the start of each depth level in the depth ordered bone indices, the last entry is the end of the final level
+        inline TVector<int32_t> const& GetDepthLevelOffsets() const { return m_depthLevelOffsets; }
+
+        inline int32_t GetNumDepthLevels() const { return (int32_t) m_depthLevelOffsets.size() - 1; }
+
         // Pose info
         //-------------------------------------------------------------------------
 
@@ -100,6 +128,9 @@ namespace EE::Animation
         TVector<Transform>                  m_localReferencePose;
         TVector<Transform>                  m_globalReferencePose;
         TVector<TBitFlags<BoneFlags>>       m_boneFlags;
+        TVector<int32_t>                    m_depthOrderedBoneIndices;
+        TVector<int32_t>                    m_depthLevelOffsets;
+        int32_t                             m_numHighLODBones = 0;
     };
 
     //-------------------------------------------------------------------------
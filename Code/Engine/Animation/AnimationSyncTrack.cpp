@@ -167,17 +167,25 @@ namespace EE::Animation
         }
         else // Search the sync track for the event and percent
         {
-            for ( auto syncEventIdx = 0; syncEventIdx < numSyncEvents; syncEventIdx++ )
+            // Sync events are contiguous so their end times are sorted, binary search for the first event whose end time (i.e. start time of next event) is greater than the playback percent
+            int32_t firstIdx = 0;
+            int32_t lastIdx = numSyncEvents - 1;
+            while ( firstIdx < lastIdx )
             {
-                // Find the first event whose end time (i.e. start time of next event) is greater than the playback percent
-                if ( ( m_syncEvents[syncEventIdx].m_startTime + m_syncEvents[syncEventIdx].m_duration ) >= percentageThrough )
+                int32_t const middleIdx = ( firstIdx + lastIdx ) / 2;
+                if ( ( m_syncEvents[middleIdx].m_startTime + m_syncEvents[middleIdx].m_duration ) >= percentageThrough )
                 {
-                    EE_ASSERT( m_syncEvents[syncEventIdx].m_duration > Math::Epsilon );
-                    time.m_eventIdx = syncEventIdx;
-                    time.m_percentageThrough = ( percentageThrough - m_syncEvents[syncEventIdx].m_startTime ) / m_syncEvents[syncEventIdx].m_duration;
-                    break;
+                    lastIdx = middleIdx;
+                }
+                else
+                {
+                    firstIdx = middleIdx + 1;
                 }
             }
+
+            EE_ASSERT( m_syncEvents[firstIdx].m_duration > Math::Epsilon );
+            time.m_eventIdx = firstIdx;
+            time.m_percentageThrough = ( percentageThrough - m_syncEvents[firstIdx].m_startTime ) / m_syncEvents[firstIdx].m_duration;
         }
 
         // Make sure we have found a valid event and percent through
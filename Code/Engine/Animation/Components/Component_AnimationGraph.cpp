@@ -22,10 +22,12 @@ namespace EE::Animation
 
         EE_ASSERT( m_pGraphVariation.IsLoaded() );
         m_pGraphInstance = EE::New<GraphInstance>( m_pGraphVariation.GetPtr(), GetEntityID().m_value );
+        m_pLODState = EE::New<LODUpdateState>( (uint32_t) GetEntityID().m_value );
     }
 
     void AnimationGraphComponent::Shutdown()
     {
+        EE::Delete( m_pLODState );
         EE::Delete( m_pGraphInstance );
         EntityComponent::Shutdown();
     }
@@ -48,6 +50,11 @@ namespace EE::Animation
 
     Pose const* AnimationGraphComponent::GetPose() const
     {
+        if ( m_pLODState->HasInterpolatedPose() )
+        {
+            return m_pLODState->GetInterpolatedPose();
+        }
+
         return m_pGraphInstance->GetPose();
     }
 
@@ -60,7 +67,7 @@ namespace EE::Animation
         m_rootMotionDelta = result.m_rootMotionDelta;
     }
 
-    void AnimationGraphComponent::ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform )
+    void AnimationGraphComponent::ExecutePrePhysicsTasks( Transform const& characterWorldTransform )
     {
         EE_ASSERT( HasGraph() );
         m_pGraphInstance->ExecutePrePhysicsPoseTasks( characterWorldTransform );
@@ -72,6 +79,49 @@ namespace EE::Animation
         m_pGraphInstance->ExecutePostPhysicsPoseTasks();
     }
 
+    void AnimationGraphComponent::SetSharedPoseBufferArena( PoseBufferArena* pArena )
+    {
+        if ( m_pGraphInstance != nullptr )
+        {
+            m_pGraphInstance->SetSharedPoseBufferArena( pArena );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationGraphComponent::SetLODEnabled( bool isEnabled )
+    {
+        if ( !isEnabled && HasGraph() )
+        {
+            SetLODTier( LODTier::High );
+        }
+
+        m_isLODEnabled = isEnabled;
+    }
+
+    void AnimationGraphComponent::SetLODTier( LODTier tier )
+    {
+        EE_ASSERT( HasGraph() && ( m_isLODEnabled || tier == LODTier::High ) );
+
+        if ( tier != m_pLODState->GetTier() )
+        {
+            m_pLODState->SetTier( tier );
+            m_pGraphInstance->SetSkeletonLOD( m_pLODState->GetSkeletonLOD() );
+        }
+    }
+
+    bool AnimationGraphComponent::UpdateLODSchedule( Seconds deltaTime, Seconds& outEvaluationDeltaTime )
+    {
+        EE_ASSERT( HasGraph() );
+        return m_pLODState->AdvanceFrame( deltaTime, outEvaluationDeltaTime );
+    }
+
+    void AnimationGraphComponent::UpdateLODPose()
+    {
+        EE_ASSERT( HasGraph() );
+        m_pLODState->UpdatePose( m_pGraphInstance->GetPose() );
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
@@ -3,6 +3,7 @@
 #include "Engine/Entity/EntityComponent.h"
 #include "Engine/Animation/Graph/Animation_RuntimeGraph_Definition.h"
 #include "Engine/Animation/Graph/Animation_RuntimeGraph_Instance.h"
+#include "Engine/Animation/AnimationLOD.h"
 
 //-------------------------------------------------------------------------
 
@@ -10,6 +11,7 @@ namespace EE::Animation
 {
     enum class TaskSystemDebugMode;
     enum class RootMotionDebugMode;
+    class PoseBufferArena;
 
     //-------------------------------------------------------------------------
 
@@ -48,6 +50,9 @@ namespace EE::Animation
         // Get the graph variation ID
         inline ResourceID const& GetGraphVariationID() const { return m_pGraphVariation.GetResourceID(); }
 
+        // Get the graph variation, only valid once the graph instance has been created
+        inline GraphVariation const* GetGraphVariation() const { EE_ASSERT( HasGraphInstance() ); return m_pGraphVariation.GetPtr(); }
+
         // This function will change the graph and data-set used! Note: this can only be called for unloaded components
         void SetGraphVariation( ResourceID graphResourceID );
 
@@ -61,11 +66,36 @@ namespace EE::Animation
         void EvaluateGraph( Seconds deltaTime, Transform const& characterWorldTransform, Physics::Scene* pPhysicsScene );
 
         // This function will execute all pre-physics tasks - it assumes that the character has already been moved in the scene, so expects the final transform for this frame
-        void ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform );
+        void ExecutePrePhysicsTasks( Transform const& characterWorldTransform );
 
         // The function will execute the post-physics tasks (if any)
         void ExecutePostPhysicsTasks();
 
+        // Lease the pose task buffers from a shared arena rather than owning them, set to null to revert to owned buffers
+        void SetSharedPoseBufferArena( PoseBufferArena* pArena );
+
+        // LOD
+        //-------------------------------------------------------------------------
+        // Note: components that require a manual update need to advance the schedule themselves and only evaluate the graph when requested
+
+        inline LODTier GetLODTier() const { return ( m_pLODState != nullptr ) ? m_pLODState->GetTier() : LODTier::High; }
+
+        // Is this component allowed to drop to a reduced LOD tier, disabled components are always evaluated at full rate (e.g. the player)
+        inline bool IsLODEnabled() const { return m_isLODEnabled; }
+        void SetLODEnabled( bool isEnabled );
+
+        // Set the LOD tier, this controls how often the graph is evaluated and which bones are sampled
+        void SetLODTier( LODTier tier );
+
+        // Advance the LOD update schedule, returns true if the graph should be evaluated this frame and the delta time to evaluate it with
+        bool UpdateLODSchedule( Seconds deltaTime, Seconds& outEvaluationDeltaTime );
+
+        // Was the graph evaluated this frame
+        inline bool WasEvaluatedThisFrame() const { return ( m_pLODState != nullptr ) ? m_pLODState->WasEvaluatedThisFrame() : true; }
+
+        // Update the interpolated pose for reduced rate LOD tiers, this needs to be called once the post-physics tasks have been executed
+        void UpdateLODPose();
+
         // Control Parameters
         //-------------------------------------------------------------------------
 
@@ -122,7 +152,7 @@ namespace EE::Animation
         void DrawDebug( Drawing::DrawContext& drawingContext );
 
         // Enable recording playback mode
-        void SwitchToRecordingPlaybackMode() { m_requiresManualUpdate = true; m_applyRootMotionToEntity = false; }
+        void SwitchToRecordingPlaybackMode() { m_requiresManualUpdate = true; m_applyRootMotionToEntity = false; SetLODEnabled( false ); }
         #endif
 
     protected:
@@ -135,10 +165,12 @@ namespace EE::Animation
         EE_EXPOSE TResourcePtr<GraphVariation>                  m_pGraphVariation = nullptr;
 
         GraphInstance*                                          m_pGraphInstance = nullptr;
+        LODUpdateState*                                         m_pLODState = nullptr;
         SampledEventsBuffer                                     m_sampledEventsBuffer;
         Transform                                               m_rootMotionDelta = Transform::Identity;
         EE_EXPOSE bool                                          m_requiresManualUpdate = false;  // Does this component require a manual update via a custom entity system?
         EE_EXPOSE bool                                          m_applyRootMotionToEntity = false; // Should we apply the root motion delta automatically to the character once we evaluate the graph. (Note: only works if we dont require a manual update)
         bool                                                    m_graphStateResetRequested = false;
+        bool                                                    m_isLODEnabled = true;
     };
 }
\ No newline at end of file
@@ -1,12 +1,21 @@
 #include "DebugView_Animation.h"
 #include "Engine/Animation/Systems/WorldSystem_Animation.h"
 #include "Engine/Animation/Graph/Animation_RuntimeGraph_Instance.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_InstanceTemplate.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "Engine/Animation/AnimationEvent.h"
+#include "Engine/Animation/AnimationPoseKernels.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/AnimationLOD.h"
+#include "Engine/Animation/AnimationMotionMatching.h"
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "System/Imgui/ImguiX.h"
 #include "System/Math/MathStringHelpers.h"
+#include "System/Time/Timers.h"
+#include "System/Math/MathRandom.h"
+#include "EASTL/sort.h"
+#include "EASTL/algorithm.h"
 
 //-------------------------------------------------------------------------
 
@@ -444,6 +453,790 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    AnimationDebugView::ValueGraphBenchmarkResults AnimationDebugView::RunValueGraphBenchmark( GraphVariation const* pGraphVariation, GraphInstance const* pSourceInstance, int32_t numInstances, int32_t numFrames )
+    {
+        EE_ASSERT( pGraphVariation != nullptr && pSourceInstance != nullptr && numInstances > 0 && numFrames > 0 );
+
+        ValueGraphBenchmarkResults results;
+        results.m_graphID = pGraphVariation->GetResourceID();
+        results.m_numInstances = numInstances;
+        results.m_numFrames = numFrames;
+        results.m_numCompiledNodes = (int32_t) pGraphVariation->GetDefinition()->GetValueGraphProgram().GetCompiledNodes().size();
+        results.m_numInstructions = pGraphVariation->GetDefinition()->GetValueGraphProgram().GetNumInstructions();
+        results.m_numSegments = pGraphVariation->GetDefinition()->GetValueGraphProgram().GetNumSegments();
+
+        //-------------------------------------------------------------------------
+
+        auto RunBenchmark = [&] ( bool useCompiledValueGraph, Milliseconds& outAverageFrameTime )
+        {
+            TVector<GraphInstance*> instances;
+            instances.reserve( numInstances );
+
+            // Create the instances and copy the source instance's current parameter values so that all instances take the same path through the graph
+            int32_t const numControlParameters = pSourceInstance->GetNumControlParameters();
+            for ( int32_t i = 0; i < numInstances; i++ )
+            {
+                GraphInstance* pInstance = instances.emplace_back( EE::New<GraphInstance>( pGraphVariation, (uint64_t) i, useCompiledValueGraph ) );
+                for ( int16_t parameterIdx = 0; parameterIdx < numControlParameters; parameterIdx++ )
+                {
+                    switch ( pInstance->GetControlParameterType( parameterIdx ) )
+                    {
+                        case GraphValueType::Bool: pInstance->SetControlParameterValue( parameterIdx, pSourceInstance->GetControlParameterValue<bool>( parameterIdx ) ); break;
+                        case GraphValueType::ID: pInstance->SetControlParameterValue( parameterIdx, pSourceInstance->GetControlParameterValue<StringID>( parameterIdx ) ); break;
+                        case GraphValueType::Int: pInstance->SetControlParameterValue( parameterIdx, pSourceInstance->GetControlParameterValue<int32_t>( parameterIdx ) ); break;
+                        case GraphValueType::Float: pInstance->SetControlParameterValue( parameterIdx, pSourceInstance->GetControlParameterValue<float>( parameterIdx ) ); break;
+                        case GraphValueType::Vector: pInstance->SetControlParameterValue( parameterIdx, pSourceInstance->GetControlParameterValue<Vector>( parameterIdx ) ); break;
+                        case GraphValueType::Target: pInstance->SetControlParameterValue( parameterIdx, pSourceInstance->GetControlParameterValue<Target>( parameterIdx ) ); break;
+                        default: break;
+                    }
+                }
+            }
+
+            // Evaluate all instances, the first frame initializes the graphs so it is excluded from the timing
+            Seconds const deltaTime = 1.0f / 30.0f;
+            for ( GraphInstance* pInstance : instances )
+            {
+                pInstance->EvaluateGraph( deltaTime, Transform::Identity, nullptr );
+            }
+
+            Milliseconds totalTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( totalTime );
+                for ( int32_t frame = 0; frame < numFrames; frame++ )
+                {
+                    for ( GraphInstance* pInstance : instances )
+                    {
+                        pInstance->EvaluateGraph( deltaTime, Transform::Identity, nullptr );
+                    }
+                }
+            }
+
+            outAverageFrameTime = totalTime.ToFloat() / numFrames;
+
+            for ( GraphInstance* pInstance : instances )
+            {
+                EE::Delete( pInstance );
+            }
+        };
+
+        RunBenchmark( true, results.m_compiledValueGraphTime );
+        RunBenchmark( false, results.m_nodeValueGraphTime );
+
+        return results;
+    }
+
+    AnimationDebugView::InstanceCreationBenchmarkResults AnimationDebugView::RunInstanceCreationBenchmark( GraphVariation const* pGraphVariation, int32_t numInstances )
+    {
+        EE_ASSERT( pGraphVariation != nullptr && numInstances > 0 );
+
+        InstanceCreationBenchmarkResults results;
+        results.m_graphID = pGraphVariation->GetResourceID();
+        results.m_numInstances = numInstances;
+
+        if ( pGraphVariation->GetInstanceTemplate() != nullptr )
+        {
+            auto const templateStats = pGraphVariation->GetInstanceTemplate()->GetStats();
+            results.m_numNodes = templateStats.m_numNodes;
+            results.m_numCopiedNodes = templateStats.m_numCopiedNodes;
+            results.m_numRelocations = templateStats.m_numRelocations;
+        }
+
+        //-------------------------------------------------------------------------
+
+        // The memory usage is the change in the total requested memory, so allocations from other threads will affect the result
+        auto RunBenchmark = [&] ( bool useInstanceTemplate, float& outCreationTimeUS, float& outMemoryPerInstance )
+        {
+            TVector<GraphInstance*> instances;
+            instances.reserve( numInstances );
+
+            size_t const memoryBefore = Memory::GetTotalRequestedMemory();
+
+            Milliseconds totalTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( totalTime );
+                for ( int32_t i = 0; i < numInstances; i++ )
+                {
+                    instances.emplace_back( EE::New<GraphInstance>( pGraphVariation, (uint64_t) i, true, useInstanceTemplate ) );
+                }
+            }
+
+            size_t const memoryAfter = Memory::GetTotalRequestedMemory();
+
+            outCreationTimeUS = totalTime.ToFloat() * 1000.0f / numInstances;
+            outMemoryPerInstance = ( memoryAfter > memoryBefore ) ? float( memoryAfter - memoryBefore ) / numInstances : 0.0f;
+
+            for ( GraphInstance* pInstance : instances )
+            {
+                EE::Delete( pInstance );
+            }
+        };
+
+        // The second template run reuses the node memory and task systems released by the first one
+        RunBenchmark( false, results.m_instantiatedCreationTimeUS, results.m_instantiatedMemoryPerInstance );
+        RunBenchmark( true, results.m_templateCreationTimeUS, results.m_templateMemoryPerInstance );
+        RunBenchmark( true, results.m_pooledTemplateCreationTimeUS, results.m_pooledTemplateMemoryPerInstance );
+
+        return results;
+    }
+
+    AnimationDebugView::MotionMatchingBenchmarkResult AnimationDebugView::RunMotionMatchingBenchmark( int32_t numEntries, int32_t numQueries, int32_t searchBudget )
+    {
+        EE_ASSERT( numEntries > 0 && numQueries > 0 && searchBudget > 0 );
+
+        MotionMatchingBenchmarkResult results;
+        results.m_numEntries = numEntries;
+        results.m_numQueries = numQueries;
+
+        // Generate a database from random walks, so that consecutive frames are similar as they would be for real clips
+        //-------------------------------------------------------------------------
+
+        constexpr int32_t const numFramesPerClip = 240;
+        Math::RNG rng( 12345 );
+
+        TVector<MotionMatchingDatabase::Entry> entries;
+        TVector<int32_t> clipFirstEntryIndices;
+        TVector<float> rawFeatures;
+        entries.reserve( numEntries );
+        rawFeatures.reserve( numEntries * MotionMatchingDatabase::s_numFeatureDimensions );
+
+        float features[MotionMatchingDatabase::s_numFeatureDimensions];
+        for ( int32_t i = 0; i < numEntries; i++ )
+        {
+            int32_t const frameIdx = i % numFramesPerClip;
+            if ( frameIdx == 0 )
+            {
+                clipFirstEntryIndices.emplace_back( i );
+                for ( float& feature : features )
+                {
+                    feature = rng.GetFloat( -1.0f, 1.0f );
+                }
+            }
+            else
+            {
+                for ( float& feature : features )
+                {
+                    feature += rng.GetFloat( -0.05f, 0.05f );
+                }
+            }
+
+            entries.emplace_back( (int32_t) clipFirstEntryIndices.size() - 1, frameIdx );
+            rawFeatures.insert( rawFeatures.end(), features, features + MotionMatchingDatabase::s_numFeatureDimensions );
+        }
+
+        float const featureWeights[(int32_t) MotionMatchingFeature::NumFeatures] = { 1.0f, 1.0f, 0.75f, 1.0f, 1.0f };
+        MotionMatchingDatabase database;
+        database.Build( entries, clipFirstEntryIndices, rawFeatures, featureWeights );
+
+        // Generate queries from random entries with random desired trajectories
+        //-------------------------------------------------------------------------
+
+        int32_t const stride = database.GetFeatureStride();
+        TVector<float> queries( numQueries * stride );
+        for ( int32_t q = 0; q < numQueries; q++ )
+        {
+            MotionMatchingDatabase::Trajectory trajectory;
+            for ( int32_t s = 0; s < MotionMatchingDatabase::s_numTrajectorySamples; s++ )
+            {
+                trajectory.m_positions[s] = Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), 0.0f );
+                trajectory.m_facingDirections[s] = Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), 0.0f );
+            }
+
+            database.BuildQuery( (int32_t) rng.GetUInt( 0, numEntries - 1 ), trajectory, &queries[q * stride] );
+        }
+
+        // Run searches
+        //-------------------------------------------------------------------------
+
+        TVector<MotionMatchingDatabase::SearchResult> bruteForceResults( numQueries );
+        TVector<MotionMatchingDatabase::SearchBlock> searchScratch;
+        int64_t numBoundedEntriesEvaluated = 0;
+        int32_t numBudgetedExactMatches = 0;
+
+        Milliseconds bruteForceTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( bruteForceTime );
+            for ( int32_t q = 0; q < numQueries; q++ )
+            {
+                bruteForceResults[q] = database.FindBestMatchBruteForce( &queries[q * stride] );
+            }
+        }
+
+        Milliseconds boundedTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( boundedTime );
+            for ( int32_t q = 0; q < numQueries; q++ )
+            {
+                MotionMatchingDatabase::SearchResult const result = database.FindBestMatch( &queries[q * stride], MotionMatchingDatabase::SearchResult(), INT_MAX, searchScratch );
+                EE_ASSERT( Math::IsNearEqual( result.m_cost, bruteForceResults[q].m_cost ) );
+                numBoundedEntriesEvaluated += result.m_numEvaluatedEntries;
+            }
+        }
+
+        Milliseconds budgetedTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( budgetedTime );
+            for ( int32_t q = 0; q < numQueries; q++ )
+            {
+                MotionMatchingDatabase::SearchResult const result = database.FindBestMatch( &queries[q * stride], MotionMatchingDatabase::SearchResult(), searchBudget, searchScratch );
+                if ( result.m_entryIdx == bruteForceResults[q].m_entryIdx )
+                {
+                    numBudgetedExactMatches++;
+                }
+            }
+        }
+
+        results.m_bruteForceQueryTimeUS = bruteForceTime.ToFloat() * 1000.0f / numQueries;
+        results.m_boundedQueryTimeUS = boundedTime.ToFloat() * 1000.0f / numQueries;
+        results.m_budgetedQueryTimeUS = budgetedTime.ToFloat() * 1000.0f / numQueries;
+        results.m_averageBoundedEntriesEvaluated = float( numBoundedEntriesEvaluated ) / numQueries;
+        results.m_budgetedExactMatchPercentage = 100.0f * numBudgetedExactMatches / numQueries;
+        return results;
+    }
+
+    AnimationDebugView::ClipLayoutBenchmarkResult AnimationDebugView::RunClipLayoutBenchmark( int32_t numBones, int32_t numClips, int32_t numFrames, int32_t numSamples )
+    {
+        EE_ASSERT( numBones > 0 && numClips > 0 && numFrames > 1 && numSamples > 0 );
+
+        ClipLayoutBenchmarkResult results;
+        results.m_numBones = numBones;
+        results.m_numClips = numClips;
+        results.m_numFrames = numFrames;
+        results.m_numSamples = numSamples;
+
+        Math::RNG rng( 24680 );
+
+        // Generate the encoded key-frames and write them out in both layouts the same way as the clip compiler
+        //-------------------------------------------------------------------------
+        // Every 4th track has a static translation and scale
+
+        static constexpr int32_t const s_encodedTransformSize = 7; // Rotation (3), Translation (3), Scale (1)
+
+        TVector<TrackCompressionSettings> trackSettings( numBones );
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            auto& settings = trackSettings[boneIdx];
+            settings.m_translationRangeX = QuantizationRange( -1.0f, 2.0f );
+            settings.m_translationRangeY = QuantizationRange( -1.0f, 2.0f );
+            settings.m_translationRangeZ = QuantizationRange( -1.0f, 2.0f );
+            settings.m_scaleRange = QuantizationRange( 0.5f, 1.0f );
+            settings.m_isTranslationStatic = settings.m_isScaleStatic = ( boneIdx % 4 ) == 3;
+        }
+
+        TVector<AnimationClip*> trackMajorClips;
+        TVector<AnimationClip*> frameMajorClips;
+        TVector<uint16_t> encodedTransforms( numFrames * numBones * s_encodedTransformSize );
+
+        for ( int32_t clipIdx = 0; clipIdx < numClips; clipIdx++ )
+        {
+            for ( int32_t i = 0; i < numFrames * numBones; i++ )
+            {
+                uint16_t* pEncodedTransform = &encodedTransforms[i * s_encodedTransformSize];
+
+                Quaternion const rotation = Quaternion( Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( 0.1f, 1.0f ) ) ).GetNormalized();
+                Quantization::EncodedQuaternion const encodedRotation( rotation );
+                pEncodedTransform[0] = encodedRotation.GetData0();
+                pEncodedTransform[1] = encodedRotation.GetData1();
+                pEncodedTransform[2] = encodedRotation.GetData2();
+
+                for ( int32_t j = 3; j < s_encodedTransformSize; j++ )
+                {
+                    pEncodedTransform[j] = (uint16_t) rng.GetUInt( 0, 0xFFFF );
+                }
+            }
+
+            auto GetEncodedTransform = [&] ( int32_t frameIdx, int32_t boneIdx ) { return &encodedTransforms[( frameIdx * numBones + boneIdx ) * s_encodedTransformSize]; };
+
+            // Track major
+            AnimationClip* pTrackMajorClip = trackMajorClips.emplace_back( EE::New<AnimationClip>() );
+            pTrackMajorClip->m_numFrames = numFrames;
+            pTrackMajorClip->m_dataLayout = AnimationClip::DataLayout::TrackMajor;
+            pTrackMajorClip->m_trackCompressionSettings = trackSettings;
+
+            auto& trackMajorData = pTrackMajorClip->m_compressedPoseData;
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                auto& settings = pTrackMajorClip->m_trackCompressionSettings[boneIdx];
+                settings.m_trackStartIndex = (uint32_t) trackMajorData.size();
+
+                int32_t const numTranslationFrames = settings.IsTranslationTrackStatic() ? 1 : numFrames;
+                int32_t const numScaleFrames = settings.IsScaleTrackStatic() ? 1 : numFrames;
+
+                for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+                {
+                    trackMajorData.insert( trackMajorData.end(), GetEncodedTransform( frameIdx, boneIdx ), GetEncodedTransform( frameIdx, boneIdx ) + 3 );
+                }
+
+                for ( int32_t frameIdx = 0; frameIdx < numTranslationFrames; frameIdx++ )
+                {
+                    trackMajorData.insert( trackMajorData.end(), GetEncodedTransform( frameIdx, boneIdx ) + 3, GetEncodedTransform( frameIdx, boneIdx ) + 6 );
+                }
+
+                for ( int32_t frameIdx = 0; frameIdx < numScaleFrames; frameIdx++ )
+                {
+                    trackMajorData.push_back( GetEncodedTransform( frameIdx, boneIdx )[6] );
+                }
+            }
+
+            // Frame major
+            AnimationClip* pFrameMajorClip = frameMajorClips.emplace_back( EE::New<AnimationClip>() );
+            pFrameMajorClip->m_numFrames = numFrames;
+            pFrameMajorClip->m_dataLayout = AnimationClip::DataLayout::FrameMajor;
+            pFrameMajorClip->m_trackCompressionSettings = trackSettings;
+
+            auto& frameMajorData = pFrameMajorClip->m_compressedPoseData;
+            uint32_t frameDataStride = 0;
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                auto& settings = pFrameMajorClip->m_trackCompressionSettings[boneIdx];
+                settings.m_staticDataStartIndex = (uint32_t) frameMajorData.size();
+                settings.m_trackStartIndex = frameDataStride;
+                frameDataStride += pFrameMajorClip->GetCompressedTrackDataSize( settings );
+
+                if ( settings.IsTranslationTrackStatic() )
+                {
+                    frameMajorData.insert( frameMajorData.end(), GetEncodedTransform( 0, boneIdx ) + 3, GetEncodedTransform( 0, boneIdx ) + 6 );
+                }
+
+                if ( settings.IsScaleTrackStatic() )
+                {
+                    frameMajorData.push_back( GetEncodedTransform( 0, boneIdx )[6] );
+                }
+            }
+
+            pFrameMajorClip->m_frameDataStartIndex = (uint32_t) frameMajorData.size();
+            pFrameMajorClip->m_frameDataStride = frameDataStride;
+
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    auto const& settings = trackSettings[boneIdx];
+                    uint16_t const* pEncodedTransform = GetEncodedTransform( frameIdx, boneIdx );
+                    frameMajorData.insert( frameMajorData.end(), pEncodedTransform, pEncodedTransform + 3 );
+
+                    if ( !settings.IsTranslationTrackStatic() )
+                    {
+                        frameMajorData.insert( frameMajorData.end(), pEncodedTransform + 3, pEncodedTransform + 6 );
+                    }
+
+                    if ( !settings.IsScaleTrackStatic() )
+                    {
+                        frameMajorData.push_back( pEncodedTransform[6] );
+                    }
+                }
+            }
+        }
+
+        // Generate random interpolated sample times across all clips so that most samples miss the cache
+        //-------------------------------------------------------------------------
+
+        struct SampleTime
+        {
+            int32_t                 m_clipIdx;
+            FrameTime               m_frameTime;
+        };
+
+        TVector<SampleTime> sampleTimes( numSamples );
+        for ( auto& sampleTime : sampleTimes )
+        {
+            sampleTime.m_clipIdx = (int32_t) rng.GetUInt( 0, numClips - 1 );
+            sampleTime.m_frameTime = FrameTime( rng.GetUInt( 0, numFrames - 2 ), Percentage( rng.GetFloat( 0.01f, 0.99f ) ) );
+        }
+
+        // Run benchmarks, these match the scalar sampling paths in AnimationClip::GetPose
+        //-------------------------------------------------------------------------
+
+        TVector<Transform> sampledTransforms( numBones );
+
+        Milliseconds trackMajorTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( trackMajorTime );
+            for ( auto const& sampleTime : sampleTimes )
+            {
+                AnimationClip const* pClip = trackMajorClips[sampleTime.m_clipIdx];
+                uint16_t const* pTrackData = pClip->m_compressedPoseData.data();
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    pTrackData = pClip->ReadCompressedTrackTransform( pTrackData, pClip->m_trackCompressionSettings[boneIdx], sampleTime.m_frameTime, sampledTransforms[boneIdx] );
+                }
+            }
+        }
+
+        Milliseconds frameMajorTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( frameMajorTime );
+            for ( auto const& sampleTime : sampleTimes )
+            {
+                AnimationClip const* pClip = frameMajorClips[sampleTime.m_clipIdx];
+                Percentage const percentageThrough = sampleTime.m_frameTime.GetPercentageThrough();
+                uint16_t const* pFrameData0 = pClip->GetCompressedFrameData( sampleTime.m_frameTime.GetFrameIndex() );
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    uint16_t const* pFrameData1 = pFrameData0 + pClip->m_frameDataStride;
+                    pFrameData0 = pClip->ReadCompressedFrameTransform( pFrameData0, pFrameData1, pClip->m_trackCompressionSettings[boneIdx], percentageThrough, sampledTransforms[boneIdx] );
+                }
+            }
+        }
+
+        // Count the distinct cache lines read for each sample
+        //-------------------------------------------------------------------------
+
+        TVector<uintptr_t> cacheLines;
+        auto AddCacheLines = [&cacheLines] ( uint16_t const* pData, int32_t numValues )
+        {
+            uintptr_t const firstLine = reinterpret_cast<uintptr_t>( pData ) / 64;
+            uintptr_t const lastLine = reinterpret_cast<uintptr_t>( pData + numValues - 1 ) / 64;
+            for ( uintptr_t line = firstLine; line <= lastLine; line++ )
+            {
+                cacheLines.emplace_back( line );
+            }
+        };
+
+        auto GetNumUniqueCacheLines = [&cacheLines] ()
+        {
+            eastl::sort( cacheLines.begin(), cacheLines.end() );
+            int32_t const numUniqueLines = (int32_t) ( eastl::unique( cacheLines.begin(), cacheLines.end() ) - cacheLines.begin() );
+            cacheLines.clear();
+            return numUniqueLines;
+        };
+
+        int64_t numTrackMajorCacheLines = 0;
+        int64_t numFrameMajorCacheLines = 0;
+        for ( auto const& sampleTime : sampleTimes )
+        {
+            uint32_t const frameIdx = sampleTime.m_frameTime.GetFrameIndex();
+
+            AnimationClip const* pTrackMajorClip = trackMajorClips[sampleTime.m_clipIdx];
+            for ( auto const& settings : pTrackMajorClip->m_trackCompressionSettings )
+            {
+                uint16_t const* pTrackData = pTrackMajorClip->m_compressedPoseData.data() + settings.m_trackStartIndex;
+                AddCacheLines( pTrackData + frameIdx * 3, 6 );
+                pTrackData += numFrames * 3;
+
+                AddCacheLines( settings.IsTranslationTrackStatic() ? pTrackData : pTrackData + frameIdx * 3, settings.IsTranslationTrackStatic() ? 3 : 6 );
+                pTrackData += settings.IsTranslationTrackStatic() ? 3 : numFrames * 3;
+
+                AddCacheLines( settings.IsScaleTrackStatic() ? pTrackData : pTrackData + frameIdx, settings.IsScaleTrackStatic() ? 1 : 2 );
+            }
+            numTrackMajorCacheLines += GetNumUniqueCacheLines();
+
+            AnimationClip const* pFrameMajorClip = frameMajorClips[sampleTime.m_clipIdx];
+            AddCacheLines( pFrameMajorClip->GetCompressedFrameData( frameIdx ), pFrameMajorClip->m_frameDataStride * 2 );
+            for ( auto const& settings : pFrameMajorClip->m_trackCompressionSettings )
+            {
+                int32_t const numStaticValues = ( settings.IsTranslationTrackStatic() ? 3 : 0 ) + ( settings.IsScaleTrackStatic() ? 1 : 0 );
+                if ( numStaticValues > 0 )
+                {
+                    AddCacheLines( pFrameMajorClip->m_compressedPoseData.data() + settings.m_staticDataStartIndex, numStaticValues );
+                }
+            }
+            numFrameMajorCacheLines += GetNumUniqueCacheLines();
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t clipIdx = 0; clipIdx < numClips; clipIdx++ )
+        {
+            EE::Delete( trackMajorClips[clipIdx] );
+            EE::Delete( frameMajorClips[clipIdx] );
+        }
+
+        float const numSampledBones = float( numSamples ) * numBones;
+        results.m_trackMajorTimePerBoneNS = trackMajorTime.ToFloat() * 1000000.0f / numSampledBones;
+        results.m_frameMajorTimePerBoneNS = frameMajorTime.ToFloat() * 1000000.0f / numSampledBones;
+        results.m_trackMajorCacheLinesPerSample = float( numTrackMajorCacheLines ) / numSamples;
+        results.m_frameMajorCacheLinesPerSample = float( numFrameMajorCacheLines ) / numSamples;
+        return results;
+    }
+
+    AnimationDebugView::PoseKernelBenchmarkResult AnimationDebugView::RunPoseKernelBenchmark( int32_t numBones, int32_t numCharacters )
+    {
+        EE_ASSERT( numBones > 1 && numCharacters > 0 );
+
+        PoseKernelBenchmarkResult results;
+        results.m_numBones = numBones;
+        results.m_numCharacters = numCharacters;
+
+        // Generate a random hierarchy, parents are picked from the previous few bones to get chains similar to a real skeleton
+        //-------------------------------------------------------------------------
+
+        Math::RNG rng( 12345 );
+
+        TVector<int32_t> parentIndices( numBones );
+        parentIndices[0] = InvalidIndex;
+        for ( int32_t i = 1; i < numBones; i++ )
+        {
+            parentIndices[i] = (int32_t) rng.GetUInt( Math::Max( 0, i - 4 ), i - 1 );
+        }
+
+        TVector<int32_t> depthOrderedBoneIndices;
+        TVector<int32_t> depthLevelOffsets;
+        PoseKernels::CalculateDepthOrdering( parentIndices, depthOrderedBoneIndices, depthLevelOffsets );
+        results.m_numDepthLevels = (int32_t) depthLevelOffsets.size() - 1;
+
+        auto GenerateRandomTransform = [&rng] ()
+        {
+            Quaternion const rotation = Quaternion( Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( 0.1f, 1.0f ) ) ).GetNormalized();
+            Vector const translation( rng.GetFloat( -0.5f, 0.5f ), rng.GetFloat( -0.5f, 0.5f ), rng.GetFloat( -0.5f, 0.5f ), 0.0f );
+            return Transform( rotation, translation, rng.GetFloat( 0.9f, 1.1f ) );
+        };
+
+        TVector<Transform> inverseBindPose( numBones );
+        for ( auto& transform : inverseBindPose )
+        {
+            transform = GenerateRandomTransform();
+        }
+
+        TVector<Transform> localTransforms( numBones * numCharacters );
+        for ( auto& transform : localTransforms )
+        {
+            transform = GenerateRandomTransform();
+        }
+
+        // Run benchmarks
+        //-------------------------------------------------------------------------
+
+        TVector<Transform> scalarGlobalTransforms( numBones * numCharacters );
+        TVector<Transform> simdGlobalTransforms( numBones * numCharacters );
+        TVector<Matrix> skinningTransforms( numBones * numCharacters );
+
+        Milliseconds scalarGlobalPoseTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( scalarGlobalPoseTime );
+            for ( int32_t c = 0; c < numCharacters; c++ )
+            {
+                Transform const* pLocal = &localTransforms[c * numBones];
+                Transform* pGlobal = &scalarGlobalTransforms[c * numBones];
+
+                pGlobal[0] = pLocal[0];
+                for ( int32_t boneIdx = 1; boneIdx < numBones; boneIdx++ )
+                {
+                    pGlobal[boneIdx] = pLocal[boneIdx] * pGlobal[parentIndices[boneIdx]];
+                }
+            }
+        }
+
+        Milliseconds simdGlobalPoseTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( simdGlobalPoseTime );
+            for ( int32_t c = 0; c < numCharacters; c++ )
+            {
+                PoseKernels::CalculateGlobalTransforms( parentIndices.data(), depthOrderedBoneIndices.data(), depthLevelOffsets.data(), results.m_numDepthLevels, &localTransforms[c * numBones], &simdGlobalTransforms[c * numBones] );
+            }
+        }
+
+        Milliseconds scalarSkinningTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( scalarSkinningTime );
+            for ( int32_t c = 0; c < numCharacters; c++ )
+            {
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    int32_t const idx = c * numBones + boneIdx;
+                    skinningTransforms[idx] = ( inverseBindPose[boneIdx] * scalarGlobalTransforms[idx] ).ToMatrix();
+                }
+            }
+        }
+
+        // Keep the scalar result around to validate the kernel
+        TVector<Matrix> const scalarSkinningTransforms = skinningTransforms;
+
+        Milliseconds simdSkinningTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( simdSkinningTime );
+            for ( int32_t c = 0; c < numCharacters; c++ )
+            {
+                PoseKernels::CalculateSkinningTransforms( inverseBindPose.data(), &scalarGlobalTransforms[c * numBones], &skinningTransforms[c * numBones], numBones );
+            }
+        }
+
+        // Validate
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < numBones * numCharacters; i++ )
+        {
+            float const translationError = scalarGlobalTransforms[i].GetTranslation().GetDistance3( simdGlobalTransforms[i].GetTranslation() );
+            results.m_maxError = Math::Max( results.m_maxError, translationError );
+
+            for ( uint32_t rowIdx = 0; rowIdx < 4; rowIdx++ )
+            {
+                float const rowError = ( scalarSkinningTransforms[i][rowIdx] - skinningTransforms[i][rowIdx] ).GetLength4();
+                results.m_maxError = Math::Max( results.m_maxError, rowError );
+            }
+        }
+
+        results.m_scalarGlobalPoseTimeUS = scalarGlobalPoseTime.ToFloat() * 1000.0f / numCharacters;
+        results.m_simdGlobalPoseTimeUS = simdGlobalPoseTime.ToFloat() * 1000.0f / numCharacters;
+        results.m_scalarSkinningTimeUS = scalarSkinningTime.ToFloat() * 1000.0f / numCharacters;
+        results.m_simdSkinningTimeUS = simdSkinningTime.ToFloat() * 1000.0f / numCharacters;
+        return results;
+    }
+
+    AnimationDebugView::PoseKernelValidationResult AnimationDebugView::RunPoseKernelValidation( int32_t numTransforms )
+    {
+        EE_ASSERT( numTransforms > 0 );
+
+        PoseKernelValidationResult results;
+        results.m_numTransforms = numTransforms;
+
+        Math::RNG rng( 54321 );
+
+        auto GenerateRandomRotation = [&rng] ()
+        {
+            return Quaternion( Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( 0.1f, 1.0f ) ) ).GetNormalized();
+        };
+
+        auto GenerateRandomTransform = [&] ()
+        {
+            Vector const translation( rng.GetFloat( -0.5f, 0.5f ), rng.GetFloat( -0.5f, 0.5f ), rng.GetFloat( -0.5f, 0.5f ), 0.0f );
+            return Transform( GenerateRandomRotation(), translation, rng.GetFloat( 0.9f, 1.1f ) );
+        };
+
+        // Quaternions are compared component-wise (accounting for double cover) since the angle is very imprecise for small differences
+        auto GetError = [] ( Transform const& reference, Transform const& result )
+        {
+            Vector const referenceRotation = reference.GetRotation().ToVector();
+            Vector const resultRotation = result.GetRotation().ToVector();
+            float const rotationError = Math::Min( ( referenceRotation - resultRotation ).GetLength4(), ( referenceRotation + resultRotation ).GetLength4() );
+            float const translationError = reference.GetTranslation().GetDistance3( result.GetTranslation() );
+            float const scaleError = Math::Abs( reference.GetScale() - result.GetScale() );
+            return Math::Max( rotationError, Math::Max( translationError, scaleError ) );
+        };
+
+        // Track decoding
+        //-------------------------------------------------------------------------
+        // Two encoded frames per track: [Rotation (3), Translation (3), Scale (1)], every 4th track has static translation and scale
+
+        static constexpr int32_t const s_frameDataSize = 7;
+
+        TVector<TrackCompressionSettings> trackSettings( numTransforms );
+        TVector<uint16_t> encodedData( numTransforms * s_frameDataSize * 2 );
+        TVector<PoseKernels::EncodedTrackSample> samples( numTransforms );
+
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            auto& settings = trackSettings[i];
+            settings.m_translationRangeX = QuantizationRange( rng.GetFloat( -2.0f, 0.0f ), rng.GetFloat( 0.1f, 4.0f ) );
+            settings.m_translationRangeY = QuantizationRange( rng.GetFloat( -2.0f, 0.0f ), rng.GetFloat( 0.1f, 4.0f ) );
+            settings.m_translationRangeZ = QuantizationRange( rng.GetFloat( -2.0f, 0.0f ), rng.GetFloat( 0.1f, 4.0f ) );
+            settings.m_scaleRange = QuantizationRange( 0.5f, 1.0f );
+
+            uint16_t* pTrackData = &encodedData[i * s_frameDataSize * 2];
+            for ( int32_t frameIdx = 0; frameIdx < 2; frameIdx++ )
+            {
+                uint16_t* pFrameData = pTrackData + frameIdx * s_frameDataSize;
+
+                Quantization::EncodedQuaternion const encodedRotation( GenerateRandomRotation() );
+                pFrameData[0] = encodedRotation.GetData0();
+                pFrameData[1] = encodedRotation.GetData1();
+                pFrameData[2] = encodedRotation.GetData2();
+
+                for ( int32_t j = 3; j < s_frameDataSize; j++ )
+                {
+                    pFrameData[j] = (uint16_t) rng.GetUInt( 0, 0xFFFF );
+                }
+            }
+
+            bool const isStatic = ( i % 4 ) == 3;
+            auto& sample = samples[i];
+            sample.m_pSettings = &settings;
+            sample.m_pRotation0 = pTrackData;
+            sample.m_pRotation1 = pTrackData + s_frameDataSize;
+            sample.m_pTranslation0 = pTrackData + 3;
+            sample.m_pTranslation1 = isStatic ? sample.m_pTranslation0 : sample.m_pTranslation0 + s_frameDataSize;
+            sample.m_pScale0 = pTrackData + 6;
+            sample.m_pScale1 = isStatic ? sample.m_pScale0 : sample.m_pScale0 + s_frameDataSize;
+        }
+
+        // Matches the scalar clip reading path
+        auto DecodeReference = [] ( uint16_t const* pRotation, uint16_t const* pTranslation, uint16_t const* pScale, TrackCompressionSettings const& settings )
+        {
+            Quaternion const rotation = Quantization::EncodedQuaternion( pRotation[0], pRotation[1], pRotation[2] ).ToQuaternion();
+            float const x = Quantization::DecodeFloat( pTranslation[0], settings.m_translationRangeX.m_rangeStart, settings.m_translationRangeX.m_rangeLength );
+            float const y = Quantization::DecodeFloat( pTranslation[1], settings.m_translationRangeY.m_rangeStart, settings.m_translationRangeY.m_rangeLength );
+            float const z = Quantization::DecodeFloat( pTranslation[2], settings.m_translationRangeZ.m_rangeStart, settings.m_translationRangeZ.m_rangeLength );
+            float const scale = Quantization::DecodeFloat( pScale[0], settings.m_scaleRange.m_rangeStart, settings.m_scaleRange.m_rangeLength );
+            return Transform( rotation, Vector( x, y, z, 0.0f ), scale );
+        };
+
+        TVector<Transform> decodedTransforms( numTransforms );
+
+        PoseKernels::DecodeTracks( samples.data(), numTransforms, 0.0f, false, decodedTransforms.data() );
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            auto const& sample = samples[i];
+            Transform const reference = DecodeReference( sample.m_pRotation0, sample.m_pTranslation0, sample.m_pScale0, *sample.m_pSettings );
+            results.m_maxDecodeError = Math::Max( results.m_maxDecodeError, GetError( reference, decodedTransforms[i] ) );
+        }
+
+        for ( float percentageThrough : { 0.0f, 0.25f, 0.5f, 0.9f, 1.0f } )
+        {
+            PoseKernels::DecodeTracks( samples.data(), numTransforms, percentageThrough, true, decodedTransforms.data() );
+            for ( int32_t i = 0; i < numTransforms; i++ )
+            {
+                auto const& sample = samples[i];
+                Transform const reference0 = DecodeReference( sample.m_pRotation0, sample.m_pTranslation0, sample.m_pScale0, *sample.m_pSettings );
+                Transform const reference1 = DecodeReference( sample.m_pRotation1, sample.m_pTranslation1, sample.m_pScale1, *sample.m_pSettings );
+                Transform const reference = Transform::Slerp( reference0, reference1, percentageThrough );
+                results.m_maxInterpolatedDecodeError = Math::Max( results.m_maxInterpolatedDecodeError, GetError( reference, decodedTransforms[i] ) );
+            }
+        }
+
+        // Local blending
+        //-------------------------------------------------------------------------
+
+        TVector<Transform> sourceTransforms( numTransforms );
+        TVector<Transform> targetTransforms( numTransforms );
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            sourceTransforms[i] = GenerateRandomTransform();
+
+            // Include some nearly identical rotations to cover the lerp fallback
+            targetTransforms[i] = GenerateRandomTransform();
+            if ( ( i % 5 ) == 4 )
+            {
+                targetTransforms[i].SetRotation( sourceTransforms[i].GetRotation() );
+            }
+        }
+
+        // Matches the scalar interpolative blender
+        auto BlendReference = [] ( Transform const& source, Transform const& target, float blendWeight )
+        {
+            return Transform( Quaternion::SLerp( source.GetRotation(), target.GetRotation(), blendWeight ), Vector::Lerp( source.GetTranslation(), target.GetTranslation(), blendWeight ), Math::Lerp( source.GetScale(), target.GetScale(), blendWeight ) );
+        };
+
+        TVector<Transform> blendedTransforms( numTransforms );
+        for ( float blendWeight : { 0.1f, 0.5f, 0.75f } )
+        {
+            PoseKernels::BlendLocal( sourceTransforms.data(), targetTransforms.data(), blendWeight, blendedTransforms.data(), numTransforms );
+            for ( int32_t i = 0; i < numTransforms; i++ )
+            {
+                Transform const reference = BlendReference( sourceTransforms[i], targetTransforms[i], blendWeight );
+                results.m_maxBlendError = Math::Max( results.m_maxBlendError, GetError( reference, blendedTransforms[i] ) );
+            }
+        }
+
+        // Per-bone weights including fully weighted bones, blended in place into the source to cover aliasing
+        TVector<float> blendWeights( numTransforms );
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            int32_t const weightType = i % 4;
+            blendWeights[i] = ( weightType == 0 ) ? 0.0f : ( weightType == 1 ) ? 1.0f : rng.GetFloat( 0.0f, 1.0f );
+        }
+
+        blendedTransforms = sourceTransforms;
+        PoseKernels::BlendLocal( blendedTransforms.data(), targetTransforms.data(), blendWeights.data(), blendedTransforms.data(), numTransforms );
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            Transform const reference = BlendReference( sourceTransforms[i], targetTransforms[i], blendWeights[i] );
+            results.m_maxPerBoneWeightBlendError = Math::Max( results.m_maxPerBoneWeightBlendError, GetError( reference, blendedTransforms[i] ) );
+        }
+
+        return results;
+    }
+
+    //-------------------------------------------------------------------------
+
     AnimationDebugView::AnimationDebugView()
     {
         m_menus.emplace_back( DebugMenu( "Engine/Animation", [this] ( EntityWorldUpdateContext const& context ) { DrawMenu( context ); } ) );
@@ -494,6 +1287,246 @@ namespace EE::Animation
 
     void AnimationDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
+        ImGuiX::TextSeparator( "Pose Kernels" );
+
+        bool useSIMDPoseKernels = PoseKernels::IsEnabled();
+        if ( ImGui::Checkbox( "Use SIMD Pose Kernels", &useSIMDPoseKernels ) )
+        {
+            PoseKernels::SetEnabled( useSIMDPoseKernels );
+        }
+
+        ImGuiX::TextSeparator( "Pose Tasks" );
+
+        PoseBufferArena::Stats const arenaStats = m_pAnimationWorldSystem->GetPoseBufferArena().GetStats();
+        ImGui::Text( "Characters Executed: %d", m_pAnimationWorldSystem->GetNumTaskExecutionsLastFrame() );
+        ImGui::Text( "Pose Buffers: %d allocated, %d in use, %d peak", arenaStats.m_numAllocatedBuffers, arenaStats.m_numBuffersInUse, arenaStats.m_peakBuffersInUse );
+        ImGui::Text( "Pose Buffer Memory: %.2f KB (%d size classes)", arenaStats.m_allocatedBytes / 1024.0f, arenaStats.m_numSizeClasses );
+
+        ImGuiX::TextSeparator( "Animation LOD" );
+
+        bool isLODEnabled = LOD::IsEnabled();
+        if ( ImGui::Checkbox( "Enable Animation LOD", &isLODEnabled ) )
+        {
+            LOD::SetEnabled( isLODEnabled );
+        }
+
+        int32_t numComponentsPerTier[(int32_t) LODTier::NumTiers] = { 0 };
+        for ( AnimationGraphComponent const* pGraphComponent : m_pAnimationWorldSystem->m_graphComponents )
+        {
+            numComponentsPerTier[(int32_t) pGraphComponent->GetLODTier()]++;
+        }
+
+        for ( int32_t i = 0; i < (int32_t) LODTier::NumTiers; i++ )
+        {
+            LODTierSettings const& tierSettings = LOD::GetTierSettings( (LODTier) i );
+            ImGui::Text( "%s: %d (Update Interval: %d)", LOD::GetTierName( (LODTier) i ), numComponentsPerTier[i], tierSettings.m_updateInterval );
+        }
+
+        ImGuiX::TextSeparator( "Value Graph Benchmark" );
+
+        if ( m_hasValueGraphBenchmarkResults )
+        {
+            auto const& results = m_valueGraphBenchmarkResults;
+            float const speedup = ( results.m_compiledValueGraphTime > 0.0f ) ? results.m_nodeValueGraphTime.ToFloat() / results.m_compiledValueGraphTime.ToFloat() : 0.0f;
+
+            ImGui::Text( "Graph: %s", results.m_graphID.c_str() );
+            ImGui::Text( "Instances: %d, Frames: %d, Compiled Nodes: %d, Instructions: %d, Segments: %d", results.m_numInstances, results.m_numFrames, results.m_numCompiledNodes, results.m_numInstructions, results.m_numSegments );
+            ImGui::Text( "Compiled Value Graph: %.3fms per frame", results.m_compiledValueGraphTime.ToFloat() );
+            ImGui::Text( "Node Value Graph: %.3fms per frame", results.m_nodeValueGraphTime.ToFloat() );
+            ImGui::Text( "Speedup: %.2fx", speedup );
+        }
+        else
+        {
+            ImGui::Text( "Run from a graph component's menu" );
+        }
+
+        ImGuiX::TextSeparator( "Instance Creation Benchmark" );
+
+        if ( m_hasInstanceCreationBenchmarkResults )
+        {
+            auto const& results = m_instanceCreationBenchmarkResults;
+
+            ImGui::Text( "Graph: %s", results.m_graphID.c_str() );
+            ImGui::Text( "Instances: %d, Nodes: %d, Copied Nodes: %d, Relocations: %d", results.m_numInstances, results.m_numNodes, results.m_numCopiedNodes, results.m_numRelocations );
+            ImGui::Text( "Instantiated: %.2fus, %.2f KB per instance", results.m_instantiatedCreationTimeUS, results.m_instantiatedMemoryPerInstance / 1024.0f );
+            ImGui::Text( "Template: %.2fus, %.2f KB per instance", results.m_templateCreationTimeUS, results.m_templateMemoryPerInstance / 1024.0f );
+            ImGui::Text( "Template (Pooled): %.2fus, %.2f KB per instance", results.m_pooledTemplateCreationTimeUS, results.m_pooledTemplateMemoryPerInstance / 1024.0f );
+        }
+        else
+        {
+            ImGui::Text( "Run from a graph component's menu" );
+        }
+
+        ImGuiX::TextSeparator( "Motion Matching Benchmark" );
+
+        if ( ImGui::MenuItem( "Run Search Benchmark" ) )
+        {
+            m_motionMatchingBenchmarkResults.clear();
+            for ( int32_t numEntries : { 1000, 10000, 50000, 100000 } )
+            {
+                m_motionMatchingBenchmarkResults.emplace_back( RunMotionMatchingBenchmark( numEntries, 200, 4096 ) );
+            }
+        }
+
+        if ( !m_motionMatchingBenchmarkResults.empty() && ImGui::BeginTable( "MotionMatchingBenchmarkTable", 6, ImGuiTableFlags_Borders ) )
+        {
+            ImGui::TableSetupColumn( "Entries" );
+            ImGui::TableSetupColumn( "Brute Force (us)" );
+            ImGui::TableSetupColumn( "Bounded (us)" );
+            ImGui::TableSetupColumn( "Bounded Evaluated" );
+            ImGui::TableSetupColumn( "Budgeted (us)" );
+            ImGui::TableSetupColumn( "Budgeted Exact (%)" );
+            ImGui::TableHeadersRow();
+
+            for ( auto const& result : m_motionMatchingBenchmarkResults )
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", result.m_numEntries );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_bruteForceQueryTimeUS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_boundedQueryTimeUS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.0f", result.m_averageBoundedEntriesEvaluated );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_budgetedQueryTimeUS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.1f", result.m_budgetedExactMatchPercentage );
+            }
+
+            ImGui::EndTable();
+        }
+
+        ImGuiX::TextSeparator( "Clip Layout Benchmark" );
+
+        if ( ImGui::MenuItem( "Run Clip Sampling Benchmark" ) )
+        {
+            m_clipLayoutBenchmarkResults.clear();
+            for ( int32_t numBones : { 30, 60, 120, 250 } )
+            {
+                m_clipLayoutBenchmarkResults.emplace_back( RunClipLayoutBenchmark( numBones, 8, 300, 2000 ) );
+            }
+        }
+
+        if ( !m_clipLayoutBenchmarkResults.empty() && ImGui::BeginTable( "ClipLayoutBenchmarkTable", 5, ImGuiTableFlags_Borders ) )
+        {
+            ImGui::TableSetupColumn( "Bones" );
+            ImGui::TableSetupColumn( "Track Major (ns/bone)" );
+            ImGui::TableSetupColumn( "Frame Major (ns/bone)" );
+            ImGui::TableSetupColumn( "Track Major Cache Lines" );
+            ImGui::TableSetupColumn( "Frame Major Cache Lines" );
+            ImGui::TableHeadersRow();
+
+            for ( auto const& result : m_clipLayoutBenchmarkResults )
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", result.m_numBones );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_trackMajorTimePerBoneNS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_frameMajorTimePerBoneNS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.1f", result.m_trackMajorCacheLinesPerSample );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.1f", result.m_frameMajorCacheLinesPerSample );
+            }
+
+            ImGui::EndTable();
+        }
+
+        ImGuiX::TextSeparator( "Pose Kernel Benchmark" );
+
+        if ( ImGui::MenuItem( "Run Global Pose and Skinning Benchmark" ) )
+        {
+            m_poseKernelBenchmarkResults.clear();
+            for ( int32_t numBones : { 60, 120, 180, 250 } )
+            {
+                m_poseKernelBenchmarkResults.emplace_back( RunPoseKernelBenchmark( numBones, 500 ) );
+            }
+        }
+
+        if ( !m_poseKernelBenchmarkResults.empty() && ImGui::BeginTable( "PoseKernelBenchmarkTable", 7, ImGuiTableFlags_Borders ) )
+        {
+            ImGui::TableSetupColumn( "Bones" );
+            ImGui::TableSetupColumn( "Levels" );
+            ImGui::TableSetupColumn( "Global Pose Scalar (us)" );
+            ImGui::TableSetupColumn( "Global Pose SIMD (us)" );
+            ImGui::TableSetupColumn( "Skinning Scalar (us)" );
+            ImGui::TableSetupColumn( "Skinning SIMD (us)" );
+            ImGui::TableSetupColumn( "Max Error" );
+            ImGui::TableHeadersRow();
+
+            for ( auto const& result : m_poseKernelBenchmarkResults )
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", result.m_numBones );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", result.m_numDepthLevels );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_scalarGlobalPoseTimeUS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_simdGlobalPoseTimeUS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_scalarSkinningTimeUS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_simdSkinningTimeUS );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.6f", result.m_maxError );
+            }
+
+            ImGui::EndTable();
+        }
+
+        ImGuiX::TextSeparator( "Pose Kernel Validation" );
+
+        if ( ImGui::MenuItem( "Validate Track Decoding and Blending" ) )
+        {
+            m_poseKernelValidationResults.clear();
+            for ( int32_t numTransforms : { 1, 7, 60, 250 } )
+            {
+                m_poseKernelValidationResults.emplace_back( RunPoseKernelValidation( numTransforms ) );
+            }
+        }
+
+        if ( !m_poseKernelValidationResults.empty() && ImGui::BeginTable( "PoseKernelValidationTable", 6, ImGuiTableFlags_Borders ) )
+        {
+            ImGui::TableSetupColumn( "Transforms" );
+            ImGui::TableSetupColumn( "Decode" );
+            ImGui::TableSetupColumn( "Decode Interpolated" );
+            ImGui::TableSetupColumn( "Blend" );
+            ImGui::TableSetupColumn( "Blend Per-Bone Weights" );
+            ImGui::TableSetupColumn( "Result" );
+            ImGui::TableHeadersRow();
+
+            for ( auto const& result : m_poseKernelValidationResults )
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", result.m_numTransforms );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.6f", result.m_maxDecodeError );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.6f", result.m_maxInterpolatedDecodeError );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.6f", result.m_maxBlendError );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.6f", result.m_maxPerBoneWeightBlendError );
+                ImGui::TableNextColumn();
+
+                bool const isWithinTolerance = result.GetMaxError() <= s_poseKernelValidationTolerance;
+                ImGui::TextColored( isWithinTolerance ? Colors::Lime.ToFloat4() : Colors::Red.ToFloat4(), isWithinTolerance ? "Pass" : "Fail" );
+            }
+
+            ImGui::EndTable();
+        }
+
+        ImGuiX::TextSeparator( "Graph Components" );
+
+        //-------------------------------------------------------------------------
+
         InlineString componentName;
         for ( AnimationGraphComponent* pGraphComponent : m_pAnimationWorldSystem->m_graphComponents )
         {
@@ -520,6 +1553,18 @@ namespace EE::Animation
                     pRuntimeSettings->m_drawSampledEvents = true;
                 }
 
+                if ( ImGui::MenuItem( "Run Value Graph Benchmark (500 Instances)", nullptr, false, pGraphComponent->m_pGraphInstance != nullptr ) )
+                {
+                    m_valueGraphBenchmarkResults = RunValueGraphBenchmark( pGraphComponent->m_pGraphVariation.GetPtr(), pGraphComponent->m_pGraphInstance, 500, 30 );
+                    m_hasValueGraphBenchmarkResults = true;
+                }
+
+                if ( ImGui::MenuItem( "Run Instance Creation Benchmark (500 Instances)", nullptr, false, pGraphComponent->m_pGraphVariation.IsLoaded() ) )
+                {
+                    m_instanceCreationBenchmarkResults = RunInstanceCreationBenchmark( pGraphComponent->m_pGraphVariation.GetPtr(), 500 );
+                    m_hasInstanceCreationBenchmarkResults = true;
+                }
+
                 //-------------------------------------------------------------------------
 
                 ImGuiX::TextSeparator( "Root Motion debug" );
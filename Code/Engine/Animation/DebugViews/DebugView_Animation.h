@@ -4,6 +4,7 @@
 #include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
 #include "Engine/Entity/EntityWorldDebugView.h"
 #include "Engine/Entity/EntityIDs.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
@@ -12,6 +13,7 @@ namespace EE::Animation
 {
     class AnimationWorldSystem;
     class GraphInstance;
+    class GraphVariation;
     class TaskSystem;
     class RootMotionDebugger;
 
@@ -33,6 +35,89 @@ namespace EE::Animation
             bool                    m_drawSampledEvents = false;
         };
 
+        // Average cost of a graph evaluation for a set of instances using the compiled value graph vs the regular node path
+        struct ValueGraphBenchmarkResults
+        {
+            ResourceID              m_graphID;
+            int32_t                 m_numInstances = 0;
+            int32_t                 m_numFrames = 0;
+            int32_t                 m_numCompiledNodes = 0;
+            int32_t                 m_numInstructions = 0;
+            int32_t                 m_numSegments = 0;
+            Milliseconds            m_compiledValueGraphTime = 0;
+            Milliseconds            m_nodeValueGraphTime = 0;
+        };
+
+        // Average creation cost of a graph instance when instantiating every node vs copying the variation's instance template (with empty and warm pools)
+        struct InstanceCreationBenchmarkResults
+        {
+            ResourceID              m_graphID;
+            int32_t                 m_numInstances = 0;
+            int32_t                 m_numNodes = 0;
+            int32_t                 m_numCopiedNodes = 0;
+            int32_t                 m_numRelocations = 0;
+            float                   m_instantiatedCreationTimeUS = 0.0f;
+            float                   m_templateCreationTimeUS = 0.0f;
+            float                   m_pooledTemplateCreationTimeUS = 0.0f;
+            float                   m_instantiatedMemoryPerInstance = 0.0f;
+            float                   m_templateMemoryPerInstance = 0.0f;
+            float                   m_pooledTemplateMemoryPerInstance = 0.0f;
+        };
+
+        // Average motion matching query latency for a randomly generated database, for a brute force search and a block bounded search with and without a budget
+        struct MotionMatchingBenchmarkResult
+        {
+            int32_t                 m_numEntries = 0;
+            int32_t                 m_numQueries = 0;
+            float                   m_bruteForceQueryTimeUS = 0.0f;
+            float                   m_boundedQueryTimeUS = 0.0f;
+            float                   m_budgetedQueryTimeUS = 0.0f;
+            float                   m_averageBoundedEntriesEvaluated = 0.0f;
+            float                   m_budgetedExactMatchPercentage = 0.0f;
+        };
+
+        // Average per character cost of the global pose and skinning matrix calculation for a randomly generated skeleton, for the scalar and SIMD paths
+        struct PoseKernelBenchmarkResult
+        {
+            int32_t                 m_numBones = 0;
+            int32_t                 m_numDepthLevels = 0;
+            int32_t                 m_numCharacters = 0;
+            float                   m_scalarGlobalPoseTimeUS = 0.0f;
+            float                   m_simdGlobalPoseTimeUS = 0.0f;
+            float                   m_scalarSkinningTimeUS = 0.0f;
+            float                   m_simdSkinningTimeUS = 0.0f;
+            float                   m_maxError = 0.0f;
+        };
+
+        // Average cost of sampling interpolated poses from randomly generated clips for the track major and frame major data layouts
+        // The cache line counts are the number of distinct 64 byte lines read per pose sample, as a proxy for the cache behavior of each layout
+        struct ClipLayoutBenchmarkResult
+        {
+            int32_t                 m_numBones = 0;
+            int32_t                 m_numClips = 0;
+            int32_t                 m_numFrames = 0;
+            int32_t                 m_numSamples = 0;
+            float                   m_trackMajorTimePerBoneNS = 0.0f;
+            float                   m_frameMajorTimePerBoneNS = 0.0f;
+            float                   m_trackMajorCacheLinesPerSample = 0.0f;
+            float                   m_frameMajorCacheLinesPerSample = 0.0f;
+        };
+
+        // Max error of the SIMD track decoding and local blending kernels against the scalar reference implementations, for random data
+        struct PoseKernelValidationResult
+        {
+            int32_t                 m_numTransforms = 0;
+            float                   m_maxDecodeError = 0.0f;
+            float                   m_maxInterpolatedDecodeError = 0.0f;
+            float                   m_maxBlendError = 0.0f;
+            float                   m_maxPerBoneWeightBlendError = 0.0f;
+
+            inline float GetMaxError() const { return Math::Max( Math::Max( m_maxDecodeError, m_maxInterpolatedDecodeError ), Math::Max( m_maxBlendError, m_maxPerBoneWeightBlendError ) ); }
+        };
+
+        // The max allowed difference between the SIMD and scalar results (rotation components, translation distance and scale)
+        constexpr static float const s_poseKernelValidationTolerance = 1.0e-4f;
+
     public:
 
         static void DrawGraphControlParameters( GraphInstance* pGraphInstance );
@@ -47,6 +132,13 @@ namespace EE::Animation
         static void DrawTaskTreeRow( TaskSystem* pTaskSystem, TaskIndex currentTaskIdx );
         static void DrawRootMotionRow( GraphInstance* pGraphInstance, RootMotionDebugger const* pRootMotionRecorder, int16_t currentActionIdx );
 
+        static ValueGraphBenchmarkResults RunValueGraphBenchmark( GraphVariation const* pGraphVariation, GraphInstance const* pSourceInstance, int32_t numInstances, int32_t numFrames );
+        static MotionMatchingBenchmarkResult RunMotionMatchingBenchmark( int32_t numEntries, int32_t numQueries, int32_t searchBudget );
+        static InstanceCreationBenchmarkResults RunInstanceCreationBenchmark( GraphVariation const* pGraphVariation, int32_t numInstances );
+        static PoseKernelBenchmarkResult RunPoseKernelBenchmark( int32_t numBones, int32_t numCharacters );
+        static PoseKernelValidationResult RunPoseKernelValidation( int32_t numTransforms );
+        static ClipLayoutBenchmarkResult RunClipLayoutBenchmark( int32_t numBones, int32_t numClips, int32_t numFrames, int32_t numSamples );
+
     public:
 
         AnimationDebugView();
@@ -66,6 +158,14 @@ namespace EE::Animation
         EntityWorld const*                      m_pWorld = nullptr;
         AnimationWorldSystem*                   m_pAnimationWorldSystem = nullptr;
         TVector<ComponentDebugState>            m_componentRuntimeSettings;
+        ValueGraphBenchmarkResults              m_valueGraphBenchmarkResults;
+        bool                                    m_hasValueGraphBenchmarkResults = false;
+        TVector<MotionMatchingBenchmarkResult>  m_motionMatchingBenchmarkResults;
+        TVector<PoseKernelBenchmarkResult>      m_poseKernelBenchmarkResults;
+        TVector<PoseKernelValidationResult>     m_poseKernelValidationResults;
+        TVector<ClipLayoutBenchmarkResult>      m_clipLayoutBenchmarkResults;
+        InstanceCreationBenchmarkResults        m_instanceCreationBenchmarkResults;
+        bool                                    m_hasInstanceCreationBenchmarkResults = false;
     };
 }
 #endif
\ No newline at end of file
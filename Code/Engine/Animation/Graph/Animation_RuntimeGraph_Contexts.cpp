@@ -51,6 +51,7 @@ namespace EE::Animation
     {
         m_pTaskSystem = nullptr;
         m_pPreviousPose = nullptr;
+        m_pValueGraphExecutor = nullptr;
 
         #if EE_DEVELOPMENT_TOOLS
         m_pActiveNodes = nullptr;
@@ -20,6 +20,7 @@ namespace EE::Animation
     class GraphNode;
     class GraphDataSet;
     class GraphInstance;
+    class ValueGraphExecutor;
 
     //-------------------------------------------------------------------------
 
@@ -207,6 +208,7 @@ namespace EE::Animation
         // Set at initialization time
         TaskSystem*                             m_pTaskSystem = nullptr;
         Pose const*                             m_pPreviousPose = nullptr;
+        ValueGraphExecutor*                     m_pValueGraphExecutor = nullptr; // Only set when the instance uses the compiled value graph
 
         // Runtime Values
         Transform                               m_worldTransform = Transform::Identity;
@@ -1,5 +1,6 @@
 #pragma once
 #include "Animation_RuntimeGraph_Node.h"
+#include "Animation_RuntimeGraph_ValueProgram.h"
 #include "Animation_RuntimeGraph_DataSet.h"
 #include "System/Resource/ResourcePtr.h"
 
@@ -7,15 +8,20 @@
 
 namespace EE::Animation
 {
+    class GraphInstanceTemplate;
+
+    //-------------------------------------------------------------------------
+
     class EE_ENGINE_API GraphDefinition final : public Resource::IResource
     {
         EE_REGISTER_RESOURCE( 'ag', "Animation Graph" );
-        EE_SERIALIZE( m_persistentNodeIndices, m_instanceNodeStartOffsets, m_instanceRequiredMemory, m_instanceRequiredAlignment, m_rootNodeIdx, m_controlParameterIDs, m_virtualParameterIDs, m_virtualParameterNodeIndices, m_childGraphSlots, m_externalGraphSlots );
+        EE_SERIALIZE( m_persistentNodeIndices, m_instanceNodeStartOffsets, m_instanceRequiredMemory, m_instanceRequiredAlignment, m_rootNodeIdx, m_controlParameterIDs, m_virtualParameterIDs, m_virtualParameterNodeIndices, m_childGraphSlots, m_externalGraphSlots, m_valueGraphProgram );
 
         friend class GraphDefinitionCompiler;
         friend class AnimationGraphCompiler;
         friend class GraphLoader;
         friend class GraphInstance;
+        friend class GraphInstanceTemplate;
 
     public:
 
@@ -45,6 +51,8 @@ namespace EE::Animation
 
         virtual bool IsValid() const override { return m_rootNodeIdx != InvalidIndex; }
 
+        inline ValueGraphProgram const& GetValueGraphProgram() const { return m_valueGraphProgram; }
+
         #if EE_DEVELOPMENT_TOOLS
         String const& GetNodePath( int16_t nodeIdx ) const{ return m_nodePaths[nodeIdx]; }
         #endif
@@ -62,6 +70,7 @@ namespace EE::Animation
         TVector<ChildGraphSlot>                     m_childGraphSlots;
         TVector<ExternalGraphSlot>                  m_externalGraphSlots;
         THashMap<StringID, int16_t>                 m_parameterLookupMap;
+        ValueGraphProgram                           m_valueGraphProgram;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<String>                             m_nodePaths;
@@ -81,6 +90,7 @@ namespace EE::Animation
         friend class AnimationGraphCompiler;
         friend class GraphLoader;
         friend class GraphInstance;
+        friend class GraphInstanceTemplate;
 
     public:
 
@@ -101,9 +111,14 @@ namespace EE::Animation
             return m_pGraphDefinition.GetPtr();
         }
 
+        inline GraphInstanceTemplate const* GetInstanceTemplate() const { return m_pInstanceTemplate; }
+
     protected:
 
         TResourcePtr<GraphDefinition>               m_pGraphDefinition = nullptr;
         GraphDataSet                                m_dataSet;
+
+        // Created by the graph loader on install, used to create graph instances by copying rather than instantiating the nodes
+        GraphInstanceTemplate*                      m_pInstanceTemplate = nullptr;
     };
 }
\ No newline at end of file
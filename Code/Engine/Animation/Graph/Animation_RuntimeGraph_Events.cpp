@@ -1,4 +1,7 @@
 #include "Animation_RuntimeGraph_Events.h"
+#include "Engine/Animation/Events/AnimationEvent_ID.h"
+#include "EASTL/sort.h"
+#include <algorithm>
 
 //-------------------------------------------------------------------------
 
@@ -8,89 +11,101 @@ namespace EE::Animation
     {
         m_sampledEvents.clear();
         m_numAnimEventsSampled = m_numStateEventsSampled = 0;
+        m_IDIndex.clear();
+        m_numIndexedEvents = 0;
     }
 
     //-------------------------------------------------------------------------
 
-    bool SampledEventsBuffer::ContainsStateEvent( StringID ID, bool onlyFromActiveBranch ) const
+    static bool CompareIndexedEventIDs( StringID lhsID, int16_t lhsEventIdx, StringID rhsID, int16_t rhsEventIdx )
     {
-        if ( onlyFromActiveBranch )
-        {
-            for ( auto const& se : m_sampledEvents )
-            {
-                if ( !se.IsStateEvent() )
-                {
-                    continue;
-                }
-
-                if ( !se.IsIgnored() && se.IsFromActiveBranch() && se.GetStateEventID() == ID )
-                {
-                    return true;
-                }
-            }
-        }
-        else
+        if ( lhsID != rhsID )
         {
-            for ( auto const& se : m_sampledEvents )
-            {
-                if ( !se.IsStateEvent() )
-                {
-                    continue;
-                }
-
-                if ( !se.IsIgnored() && se.GetStateEventID() == ID )
-                {
-                    return true;
-                }
-            }
+            return lhsID.GetID() < rhsID.GetID();
         }
 
-        return false;
+        return lhsEventIdx < rhsEventIdx;
     }
 
-    bool SampledEventsBuffer::ContainsSpecificStateEvent( StateEventType eventType, StringID ID, bool onlyFromActiveBranch ) const
+    void SampledEventsBuffer::UpdateIDIndex() const
     {
-        if ( onlyFromActiveBranch )
+        int16_t const numSampledEvents = GetNumSampledEvents();
+        if ( m_numIndexedEvents == numSampledEvents )
         {
-            for ( auto const& se : m_sampledEvents )
-            {
-                if ( !se.IsStateEvent() )
-                {
-                    continue;
-                }
-
-                if ( !se.IsIgnored() && se.IsFromActiveBranch() && se.GetEventType() == eventType && se.GetStateEventID() == ID )
-                {
-                    return true;
-                }
-            }
+            return;
         }
-        else
+
+        // The buffer is only ever appended to (or cleared) so we only need to add the newly sampled events
+        EE_ASSERT( m_numIndexedEvents < numSampledEvents );
+        size_t const numPreviouslyIndexedIDs = m_IDIndex.size();
+        for ( int16_t i = m_numIndexedEvents; i < numSampledEvents; i++ )
         {
-            for ( auto const& se : m_sampledEvents )
+            StringID ID;
+
+            SampledEvent const& sampledEvent = m_sampledEvents[i];
+            if ( sampledEvent.IsStateEvent() )
             {
-                if ( !se.IsStateEvent() )
-                {
-                    continue;
-                }
-
-                if ( !se.IsIgnored() && se.GetEventType() == eventType && se.GetStateEventID() == ID )
-                {
-                    return true;
-                }
+                ID = sampledEvent.GetStateEventID();
+            }
+            else if ( auto pIDEvent = sampledEvent.TryGetEvent<IDEvent>() )
+            {
+                ID = pIDEvent->GetID();
+            }
+
+            if ( ID.IsValid() )
+            {
+                m_IDIndex.push_back( { ID, i } );
             }
         }
 
-        return false;
+        // Only sort the newly added entries and merge them with the already sorted ones
+        // Note: EASTL doesnt provide an inplace_merge so we use the std one
+        auto comparator = [] ( IndexedEventID const& lhs, IndexedEventID const& rhs ) { return CompareIndexedEventIDs( lhs.m_ID, lhs.m_eventIdx, rhs.m_ID, rhs.m_eventIdx ); };
+        auto const middleIter = m_IDIndex.begin() + numPreviouslyIndexedIDs;
+        eastl::sort( middleIter, m_IDIndex.end(), comparator );
+        if ( numPreviouslyIndexedIDs > 0 && middleIter != m_IDIndex.end() )
+        {
+            std::inplace_merge( m_IDIndex.begin(), middleIter, m_IDIndex.end(), comparator );
+        }
+
+        m_numIndexedEvents = numSampledEvents;
+    }
+
+    void SampledEventsBuffer::FindEventsWithID( SampledEventRange const& range, StringID ID, TInlineVector<int16_t, 10>& outEventIndices ) const
+    {
+        EE_ASSERT( IsValidRange( range ) );
+        UpdateIDIndex();
+
+        // Find the first indexed event with this ID that is within the range, all following entries are sorted by event index
+        auto iter = eastl::lower_bound( m_IDIndex.begin(), m_IDIndex.end(), IndexedEventID{ ID, range.m_startIdx }, [] ( IndexedEventID const& lhs, IndexedEventID const& rhs ) { return CompareIndexedEventIDs( lhs.m_ID, lhs.m_eventIdx, rhs.m_ID, rhs.m_eventIdx ); } );
+        for ( ; iter != m_IDIndex.end() && iter->m_ID == ID && iter->m_eventIdx < range.m_endIdx; ++iter )
+        {
+            outEventIndices.emplace_back( iter->m_eventIdx );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool SampledEventsBuffer::ContainsStateEvent( StringID ID, bool onlyFromActiveBranch ) const
+    {
+        return ContainsStateEvent( SampledEventRange( 0, GetNumSampledEvents() ), ID, onlyFromActiveBranch );
+    }
+
+    bool SampledEventsBuffer::ContainsSpecificStateEvent( StateEventType eventType, StringID ID, bool onlyFromActiveBranch ) const
+    {
+        return ContainsSpecificStateEvent( SampledEventRange( 0, GetNumSampledEvents() ), eventType, ID, onlyFromActiveBranch );
     }
 
     bool SampledEventsBuffer::ContainsStateEvent( SampledEventRange const& range, StringID ID, bool onlyFromActiveBranch ) const
     {
         EE_ASSERT( IsValidRange( range ) );
 
-        for ( int32_t i = range.m_startIdx; i < range.m_endIdx; i++ )
+        TInlineVector<int16_t, 10> eventIndices;
+        FindEventsWithID( range, ID, eventIndices );
+
+        for ( int16_t const eventIdx : eventIndices )
         {
-            auto const& se = m_sampledEvents[i];
+            auto const& se = m_sampledEvents[eventIdx];
 
             if ( !se.IsStateEvent() )
             {
@@ -107,10 +122,7 @@ namespace EE::Animation
                 continue;
             }
 
-            if ( se.GetStateEventID() == ID )
-            {
-                return true;
-            }
+            return true;
         }
 
         return false;
@@ -120,9 +132,12 @@ namespace EE::Animation
     {
         EE_ASSERT( IsValidRange( range ) );
 
-        for ( int32_t i = range.m_startIdx; i < range.m_endIdx; i++ )
+        TInlineVector<int16_t, 10> eventIndices;
+        FindEventsWithID( range, ID, eventIndices );
+
+        for ( int16_t const eventIdx : eventIndices )
         {
-            auto const& se = m_sampledEvents[i];
+            auto const& se = m_sampledEvents[eventIdx];
 
             if ( !se.IsStateEvent() )
             {
@@ -139,7 +154,7 @@ namespace EE::Animation
                 continue;
             }
 
-            if ( se.GetEventType() == eventType && se.GetStateEventID() == ID )
+            if ( se.GetEventType() == eventType )
             {
                 return true;
             }
@@ -158,6 +158,13 @@ namespace EE::Animation
 
     class EE_ENGINE_API SampledEventsBuffer
     {
+        // An entry in the ID index, the index is sorted by ID and then by sampled event index
+        struct IndexedEventID
+        {
+            StringID                                m_ID;
+            int16_t                                 m_eventIdx;
+        };
+
     public:
 
         // Empty the buffer
@@ -251,6 +258,13 @@ namespace EE::Animation
 
         inline int16_t GetNumStateEventsSampled() const { return m_numStateEventsSampled; }
 
+        // ID Index
+        //-------------------------------------------------------------------------
+        // The buffer lazily maintains an index of all the sampled events that have an ID (i.e. ID animation events and state events) sorted by ID
+
+        // Get the indices (in order) of all the sampled events within the supplied range that have the specified ID
+        void FindEventsWithID( SampledEventRange const& range, StringID ID, TInlineVector<int16_t, 10>& outEventIndices ) const;
+
         bool ContainsStateEvent( StringID ID, bool onlyFromActiveBranch = false ) const;
         bool ContainsStateEvent( SampledEventRange const& range, StringID ID, bool onlyFromActiveBranch = false ) const;
         bool ContainsSpecificStateEvent( StateEventType eventType, StringID ID, bool onlyFromActiveBranch = false ) const;
@@ -279,10 +293,20 @@ namespace EE::Animation
         EE_FORCE_INLINE SampledEvent& operator[]( uint32_t i ) { EE_ASSERT( i < m_sampledEvents.size() ); return m_sampledEvents[i]; }
         EE_FORCE_INLINE SampledEvent const& operator[]( uint32_t i ) const { EE_ASSERT( i < m_sampledEvents.size() ); return m_sampledEvents[i]; }
 
+    private:
+
+        // Add all events sampled since the last update to the ID index
+        void UpdateIDIndex() const;
+
     public:
 
         TVector<SampledEvent>                       m_sampledEvents;
         int16_t                                     m_numAnimEventsSampled = 0;
         int16_t                                     m_numStateEventsSampled = 0;
+
+    private:
+
+        mutable TVector<IndexedEventID>             m_IDIndex;
+        mutable int16_t                             m_numIndexedEvents = 0;
     };
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Animation_RuntimeGraph_Instance.h"
 #include "Animation_RuntimeGraph_Node.h"
+#include "Animation_RuntimeGraph_InstanceTemplate.h"
 #include "Nodes/Animation_RuntimeGraphNode_ExternalGraph.h"
 #include "System/Log.h"
 #include "System/Profiling.h"
@@ -9,40 +10,42 @@
 
 namespace EE::Animation
 {
-    GraphInstance::GraphInstance( GraphVariation const* pGraphVariation, uint64_t userID, TaskSystem* pTaskSystem )
+    GraphInstance::GraphInstance( GraphVariation const* pGraphVariation, uint64_t userID, TaskSystem* pTaskSystem, bool useCompiledValueGraph, bool useInstanceTemplate )
         : m_pGraphVariation( pGraphVariation )
         , m_userID( userID )
         , m_graphContext( userID, pGraphVariation->GetSkeleton() )
+        , m_useCompiledValueGraph( useCompiledValueGraph )
+        , m_useInstanceTemplate( useInstanceTemplate )
     {
         EE_ASSERT( pGraphVariation != nullptr );
 
+        // The template is created with the compiled value graph, so it cannot be used if that is disabled
+        auto pInstanceTemplate = m_pGraphVariation->m_pInstanceTemplate;
+        if ( m_useInstanceTemplate && m_useCompiledValueGraph && pInstanceTemplate != nullptr && pInstanceTemplate->IsValid() )
+        {
+            m_pInstanceTemplate = pInstanceTemplate;
+        }
+
         //-------------------------------------------------------------------------
 
         // If the supplied task system is null, then this is a standalone graph instance
         bool const isStandaloneGraphInstance = ( pTaskSystem == nullptr );
         if ( isStandaloneGraphInstance )
         {
-            m_pTaskSystem = EE::New<TaskSystem>( m_pGraphVariation->GetSkeleton() );
+            if ( m_pInstanceTemplate != nullptr )
+            {
+                m_pTaskSystem = m_pInstanceTemplate->GetTaskSystemPool()->AcquireTaskSystem( m_pGraphVariation->GetSkeleton() );
+            }
+            else
+            {
+                m_pTaskSystem = EE::New<TaskSystem>( m_pGraphVariation->GetSkeleton() );
+            }
         }
 
-        // Allocate memory
-        //-------------------------------------------------------------------------
-
         auto pGraphDef = m_pGraphVariation->m_pGraphDefinition.GetPtr();
         size_t const numNodes = pGraphDef->m_instanceNodeStartOffsets.size();
         EE_ASSERT( pGraphDef->m_nodeSettings.size() == numNodes );
 
-        m_pAllocatedInstanceMemory = reinterpret_cast<uint8_t*>( EE::Alloc( pGraphDef->m_instanceRequiredMemory, pGraphDef->m_instanceRequiredAlignment ) );
-
-        m_nodes.reserve( numNodes );
-
-        for ( auto const& nodeOffset : pGraphDef->m_instanceNodeStartOffsets )
-        {
-            // Create ptrs to the future nodes!
-            // The nodes are not actually created yet but the ptrs are valid
-            m_nodes.emplace_back( reinterpret_cast<GraphNode*>( m_pAllocatedInstanceMemory + nodeOffset ) );
-        }
-
         // Create child graph instances
         //-------------------------------------------------------------------------
 
@@ -61,7 +64,7 @@ namespace EE::Animation
                 {
                     ChildGraph cg;
                     cg.m_nodeIdx = childGraphSlot.m_nodeIdx;
-                    cg.m_pInstance = new ( EE::Alloc( sizeof( GraphInstance ) ) ) GraphInstance( pChildGraphVariation, m_userID, isStandaloneGraphInstance ? m_pTaskSystem : pTaskSystem );
+                    cg.m_pInstance = new ( EE::Alloc( sizeof( GraphInstance ) ) ) GraphInstance( pChildGraphVariation, m_userID, isStandaloneGraphInstance ? m_pTaskSystem : pTaskSystem, m_useCompiledValueGraph, m_useInstanceTemplate );
                     m_childGraphs.emplace_back( cg );
 
                     createdChildGraphInstances.emplace_back( cg.m_pInstance );
@@ -79,19 +82,68 @@ namespace EE::Animation
             }
         }
 
-        // Instantiate individual nodes
+        // Create nodes from the template
         //-------------------------------------------------------------------------
 
-        InstantiationContext instantiationContext = { (int16_t) InvalidIndex, m_nodes, createdChildGraphInstances, m_pGraphVariation->m_pGraphDefinition->m_parameterLookupMap, &m_pGraphVariation->m_dataSet, m_userID };
+        if ( m_pInstanceTemplate != nullptr )
+        {
+            GraphInstanceTemplate::InstantiatedNodes instantiatedNodes;
+            m_pInstanceTemplate->CreateInstanceNodes( m_userID, createdChildGraphInstances, instantiatedNodes );
 
-        #if EE_DEVELOPMENT_TOOLS
-        instantiationContext.m_pLog = &m_log;
-        #endif
+            m_pAllocatedInstanceMemory = instantiatedNodes.m_pNodeMemory;
+            m_pCompiledValueNodeMemory = instantiatedNodes.m_pCompiledValueNodeMemory;
+            m_nodes.swap( instantiatedNodes.m_nodes );
+            m_valueRegisters.swap( instantiatedNodes.m_valueRegisters );
 
-        for ( int16_t i = 0; i < numNodes; i++ )
+            #if EE_DEVELOPMENT_TOOLS
+            m_log.swap( instantiatedNodes.m_log );
+            #endif
+        }
+        else
         {
-            instantiationContext.m_currentNodeIdx = i;
-            pGraphDef->m_nodeSettings[i]->InstantiateNode( instantiationContext, InstantiationOptions::CreateNode );
+            // Allocate memory
+            //-------------------------------------------------------------------------
+
+            m_pAllocatedInstanceMemory = reinterpret_cast<uint8_t*>( EE::Alloc( pGraphDef->m_instanceRequiredMemory, pGraphDef->m_instanceRequiredAlignment ) );
+
+            m_nodes.reserve( numNodes );
+
+            for ( auto const& nodeOffset : pGraphDef->m_instanceNodeStartOffsets )
+            {
+                // Create ptrs to the future nodes!
+                // The nodes are not actually created yet but the ptrs are valid
+                m_nodes.emplace_back( reinterpret_cast<GraphNode*>( m_pAllocatedInstanceMemory + nodeOffset ) );
+            }
+
+            // Create compiled value nodes
+            //-------------------------------------------------------------------------
+
+            // This needs to happen before we instantiate the rest of the nodes since they will cache the ptrs to their input nodes
+            TVector<bool> isCompiledNode;
+            if ( m_useCompiledValueGraph && pGraphDef->m_valueGraphProgram.IsValid() )
+            {
+                CreateCompiledValueNodes( isCompiledNode );
+            }
+
+            // Instantiate individual nodes
+            //-------------------------------------------------------------------------
+
+            InstantiationContext instantiationContext = { (int16_t) InvalidIndex, m_nodes, createdChildGraphInstances, m_pGraphVariation->m_pGraphDefinition->m_parameterLookupMap, &m_pGraphVariation->m_dataSet, m_userID };
+
+            #if EE_DEVELOPMENT_TOOLS
+            instantiationContext.m_pLog = &m_log;
+            #endif
+
+            for ( int16_t i = 0; i < numNodes; i++ )
+            {
+                if ( !isCompiledNode.empty() && isCompiledNode[i] )
+                {
+                    continue;
+                }
+
+                instantiationContext.m_currentNodeIdx = i;
+                pGraphDef->m_nodeSettings[i]->InstantiateNode( instantiationContext, InstantiationOptions::CreateNode );
+            }
         }
 
         // Set up graph context
@@ -109,6 +161,8 @@ namespace EE::Animation
         // Initialize graph nodes
         //-------------------------------------------------------------------------
 
+        InitializeCompiledValueGraph();
+
         // Initialize persistent graph nodes
         for ( auto nodeIdx : pGraphDef->m_persistentNodeIndices )
         {
@@ -162,8 +216,57 @@ namespace EE::Animation
         }
         m_childGraphs.clear();
 
-        EE::Free( m_pAllocatedInstanceMemory );
-        EE::Delete( m_pTaskSystem );
+        if ( m_pInstanceTemplate != nullptr )
+        {
+            m_pInstanceTemplate->ReleaseInstanceMemory( m_pAllocatedInstanceMemory, m_pCompiledValueNodeMemory );
+
+            if ( m_pTaskSystem != nullptr )
+            {
+                m_pInstanceTemplate->GetTaskSystemPool()->ReleaseTaskSystem( m_pTaskSystem );
+            }
+        }
+        else
+        {
+            EE::Free( m_pCompiledValueNodeMemory );
+            EE::Free( m_pAllocatedInstanceMemory );
+            EE::Delete( m_pTaskSystem );
+        }
+    }
+
+    void GraphInstance::CreateCompiledValueNodes( TVector<bool>& outIsCompiledNode )
+    {
+        auto pGraphDef = m_pGraphVariation->m_pGraphDefinition.GetPtr();
+        auto const& valueGraphProgram = pGraphDef->m_valueGraphProgram;
+        auto const& compiledNodes = valueGraphProgram.GetCompiledNodes();
+
+        m_valueRegisters.resize( valueGraphProgram.GetNumRegisters() );
+        outIsCompiledNode.resize( m_nodes.size(), false );
+
+        // All compiled nodes are allocated in a single block, the original node memory for these nodes is left unused
+        m_pCompiledValueNodeMemory = reinterpret_cast<uint8_t*>( EE::Alloc( sizeof( CompiledValueNode ) * compiledNodes.size(), alignof( CompiledValueNode ) ) );
+
+        auto pCompiledNodes = reinterpret_cast<CompiledValueNode*>( m_pCompiledValueNodeMemory );
+        for ( auto const& compiledNode : compiledNodes )
+        {
+            EE_ASSERT( compiledNode.m_register >= 0 && compiledNode.m_register < m_valueRegisters.size() );
+            auto pNode = new ( pCompiledNodes ) CompiledValueNode( pGraphDef->m_nodeSettings[compiledNode.m_nodeIdx], compiledNode.m_valueType, &m_valueRegisters[compiledNode.m_register], compiledNode.m_segmentIdx );
+            m_nodes[compiledNode.m_nodeIdx] = pNode;
+            outIsCompiledNode[compiledNode.m_nodeIdx] = true;
+            pCompiledNodes++;
+        }
+    }
+
+    void GraphInstance::InitializeCompiledValueGraph()
+    {
+        if ( m_pCompiledValueNodeMemory == nullptr )
+        {
+            return;
+        }
+
+        // Only the constants are set here, all other segments are executed on demand by the compiled value nodes
+        auto pGraphDef = m_pGraphVariation->m_pGraphDefinition.GetPtr();
+        m_valueGraphExecutor.Initialize( m_graphContext, &pGraphDef->m_valueGraphProgram, &m_nodes, &pGraphDef->m_nodeSettings, m_valueRegisters.data() );
+        m_graphContext.m_pValueGraphExecutor = &m_valueGraphExecutor;
     }
 
     //-------------------------------------------------------------------------
@@ -179,6 +282,18 @@ namespace EE::Animation
         return m_pTaskSystem->RequiresUpdate();
     }
 
+    void GraphInstance::SetSharedPoseBufferArena( PoseBufferArena* pArena )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        m_pTaskSystem->SetSharedPoseBufferArena( pArena );
+    }
+
+    void GraphInstance::SetSkeletonLOD( Skeleton::LOD lod )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        m_pTaskSystem->SetSkeletonLOD( lod );
+    }
+
     //-------------------------------------------------------------------------
 
     int32_t GraphInstance::GetExternalGraphSlotIndex( StringID slotID ) const
@@ -252,7 +367,7 @@ namespace EE::Animation
         // Create graph instance
         //-------------------------------------------------------------------------
 
-        connectedGraph.m_pInstance = new ( EE::Alloc( sizeof( GraphInstance ) ) ) GraphInstance( pExternalGraphVariation, m_userID, m_pTaskSystem );
+        connectedGraph.m_pInstance = new ( EE::Alloc( sizeof( GraphInstance ) ) ) GraphInstance( pExternalGraphVariation, m_userID, m_pTaskSystem, m_useCompiledValueGraph, m_useInstanceTemplate );
         EE_ASSERT( connectedGraph.m_pInstance != nullptr );
 
         // Attach instance to the node
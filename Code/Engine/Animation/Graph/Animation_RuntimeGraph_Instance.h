@@ -17,6 +17,8 @@ namespace EE::Animation
 {
     class GraphContext;
     class TaskSystem;
+    class PoseBufferArena;
+    class GraphInstanceTemplate;
     class GraphNode;
     class PoseNode;
     enum class TaskSystemDebugMode;
@@ -65,7 +67,9 @@ namespace EE::Animation
     public:
 
         // Main instance
-        inline GraphInstance( GraphVariation const* pGraphVariation, uint64_t ownerID ) : GraphInstance( pGraphVariation, ownerID, nullptr ) {}
+        // Value subgraphs are evaluated via the compiled value program by default, disable this to use the regular node path (useful for debugging the compiler)
+        // Instances are created by copying the variation's instance template by default, disable this to instantiate each node individually
+        inline GraphInstance( GraphVariation const* pGraphVariation, uint64_t ownerID, bool useCompiledValueGraph = true, bool useInstanceTemplate = true ) : GraphInstance( pGraphVariation, ownerID, nullptr, useCompiledValueGraph, useInstanceTemplate ) {}
         ~GraphInstance();
 
         // Info 
@@ -84,6 +88,12 @@ namespace EE::Animation
         // Does the task system has unexecuted pose tasks
         bool DoesTaskSystemNeedUpdate() const;
 
+        // Lease the task system's transient pose buffers from a shared arena (only valid for standalone instances)
+        void SetSharedPoseBufferArena( PoseBufferArena* pArena );
+
+        // Set the set of bones that should be sampled by the pose tasks
+        void SetSkeletonLOD( Skeleton::LOD lod );
+
         // Graph State
         //-------------------------------------------------------------------------
 
@@ -275,7 +285,11 @@ namespace EE::Animation
 
     private:
 
-        explicit GraphInstance( GraphVariation const* pGraphVariation, uint64_t ownerID, TaskSystem* pTaskSystem );
+        explicit GraphInstance( GraphVariation const* pGraphVariation, uint64_t ownerID, TaskSystem* pTaskSystem, bool useCompiledValueGraph, bool useInstanceTemplate );
+
+        // Create the compiled value nodes and run the value program initialization
+        void CreateCompiledValueNodes( TVector<bool>& outIsCompiledNode );
+        void InitializeCompiledValueGraph();
 
         EE_FORCE_INLINE bool IsControlParameter( int16_t nodeIdx ) const { return nodeIdx < GetNumControlParameters(); }
         int32_t GetExternalGraphSlotIndex( StringID slotID ) const;
@@ -306,6 +320,12 @@ namespace EE::Animation
         GraphContext                            m_graphContext;
         TVector<ChildGraph>                     m_childGraphs;
         TVector<ExternalGraph>                  m_externalGraphs;
+        TVector<ValueGraphRegister>             m_valueRegisters;
+        ValueGraphExecutor                      m_valueGraphExecutor;
+        uint8_t*                                m_pCompiledValueNodeMemory = nullptr;
+        GraphInstanceTemplate const*            m_pInstanceTemplate = nullptr; // Set if this instance was created from the variation's template
+        bool                                    m_useCompiledValueGraph = true;
+        bool                                    m_useInstanceTemplate = true;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<int16_t>                        m_activeNodes;
@@ -0,0 +1,399 @@
+#include "Animation_RuntimeGraph_InstanceTemplate.h"
+#include "Animation_RuntimeGraph_Definition.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "System/Profiling.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    GraphInstanceTemplate::GraphInstanceTemplate( GraphVariation const* pGraphVariation, TaskSystemPool* pTaskSystemPool )
+        : m_pGraphVariation( pGraphVariation )
+        , m_pTaskSystemPool( pTaskSystemPool )
+    {
+        EE_ASSERT( m_pGraphVariation != nullptr && m_pGraphVariation->IsValid() );
+        EE_ASSERT( m_pTaskSystemPool != nullptr );
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        auto pGraphDef = m_pGraphVariation->GetDefinition();
+
+        // Child graph instances are not available when creating the template, so child graph nodes are always instantiated per instance
+        TInlineVector<GraphInstance*, 20> childGraphInstances;
+        childGraphInstances.resize( pGraphDef->m_childGraphSlots.size(), nullptr );
+
+        // Instantiate the graph twice (with different user IDs) and compare the two copies to find what needs to be relocated
+        InstantiatedNodes comparisonInstance;
+        InstantiateNodes( 0, childGraphInstances, m_template );
+        InstantiateNodes( 0xFFFFFFFFFFFFFFFF, childGraphInstances, comparisonInstance );
+        GenerateRelocations( m_template, comparisonInstance );
+        DestroyInstantiatedNodes( comparisonInstance );
+
+        // Only keep the log entries for the copied nodes, the instantiated nodes will log again when they are created
+        #if EE_DEVELOPMENT_TOOLS
+        for ( int32_t i = (int32_t) m_template.m_log.size() - 1; i >= 0; i-- )
+        {
+            if ( VectorContains( m_nodesToInstantiate, (int16_t) m_template.m_log[i].m_nodeIdx ) )
+            {
+                m_template.m_log.erase( m_template.m_log.begin() + i );
+            }
+        }
+        #endif
+    }
+
+    GraphInstanceTemplate::~GraphInstanceTemplate()
+    {
+        EE_ASSERT( m_numInstancesInUse == 0 );
+        DestroyInstantiatedNodes( m_template );
+        FreePooledInstanceMemory( 0 );
+    }
+
+    GraphInstanceTemplate::Stats GraphInstanceTemplate::GetStats() const
+    {
+        Stats stats;
+        stats.m_numNodes = (int32_t) m_template.m_nodes.size();
+        stats.m_numCopiedNodes = m_numCopiedNodes;
+        stats.m_numRelocations = (int32_t) m_relocations.size();
+        stats.m_instanceMemorySize = m_pGraphVariation->GetDefinition()->m_instanceRequiredMemory + m_compiledValueNodeMemorySize;
+
+        Threading::ScopeLock lock( m_memoryPoolMutex );
+        stats.m_numPooledInstances = (int32_t) m_freeInstanceMemory.size();
+        stats.m_numInstancesInUse = m_numInstancesInUse;
+        return stats;
+    }
+
+    void GraphInstanceTemplate::TrimPooledInstanceMemory() const
+    {
+        Threading::ScopeLock lock( m_memoryPoolMutex );
+        EE_ASSERT( m_peakInstancesInUse >= m_numInstancesInUse );
+        FreePooledInstanceMemory( m_peakInstancesInUse - m_numInstancesInUse );
+        m_peakInstancesInUse = m_numInstancesInUse;
+    }
+
+    void GraphInstanceTemplate::FreePooledInstanceMemory( int32_t numBlocksToKeep ) const
+    {
+        EE_ASSERT( numBlocksToKeep >= 0 );
+        while ( (int32_t) m_freeInstanceMemory.size() > numBlocksToKeep )
+        {
+            EE::Free( m_freeInstanceMemory.back().first );
+            EE::Free( m_freeInstanceMemory.back().second );
+            m_freeInstanceMemory.pop_back();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void GraphInstanceTemplate::InstantiateNodes( uint64_t userID, TInlineVector<GraphInstance*, 20> const& childGraphInstances, InstantiatedNodes& outInstantiatedNodes ) const
+    {
+        auto pGraphDef = m_pGraphVariation->GetDefinition();
+        size_t const numNodes = pGraphDef->m_instanceNodeStartOffsets.size();
+
+        // Clear the memory so that any padding compares as equal
+        outInstantiatedNodes.m_pNodeMemory = reinterpret_cast<uint8_t*>( EE::Alloc( pGraphDef->m_instanceRequiredMemory, pGraphDef->m_instanceRequiredAlignment ) );
+        memset( outInstantiatedNodes.m_pNodeMemory, 0, pGraphDef->m_instanceRequiredMemory );
+
+        outInstantiatedNodes.m_nodes.reserve( numNodes );
+        for ( auto const& nodeOffset : pGraphDef->m_instanceNodeStartOffsets )
+        {
+            outInstantiatedNodes.m_nodes.emplace_back( reinterpret_cast<GraphNode*>( outInstantiatedNodes.m_pNodeMemory + nodeOffset ) );
+        }
+
+        // Compiled value nodes
+        //-------------------------------------------------------------------------
+
+        TVector<bool> isCompiledNode( numNodes, false );
+
+        auto const& valueGraphProgram = pGraphDef->m_valueGraphProgram;
+        if ( valueGraphProgram.IsValid() )
+        {
+            auto const& compiledNodes = valueGraphProgram.GetCompiledNodes();
+            size_t const compiledValueNodeMemorySize = sizeof( CompiledValueNode ) * compiledNodes.size();
+
+            outInstantiatedNodes.m_valueRegisters.resize( valueGraphProgram.GetNumRegisters() );
+            outInstantiatedNodes.m_pCompiledValueNodeMemory = reinterpret_cast<uint8_t*>( EE::Alloc( compiledValueNodeMemorySize, alignof( CompiledValueNode ) ) );
+            memset( outInstantiatedNodes.m_pCompiledValueNodeMemory, 0, compiledValueNodeMemorySize );
+
+            auto pCompiledNodes = reinterpret_cast<CompiledValueNode*>( outInstantiatedNodes.m_pCompiledValueNodeMemory );
+            for ( auto const& compiledNode : compiledNodes )
+            {
+                auto pNode = new ( pCompiledNodes ) CompiledValueNode( pGraphDef->m_nodeSettings[compiledNode.m_nodeIdx], compiledNode.m_valueType, &outInstantiatedNodes.m_valueRegisters[compiledNode.m_register], compiledNode.m_segmentIdx );
+                outInstantiatedNodes.m_nodes[compiledNode.m_nodeIdx] = pNode;
+                isCompiledNode[compiledNode.m_nodeIdx] = true;
+                pCompiledNodes++;
+            }
+        }
+
+        // Instantiate nodes
+        //-------------------------------------------------------------------------
+
+        InstantiationContext instantiationContext = { (int16_t) InvalidIndex, outInstantiatedNodes.m_nodes, childGraphInstances, pGraphDef->m_parameterLookupMap, &m_pGraphVariation->m_dataSet, userID };
+
+        #if EE_DEVELOPMENT_TOOLS
+        instantiationContext.m_pLog = &outInstantiatedNodes.m_log;
+        #endif
+
+        for ( int16_t i = 0; i < numNodes; i++ )
+        {
+            if ( isCompiledNode[i] )
+            {
+                continue;
+            }
+
+            instantiationContext.m_currentNodeIdx = i;
+            pGraphDef->m_nodeSettings[i]->InstantiateNode( instantiationContext, InstantiationOptions::CreateNode );
+        }
+    }
+
+    void GraphInstanceTemplate::DestroyInstantiatedNodes( InstantiatedNodes& instantiatedNodes ) const
+    {
+        for ( auto pNode : instantiatedNodes.m_nodes )
+        {
+            pNode->~GraphNode();
+        }
+
+        instantiatedNodes.m_nodes.clear();
+        instantiatedNodes.m_valueRegisters.clear();
+
+        EE::Free( instantiatedNodes.m_pNodeMemory );
+        EE::Free( instantiatedNodes.m_pCompiledValueNodeMemory );
+    }
+
+    void GraphInstanceTemplate::GenerateRelocations( InstantiatedNodes const& instanceA, InstantiatedNodes const& instanceB )
+    {
+        auto pGraphDef = m_pGraphVariation->GetDefinition();
+        int32_t const numNodes = (int32_t) pGraphDef->m_instanceNodeStartOffsets.size();
+        auto const& valueGraphProgram = pGraphDef->m_valueGraphProgram;
+
+        m_compiledValueNodeMemorySize = valueGraphProgram.IsValid() ? sizeof( CompiledValueNode ) * valueGraphProgram.GetCompiledNodes().size() : 0;
+
+        m_isCompiledNode.resize( numNodes, false );
+        if ( valueGraphProgram.IsValid() )
+        {
+            for ( auto const& compiledNode : valueGraphProgram.GetCompiledNodes() )
+            {
+                m_isCompiledNode[compiledNode.m_nodeIdx] = true;
+            }
+        }
+
+        // The address ranges of each memory block for both copies
+        //-------------------------------------------------------------------------
+
+        uintptr_t const blockSizes[(int32_t) MemoryBlock::NumBlocks] =
+        {
+            pGraphDef->m_instanceRequiredMemory,
+            m_compiledValueNodeMemorySize,
+            instanceA.m_valueRegisters.size() * sizeof( ValueGraphRegister )
+        };
+
+        uint8_t const* const blocksA[(int32_t) MemoryBlock::NumBlocks] = { instanceA.m_pNodeMemory, instanceA.m_pCompiledValueNodeMemory, reinterpret_cast<uint8_t const*>( instanceA.m_valueRegisters.data() ) };
+        uint8_t const* const blocksB[(int32_t) MemoryBlock::NumBlocks] = { instanceB.m_pNodeMemory, instanceB.m_pCompiledValueNodeMemory, reinterpret_cast<uint8_t const*>( instanceB.m_valueRegisters.data() ) };
+
+        // Compare the memory of a single node in both copies, returns false if the node contains data that cannot be relocated
+        auto GenerateNodeRelocations = [&] ( MemoryBlock sourceBlock, uint32_t startOffset, uint32_t endOffset )
+        {
+            size_t const numPreviousRelocations = m_relocations.size();
+            uint8_t const* pMemoryA = blocksA[(int32_t) sourceBlock];
+            uint8_t const* pMemoryB = blocksB[(int32_t) sourceBlock];
+
+            uint32_t offset = startOffset;
+            for ( ; offset + sizeof( uintptr_t ) <= endOffset; offset += sizeof( uintptr_t ) )
+            {
+                uintptr_t valueA, valueB;
+                memcpy( &valueA, pMemoryA + offset, sizeof( uintptr_t ) );
+                memcpy( &valueB, pMemoryB + offset, sizeof( uintptr_t ) );
+
+                if ( valueA == valueB )
+                {
+                    continue;
+                }
+
+                // Check if this is a ptr to the same location in one of the blocks
+                bool isRelocatable = false;
+                for ( int32_t blockIdx = 0; blockIdx < (int32_t) MemoryBlock::NumBlocks; blockIdx++ )
+                {
+                    uintptr_t const baseA = reinterpret_cast<uintptr_t>( blocksA[blockIdx] );
+                    uintptr_t const baseB = reinterpret_cast<uintptr_t>( blocksB[blockIdx] );
+                    if ( blockSizes[blockIdx] > 0 && valueA >= baseA && valueA < baseA + blockSizes[blockIdx] && ( valueA - baseA ) == ( valueB - baseB ) )
+                    {
+                        m_relocations.emplace_back( Relocation{ offset, sourceBlock, (MemoryBlock) blockIdx } );
+                        isRelocatable = true;
+                        break;
+                    }
+                }
+
+                if ( !isRelocatable )
+                {
+                    m_relocations.resize( numPreviousRelocations );
+                    return false;
+                }
+            }
+
+            // Any trailing bytes cannot contain a ptr
+            if ( offset < endOffset && memcmp( pMemoryA + offset, pMemoryB + offset, endOffset - offset ) != 0 )
+            {
+                m_relocations.resize( numPreviousRelocations );
+                return false;
+            }
+
+            return true;
+        };
+
+        // Nodes
+        //-------------------------------------------------------------------------
+
+        // The node offsets are not guaranteed to be ordered so calculate the extent of each node from the sorted offsets
+        TVector<uint32_t> sortedNodeOffsets = pGraphDef->m_instanceNodeStartOffsets;
+        eastl::sort( sortedNodeOffsets.begin(), sortedNodeOffsets.end() );
+
+        for ( int16_t i = 0; i < numNodes; i++ )
+        {
+            if ( m_isCompiledNode[i] )
+            {
+                continue;
+            }
+
+            bool const isChildGraphNode = eastl::find_if( pGraphDef->m_childGraphSlots.begin(), pGraphDef->m_childGraphSlots.end(), [i] ( GraphDefinition::ChildGraphSlot const& slot ) { return slot.m_nodeIdx == i; } ) != pGraphDef->m_childGraphSlots.end();
+
+            uint32_t const startOffset = pGraphDef->m_instanceNodeStartOffsets[i];
+            auto nextOffsetIter = eastl::upper_bound( sortedNodeOffsets.begin(), sortedNodeOffsets.end(), startOffset );
+            uint32_t const endOffset = ( nextOffsetIter != sortedNodeOffsets.end() ) ? *nextOffsetIter : pGraphDef->m_instanceRequiredMemory;
+
+            if ( isChildGraphNode || !GenerateNodeRelocations( MemoryBlock::Nodes, startOffset, endOffset ) )
+            {
+                m_nodesToInstantiate.emplace_back( i );
+            }
+            else
+            {
+                m_numCopiedNodes++;
+            }
+        }
+
+        // Compiled value nodes
+        //-------------------------------------------------------------------------
+
+        // Compiled value nodes only contain ptrs into the instance so they should always be copyable, if not the template cannot be used
+        for ( uint32_t offset = 0; offset < m_compiledValueNodeMemorySize; offset += sizeof( CompiledValueNode ) )
+        {
+            if ( !GenerateNodeRelocations( MemoryBlock::CompiledValueNodes, offset, offset + sizeof( CompiledValueNode ) ) )
+            {
+                m_isValid = false;
+                break;
+            }
+
+            m_numCopiedNodes++;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void GraphInstanceTemplate::CreateInstanceNodes( uint64_t userID, TInlineVector<GraphInstance*, 20> const& childGraphInstances, InstantiatedNodes& outInstantiatedNodes ) const
+    {
+        EE_ASSERT( m_isValid );
+        auto pGraphDef = m_pGraphVariation->GetDefinition();
+        size_t const numNodes = m_template.m_nodes.size();
+
+        // Get memory
+        //-------------------------------------------------------------------------
+
+        {
+            Threading::ScopeLock lock( m_memoryPoolMutex );
+            m_numInstancesInUse++;
+            m_peakInstancesInUse = Math::Max( m_peakInstancesInUse, m_numInstancesInUse );
+
+            if ( !m_freeInstanceMemory.empty() )
+            {
+                outInstantiatedNodes.m_pNodeMemory = m_freeInstanceMemory.back().first;
+                outInstantiatedNodes.m_pCompiledValueNodeMemory = m_freeInstanceMemory.back().second;
+                m_freeInstanceMemory.pop_back();
+            }
+        }
+
+        if ( outInstantiatedNodes.m_pNodeMemory == nullptr )
+        {
+            outInstantiatedNodes.m_pNodeMemory = reinterpret_cast<uint8_t*>( EE::Alloc( pGraphDef->m_instanceRequiredMemory, pGraphDef->m_instanceRequiredAlignment ) );
+            if ( m_compiledValueNodeMemorySize > 0 )
+            {
+                outInstantiatedNodes.m_pCompiledValueNodeMemory = reinterpret_cast<uint8_t*>( EE::Alloc( m_compiledValueNodeMemorySize, alignof( CompiledValueNode ) ) );
+            }
+        }
+
+        outInstantiatedNodes.m_valueRegisters.resize( m_template.m_valueRegisters.size() );
+
+        // Copy and relocate
+        //-------------------------------------------------------------------------
+
+        memcpy( outInstantiatedNodes.m_pNodeMemory, m_template.m_pNodeMemory, pGraphDef->m_instanceRequiredMemory );
+        if ( m_compiledValueNodeMemorySize > 0 )
+        {
+            memcpy( outInstantiatedNodes.m_pCompiledValueNodeMemory, m_template.m_pCompiledValueNodeMemory, m_compiledValueNodeMemorySize );
+        }
+
+        uint8_t* const targetBlocks[(int32_t) MemoryBlock::NumBlocks] = { outInstantiatedNodes.m_pNodeMemory, outInstantiatedNodes.m_pCompiledValueNodeMemory, reinterpret_cast<uint8_t*>( outInstantiatedNodes.m_valueRegisters.data() ) };
+        uintptr_t const templateBlocks[(int32_t) MemoryBlock::NumBlocks] = { reinterpret_cast<uintptr_t>( m_template.m_pNodeMemory ), reinterpret_cast<uintptr_t>( m_template.m_pCompiledValueNodeMemory ), reinterpret_cast<uintptr_t>( m_template.m_valueRegisters.data() ) };
+
+        uintptr_t relocationDeltas[(int32_t) MemoryBlock::NumBlocks];
+        for ( int32_t blockIdx = 0; blockIdx < (int32_t) MemoryBlock::NumBlocks; blockIdx++ )
+        {
+            relocationDeltas[blockIdx] = reinterpret_cast<uintptr_t>( targetBlocks[blockIdx] ) - templateBlocks[blockIdx];
+        }
+
+        for ( auto const& relocation : m_relocations )
+        {
+            uintptr_t* pPtr = reinterpret_cast<uintptr_t*>( targetBlocks[(int32_t) relocation.m_sourceBlock] + relocation.m_offset );
+            *pPtr += relocationDeltas[(int32_t) relocation.m_targetBlock];
+        }
+
+        // Set node ptrs
+        //-------------------------------------------------------------------------
+
+        outInstantiatedNodes.m_nodes.resize( numNodes );
+        for ( size_t i = 0; i < numNodes; i++ )
+        {
+            MemoryBlock const block = m_isCompiledNode[i] ? MemoryBlock::CompiledValueNodes : MemoryBlock::Nodes;
+            outInstantiatedNodes.m_nodes[i] = reinterpret_cast<GraphNode*>( reinterpret_cast<uintptr_t>( m_template.m_nodes[i] ) + relocationDeltas[(int32_t) block] );
+        }
+
+        // Instantiate the nodes that couldnt be copied
+        //-------------------------------------------------------------------------
+        // The copied memory for these nodes is not a valid object (it may share allocations with the template), so it is simply overwritten
+
+        #if EE_DEVELOPMENT_TOOLS
+        outInstantiatedNodes.m_log = m_template.m_log;
+        #endif
+
+        if ( !m_nodesToInstantiate.empty() )
+        {
+            InstantiationContext instantiationContext = { (int16_t) InvalidIndex, outInstantiatedNodes.m_nodes, childGraphInstances, pGraphDef->m_parameterLookupMap, &m_pGraphVariation->m_dataSet, userID };
+
+            #if EE_DEVELOPMENT_TOOLS
+            instantiationContext.m_pLog = &outInstantiatedNodes.m_log;
+            #endif
+
+            for ( auto nodeIdx : m_nodesToInstantiate )
+            {
+                instantiationContext.m_currentNodeIdx = nodeIdx;
+                pGraphDef->m_nodeSettings[nodeIdx]->InstantiateNode( instantiationContext, InstantiationOptions::CreateNode );
+            }
+        }
+    }
+
+    void GraphInstanceTemplate::ReleaseInstanceMemory( uint8_t* pNodeMemory, uint8_t* pCompiledValueNodeMemory ) const
+    {
+        EE_ASSERT( pNodeMemory != nullptr );
+        Threading::ScopeLock lock( m_memoryPoolMutex );
+        EE_ASSERT( m_numInstancesInUse > 0 );
+        m_numInstancesInUse--;
+
+        // Once the last instance is destroyed, nothing is going to reuse the memory until the variation is instantiated again
+        if ( m_numInstancesInUse == 0 )
+        {
+            EE::Free( pNodeMemory );
+            EE::Free( pCompiledValueNodeMemory );
+            FreePooledInstanceMemory( 0 );
+            m_peakInstancesInUse = 0;
+            return;
+        }
+
+        m_freeInstanceMemory.emplace_back( pNodeMemory, pCompiledValueNodeMemory );
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Animation_RuntimeGraph_Contexts.h"
+#include "Animation_RuntimeGraph_ValueProgram.h"
+#include "System/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+// Graph Instance Template
+//-------------------------------------------------------------------------
+// A pre-instantiated copy of all the nodes of a graph variation, created once when the variation is installed. Graph instances are created by
+// copying the template memory and relocating the node ptrs rather than by running each node's instantiation function.
+//
+// The relocation table is generated by instantiating the graph twice at different addresses and comparing the two copies: every word that differs
+// by exactly the offset between the two allocations is a ptr into the instance memory and gets relocated. Nodes with any other per-instance data
+// (i.e. heap allocations, child graph instance ptrs or the user ID) cannot be copied and are instantiated normally on top of the copied memory.
+//
+// The template also recycles the node memory of destroyed instances. The pool is trimmed back to the high-water mark of the instances in use since
+// the last trim, and is freed completely once no instances of the variation remain (i.e. when the worlds using it are unloaded).
+
+namespace EE::Animation
+{
+    class GraphVariation;
+    class GraphInstance;
+    class GraphNode;
+    class TaskSystemPool;
+
+    //-------------------------------------------------------------------------
+
+    class GraphInstanceTemplate
+    {
+        friend class GraphInstance;
+
+        enum class MemoryBlock : uint8_t
+        {
+            Nodes = 0,
+            CompiledValueNodes,
+            ValueRegisters,
+
+            NumBlocks
+        };
+
+        struct Relocation
+        {
+            uint32_t                                m_offset;
+            MemoryBlock                             m_sourceBlock;
+            MemoryBlock                             m_targetBlock;
+        };
+
+        struct InstantiatedNodes
+        {
+            uint8_t*                                m_pNodeMemory = nullptr;
+            uint8_t*                                m_pCompiledValueNodeMemory = nullptr;
+            TVector<ValueGraphRegister>             m_valueRegisters;
+            TVector<GraphNode*>                     m_nodes;
+
+            #if EE_DEVELOPMENT_TOOLS
+            TVector<GraphLogEntry>                  m_log;
+            #endif
+        };
+
+    public:
+
+        struct Stats
+        {
+            int32_t                                 m_numNodes = 0;
+            int32_t                                 m_numCopiedNodes = 0;
+            int32_t                                 m_numRelocations = 0;
+            int32_t                                 m_numPooledInstances = 0;
+            int32_t                                 m_numInstancesInUse = 0;
+            size_t                                  m_instanceMemorySize = 0;
+        };
+
+    public:
+
+        GraphInstanceTemplate( GraphVariation const* pGraphVariation, TaskSystemPool* pTaskSystemPool );
+        GraphInstanceTemplate( GraphInstanceTemplate const& ) = delete;
+        GraphInstanceTemplate& operator=( GraphInstanceTemplate const& ) = delete;
+        ~GraphInstanceTemplate();
+
+        // Is the template usable, if not instances need to be created via the regular instantiation path
+        inline bool IsValid() const { return m_isValid; }
+
+        inline TaskSystemPool* GetTaskSystemPool() const { return m_pTaskSystemPool; }
+
+        // Get the template info and the current number of pooled instance memory blocks
+        Stats GetStats() const;
+
+        // Free the pooled instance memory above the high-water mark of instances in use since the last trim - this is thread-safe
+        void TrimPooledInstanceMemory() const;
+
+    private:
+
+        // Instantiate all nodes into newly allocated memory, this is the same as the regular graph instance creation
+        void InstantiateNodes( uint64_t userID, TInlineVector<GraphInstance*, 20> const& childGraphInstances, InstantiatedNodes& outInstantiatedNodes ) const;
+        void DestroyInstantiatedNodes( InstantiatedNodes& instantiatedNodes ) const;
+
+        // Compare two instantiations of the graph and generate the relocation table
+        void GenerateRelocations( InstantiatedNodes const& instanceA, InstantiatedNodes const& instanceB );
+
+        // Create the nodes for a new instance by copying the template, the memory blocks are allocated (or reused) by the template
+        void CreateInstanceNodes( uint64_t userID, TInlineVector<GraphInstance*, 20> const& childGraphInstances, InstantiatedNodes& outInstantiatedNodes ) const;
+
+        // Return the memory of a destroyed instance to the template, the nodes need to have been destructed
+        void ReleaseInstanceMemory( uint8_t* pNodeMemory, uint8_t* pCompiledValueNodeMemory ) const;
+
+        // Free the pooled memory blocks above the specified count, the pool mutex needs to be held
+        void FreePooledInstanceMemory( int32_t numBlocksToKeep ) const;
+
+    private:
+
+        GraphVariation const*                       m_pGraphVariation = nullptr;
+        TaskSystemPool*                             m_pTaskSystemPool = nullptr;
+        InstantiatedNodes                           m_template;
+        size_t                                      m_compiledValueNodeMemorySize = 0;
+        TVector<Relocation>                         m_relocations;
+        TVector<int16_t>                            m_nodesToInstantiate; // Nodes that cannot be copied from the template
+        TVector<bool>                               m_isCompiledNode;
+        int32_t                                     m_numCopiedNodes = 0;
+        bool                                        m_isValid = true;
+
+        mutable Threading::Mutex                    m_memoryPoolMutex;
+        mutable TVector<TPair<uint8_t*, uint8_t*>>  m_freeInstanceMemory;
+        mutable int32_t                             m_numInstancesInUse = 0;
+        mutable int32_t                             m_peakInstancesInUse = 0; // The high-water mark since the last trim
+    };
+}
@@ -52,6 +52,7 @@ namespace EE::Animation
     {
         friend class PoseNode;
         friend class ValueNode;
+        friend class CompiledValueNode;
 
     public:
 
@@ -0,0 +1,464 @@
+#include "Animation_RuntimeGraph_ValueProgram.h"
+#include "Nodes/Animation_RuntimeGraphNode_Floats.h"
+#include "Nodes/Animation_RuntimeGraphNode_IDs.h"
+#include "Nodes/Animation_RuntimeGraphNode_Vectors.h"
+#include "System/Math/MathHelpers.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    using namespace GraphNodes;
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE static Vector LoadVector( ValueGraphRegister const& reg )
+    {
+        return Vector( *reinterpret_cast<Float4 const*>( reg.m_vector ) );
+    }
+
+    EE_FORCE_INLINE static void StoreVector( ValueGraphRegister& reg, Vector const& value )
+    {
+        value.StoreFloat4( *reinterpret_cast<Float4*>( reg.m_vector ) );
+    }
+
+    template<typename T>
+    EE_FORCE_INLINE static typename T::Settings const* GetNodeSettings( TVector<GraphNode::Settings*> const& nodeSettings, int16_t nodeIdx )
+    {
+        return reinterpret_cast<typename T::Settings const*>( nodeSettings[nodeIdx] );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ValueGraphProgram::Execute( ValueGraphInstruction const* pInstructions, int32_t numInstructions, GraphContext& context, TVector<GraphNode*> const& nodes, TVector<GraphNode::Settings*> const& nodeSettings, ValueGraphRegister* pRegisters )
+    {
+        EE_ASSERT( pRegisters != nullptr );
+
+        for ( int32_t i = 0; i < numInstructions; i++ )
+        {
+            ValueGraphInstruction const& instruction = pInstructions[i];
+            ValueGraphRegister& result = pRegisters[instruction.m_result];
+
+            switch ( instruction.m_op )
+            {
+                // Loads
+                //-------------------------------------------------------------------------
+
+                case ValueGraphOp::LoadBool:
+                {
+                    result.m_bool = reinterpret_cast<ValueNode*>( nodes[instruction.m_nodeIdx] )->GetValue<bool>( context );
+                }
+                break;
+
+                case ValueGraphOp::LoadID:
+                {
+                    result.m_ID = reinterpret_cast<ValueNode*>( nodes[instruction.m_nodeIdx] )->GetValue<StringID>( context ).GetID();
+                }
+                break;
+
+                case ValueGraphOp::LoadInt:
+                {
+                    result.m_int = reinterpret_cast<ValueNode*>( nodes[instruction.m_nodeIdx] )->GetValue<int32_t>( context );
+                }
+                break;
+
+                case ValueGraphOp::LoadFloat:
+                {
+                    result.m_float = reinterpret_cast<ValueNode*>( nodes[instruction.m_nodeIdx] )->GetValue<float>( context );
+                }
+                break;
+
+                case ValueGraphOp::LoadVector:
+                {
+                    StoreVector( result, reinterpret_cast<ValueNode*>( nodes[instruction.m_nodeIdx] )->GetValue<Vector>( context ) );
+                }
+                break;
+
+                // Immediates
+                //-------------------------------------------------------------------------
+
+                case ValueGraphOp::SetBool:
+                {
+                    result.m_bool = instruction.m_immediate != 0.0f;
+                }
+                break;
+
+                case ValueGraphOp::SetFloat:
+                {
+                    result.m_float = instruction.m_immediate;
+                }
+                break;
+
+                // Bools
+                //-------------------------------------------------------------------------
+
+                case ValueGraphOp::And:
+                {
+                    result.m_bool = pRegisters[instruction.m_a].m_bool && pRegisters[instruction.m_b].m_bool;
+                }
+                break;
+
+                case ValueGraphOp::Or:
+                {
+                    result.m_bool = pRegisters[instruction.m_a].m_bool || pRegisters[instruction.m_b].m_bool;
+                }
+                break;
+
+                case ValueGraphOp::Not:
+                {
+                    result.m_bool = !pRegisters[instruction.m_a].m_bool;
+                }
+                break;
+
+                // Floats
+                //-------------------------------------------------------------------------
+
+                case ValueGraphOp::FloatAdd:
+                {
+                    result.m_float = pRegisters[instruction.m_a].m_float + pRegisters[instruction.m_b].m_float;
+                }
+                break;
+
+                case ValueGraphOp::FloatSub:
+                {
+                    result.m_float = pRegisters[instruction.m_a].m_float - pRegisters[instruction.m_b].m_float;
+                }
+                break;
+
+                case ValueGraphOp::FloatMul:
+                {
+                    result.m_float = pRegisters[instruction.m_a].m_float * pRegisters[instruction.m_b].m_float;
+                }
+                break;
+
+                case ValueGraphOp::FloatDiv:
+                {
+                    float const valueB = pRegisters[instruction.m_b].m_float;
+                    if ( Math::IsNearZero( valueB ) )
+                    {
+                        #if EE_DEVELOPMENT_TOOLS
+                        context.LogWarning( instruction.m_nodeIdx, "Dividing by zero in FloatMathNode" );
+                        #endif
+                        result.m_float = 0;
+                    }
+                    else
+                    {
+                        result.m_float = pRegisters[instruction.m_a].m_float / valueB;
+                    }
+                }
+                break;
+
+                case ValueGraphOp::FloatAbs:
+                {
+                    result.m_float = Math::Abs( pRegisters[instruction.m_a].m_float );
+                }
+                break;
+
+                case ValueGraphOp::FloatRemap:
+                {
+                    auto pSettings = GetNodeSettings<FloatRemapNode>( nodeSettings, instruction.m_nodeIdx );
+                    result.m_float = Math::RemapRange( pRegisters[instruction.m_a].m_float, pSettings->m_inputRange.m_begin, pSettings->m_inputRange.m_end, pSettings->m_outputRange.m_begin, pSettings->m_outputRange.m_end );
+                }
+                break;
+
+                case ValueGraphOp::FloatClamp:
+                {
+                    auto pSettings = GetNodeSettings<FloatClampNode>( nodeSettings, instruction.m_nodeIdx );
+                    result.m_float = pSettings->m_clampRange.GetClampedValue( pRegisters[instruction.m_a].m_float );
+                }
+                break;
+
+                case ValueGraphOp::FloatCurve:
+                {
+                    auto pSettings = GetNodeSettings<FloatCurveNode>( nodeSettings, instruction.m_nodeIdx );
+                    result.m_float = pSettings->m_curve.Evaluate( pRegisters[instruction.m_a].m_float );
+                }
+                break;
+
+                case ValueGraphOp::FloatSelect:
+                {
+                    result.m_float = pRegisters[instruction.m_a].m_bool ? pRegisters[instruction.m_b].m_float : pRegisters[instruction.m_c].m_float;
+                }
+                break;
+
+                case ValueGraphOp::FloatClampTo180:
+                {
+                    result.m_float = Degrees( pRegisters[instruction.m_a].m_float ).GetClamped180().ToFloat();
+                }
+                break;
+
+                case ValueGraphOp::FloatClampTo360:
+                {
+                    result.m_float = Degrees( pRegisters[instruction.m_a].m_float ).ClampPositive360().ToFloat();
+                }
+                break;
+
+                case ValueGraphOp::FloatFlipHemisphere:
+                {
+                    result.m_float = Degrees( pRegisters[instruction.m_a].m_float - 180.0f ).GetClamped180().ToFloat();
+                }
+                break;
+
+                case ValueGraphOp::FloatFlipHemisphereNegate:
+                {
+                    result.m_float = -Degrees( pRegisters[instruction.m_a].m_float - 180.0f ).GetClamped180().ToFloat();
+                }
+                break;
+
+                case ValueGraphOp::FloatGreaterThanEqual:
+                {
+                    result.m_bool = pRegisters[instruction.m_a].m_float >= pRegisters[instruction.m_b].m_float;
+                }
+                break;
+
+                case ValueGraphOp::FloatLessThanEqual:
+                {
+                    result.m_bool = pRegisters[instruction.m_a].m_float <= pRegisters[instruction.m_b].m_float;
+                }
+                break;
+
+                case ValueGraphOp::FloatNearEqual:
+                {
+                    result.m_bool = Math::IsNearEqual( pRegisters[instruction.m_a].m_float, pRegisters[instruction.m_b].m_float, instruction.m_immediate );
+                }
+                break;
+
+                case ValueGraphOp::FloatGreaterThan:
+                {
+                    result.m_bool = pRegisters[instruction.m_a].m_float > pRegisters[instruction.m_b].m_float;
+                }
+                break;
+
+                case ValueGraphOp::FloatLessThan:
+                {
+                    result.m_bool = pRegisters[instruction.m_a].m_float < pRegisters[instruction.m_b].m_float;
+                }
+                break;
+
+                case ValueGraphOp::FloatInRangeInclusive:
+                {
+                    auto pSettings = GetNodeSettings<FloatRangeComparisonNode>( nodeSettings, instruction.m_nodeIdx );
+                    result.m_bool = pSettings->m_range.ContainsInclusive( pRegisters[instruction.m_a].m_float );
+                }
+                break;
+
+                case ValueGraphOp::FloatInRangeExclusive:
+                {
+                    auto pSettings = GetNodeSettings<FloatRangeComparisonNode>( nodeSettings, instruction.m_nodeIdx );
+                    result.m_bool = pSettings->m_range.ContainsExclusive( pRegisters[instruction.m_a].m_float );
+                }
+                break;
+
+                // IDs
+                //-------------------------------------------------------------------------
+
+                case ValueGraphOp::IDMatches:
+                {
+                    auto pSettings = GetNodeSettings<IDComparisonNode>( nodeSettings, instruction.m_nodeIdx );
+                    result.m_bool = VectorContains( pSettings->m_comparisionIDs, StringID( pRegisters[instruction.m_a].m_ID ) );
+                }
+                break;
+
+                case ValueGraphOp::IDDoesntMatch:
+                {
+                    auto pSettings = GetNodeSettings<IDComparisonNode>( nodeSettings, instruction.m_nodeIdx );
+                    result.m_bool = !VectorContains( pSettings->m_comparisionIDs, StringID( pRegisters[instruction.m_a].m_ID ) );
+                }
+                break;
+
+                case ValueGraphOp::IDToFloat:
+                {
+                    auto pSettings = GetNodeSettings<IDToFloatNode>( nodeSettings, instruction.m_nodeIdx );
+                    int32_t const foundIdx = VectorFindIndex( pSettings->m_IDs, StringID( pRegisters[instruction.m_a].m_ID ) );
+                    result.m_float = ( foundIdx != InvalidIndex ) ? pSettings->m_values[foundIdx] : pSettings->m_defaultValue;
+                }
+                break;
+
+                // Vectors
+                //-------------------------------------------------------------------------
+
+                case ValueGraphOp::VectorX:
+                case ValueGraphOp::VectorY:
+                case ValueGraphOp::VectorZ:
+                case ValueGraphOp::VectorW:
+                {
+                    result.m_float = pRegisters[instruction.m_a].m_vector[(uint8_t) instruction.m_op - (uint8_t) ValueGraphOp::VectorX];
+                }
+                break;
+
+                case ValueGraphOp::VectorLength:
+                {
+                    result.m_float = LoadVector( pRegisters[instruction.m_a] ).GetLength3();
+                }
+                break;
+
+                // Vectors are assumed to be in character space, zero vectors leave the previous result untouched
+                case ValueGraphOp::VectorAngleHorizontal:
+                {
+                    Vector const inputVector = LoadVector( pRegisters[instruction.m_a] );
+                    if ( !inputVector.IsNearZero3() )
+                    {
+                        result.m_float = Math::GetYawAngleBetweenVectors( Vector::WorldForward, inputVector ).ToDegrees().ToFloat();
+                    }
+                    else
+                    {
+                        #if EE_DEVELOPMENT_TOOLS
+                        context.LogWarning( instruction.m_nodeIdx, "Zero input vector for info node!" );
+                        #endif
+                    }
+                }
+                break;
+
+                case ValueGraphOp::VectorAngleVertical:
+                {
+                    Vector const inputVector = LoadVector( pRegisters[instruction.m_a] );
+                    if ( !inputVector.IsNearZero3() )
+                    {
+                        EulerAngles const angles = Quaternion::FromRotationBetweenVectors( Vector::WorldForward, inputVector ).ToEulerAngles();
+                        result.m_float = angles.GetPitch().ToDegrees().ToFloat();
+                    }
+                    else
+                    {
+                        #if EE_DEVELOPMENT_TOOLS
+                        context.LogWarning( instruction.m_nodeIdx, "Zero input vector for info node!" );
+                        #endif
+                    }
+                }
+                break;
+
+                case ValueGraphOp::VectorZero:
+                {
+                    StoreVector( result, Vector::Zero );
+                }
+                break;
+
+                case ValueGraphOp::VectorCopy:
+                {
+                    result = pRegisters[instruction.m_a];
+                }
+                break;
+
+                case ValueGraphOp::VectorSetX:
+                case ValueGraphOp::VectorSetY:
+                case ValueGraphOp::VectorSetZ:
+                {
+                    result.m_vector[(uint8_t) instruction.m_op - (uint8_t) ValueGraphOp::VectorSetX] = pRegisters[instruction.m_a].m_float;
+                }
+                break;
+
+                case ValueGraphOp::VectorNegate:
+                {
+                    StoreVector( result, LoadVector( pRegisters[instruction.m_a] ).GetNegated() );
+                }
+                break;
+
+                default:
+                {
+                    EE_UNREACHABLE_CODE();
+                }
+                break;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ValueGraphExecutor::Initialize( GraphContext& context, ValueGraphProgram const* pProgram, TVector<GraphNode*> const* pNodes, TVector<GraphNode::Settings*> const* pNodeSettings, ValueGraphRegister* pRegisters )
+    {
+        EE_ASSERT( pProgram != nullptr && pProgram->IsValid() );
+        EE_ASSERT( pNodes != nullptr && pNodeSettings != nullptr && pRegisters != nullptr );
+
+        m_pProgram = pProgram;
+        m_pNodes = pNodes;
+        m_pNodeSettings = pNodeSettings;
+        m_pRegisters = pRegisters;
+        m_segmentUpdateIDs.resize( pProgram->GetNumSegments(), 0xFFFFFFFF );
+
+        m_pProgram->Initialize( context, *m_pNodes, *m_pNodeSettings, m_pRegisters );
+    }
+
+    void ValueGraphExecutor::ExecuteSegment( GraphContext& context, int16_t segmentIdx )
+    {
+        EE_ASSERT( IsInitialized() );
+
+        if ( m_segmentUpdateIDs[segmentIdx] == context.m_updateID )
+        {
+            return;
+        }
+
+        m_segmentUpdateIDs[segmentIdx] = context.m_updateID;
+
+        // Dependencies are always emitted before the segments that use them so there are no cycles
+        ValueGraphProgram::Segment const& segment = m_pProgram->GetSegment( segmentIdx );
+        for ( int32_t i = 0; i < segment.m_numDependencies; i++ )
+        {
+            ExecuteSegment( context, m_pProgram->GetSegmentDependency( segment.m_firstDependencyIdx + i ) );
+        }
+
+        m_pProgram->ExecuteSegment( segmentIdx, context, *m_pNodes, *m_pNodeSettings, m_pRegisters );
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompiledValueNode::CompiledValueNode( GraphNode::Settings const* pSettings, GraphValueType valueType, ValueGraphRegister const* pRegister, int16_t segmentIdx )
+        : m_pRegister( pRegister )
+        , m_segmentIdx( segmentIdx )
+        , m_valueType( valueType )
+    {
+        EE_ASSERT( pSettings != nullptr && pRegister != nullptr );
+        m_pSettings = pSettings;
+    }
+
+    void CompiledValueNode::GetValueInternal( GraphContext& context, void* pOutValue )
+    {
+        if ( !WasUpdated( context ) )
+        {
+            MarkNodeActive( context );
+
+            if ( m_segmentIdx != InvalidIndex )
+            {
+                EE_ASSERT( context.m_pValueGraphExecutor != nullptr );
+                context.m_pValueGraphExecutor->ExecuteSegment( context, m_segmentIdx );
+            }
+        }
+
+        switch ( m_valueType )
+        {
+            case GraphValueType::Bool:
+            {
+                *reinterpret_cast<bool*>( pOutValue ) = m_pRegister->m_bool;
+            }
+            break;
+
+            case GraphValueType::ID:
+            {
+                *reinterpret_cast<StringID*>( pOutValue ) = StringID( m_pRegister->m_ID );
+            }
+            break;
+
+            case GraphValueType::Int:
+            {
+                *reinterpret_cast<int32_t*>( pOutValue ) = m_pRegister->m_int;
+            }
+            break;
+
+            case GraphValueType::Float:
+            {
+                *reinterpret_cast<float*>( pOutValue ) = m_pRegister->m_float;
+            }
+            break;
+
+            case GraphValueType::Vector:
+            {
+                *reinterpret_cast<Vector*>( pOutValue ) = LoadVector( *m_pRegister );
+            }
+            break;
+
+            default:
+            {
+                EE_UNREACHABLE_CODE();
+            }
+            break;
+        }
+    }
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "Animation_RuntimeGraph_Node.h"
+
+//-------------------------------------------------------------------------
+// Compiled Value Graph
+//-------------------------------------------------------------------------
+// Pure value subgraphs (i.e. subgraphs that only depend on control parameters, constants and stateless value nodes) are lowered by the graph compiler
+// into a linear register based program and every lowered node is replaced by a compiled value node that simply returns the value of its register.
+// This removes the virtual call tree and the per-node caching from the vast majority of value lookups.
+//
+// The program is split into segments, one per output value subgraph (i.e. a lowered node that isnt an input to another lowered node). Segments are
+// executed on demand, the first time one of their compiled nodes is queried in an update, so only values used by active nodes are calculated.
+//
+// Stateful nodes (easing, cached values, state conditions, etc...) are never lowered and are evaluated on demand via the regular node path. This
+// includes state machine transition conditions, only the pure value subgraphs feeding into them are lowered.
+
+namespace EE::Animation
+{
+    enum class ValueGraphOp : uint8_t
+    {
+        // Loads from non-lowered nodes (control parameters and constants)
+        LoadBool = 0,
+        LoadID,
+        LoadInt,
+        LoadFloat,
+        LoadVector,
+
+        // Immediates
+        SetBool,
+        SetFloat,
+
+        // Bools
+        And,
+        Or,
+        Not,
+
+        // Floats
+        FloatAdd,
+        FloatSub,
+        FloatMul,
+        FloatDiv,
+        FloatAbs,
+        FloatRemap,
+        FloatClamp,
+        FloatCurve,
+        FloatSelect,
+        FloatClampTo180,
+        FloatClampTo360,
+        FloatFlipHemisphere,
+        FloatFlipHemisphereNegate,
+        FloatGreaterThanEqual,
+        FloatLessThanEqual,
+        FloatNearEqual,
+        FloatGreaterThan,
+        FloatLessThan,
+        FloatInRangeInclusive,
+        FloatInRangeExclusive,
+
+        // IDs
+        IDMatches,
+        IDDoesntMatch,
+        IDToFloat,
+
+        // Vectors
+        VectorX,
+        VectorY,
+        VectorZ,
+        VectorW,
+        VectorLength,
+        VectorAngleHorizontal,
+        VectorAngleVertical,
+        VectorZero,
+        VectorCopy,
+        VectorSetX,
+        VectorSetY,
+        VectorSetZ,
+        VectorNegate,
+    };
+
+    //-------------------------------------------------------------------------
+
+    // A single untyped register, the type is implied by the instruction that writes it
+    struct ValueGraphRegister
+    {
+        union
+        {
+            bool                                    m_bool;
+            uint32_t                                m_ID;
+            int32_t                                 m_int;
+            float                                   m_float;
+            float                                   m_vector[4];
+        };
+    };
+
+    static_assert( sizeof( ValueGraphRegister ) == 16, "Registers are expected to be 16 bytes" );
+
+    //-------------------------------------------------------------------------
+
+    struct ValueGraphInstruction
+    {
+        EE_SERIALIZE( m_op, m_nodeIdx, m_result, m_a, m_b, m_c, m_immediate );
+
+        ValueGraphOp                                m_op = ValueGraphOp::SetBool;
+        int16_t                                     m_nodeIdx = InvalidIndex;   // The node this instruction was lowered from (used for settings, loads and logging)
+        int16_t                                     m_result = InvalidIndex;
+        int16_t                                     m_a = InvalidIndex;
+        int16_t                                     m_b = InvalidIndex;
+        int16_t                                     m_c = InvalidIndex;
+        float                                       m_immediate = 0.0f;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API ValueGraphProgram
+    {
+        EE_SERIALIZE( m_initializationInstructions, m_instructions, m_segments, m_segmentDependencies, m_compiledNodes, m_numRegisters );
+
+        friend class GraphDefinitionCompiler;
+
+    public:
+
+        // A lowered node, instances replace these nodes with compiled value nodes that read the specified register
+        struct CompiledNode
+        {
+            EE_SERIALIZE( m_nodeIdx, m_register, m_segmentIdx, m_valueType );
+
+            int16_t                                 m_nodeIdx = InvalidIndex;
+            int16_t                                 m_register = InvalidIndex;
+            int16_t                                 m_segmentIdx = InvalidIndex;    // The segment that writes the register, invalid for values only set at initialization
+            GraphValueType                          m_valueType = GraphValueType::Unknown;
+        };
+
+        // A contiguous range of instructions, the listed dependency segments need to be executed first
+        struct Segment
+        {
+            EE_SERIALIZE( m_firstInstructionIdx, m_numInstructions, m_firstDependencyIdx, m_numDependencies );
+
+            int32_t                                 m_firstInstructionIdx = 0;
+            int32_t                                 m_numInstructions = 0;
+            int32_t                                 m_firstDependencyIdx = 0;
+            int32_t                                 m_numDependencies = 0;
+        };
+
+    public:
+
+        inline bool IsValid() const { return !m_compiledNodes.empty(); }
+        inline int32_t GetNumRegisters() const { return m_numRegisters; }
+        inline int32_t GetNumInstructions() const { return (int32_t) m_instructions.size(); }
+        inline int32_t GetNumSegments() const { return (int32_t) m_segments.size(); }
+        inline TVector<CompiledNode> const& GetCompiledNodes() const { return m_compiledNodes; }
+
+        // Set all constant registers, needs to be run once per instance
+        void Initialize( GraphContext& context, TVector<GraphNode*> const& nodes, TVector<GraphNode::Settings*> const& nodeSettings, ValueGraphRegister* pRegisters ) const
+        {
+            Execute( m_initializationInstructions.data(), (int32_t) m_initializationInstructions.size(), context, nodes, nodeSettings, pRegisters );
+        }
+
+        // Evaluate a single segment, this does not evaluate the segment's dependencies
+        void ExecuteSegment( int16_t segmentIdx, GraphContext& context, TVector<GraphNode*> const& nodes, TVector<GraphNode::Settings*> const& nodeSettings, ValueGraphRegister* pRegisters ) const
+        {
+            EE_ASSERT( segmentIdx >= 0 && segmentIdx < m_segments.size() );
+            Segment const& segment = m_segments[segmentIdx];
+            Execute( m_instructions.data() + segment.m_firstInstructionIdx, segment.m_numInstructions, context, nodes, nodeSettings, pRegisters );
+        }
+
+        inline Segment const& GetSegment( int16_t segmentIdx ) const { EE_ASSERT( segmentIdx >= 0 && segmentIdx < m_segments.size() ); return m_segments[segmentIdx]; }
+        inline int16_t GetSegmentDependency( int32_t dependencyIdx ) const { return m_segmentDependencies[dependencyIdx]; }
+
+    private:
+
+        static void Execute( ValueGraphInstruction const* pInstructions, int32_t numInstructions, GraphContext& context, TVector<GraphNode*> const& nodes, TVector<GraphNode::Settings*> const& nodeSettings, ValueGraphRegister* pRegisters );
+
+    private:
+
+        TVector<ValueGraphInstruction>              m_initializationInstructions;
+        TVector<ValueGraphInstruction>              m_instructions;
+        TVector<Segment>                            m_segments;
+        TVector<int16_t>                            m_segmentDependencies;
+        TVector<CompiledNode>                       m_compiledNodes;
+        int32_t                                     m_numRegisters = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // The per-instance execution state of a value graph program, tracks which segments have already been executed this update
+    class EE_ENGINE_API ValueGraphExecutor
+    {
+    public:
+
+        void Initialize( GraphContext& context, ValueGraphProgram const* pProgram, TVector<GraphNode*> const* pNodes, TVector<GraphNode::Settings*> const* pNodeSettings, ValueGraphRegister* pRegisters );
+        inline bool IsInitialized() const { return m_pProgram != nullptr; }
+
+        // Execute a segment (and all its dependencies) if it hasnt already been executed this update
+        void ExecuteSegment( GraphContext& context, int16_t segmentIdx );
+
+    private:
+
+        ValueGraphProgram const*                    m_pProgram = nullptr;
+        TVector<GraphNode*> const*                  m_pNodes = nullptr;
+        TVector<GraphNode::Settings*> const*        m_pNodeSettings = nullptr;
+        ValueGraphRegister*                         m_pRegisters = nullptr;
+        TVector<uint32_t>                           m_segmentUpdateIDs;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Replaces a lowered value node in a graph instance, returns the value calculated by the value graph program
+    class EE_ENGINE_API CompiledValueNode final : public ValueNode
+    {
+    public:
+
+        CompiledValueNode( GraphNode::Settings const* pSettings, GraphValueType valueType, ValueGraphRegister const* pRegister, int16_t segmentIdx );
+
+        virtual GraphValueType GetValueType() const override { return m_valueType; }
+
+    private:
+
+        virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
+
+    private:
+
+        ValueGraphRegister const*                   m_pRegister = nullptr;
+        int16_t                                     m_segmentIdx = InvalidIndex;
+        GraphValueType                              m_valueType = GraphValueType::Unknown;
+    };
+}
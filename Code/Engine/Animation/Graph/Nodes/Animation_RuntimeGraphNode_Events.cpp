@@ -69,64 +69,50 @@ namespace EE::Animation::GraphNodes
         // Perform search
         //-------------------------------------------------------------------------
 
-        for ( auto i = searchRange.m_startIdx; i != searchRange.m_endIdx; i++ )
+        TInlineVector<int16_t, 10> eventIndices;
+        for ( auto t = 0; t < numEventIDs; t++ )
         {
-            StringID foundID;
-
-            SampledEvent const& sampledEvent = context.m_sampledEventsBuffer[i];
+            eventIndices.clear();
+            context.m_sampledEventsBuffer.FindEventsWithID( searchRange, pNodeSettings->m_eventIDs[t], eventIndices );
 
-            if ( sampledEvent.IsIgnored() )
+            for ( int16_t const eventIdx : eventIndices )
             {
-                continue;
-            }
+                SampledEvent const& sampledEvent = context.m_sampledEventsBuffer[eventIdx];
 
-            // Skip events from inactive branch if so requested
-            if ( pNodeSettings->m_onlyCheckEventsFromActiveBranch && !sampledEvent.IsFromActiveBranch() )
-            {
-                continue;
-            }
+                if ( sampledEvent.IsIgnored() )
+                {
+                    continue;
+                }
 
-            // Animation Event
-            if ( sampledEvent.IsAnimationEvent() )
-            {
-                if ( pNodeSettings->m_searchRule != SearchRule::OnlySearchStateEvents )
+                // Skip events from inactive branch if so requested
+                if ( pNodeSettings->m_onlyCheckEventsFromActiveBranch && !sampledEvent.IsFromActiveBranch() )
                 {
-                    if ( auto pIDEvent = sampledEvent.TryGetEvent<IDEvent>() )
-                    {
-                        foundID = pIDEvent->GetID();
-                    }
+                    continue;
                 }
-            }
-            else // State event
-            {
-                if ( pNodeSettings->m_searchRule != SearchRule::OnlySearchAnimEvents )
+
+                // Skip event types that we are not searching for
+                if ( sampledEvent.IsAnimationEvent() ? ( pNodeSettings->m_searchRule == SearchRule::OnlySearchStateEvents ) : ( pNodeSettings->m_searchRule == SearchRule::OnlySearchAnimEvents ) )
                 {
-                    foundID = sampledEvent.GetStateEventID();
+                    continue;
                 }
+
+                foundIDs[t] = true;
+                break;
             }
 
             //-------------------------------------------------------------------------
 
-            if ( foundID.IsValid() )
+            if ( foundIDs[t] )
             {
-                // Check against the set of events we need to match
-                for ( auto t = 0; t < numEventIDs; t++ )
+                if ( pNodeSettings->m_operator == Operator::Or )
                 {
-                    if ( pNodeSettings->m_eventIDs[t] == foundID )
-                    {
-                        // 
-                        if ( pNodeSettings->m_operator == Operator::Or )
-                        {
-                            return true;
-                        }
-                        else
-                        {
-                            foundIDs[t] = true;
-                            break;
-                        }
-                    }
+                    return true;
                 }
             }
+            else if ( pNodeSettings->m_operator == Operator::And )
+            {
+                return false;
+            }
         }
 
         // Ensure that all events have been found
@@ -198,9 +184,12 @@ namespace EE::Animation::GraphNodes
             float highestWeightFound = -1.0f;
             bool eventFound = false;
 
-            for ( auto i = searchRange.m_startIdx; i < searchRange.m_endIdx; i++ )
+            TInlineVector<int16_t, 10> eventIndices;
+            context.m_sampledEventsBuffer.FindEventsWithID( searchRange, pSettings->m_eventID, eventIndices );
+
+            for ( int16_t const eventIdx : eventIndices )
             {
-                auto pSampledEvent = &context.m_sampledEventsBuffer[i];
+                auto pSampledEvent = &context.m_sampledEventsBuffer[eventIdx];
                 if ( pSampledEvent->IsIgnored() || pSampledEvent->IsStateEvent() || ( pSettings->m_onlyCheckEventsFromActiveBranch && !pSampledEvent->IsFromActiveBranch() ) )
                 {
                     continue;
@@ -208,15 +197,8 @@ namespace EE::Animation::GraphNodes
 
                 //-------------------------------------------------------------------------
 
-                if ( auto pEvent = pSampledEvent->TryGetEvent<IDEvent>() )
+                if ( pSampledEvent->IsEventOfType<IDEvent>() )
                 {
-                    if ( pSettings->m_eventID != pEvent->GetID() )
-                    {
-                        continue;
-                    }
-
-                    //-------------------------------------------------------------------------
-
                     bool updateEvent = false;
 
                     // If we already have a found event then apply priority rule
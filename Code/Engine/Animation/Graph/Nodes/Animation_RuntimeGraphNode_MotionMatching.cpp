@@ -0,0 +1,322 @@
+#include "Animation_RuntimeGraphNode_MotionMatching.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_RootMotionDebugger.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/TaskSystem/Tasks/Animation_Task_Sample.h"
+#include "Engine/Animation/TaskSystem/Tasks/Animation_Task_Blend.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_DataSet.h"
+#include "Engine/Animation/AnimationBlender.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::GraphNodes
+{
+    void MotionMatchingNode::Settings::InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const
+    {
+        auto pNode = CreateNode<MotionMatchingNode>( context, options );
+        context.SetNodePtrFromIndex( m_desiredVelocityValueNodeIdx, pNode->m_pDesiredVelocityValueNode );
+        context.SetOptionalNodePtrFromIndex( m_desiredFacingValueNodeIdx, pNode->m_pDesiredFacingValueNode );
+        pNode->m_pDatabase = context.GetResource<MotionMatchingDatabase>( m_dataSlotIdx );
+    }
+
+    bool MotionMatchingNode::IsValid() const
+    {
+        return PoseNode::IsValid() && m_pDatabase != nullptr && m_pDatabase->IsValid();
+    }
+
+    SyncTrack const& MotionMatchingNode::GetSyncTrack() const
+    {
+        EE_ASSERT( IsValid() && m_currentClipIdx != InvalidIndex );
+        return m_pDatabase->GetClip( m_currentClipIdx )->GetSyncTrack();
+    }
+
+    void MotionMatchingNode::InitializeInternal( GraphContext& context, SyncTrackTime const& initialTime )
+    {
+        PoseNode::InitializeInternal( context, initialTime );
+
+        m_pDesiredVelocityValueNode->Initialize( context );
+
+        if ( m_pDesiredFacingValueNode != nullptr )
+        {
+            m_pDesiredFacingValueNode->Initialize( context );
+        }
+
+        // Start at the first clip and force a search on the first update
+        m_blendSourceClipIdx = InvalidIndex;
+        m_blendElapsedTime = 0.0f;
+        m_timeSinceLastSearch = GetSettings<MotionMatchingNode>()->m_searchInterval;
+
+        if ( IsValid() )
+        {
+            m_currentClipIdx = 0;
+            AnimationClip const* pClip = m_pDatabase->GetClip( m_currentClipIdx );
+            m_duration = pClip->GetDuration();
+            m_currentTime = m_previousTime = pClip->GetSyncTrack().GetPercentageThrough( initialTime );
+            m_query.resize( m_pDatabase->GetFeatureStride() );
+        }
+        else
+        {
+            m_currentClipIdx = InvalidIndex;
+        }
+    }
+
+    void MotionMatchingNode::ShutdownInternal( GraphContext& context )
+    {
+        if ( m_pDesiredFacingValueNode != nullptr )
+        {
+            m_pDesiredFacingValueNode->Shutdown( context );
+        }
+
+        m_pDesiredVelocityValueNode->Shutdown( context );
+
+        m_currentClipIdx = m_blendSourceClipIdx = InvalidIndex;
+        m_currentTime = m_previousTime = 0.0f;
+        PoseNode::ShutdownInternal( context );
+    }
+
+    //-------------------------------------------------------------------------
+
+    MotionMatchingDatabase::Trajectory MotionMatchingNode::CalculateDesiredTrajectory( GraphContext& context )
+    {
+        Vector const desiredVelocity = m_pDesiredVelocityValueNode->GetValue<Vector>( context ).Get2D();
+
+        // If no facing is supplied, we face the direction of travel
+        Vector desiredFacing = ( m_pDesiredFacingValueNode != nullptr ) ? m_pDesiredFacingValueNode->GetValue<Vector>( context ).Get2D() : desiredVelocity;
+        desiredFacing = desiredFacing.IsNearZero2() ? Vector::WorldForward : desiredFacing.GetNormalized2();
+
+        // Positions move linearly along the desired velocity, the facing turns from the current facing (i.e. forward in character space) over the trajectory
+        MotionMatchingDatabase::Trajectory trajectory;
+        float const trajectoryLength = MotionMatchingDatabase::s_trajectorySampleTimes[MotionMatchingDatabase::s_numTrajectorySamples - 1];
+        for ( int32_t i = 0; i < MotionMatchingDatabase::s_numTrajectorySamples; i++ )
+        {
+            float const sampleTime = MotionMatchingDatabase::s_trajectorySampleTimes[i];
+            trajectory.m_positions[i] = desiredVelocity * sampleTime;
+            trajectory.m_facingDirections[i] = Vector::SLerp( Vector::WorldForward, desiredFacing, sampleTime / trajectoryLength );
+        }
+
+        return trajectory;
+    }
+
+    void MotionMatchingNode::PerformSearch( GraphContext& context, bool hasReachedEndOfSearchableFrames )
+    {
+        auto pSettings = GetSettings<MotionMatchingNode>();
+
+        int32_t const currentEntryIdx = m_pDatabase->GetEntryIndex( m_currentClipIdx, m_currentTime );
+        m_pDatabase->BuildQuery( currentEntryIdx, CalculateDesiredTrajectory( context ), m_query.data() );
+
+        // Continuing the current clip is the match to beat, unless we have run out of frames to play
+        MotionMatchingDatabase::SearchResult initialResult;
+        if ( !hasReachedEndOfSearchableFrames )
+        {
+            initialResult.m_entryIdx = currentEntryIdx;
+            initialResult.m_cost = m_pDatabase->CalculateCost( m_query.data(), currentEntryIdx );
+        }
+
+        MotionMatchingDatabase::SearchResult const result = m_pDatabase->FindBestMatch( m_query.data(), initialResult, pSettings->m_maxEvaluatedEntriesPerSearch, m_searchScratch );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_lastSearchResult = result;
+        #endif
+
+        if ( !result.IsValid() || result.m_entryIdx == currentEntryIdx )
+        {
+            return;
+        }
+
+        // Ignore matches that are close to the current time in the current clip since we are already playing them
+        MotionMatchingDatabase::Entry const& bestEntry = m_pDatabase->GetEntry( result.m_entryIdx );
+        Percentage const bestEntryTime = m_pDatabase->GetEntryTime( result.m_entryIdx );
+        if ( !hasReachedEndOfSearchableFrames && bestEntry.m_clipIdx == m_currentClipIdx )
+        {
+            Seconds const timeDelta = Math::Abs( bestEntryTime.ToFloat() - m_currentTime.ToFloat() ) * m_duration;
+            if ( timeDelta < pSettings->m_sameClipTimeTolerance )
+            {
+                return;
+            }
+        }
+
+        // Crossfade from the current clip to the match, the current clip's update for this frame becomes the blend source's update
+        if ( pSettings->m_blendTime > 0.0f )
+        {
+            m_blendSourceClipIdx = m_currentClipIdx;
+            m_blendSourcePreviousTime = m_previousTime;
+            m_blendSourceCurrentTime = m_currentTime;
+            m_blendElapsedTime = 0.0f;
+        }
+
+        m_currentClipIdx = bestEntry.m_clipIdx;
+        m_duration = m_pDatabase->GetClip( m_currentClipIdx )->GetDuration();
+        m_previousTime = m_currentTime = bestEntryTime;
+        m_loopCount = 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    GraphPoseNodeResult MotionMatchingNode::Update( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() && IsInitialized() );
+
+        if ( !IsValid() )
+        {
+            return GraphPoseNodeResult();
+        }
+
+        MarkNodeActive( context );
+        auto pSettings = GetSettings<MotionMatchingNode>();
+
+        // Update time
+        //-------------------------------------------------------------------------
+
+        m_previousTime = m_currentTime;
+        if ( m_duration > 0.0f )
+        {
+            m_currentTime = ( m_currentTime + Percentage( context.m_deltaTime / m_duration ) ).GetClamped( false );
+        }
+
+        if ( m_blendSourceClipIdx != InvalidIndex )
+        {
+            m_blendElapsedTime += context.m_deltaTime;
+            if ( m_blendElapsedTime >= pSettings->m_blendTime )
+            {
+                m_blendSourceClipIdx = InvalidIndex;
+            }
+            else
+            {
+                Seconds const blendSourceDuration = m_pDatabase->GetClip( m_blendSourceClipIdx )->GetDuration();
+                m_blendSourcePreviousTime = m_blendSourceCurrentTime;
+                if ( blendSourceDuration > 0.0f )
+                {
+                    m_blendSourceCurrentTime = ( m_blendSourceCurrentTime + Percentage( context.m_deltaTime / blendSourceDuration ) ).GetClamped( false );
+                }
+            }
+        }
+
+        // Search
+        //-------------------------------------------------------------------------
+
+        AnimationClip const* pCurrentClip = m_pDatabase->GetClip( m_currentClipIdx );
+        int32_t const currentEntryIdx = m_pDatabase->GetEntryIndex( m_currentClipIdx, m_currentTime );
+        bool const hasReachedEndOfSearchableFrames = (int32_t) pCurrentClip->GetFrameTime( m_currentTime ).GetNearestFrameIndex() > m_pDatabase->GetEntry( currentEntryIdx ).m_frameIdx;
+
+        m_timeSinceLastSearch += context.m_deltaTime;
+        if ( m_timeSinceLastSearch >= pSettings->m_searchInterval || hasReachedEndOfSearchableFrames )
+        {
+            PerformSearch( context, hasReachedEndOfSearchableFrames );
+            m_timeSinceLastSearch = 0.0f;
+        }
+
+        // Sample
+        //-------------------------------------------------------------------------
+
+        bool const isFromActiveBranch = ( context.m_branchState == BranchState::Active );
+
+        if ( m_blendSourceClipIdx == InvalidIndex )
+        {
+            return SampleClip( context, m_pDatabase->GetClip( m_currentClipIdx ), m_previousTime, m_currentTime, isFromActiveBranch );
+        }
+
+        // Crossfade, the source events are never from the active branch since we are transitioning away from them
+        GraphPoseNodeResult const sourceResult = SampleClip( context, m_pDatabase->GetClip( m_blendSourceClipIdx ), m_blendSourcePreviousTime, m_blendSourceCurrentTime, false );
+
+        #if EE_DEVELOPMENT_TOOLS
+        int16_t const rootMotionActionIdxSource = context.GetRootMotionDebugger()->GetLastActionIndex();
+        #endif
+
+        GraphPoseNodeResult const targetResult = SampleClip( context, m_pDatabase->GetClip( m_currentClipIdx ), m_previousTime, m_currentTime, isFromActiveBranch );
+
+        #if EE_DEVELOPMENT_TOOLS
+        int16_t const rootMotionActionIdxTarget = context.GetRootMotionDebugger()->GetLastActionIndex();
+        #endif
+
+        float const blendWeight = Math::Clamp( m_blendElapsedTime.ToFloat() / pSettings->m_blendTime.ToFloat(), 0.0f, 1.0f );
+
+        GraphPoseNodeResult result;
+        result.m_sampledEventRange = SampledEventRange( sourceResult.m_sampledEventRange.m_startIdx, targetResult.m_sampledEventRange.m_endIdx );
+        result.m_rootMotionDelta = Blender::BlendRootMotionDeltas( sourceResult.m_rootMotionDelta, targetResult.m_rootMotionDelta, blendWeight );
+        result.m_taskIdx = context.m_pTaskSystem->RegisterTask<Tasks::BlendTask>( GetNodeIndex(), sourceResult.m_taskIdx, targetResult.m_taskIdx, blendWeight );
+
+        #if EE_DEVELOPMENT_TOOLS
+        context.GetRootMotionDebugger()->RecordBlend( GetNodeIndex(), rootMotionActionIdxSource, rootMotionActionIdxTarget, result.m_rootMotionDelta );
+        #endif
+
+        return result;
+    }
+
+    GraphPoseNodeResult MotionMatchingNode::Update( GraphContext& context, SyncTrackTimeRange const& updateRange )
+    {
+        // The selected clip changes independently of any sync track, so we always perform an unsynchronized update
+        #if EE_DEVELOPMENT_TOOLS
+        context.LogWarning( GetNodeIndex(), "Motion matching nodes cannot be time synchronized, performing an unsynchronized update!" );
+        #endif
+
+        return Update( context );
+    }
+
+    GraphPoseNodeResult MotionMatchingNode::SampleClip( GraphContext& context, AnimationClip const* pClip, Percentage previousTime, Percentage currentTime, bool isFromActiveBranch ) const
+    {
+        EE_ASSERT( pClip != nullptr );
+
+        GraphPoseNodeResult result;
+        result.m_sampledEventRange = SampledEventRange( context.m_sampledEventsBuffer.GetNumSampledEvents() );
+
+        // Events
+        //-------------------------------------------------------------------------
+
+        TInlineVector<Event const*, 10> sampledAnimationEvents;
+        pClip->GetEventsForRange( previousTime, currentTime, sampledAnimationEvents );
+
+        for ( auto pEvent : sampledAnimationEvents )
+        {
+            Percentage percentageThroughEvent = 1.0f;
+            if ( pEvent->IsDurationEvent() )
+            {
+                Seconds const currentAnimTimeSeconds( pClip->GetDuration() * currentTime.ToFloat() );
+                percentageThroughEvent = pEvent->GetTimeRange().GetPercentageThroughClamped( currentAnimTimeSeconds );
+            }
+
+            context.m_sampledEventsBuffer.EmplaceAnimationEvent( GetNodeIndex(), pEvent, percentageThroughEvent, isFromActiveBranch );
+        }
+
+        result.m_sampledEventRange.m_endIdx = context.m_sampledEventsBuffer.GetNumSampledEvents();
+
+        // Root Motion
+        //-------------------------------------------------------------------------
+
+        result.m_rootMotionDelta = pClip->GetRootMotionDelta( previousTime, currentTime );
+
+        #if EE_DEVELOPMENT_TOOLS
+        context.GetRootMotionDebugger()->RecordSampling( GetNodeIndex(), result.m_rootMotionDelta );
+        #endif
+
+        // Register pose tasks
+        //-------------------------------------------------------------------------
+
+        result.m_taskIdx = context.m_pTaskSystem->RegisterTask<Tasks::SampleTask>( GetNodeIndex(), pClip, currentTime );
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    void MotionMatchingNode::RecordGraphState( RecordedGraphState& outState )
+    {
+        PoseNode::RecordGraphState( outState );
+        outState.WriteValue( m_currentClipIdx );
+        outState.WriteValue( m_blendSourceClipIdx );
+        outState.WriteValue( m_blendSourcePreviousTime );
+        outState.WriteValue( m_blendSourceCurrentTime );
+        outState.WriteValue( m_blendElapsedTime );
+        outState.WriteValue( m_timeSinceLastSearch );
+    }
+
+    void MotionMatchingNode::RestoreGraphState( RecordedGraphState const& inState )
+    {
+        PoseNode::RestoreGraphState( inState );
+        inState.ReadValue( m_currentClipIdx );
+        inState.ReadValue( m_blendSourceClipIdx );
+        inState.ReadValue( m_blendSourcePreviousTime );
+        inState.ReadValue( m_blendSourceCurrentTime );
+        inState.ReadValue( m_blendElapsedTime );
+        inState.ReadValue( m_timeSinceLastSearch );
+    }
+    #endif
+}
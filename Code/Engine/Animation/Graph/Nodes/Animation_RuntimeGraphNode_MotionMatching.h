@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Node.h"
+#include "Engine/Animation/AnimationMotionMatching.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::GraphNodes
+{
+    // Selects and plays frames from a motion matching database. The database is periodically searched for the frame that best matches the current pose and
+    // a desired trajectory (predicted from the desired character space velocity and facing), switching to a new frame crossfades from the previous clip.
+    class EE_ENGINE_API MotionMatchingNode final : public PoseNode
+    {
+    public:
+
+        struct EE_ENGINE_API Settings final : public PoseNode::Settings
+        {
+            EE_REGISTER_TYPE( Settings );
+            EE_SERIALIZE_GRAPHNODESETTINGS( PoseNode::Settings, m_desiredVelocityValueNodeIdx, m_desiredFacingValueNodeIdx, m_dataSlotIdx, m_searchInterval, m_blendTime, m_sameClipTimeTolerance, m_maxEvaluatedEntriesPerSearch );
+
+            virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
+
+            int16_t                                     m_desiredVelocityValueNodeIdx = InvalidIndex;
+            int16_t                                     m_desiredFacingValueNodeIdx = InvalidIndex;
+            int16_t                                     m_dataSlotIdx = InvalidIndex;
+            Seconds                                     m_searchInterval = 0.1f;
+            Seconds                                     m_blendTime = 0.2f;
+            Seconds                                     m_sameClipTimeTolerance = 0.2f; // Matches in the current clip closer than this to the current time are ignored
+            int32_t                                     m_maxEvaluatedEntriesPerSearch = 4096; // The per-search budget
+        };
+
+    public:
+
+        virtual bool IsValid() const override;
+        virtual SyncTrack const& GetSyncTrack() const override;
+
+        virtual GraphPoseNodeResult Update( GraphContext& context ) override;
+        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const& updateRange ) override;
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline MotionMatchingDatabase::SearchResult const& GetLastSearchResult() const { return m_lastSearchResult; }
+        #endif
+
+    private:
+
+        virtual void InitializeInternal( GraphContext& context, SyncTrackTime const& initialTime ) override;
+        virtual void ShutdownInternal( GraphContext& context ) override;
+
+        // Predict the desired character space trajectory from the desired velocity and facing
+        MotionMatchingDatabase::Trajectory CalculateDesiredTrajectory( GraphContext& context );
+
+        // Search the database and switch to the best match if needed
+        void PerformSearch( GraphContext& context, bool hasReachedEndOfSearchableFrames );
+
+        // Sample events and root motion for a single clip and register the sample task
+        GraphPoseNodeResult SampleClip( GraphContext& context, AnimationClip const* pClip, Percentage previousTime, Percentage currentTime, bool isFromActiveBranch ) const;
+
+        #if EE_DEVELOPMENT_TOOLS
+        virtual void RecordGraphState( RecordedGraphState& outState ) override;
+        virtual void RestoreGraphState( RecordedGraphState const& inState ) override;
+        #endif
+
+    private:
+
+        MotionMatchingDatabase const*                   m_pDatabase = nullptr;
+        VectorValueNode*                                m_pDesiredVelocityValueNode = nullptr;
+        VectorValueNode*                                m_pDesiredFacingValueNode = nullptr;
+        TVector<MotionMatchingDatabase::SearchBlock>    m_searchScratch;
+        TInlineVector<float, 32>                        m_query;
+
+        int32_t                                         m_currentClipIdx = InvalidIndex;
+        int32_t                                         m_blendSourceClipIdx = InvalidIndex;
+        Percentage                                      m_blendSourcePreviousTime = 0.0f;
+        Percentage                                      m_blendSourceCurrentTime = 0.0f;
+        Seconds                                         m_blendElapsedTime = 0.0f;
+        Seconds                                         m_timeSinceLastSearch = 0.0f;
+
+        #if EE_DEVELOPMENT_TOOLS
+        MotionMatchingDatabase::SearchResult            m_lastSearchResult;
+        #endif
+    };
+}
@@ -51,15 +51,7 @@ namespace EE::Animation::GraphNodes
         //-------------------------------------------------------------------------
 
         // Try to find warp event
-        OrientationWarpEvent* pWarpEvent = nullptr;
-        for ( auto const pEvent : pAnimation->GetEvents() )
-        {
-            pWarpEvent = TryCast<OrientationWarpEvent>( pEvent );
-            if ( pWarpEvent != nullptr )
-            {
-                break;
-            }
-        }
+        OrientationWarpEvent const* pWarpEvent = pAnimation->GetFirstEventOfType<OrientationWarpEvent>();
 
         // Create warp range and validate it given the current start time
         if ( pWarpEvent == nullptr )
@@ -26,6 +26,17 @@ namespace EE::Animation
         archive << *pAnimation;
         pResourceRecord->SetResourceData( pAnimation );
 
+        // The sampling path is selected from the serialized data layout, so validate it here
+        if ( pAnimation->m_dataLayout == AnimationClip::DataLayout::FrameMajor )
+        {
+            size_t const expectedDataSize = pAnimation->m_frameDataStartIndex + ( size_t( pAnimation->m_numFrames ) * pAnimation->m_frameDataStride );
+            if ( pAnimation->m_compressedPoseData.size() != expectedDataSize )
+            {
+                EE_LOG_ERROR( "Animation", "Animation Clip Loader", "Invalid frame-major pose data for animation clip: %s (expected %u values, got %u)", resID.c_str(), (uint32_t) expectedDataSize, (uint32_t) pAnimation->m_compressedPoseData.size() );
+                return false;
+            }
+        }
+
         // Read sync events
         //-------------------------------------------------------------------------
 
@@ -42,6 +53,9 @@ namespace EE::Animation
         collectionDesc.CalculateCollectionRequirements( *m_pTypeRegistry );
         TypeSystem::TypeDescriptorCollection::InstantiateStaticCollection( *m_pTypeRegistry, collectionDesc, pAnimation->m_events );
 
+        archive << pAnimation->m_eventIndex;
+        EE_ASSERT( pAnimation->m_eventIndex.m_maxEndTimes.size() == pAnimation->m_events.size() );
+
         return true;
     }
 
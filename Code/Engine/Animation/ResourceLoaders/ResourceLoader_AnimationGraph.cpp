@@ -1,5 +1,7 @@
 #include "ResourceLoader_AnimationGraph.h"
 #include "Engine/Animation/Graph/Animation_RuntimeGraph_Definition.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_InstanceTemplate.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
 #include "System/Serialization/BinarySerialization.h"
 #include "System/TypeSystem/TypeDescriptors.h"
 #include "System/Log.h"
@@ -12,6 +14,13 @@ namespace EE::Animation
     {
         m_loadableTypes.push_back( GraphDefinition::GetStaticResourceTypeID() );
         m_loadableTypes.push_back( GraphVariation::GetStaticResourceTypeID() );
+        m_pTaskSystemPool = EE::New<TaskSystemPool>();
+    }
+
+    GraphLoader::~GraphLoader()
+    {
+        EE_ASSERT( m_pTypeRegistry == nullptr );
+        EE::Delete( m_pTaskSystemPool );
     }
 
     bool GraphLoader::LoadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Serialization::BinaryInputArchive& archive ) const
@@ -120,6 +129,12 @@ namespace EE::Animation
                     dataSet.m_resources[i] = GetInstallDependency( installDependencies, dataSet.m_resources[i].GetResourceID() );
                 }
             }
+
+            // Create instance template
+            //-------------------------------------------------------------------------
+
+            EE_ASSERT( pGraphVariation->m_pInstanceTemplate == nullptr );
+            pGraphVariation->m_pInstanceTemplate = EE::New<GraphInstanceTemplate>( pGraphVariation, m_pTaskSystemPool );
         }
 
         //-------------------------------------------------------------------------
@@ -128,6 +143,21 @@ namespace EE::Animation
         return Resource::InstallResult::Succeeded;
     }
 
+    void GraphLoader::Uninstall( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const
+    {
+        auto const resourceTypeID = resID.GetResourceTypeID();
+        if ( resourceTypeID == GraphVariation::GetStaticResourceTypeID() )
+        {
+            // The template nodes and any pooled task systems reference the data set resources
+            auto pGraphVariation = pResourceRecord->GetResourceData<GraphVariation>();
+            if ( pGraphVariation != nullptr && pGraphVariation->m_pInstanceTemplate != nullptr )
+            {
+                EE::Delete( pGraphVariation->m_pInstanceTemplate );
+                m_pTaskSystemPool->DestroyFreeTaskSystems( pGraphVariation->m_dataSet.GetSkeleton() );
+            }
+        }
+    }
+
     void GraphLoader::UnloadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const
     {
         auto const resourceTypeID = resID.GetResourceTypeID();
@@ -11,12 +11,16 @@ namespace EE::TypeSystem { class TypeRegistry; }
 
 namespace EE::Animation
 {
+    class TaskSystemPool;
+
+    //-------------------------------------------------------------------------
+
     class GraphLoader final : public Resource::ResourceLoader
     {
     public:
 
         GraphLoader();
-        ~GraphLoader() { EE_ASSERT( m_pTypeRegistry == nullptr ); }
+        ~GraphLoader();
 
         inline void SetTypeRegistryPtr( TypeSystem::TypeRegistry const* pTypeRegistry ) { EE_ASSERT( pTypeRegistry != nullptr ); m_pTypeRegistry = pTypeRegistry; }
         inline void ClearTypeRegistryPtr() { m_pTypeRegistry = nullptr; }
@@ -27,9 +31,11 @@ namespace EE::Animation
         virtual void UnloadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const override;
 
         virtual Resource::InstallResult Install( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Resource::InstallDependencyList const& installDependencies ) const override;
+        virtual void Uninstall( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord ) const override;
 
     private:
 
         TypeSystem::TypeRegistry const* m_pTypeRegistry = nullptr;
+        TaskSystemPool*                 m_pTaskSystemPool = nullptr; // Shared by the instance templates of all loaded graph variations
     };
 }
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "ResourceLoader_AnimationMotionMatchingDatabase.h"
+#include "Engine/Animation/AnimationMotionMatching.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    MotionMatchingDatabaseLoader::MotionMatchingDatabaseLoader()
+    {
+        m_loadableTypes.push_back( MotionMatchingDatabase::GetStaticResourceTypeID() );
+    }
+
+    bool MotionMatchingDatabaseLoader::LoadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Serialization::BinaryInputArchive& archive ) const
+    {
+        MotionMatchingDatabase* pDatabase = EE::New<MotionMatchingDatabase>();
+        archive << *pDatabase;
+        pResourceRecord->SetResourceData( pDatabase );
+
+        // Validate the search data layout
+        EE_ASSERT( ( pDatabase->m_stride % 4 ) == 0 && pDatabase->m_features.size() == pDatabase->m_entries.size() * pDatabase->m_stride );
+        EE_ASSERT( pDatabase->m_blockBoundsMin.size() == pDatabase->GetNumBlocks() * pDatabase->m_stride );
+        return true;
+    }
+
+    Resource::InstallResult MotionMatchingDatabaseLoader::Install( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Resource::InstallDependencyList const& installDependencies ) const
+    {
+        auto pDatabase = pResourceRecord->GetResourceData<MotionMatchingDatabase>();
+        EE_ASSERT( pDatabase->m_skeleton.GetResourceID().IsValid() );
+
+        pDatabase->m_skeleton = GetInstallDependency( installDependencies, pDatabase->m_skeleton.GetResourceID() );
+
+        for ( auto& clip : pDatabase->m_clips )
+        {
+            clip = GetInstallDependency( installDependencies, clip.GetResourceID() );
+        }
+
+        if ( !pDatabase->IsValid() )
+        {
+            EE_LOG_ERROR( "Animation", "Motion Matching Database Loader", "Failed to install resources for motion matching database: %s", resID.ToString().c_str() );
+            return Resource::InstallResult::Failed;
+        }
+
+        ResourceLoader::Install( resID, pResourceRecord, installDependencies );
+        return Resource::InstallResult::Succeeded;
+    }
+}
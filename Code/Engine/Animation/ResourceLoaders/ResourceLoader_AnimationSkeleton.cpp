@@ -1,5 +1,6 @@
 #include "ResourceLoader_AnimationSkeleton.h"
 #include "Engine/Animation/AnimationSkeleton.h"
+#include "Engine/Animation/AnimationPoseKernels.h"
 #include "System/Serialization/BinarySerialization.h"
 
 //-------------------------------------------------------------------------
@@ -31,6 +32,23 @@ namespace EE::Animation
             pSkeleton->m_globalReferencePose[boneIdx] = pSkeleton->m_localReferencePose[boneIdx] * pSkeleton->m_globalReferencePose[parentIdx];
         }
 
+        // Count LOD bones
+        //-------------------------------------------------------------------------
+
+        pSkeleton->m_numHighLODBones = 0;
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            if ( pSkeleton->IsHighLODBone( boneIdx ) )
+            {
+                pSkeleton->m_numHighLODBones++;
+            }
+        }
+
+        // Sort bones by depth for the batched global pose calculation
+        //-------------------------------------------------------------------------
+
+        PoseKernels::CalculateDepthOrdering( pSkeleton->m_parentIndices, pSkeleton->m_depthOrderedBoneIndices, pSkeleton->m_depthLevelOffsets );
+
         //-------------------------------------------------------------------------
 
         return true;
@@ -1,10 +1,12 @@
 #include "EntitySystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationClipPlayer.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
+#include "Engine/Animation/Systems/WorldSystem_Animation.h"
 #include "Engine/Render/Components/Component_SkeletalMesh.h"
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "System/Render/RenderViewport.h"
 #include "System/Profiling.h"
 #include "System/Log.h"
 
@@ -171,6 +173,23 @@ namespace EE::Animation
         if ( updateStage == UpdateStage::PrePhysics )
         {
             auto pPhysicsWorldSystem = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>();
+            auto pAnimationWorldSystem = ctx.GetWorldSystem<AnimationWorldSystem>();
+
+            // Select the LOD tier, the view state is from the renderer's culling last frame
+            //-------------------------------------------------------------------------
+
+            bool isInView = m_meshComponents.empty();
+            for ( auto pMeshComponent : m_meshComponents )
+            {
+                if ( pMeshComponent->WasInView() )
+                {
+                    isInView = true;
+                    break;
+                }
+            }
+
+            float const distanceFromViewer = characterWorldTransform.GetTranslation().GetDistance3( ctx.GetViewport()->GetViewPosition() );
+            LODTier const lodTier = LOD::SelectTier( distanceFromViewer, isInView );
 
             //-------------------------------------------------------------------------
 
@@ -181,27 +200,42 @@ namespace EE::Animation
                     continue;
                 }
 
-                if ( !pAnimComponent->RequiresManualUpdate() )
+                // Reduced rate LOD tiers skip the graph evaluation on some frames, the pose is interpolated in the post-physics update instead
+                // Components requiring a manual update pick up the tier here but drive the evaluation schedule themselves
+                if ( pAnimComponent->IsLODEnabled() )
                 {
-                    // Evaluate the graph nodes and calculate the root motion delta
-                    pAnimComponent->EvaluateGraph( ctx.GetDeltaTime(), characterWorldTransform, pPhysicsWorldSystem->GetScene() );
+                    pAnimComponent->SetLODTier( lodTier );
+                }
 
-                    // Apply the root motion if desired
-                    Transform adjustedCharacterTransform = characterWorldTransform;
-                    if ( m_pRootComponent != nullptr && pAnimComponent->ShouldApplyRootMotionToEntity() )
-                    {
-                        Transform rootMotionDelta = pAnimComponent->GetRootMotionDelta();
-                        Transform worldTransform = m_pRootComponent->GetWorldTransform();
-                        worldTransform = rootMotionDelta * worldTransform;
-                        m_pRootComponent->SetWorldTransform( worldTransform );
+                if ( pAnimComponent->RequiresManualUpdate() )
+                {
+                    continue;
+                }
 
-                        // Shift character world transform
-                        adjustedCharacterTransform = rootMotionDelta * characterWorldTransform;
-                    }
+                Seconds evaluationDeltaTime = 0.0f;
+                if ( !pAnimComponent->UpdateLODSchedule( ctx.GetDeltaTime(), evaluationDeltaTime ) )
+                {
+                    continue;
+                }
+
+                // Evaluate the graph nodes and calculate the root motion delta
+                pAnimComponent->EvaluateGraph( evaluationDeltaTime, characterWorldTransform, pPhysicsWorldSystem->GetScene() );
+
+                // Apply the root motion if desired
+                Transform adjustedCharacterTransform = characterWorldTransform;
+                if ( m_pRootComponent != nullptr && pAnimComponent->ShouldApplyRootMotionToEntity() )
+                {
+                    Transform rootMotionDelta = pAnimComponent->GetRootMotionDelta();
+                    Transform worldTransform = m_pRootComponent->GetWorldTransform();
+                    worldTransform = rootMotionDelta * worldTransform;
+                    m_pRootComponent->SetWorldTransform( worldTransform );
 
-                    // Calculate pose tasks
-                    pAnimComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), adjustedCharacterTransform );
+                    // Shift character world transform
+                    adjustedCharacterTransform = rootMotionDelta * characterWorldTransform;
                 }
+
+                // Queue the pose tasks, these are executed for all characters in parallel once all entities have been updated
+                pAnimationWorldSystem->QueuePrePhysicsTasks( pAnimComponent, adjustedCharacterTransform );
             }
         }
         else if ( updateStage == UpdateStage::PostPhysics )
@@ -213,12 +247,14 @@ namespace EE::Animation
                     continue;
                 }
 
-                // Calculate the final pose tasks
-                if ( !pAnimComponent->RequiresManualUpdate() )
+                // Calculate the final pose tasks (manually updated components have already done so) and update the LOD interpolated pose
+                if ( !pAnimComponent->RequiresManualUpdate() && pAnimComponent->WasEvaluatedThisFrame() )
                 {
                     pAnimComponent->ExecutePostPhysicsTasks();
                 }
 
+                pAnimComponent->UpdateLODPose();
+
                 // Set poses
                 //-------------------------------------------------------------------------
                 // Note:    for components requiring manual update, the users need to ensure the manual update occurs before this update
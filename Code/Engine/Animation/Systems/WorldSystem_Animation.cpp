@@ -1,7 +1,10 @@
 #include "WorldSystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_InstanceTemplate.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
 
 //-------------------------------------------------------------------------
 
@@ -10,6 +13,7 @@ namespace EE::Animation
     void AnimationWorldSystem::ShutdownSystem()
     {
         EE_ASSERT( m_graphComponents.empty() );
+        EE_ASSERT( m_queuedTaskExecutions.empty() );
     }
 
     void AnimationWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -17,6 +21,7 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<AnimationGraphComponent>( pComponent ) )
         {
             m_graphComponents.Add( pGraphComponent );
+            pGraphComponent->SetSharedPoseBufferArena( &m_poseBufferArena );
         }
     }
 
@@ -24,12 +29,119 @@ namespace EE::Animation
     {
         if ( auto pGraphComponent = TryCast<AnimationGraphComponent>( pComponent ) )
         {
+            pGraphComponent->SetSharedPoseBufferArena( nullptr );
             m_graphComponents.Remove( pGraphComponent->GetID() );
         }
     }
 
+    WorldSystemDataAccessList const& AnimationWorldSystem::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( WritesComponent<AnimationGraphComponent>() );
+        return accessList;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::QueuePrePhysicsTasks( AnimationGraphComponent* pGraphComponent, Transform const& characterWorldTransform )
+    {
+        EE_ASSERT( pGraphComponent != nullptr && pGraphComponent->HasGraph() );
+
+        Threading::ScopeLock lock( m_queuedTaskExecutionsMutex );
+        m_queuedTaskExecutions.push_back( { pGraphComponent, characterWorldTransform } );
+    }
+
+    void AnimationWorldSystem::ExecuteQueuedTasks( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Execute Queued Pose Tasks" );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_numTaskExecutionsLastFrame = (int32_t) m_queuedTaskExecutions.size();
+        #endif
+
+        if ( m_queuedTaskExecutions.empty() )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct PoseTaskExecutionTask final : public ITaskSet
+        {
+            PoseTaskExecutionTask( TVector<QueuedTaskExecution> const& queuedTaskExecutions )
+                : m_queuedTaskExecutions( queuedTaskExecutions )
+            {
+                m_SetSize = (uint32_t) queuedTaskExecutions.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ANIMATION( "Execute Character Pose Tasks" );
+
+                // Each character's task list is a single dependency chain, so each one is executed as a single job
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    auto const& queuedExecution = m_queuedTaskExecutions[i];
+                    queuedExecution.m_pGraphComponent->ExecutePrePhysicsTasks( queuedExecution.m_characterWorldTransform );
+                }
+            }
+
+        private:
+
+            TVector<QueuedTaskExecution> const&         m_queuedTaskExecutions;
+        };
+
+        //-------------------------------------------------------------------------
+
+        auto pTaskSystem = ctx.GetSystem<EE::TaskSystem>();
+        PoseTaskExecutionTask executionTask( m_queuedTaskExecutions );
+        pTaskSystem->ScheduleTask( &executionTask );
+        pTaskSystem->WaitForTask( &executionTask );
+
+        m_queuedTaskExecutions.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::TrimPooledInstanceMemory()
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Trim Pooled Graph Instance Memory" );
+
+        // Templates can be shared by many components (and by other worlds), so only trim each one once
+        TInlineVector<GraphInstanceTemplate const*, 16> trimmedTemplates;
+        for ( auto pComponent : m_graphComponents )
+        {
+            if ( !pComponent->HasGraphInstance() )
+            {
+                continue;
+            }
+
+            GraphInstanceTemplate const* pInstanceTemplate = pComponent->GetGraphVariation()->GetInstanceTemplate();
+            if ( pInstanceTemplate != nullptr && !VectorContains( trimmedTemplates, pInstanceTemplate ) )
+            {
+                pInstanceTemplate->TrimPooledInstanceMemory();
+                trimmedTemplates.emplace_back( pInstanceTemplate );
+            }
+        }
+    }
+
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        if ( ctx.GetUpdateStage() == UpdateStage::PrePhysics )
+        {
+            ExecuteQueuedTasks( ctx );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( ++m_framesSinceInstanceMemoryTrim >= s_instanceMemoryTrimIntervalFrames )
+        {
+            TrimPooledInstanceMemory();
+            m_framesSinceInstanceMemoryTrim = 0;
+        }
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
         for ( auto pComponent : m_graphComponents )
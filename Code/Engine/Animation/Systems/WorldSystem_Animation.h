@@ -2,7 +2,9 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskPosePool.h"
 #include "System/Types/IDVector.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
@@ -16,12 +18,29 @@ namespace EE::Animation
     {
         friend class AnimationDebugView;
 
+        // How often we trim the pooled graph instance memory of the registered graphs back to their recent high-water mark
+        constexpr static uint32_t const s_instanceMemoryTrimIntervalFrames = 300;
+
+        struct QueuedTaskExecution
+        {
+            AnimationGraphComponent*                            m_pGraphComponent = nullptr;
+            Transform                                           m_characterWorldTransform;
+        };
+
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::FrameEnd ) );
+
+        // Queue the pre-physics pose tasks for a graph component. All queued tasks are executed in parallel (one job per character) once all entities have been updated.
+        // This is thread-safe and can be called from entity system updates
+        void QueuePrePhysicsTasks( AnimationGraphComponent* pGraphComponent, Transform const& characterWorldTransform );
+
+        // Get the shared pose buffer arena used by all registered graph components
+        inline PoseBufferArena const& GetPoseBufferArena() const { return m_poseBufferArena; }
 
         #if EE_DEVELOPMENT_TOOLS
         inline TVector<AnimationGraphComponent*> const& GetRegisteredGraphComponents() const { return m_graphComponents.GetVector(); }
+        inline int32_t GetNumTaskExecutionsLastFrame() const { return m_numTaskExecutionsLastFrame; }
         #endif
 
     private:
@@ -30,9 +49,21 @@ namespace EE::Animation
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemDataAccessList const& GetDataAccess() const override;
+
+        void ExecuteQueuedTasks( EntityWorldUpdateContext const& ctx );
+        void TrimPooledInstanceMemory();
 
     private:
 
         TIDVector<ComponentID, AnimationGraphComponent*>          m_graphComponents;
+        PoseBufferArena                                           m_poseBufferArena;
+        Threading::Mutex                                          m_queuedTaskExecutionsMutex;
+        TVector<QueuedTaskExecution>                              m_queuedTaskExecutions;
+        uint32_t                                                  m_framesSinceInstanceMemoryTrim = 0;
+
+        #if EE_DEVELOPMENT_TOOLS
+        int32_t                                                   m_numTaskExecutionsLastFrame = 0;
+        #endif
     };
 } 
\ No newline at end of file
@@ -22,6 +22,108 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    PoseBufferArena::~PoseBufferArena()
+    {
+        EE_ASSERT( m_numBuffersInUse == 0 );
+
+        for ( auto pBuffer : m_allocatedBuffers )
+        {
+            EE::Delete( pBuffer );
+        }
+    }
+
+    PoseBuffer* PoseBufferArena::AcquireBuffer( Skeleton const* pSkeleton )
+    {
+        EE_ASSERT( pSkeleton != nullptr );
+
+        int32_t const numBones = pSkeleton->GetNumBones();
+        int32_t const maxNumBones = ( ( numBones + s_sizeClassBoneGranularity - 1 ) / s_sizeClassBoneGranularity ) * s_sizeClassBoneGranularity;
+
+        PoseBuffer* pBuffer = nullptr;
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+
+            // Find the size class for this bone count
+            int32_t sizeClassIdx = InvalidIndex;
+            int32_t const numSizeClasses = (int32_t) m_sizeClasses.size();
+            for ( int32_t i = 0; i < numSizeClasses; i++ )
+            {
+                if ( m_sizeClasses[i].m_maxNumBones == maxNumBones )
+                {
+                    sizeClassIdx = i;
+                    break;
+                }
+            }
+
+            if ( sizeClassIdx == InvalidIndex )
+            {
+                sizeClassIdx = numSizeClasses;
+                m_sizeClasses.emplace_back().m_maxNumBones = maxNumBones;
+                EE_ASSERT( m_sizeClasses.size() <= INT8_MAX ); // Size class indices are stored as int8_t
+            }
+
+            // Reuse a free buffer if we have one
+            auto& sizeClass = m_sizeClasses[sizeClassIdx];
+            if ( !sizeClass.m_freeBuffers.empty() )
+            {
+                pBuffer = sizeClass.m_freeBuffers.back();
+                sizeClass.m_freeBuffers.pop_back();
+            }
+            else
+            {
+                pBuffer = m_allocatedBuffers.emplace_back( EE::New<PoseBuffer>( pSkeleton ) );
+                pBuffer->m_arenaSizeClassIdx = (int8_t) sizeClassIdx;
+                pBuffer->m_pose.m_localTransforms.reserve( maxNumBones );
+                pBuffer->m_pose.m_globalTransforms.reserve( maxNumBones );
+            }
+
+            m_numBuffersInUse++;
+            m_peakBuffersInUse = Math::Max( m_peakBuffersInUse, m_numBuffersInUse );
+        }
+
+        // Bind the buffer to the requested skeleton - this never reallocates since the buffer storage is sized for the whole size class
+        Pose& pose = pBuffer->m_pose;
+        pose.m_pSkeleton = pSkeleton;
+        pose.m_localTransforms.resize( numBones );
+        pose.m_globalTransforms.clear();
+        pose.m_state = Pose::State::Unset;
+        EE_ASSERT( !pBuffer->m_isUsed );
+
+        return pBuffer;
+    }
+
+    void PoseBufferArena::ReleaseBuffer( PoseBuffer* pBuffer )
+    {
+        EE_ASSERT( pBuffer != nullptr && pBuffer->m_arenaSizeClassIdx != InvalidIndex );
+        pBuffer->Reset();
+
+        Threading::ScopeLock lock( m_mutex );
+        EE_ASSERT( m_numBuffersInUse > 0 );
+        m_sizeClasses[pBuffer->m_arenaSizeClassIdx].m_freeBuffers.emplace_back( pBuffer );
+        m_numBuffersInUse--;
+    }
+
+    PoseBufferArena::Stats PoseBufferArena::GetStats() const
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        Stats stats;
+        stats.m_numSizeClasses = (int32_t) m_sizeClasses.size();
+        stats.m_numAllocatedBuffers = (int32_t) m_allocatedBuffers.size();
+        stats.m_numBuffersInUse = m_numBuffersInUse;
+        stats.m_peakBuffersInUse = m_peakBuffersInUse;
+
+        for ( auto pBuffer : m_allocatedBuffers )
+        {
+            stats.m_allocatedBytes += sizeof( PoseBuffer ) + ( ( pBuffer->m_pose.m_localTransforms.capacity() + pBuffer->m_pose.m_globalTransforms.capacity() ) * sizeof( Transform ) );
+        }
+
+        return stats;
+    }
+
+    //-------------------------------------------------------------------------
+
     PoseBufferPool::PoseBufferPool( Skeleton const* pSkeleton )
         : m_pSkeleton( pSkeleton )
     {
@@ -29,7 +131,7 @@ namespace EE::Animation
 
         for ( auto i = 0; i < s_numInitialBuffers; i++ )
         {
-            m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
+            m_poseBuffers.emplace_back( EE::New<PoseBuffer>( m_pSkeleton ) );
             m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
 
             #if EE_DEVELOPMENT_TOOLS
@@ -42,14 +144,22 @@ namespace EE::Animation
     PoseBufferPool::~PoseBufferPool()
     {
         Reset();
+        DestroyOwnedBuffers();
     }
 
     void PoseBufferPool::Reset()
     {
         // Reset all buffers
-        for ( auto& PoseBuffer : m_poseBuffers )
+        if ( m_pSharedArena != nullptr )
         {
-            PoseBuffer.Reset();
+            ReleaseLeasedBuffers();
+        }
+        else
+        {
+            for ( auto pPoseBuffer : m_poseBuffers )
+            {
+                pPoseBuffer->Reset();
+            }
         }
 
         m_firstFreeBuffer = 0;
@@ -74,26 +184,90 @@ namespace EE::Animation
         #endif
     }
 
+    void PoseBufferPool::SetSharedArena( PoseBufferArena* pArena )
+    {
+        if ( pArena == m_pSharedArena )
+        {
+            return;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( auto pPoseBuffer : m_poseBuffers )
+        {
+            EE_ASSERT( !pPoseBuffer->m_isUsed );
+        }
+        #endif
+
+        // Release the current buffers, the pool will lease or allocate new ones on demand
+        if ( m_pSharedArena != nullptr )
+        {
+            ReleaseLeasedBuffers();
+        }
+        else
+        {
+            DestroyOwnedBuffers();
+        }
+
+        m_pSharedArena = pArena;
+        m_firstFreeBuffer = 0;
+    }
+
+    void PoseBufferPool::ReleaseLeasedBuffers()
+    {
+        if ( m_pSharedArena == nullptr )
+        {
+            return;
+        }
+
+        for ( auto pPoseBuffer : m_poseBuffers )
+        {
+            m_pSharedArena->ReleaseBuffer( pPoseBuffer );
+        }
+
+        m_poseBuffers.clear();
+        m_firstFreeBuffer = 0;
+    }
+
+    void PoseBufferPool::DestroyOwnedBuffers()
+    {
+        EE_ASSERT( m_pSharedArena == nullptr );
+
+        for ( auto pPoseBuffer : m_poseBuffers )
+        {
+            EE::Delete( pPoseBuffer );
+        }
+
+        m_poseBuffers.clear();
+    }
+
     int8_t PoseBufferPool::RequestPoseBuffer()
     {
         if ( m_firstFreeBuffer == m_poseBuffers.size() )
         {
-            for ( auto i = 0; i < s_bufferGrowAmount; i++ )
+            // The arena handles reuse across task systems so only lease what we need
+            if ( m_pSharedArena != nullptr )
+            {
+                m_poseBuffers.emplace_back( m_pSharedArena->AcquireBuffer( m_pSkeleton ) );
+            }
+            else
             {
-                m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
+                for ( auto i = 0; i < s_bufferGrowAmount; i++ )
+                {
+                    m_poseBuffers.emplace_back( EE::New<PoseBuffer>( m_pSkeleton ) );
+                }
             }
-            EE_ASSERT( m_poseBuffers.size() < 255 );
+            EE_ASSERT( m_poseBuffers.size() <= s_maxNumBuffers );
         }
 
         int8_t const freeBufferIdx = m_firstFreeBuffer;
-        EE_ASSERT( !m_poseBuffers[freeBufferIdx].m_isUsed );
-        m_poseBuffers[freeBufferIdx].m_isUsed = true;
+        EE_ASSERT( !m_poseBuffers[freeBufferIdx]->m_isUsed );
+        m_poseBuffers[freeBufferIdx]->m_isUsed = true;
 
         // Update free index
         int8_t const numPoseBuffers = (int8_t) m_poseBuffers.size();
         for ( ; m_firstFreeBuffer < numPoseBuffers; m_firstFreeBuffer++ )
         {
-            if ( !m_poseBuffers[m_firstFreeBuffer].m_isUsed )
+            if ( !m_poseBuffers[m_firstFreeBuffer]->m_isUsed )
             {
                 break;
             }
@@ -104,8 +278,8 @@ namespace EE::Animation
 
     void PoseBufferPool::ReleasePoseBuffer( int8_t BufferIdx )
     {
-        EE_ASSERT( m_poseBuffers[BufferIdx].m_isUsed );
-        m_poseBuffers[BufferIdx].m_isUsed = false;
+        EE_ASSERT( m_poseBuffers[BufferIdx]->m_isUsed );
+        m_poseBuffers[BufferIdx]->m_isUsed = false;
         m_firstFreeBuffer = Math::Min( BufferIdx, m_firstFreeBuffer );
     }
 
@@ -120,7 +294,7 @@ namespace EE::Animation
                 pCachedPoseBuffer = &m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
             }
 
-            EE_ASSERT( m_cachedBuffers.size() < 255 );
+            EE_ASSERT( m_cachedBuffers.size() <= s_maxNumBuffers );
         }
         else
         {
@@ -203,11 +377,11 @@ namespace EE::Animation
                 m_debugBufferTaskIdxMapping.emplace_back( int8_t( -1 ) );
             }
 
-            EE_ASSERT( m_debugBuffers.size() < 255 );
+            EE_ASSERT( m_debugBuffers.size() <= s_maxNumBuffers );
         }
 
-        EE_ASSERT( m_poseBuffers[poseBufferIdx].m_isUsed );
-        m_debugBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx].m_pose );
+        EE_ASSERT( m_poseBuffers[poseBufferIdx]->m_isUsed );
+        m_debugBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx]->m_pose );
         m_debugBufferTaskIdxMapping[m_firstFreeDebugBuffer] = taskIdx;
         m_firstFreeDebugBuffer++;
     }
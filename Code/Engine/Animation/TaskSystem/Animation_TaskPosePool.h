@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Animation/AnimationPose.h"
+#include "System/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -9,6 +10,7 @@ namespace EE::Animation
     struct PoseBuffer
     {
         friend class PoseBufferPool;
+        friend class PoseBufferArena;
 
     public:
 
@@ -25,6 +27,7 @@ namespace EE::Animation
     private:
 
         bool								m_isUsed = false;
+        int8_t                              m_arenaSizeClassIdx = InvalidIndex;
     };
 
     //-------------------------------------------------------------------------
@@ -51,9 +54,76 @@ namespace EE::Animation
     };
 
     //-------------------------------------------------------------------------
+    // Pose Buffer Arena
+    //-------------------------------------------------------------------------
+    // A shared store of pose buffers for all the task systems in a world, bucketed into size classes by bone count.
+    // Task systems lease their transient buffers from here and return them as soon as their final pose has been
+    // extracted, so the number of buffers needed scales with the number of characters executing concurrently rather
+    // than with the total number of characters. Buffers in a size class can be reused by any skeleton that fits.
+
+    class PoseBufferArena
+    {
+        constexpr static int32_t const s_sizeClassBoneGranularity = 32;
+
+    public:
+
+        struct Stats
+        {
+            int32_t                                 m_numSizeClasses = 0;
+            int32_t                                 m_numAllocatedBuffers = 0;
+            int32_t                                 m_numBuffersInUse = 0;
+            int32_t                                 m_peakBuffersInUse = 0;
+            size_t                                  m_allocatedBytes = 0;
+        };
+
+    public:
+
+        PoseBufferArena() = default;
+        PoseBufferArena( PoseBufferArena const& ) = delete;
+        PoseBufferArena& operator=( PoseBufferArena const& ) = delete;
+        ~PoseBufferArena();
+
+        // Get a buffer that is bound to the specified skeleton - this is thread-safe
+        PoseBuffer* AcquireBuffer( Skeleton const* pSkeleton );
+
+        // Return a buffer to the arena - this is thread-safe
+        void ReleaseBuffer( PoseBuffer* pBuffer );
+
+        // Get the current usage stats
+        Stats GetStats() const;
+
+    private:
+
+        struct SizeClass
+        {
+            int32_t                                 m_maxNumBones = 0;
+            TVector<PoseBuffer*>                    m_freeBuffers;
+        };
+
+    private:
+
+        mutable Threading::Mutex                    m_mutex;
+        TVector<SizeClass>                          m_sizeClasses;
+        TVector<PoseBuffer*>                        m_allocatedBuffers;
+        int32_t                                     m_numBuffersInUse = 0;
+        int32_t                                     m_peakBuffersInUse = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Pose Buffer Pool
+    //-------------------------------------------------------------------------
+    // The per task system set of pose buffers. By default the pool owns its buffers, if a shared arena is set, the
+    // transient (i.e. non-cached) buffers are leased from the arena and returned once the task system is done with them.
 
     class PoseBufferPool
     {
+    public:
+
+        // Pose buffers are referenced by int8_t indices in the task system, so this is the max number of buffers a single pool can hold
+        constexpr static int32_t const s_maxNumBuffers = INT8_MAX;
+
+    private:
+
         constexpr static int8_t const s_numInitialBuffers = 6;
         constexpr static int8_t const s_bufferGrowAmount = 3;
 
@@ -64,6 +134,13 @@ namespace EE::Animation
 
         void Reset();
 
+        // Set the shared arena to lease transient buffers from, this must only be called when no buffers are in use
+        void SetSharedArena( PoseBufferArena* pArena );
+        inline bool HasSharedArena() const { return m_pSharedArena != nullptr; }
+
+        // Return all leased buffers to the shared arena, this does nothing if the pool owns its buffers
+        void ReleaseLeasedBuffers();
+
         // Poses
         //-------------------------------------------------------------------------
 
@@ -72,8 +149,8 @@ namespace EE::Animation
 
         inline PoseBuffer* GetBuffer( int8_t bufferIdx )
         {
-            EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-            return &m_poseBuffers[bufferIdx];
+            EE_ASSERT( m_poseBuffers[bufferIdx]->m_isUsed );
+            return m_poseBuffers[bufferIdx];
         }
 
         // Cached Poses
@@ -94,10 +171,15 @@ namespace EE::Animation
         Pose const* GetRecordedPoseForTask( int8_t taskIdx ) const;
         #endif
 
+    private:
+
+        void DestroyOwnedBuffers();
+
     private:
 
         Skeleton const*                             m_pSkeleton = nullptr;
-        TVector<PoseBuffer>                         m_poseBuffers;
+        PoseBufferArena*                            m_pSharedArena = nullptr;
+        TVector<PoseBuffer*>                        m_poseBuffers;
         TVector<CachedPoseBuffer>                   m_cachedBuffers;
         TInlineVector<UUID, 5>                      m_cachedPoseBuffersToDestroy;
         int8_t                                      m_firstFreeCachedBuffer = 0;
@@ -15,26 +15,45 @@ namespace EE::Animation
         , m_finalPose( pSkeleton )
     {
         EE_ASSERT( pSkeleton != nullptr );
+        m_taskArena.Initialize( s_taskArenaCapacity );
         m_finalPose.CalculateGlobalTransforms();
     }
 
     TaskSystem::~TaskSystem()
     {
         Reset();
+        m_taskArena.Shutdown();
     }
 
     void TaskSystem::Reset()
     {
         for ( auto pTask : m_tasks )
         {
-            EE::Delete( pTask );
+            pTask->~Task();
         }
 
         m_tasks.clear();
+        m_taskArena.Reset();
         m_posePool.Reset();
         m_hasPhysicsDependency = false;
     }
 
+    void TaskSystem::ResetForReuse()
+    {
+        Reset();
+
+        #if EE_DEVELOPMENT_TOOLS
+        SetDebugMode( TaskSystemDebugMode::Off );
+        #endif
+
+        m_posePool.SetSharedArena( nullptr );
+        m_taskContext.m_skeletonLOD = Skeleton::LOD::High;
+        m_prePhysicsTaskIndices.clear();
+        m_hasCodependentPhysicsTasks = false;
+        m_needsUpdate = false;
+        m_finalPose.Reset( Pose::Type::ReferencePose, true );
+    }
+
     //-------------------------------------------------------------------------
 
     void TaskSystem::RollbackToTaskIndexMarker( TaskIndex const marker )
@@ -43,7 +62,8 @@ namespace EE::Animation
 
         for ( int16_t t = (int16_t) m_tasks.size() - 1; t >= marker; t-- )
         {
-            EE::Delete( m_tasks[t] );
+            // The arena memory is only reclaimed on reset
+            m_tasks[t]->~Task();
             m_tasks.erase( m_tasks.begin() + t );
         }
     }
@@ -142,6 +162,9 @@ namespace EE::Animation
         else // If we have no physics dependent tasks, execute all tasks now
         {
             ExecuteTasks();
+
+            // Nothing left to do post-physics, so extract the pose right away so that any leased buffers can be reused by other characters
+            ReflectFinalPose();
         }
     }
 
@@ -159,16 +182,17 @@ namespace EE::Animation
 
         // Execute tasks
         //-------------------------------------------------------------------------
-        // Only run tasks if we have a physics dependency, else all tasks were already executed in the first update stage
+        // Only run tasks if we have a physics dependency, else all tasks were already executed and the pose reflected in the first update stage
 
         if ( m_hasPhysicsDependency )
         {
             ExecuteTasks();
+            ReflectFinalPose();
         }
+    }
 
-        // Reflect animation pose out
-        //-------------------------------------------------------------------------
-
+    void TaskSystem::ReflectFinalPose()
+    {
         if ( !m_tasks.empty() )
         {
             auto pFinalTask = m_tasks.back();
@@ -195,6 +219,8 @@ namespace EE::Animation
         {
             m_finalPose.Reset( Pose::Type::ReferencePose, true );
         }
+
+        m_posePool.ReleaseLeasedBuffers();
     }
 
     void TaskSystem::ExecuteTasks()
@@ -336,4 +362,74 @@ namespace EE::Animation
         }
     }
     #endif
+
+    //-------------------------------------------------------------------------
+
+    TaskSystemPool::~TaskSystemPool()
+    {
+        EE_ASSERT( m_numTaskSystemsInUse == 0 );
+
+        for ( auto pTaskSystem : m_freeTaskSystems )
+        {
+            EE::Delete( pTaskSystem );
+        }
+    }
+
+    TaskSystem* TaskSystemPool::AcquireTaskSystem( Skeleton const* pSkeleton )
+    {
+        EE_ASSERT( pSkeleton != nullptr );
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_numTaskSystemsInUse++;
+
+            // Reuse the most recently released task system for this skeleton
+            for ( int32_t i = (int32_t) m_freeTaskSystems.size() - 1; i >= 0; i-- )
+            {
+                TaskSystem* pTaskSystem = m_freeTaskSystems[i];
+                if ( pTaskSystem->GetSkeleton() == pSkeleton )
+                {
+                    m_freeTaskSystems.erase_unsorted( m_freeTaskSystems.begin() + i );
+                    return pTaskSystem;
+                }
+            }
+        }
+
+        return EE::New<TaskSystem>( pSkeleton );
+    }
+
+    void TaskSystemPool::ReleaseTaskSystem( TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+        pTaskSystem->ResetForReuse();
+
+        Threading::ScopeLock lock( m_mutex );
+        EE_ASSERT( m_numTaskSystemsInUse > 0 );
+        m_freeTaskSystems.emplace_back( pTaskSystem );
+        m_numTaskSystemsInUse--;
+    }
+
+    void TaskSystemPool::DestroyFreeTaskSystems( Skeleton const* pSkeleton )
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        for ( int32_t i = (int32_t) m_freeTaskSystems.size() - 1; i >= 0; i-- )
+        {
+            if ( m_freeTaskSystems[i]->GetSkeleton() == pSkeleton )
+            {
+                EE::Delete( m_freeTaskSystems[i] );
+                m_freeTaskSystems.erase_unsorted( m_freeTaskSystems.begin() + i );
+            }
+        }
+    }
+
+    TaskSystemPool::Stats TaskSystemPool::GetStats() const
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        Stats stats;
+        stats.m_numPooledTaskSystems = (int32_t) m_freeTaskSystems.size();
+        stats.m_numTaskSystemsInUse = m_numTaskSystemsInUse;
+        return stats;
+    }
 }
\ No newline at end of file
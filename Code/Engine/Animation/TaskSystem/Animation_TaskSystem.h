@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Animation_Task.h"
+#include "System/Threading/Threading.h"
+#include "System/Memory/FrameArena.h"
 
 //-------------------------------------------------------------------------
 
@@ -29,6 +31,9 @@ namespace EE::Animation
 
         void Reset();
 
+        // Return the task system to its initial state so that it can be reused by another graph instance with the same skeleton
+        void ResetForReuse();
+
         // Get the primary skeleton from this task system
         Skeleton const* GetSkeleton() const { return m_finalPose.GetSkeleton(); }
 
@@ -53,6 +58,13 @@ namespace EE::Animation
         // Run all post-physics tasks and fill out the final pose buffer
         void UpdatePostPhysics();
 
+        // Lease transient pose buffers from a shared arena instead of the task system owning them. Set to null to revert to owned buffers.
+        // Note: this must not be called while tasks are executing
+        inline void SetSharedPoseBufferArena( PoseBufferArena* pArena ) { m_posePool.SetSharedArena( pArena ); }
+
+        // Set the set of bones that the sampling tasks should decode
+        inline void SetSkeletonLOD( Skeleton::LOD lod ) { m_taskContext.m_skeletonLOD = lod; }
+
         // Cached Pose storage
         //-------------------------------------------------------------------------
 
@@ -69,7 +81,8 @@ namespace EE::Animation
         inline TaskIndex RegisterTask( ConstructorParams&&... params )
         {
             EE_ASSERT( m_tasks.size() < 0xFF );
-            auto pNewTask = m_tasks.emplace_back( EE::New<T>( std::forward<ConstructorParams>( params )... ) );
+            void* pTaskMemory = m_taskArena.Allocate( sizeof( T ), alignof( T ) );
+            auto pNewTask = m_tasks.emplace_back( new ( pTaskMemory ) T( std::forward<ConstructorParams>( params )... ) );
             m_hasPhysicsDependency |= pNewTask->HasPhysicsDependency();
             m_needsUpdate = true;
             return (TaskIndex) ( m_tasks.size() - 1 );
@@ -92,12 +105,19 @@ namespace EE::Animation
         bool AddTaskChainToPrePhysicsList( TaskIndex taskIdx );
         void ExecuteTasks();
 
+        // Copy the result of the final task into the final pose and release all transient pose buffers
+        void ReflectFinalPose();
+
         #if EE_DEVELOPMENT_TOOLS
         void CalculateTaskOffset( TaskIndex taskIdx, Float2 const& currentOffset, TInlineVector<Float2, 16>& offsets );
         #endif
 
     private:
 
+        // Tasks only live until the next reset so they are allocated linearly from a task system owned arena
+        constexpr static size_t const   s_taskArenaCapacity = 16 * 1024;
+
+        Memory::FrameArena              m_taskArena;
         TVector<Task*>                  m_tasks;
         PoseBufferPool                  m_posePool;
         TaskContext                     m_taskContext;
@@ -111,4 +131,46 @@ namespace EE::Animation
         TaskSystemDebugMode             m_debugMode = TaskSystemDebugMode::Off;
         #endif
     };
+
+    //-------------------------------------------------------------------------
+    // Task System Pool
+    //-------------------------------------------------------------------------
+    // Recycles task systems (and their pose buffer pools) per skeleton so that creating a graph instance doesnt need to allocate them.
+    // Task systems are reset when they are returned to the pool.
+
+    class TaskSystemPool
+    {
+    public:
+
+        struct Stats
+        {
+            int32_t                                 m_numPooledTaskSystems = 0;
+            int32_t                                 m_numTaskSystemsInUse = 0;
+        };
+
+    public:
+
+        TaskSystemPool() = default;
+        TaskSystemPool( TaskSystemPool const& ) = delete;
+        TaskSystemPool& operator=( TaskSystemPool const& ) = delete;
+        ~TaskSystemPool();
+
+        // Get a task system for the specified skeleton, this will create a new one if there are no free ones - this is thread-safe
+        TaskSystem* AcquireTaskSystem( Skeleton const* pSkeleton );
+
+        // Return a task system to the pool - this is thread-safe
+        void ReleaseTaskSystem( TaskSystem* pTaskSystem );
+
+        // Destroy all free task systems for the specified skeleton, needs to be called before the skeleton is unloaded
+        void DestroyFreeTaskSystems( Skeleton const* pSkeleton );
+
+        // Get the current usage stats
+        Stats GetStats() const;
+
+    private:
+
+        mutable Threading::Mutex                    m_mutex;
+        TVector<TaskSystem*>                        m_freeTaskSystems;
+        int32_t                                     m_numTaskSystemsInUse = 0;
+    };
 }
\ No newline at end of file
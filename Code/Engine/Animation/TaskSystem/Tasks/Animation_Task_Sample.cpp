@@ -17,7 +17,7 @@ namespace EE::Animation::Tasks
         EE_ASSERT( m_pAnimation != nullptr );
 
         auto pResultBuffer = GetNewPoseBuffer( context );
-        m_pAnimation->GetPose( m_time, &pResultBuffer->m_pose );
+        m_pAnimation->GetPose( m_time, &pResultBuffer->m_pose, context.m_skeletonLOD );
         MarkTaskComplete( context );
     }
 
@@ -81,6 +81,12 @@ namespace EE
         }
     }
 
+    WorldSystemDataAccessList const& CameraManager::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( WritesComponent<CameraComponent>(), WritesEntityMaps() );
+        return accessList;
+    }
+
     void CameraManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         // Maintain valid active camera ptr
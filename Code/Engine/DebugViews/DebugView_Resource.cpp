@@ -1,5 +1,10 @@
 #include "DebugView_Resource.h"
 #include "System/Resource/ResourceSystem.h"
+#include "System/Resource/ResourceSettings.h"
+#include "System/Resource/ResourcePackage.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/FileSystem/FileSystemUtils.h"
+#include "System/Time/Timers.h"
 #include "System/Systems.h"
 #include "System/Imgui/ImguiX.h"
 
@@ -38,6 +43,11 @@ namespace EE::Resource
             ImGui::SetNextWindowBgAlpha( 0.75f );
             DrawOverviewWindow( m_pResourceSystem, &m_isOverviewWindowOpen );
         }
+
+        if ( m_isBenchmarksOpen )
+        {
+            DrawBenchmarks( context );
+        }
     }
 
     void ResourceDebugView::DrawResourceMenu( EntityWorldUpdateContext const& context )
@@ -51,6 +61,199 @@ namespace EE::Resource
         {
             m_isHistoryWindowOpen = true;
         }
+
+        if ( ImGui::MenuItem( "Show Benchmarks" ) )
+        {
+            m_isBenchmarksOpen = true;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Benchmarks
+    //-------------------------------------------------------------------------
+
+    ResourceDebugView::PackageLoadBenchmarkResult ResourceDebugView::RunPackageLoadBenchmark( ResourceSettings const& settings )
+    {
+        PackageLoadBenchmarkResult results;
+
+        // Gather all the compiled resources that are also in the package
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path const packagePath = settings.m_compiledResourcePath + ResourcePackageFormat::s_defaultFileName;
+
+        ResourcePackage package;
+        if ( !package.Open( packagePath ) )
+        {
+            return results;
+        }
+
+        TVector<FileSystem::Path> compiledFiles;
+        FileSystem::GetDirectoryContents( settings.m_compiledResourcePath, compiledFiles, FileSystem::DirectoryReaderOutput::OnlyFiles );
+
+        TVector<TPair<ResourceID, FileSystem::Path>> resources;
+        for ( auto const& filePath : compiledFiles )
+        {
+            ResourceID const resourceID = ResourceID::FromFileSystemPath( settings.m_compiledResourcePath, filePath );
+            if ( resourceID.IsValid() && package.Contains( resourceID ) )
+            {
+                resources.emplace_back( resourceID, filePath );
+            }
+        }
+
+        package.Close();
+
+        if ( resources.empty() )
+        {
+            return results;
+        }
+
+        results.m_numResources = (int32_t) resources.size();
+
+        // Loose files - same as the regular resource request path i.e. open, size, read in 64KB chunks and close per resource
+        // Note: the OS file cache is not flushed, so this is only a true cold load on the first run after a reboot
+        //-------------------------------------------------------------------------
+
+        {
+            ScopedTimer<PlatformClock> timer( results.m_looseTime );
+
+            Blob fileData;
+            for ( auto const& resource : resources )
+            {
+                if ( FileSystem::LoadFile( resource.second.c_str(), fileData ) )
+                {
+                    results.m_totalBytes += fileData.size();
+                    results.m_looseNumFilesOpened++;
+                    results.m_looseNumSysCalls += 3 + (int32_t) ( ( fileData.size() + 65535 ) / 65536 );
+                }
+            }
+        }
+
+        // Package - map once, then touch every payload (development builds hash each payload on access, same as a real load)
+        //-------------------------------------------------------------------------
+
+        {
+            ScopedTimer<PlatformClock> timer( results.m_packageTime );
+
+            if ( package.Open( packagePath ) )
+            {
+                results.m_packageNumFilesOpened = 1;
+                results.m_packageNumSysCalls = 7; // Open, size, create mapping and map view + unmap and two handle closes
+
+                uint8_t const* pData = nullptr;
+                size_t dataSize = 0;
+                volatile uint8_t touched = 0;
+                for ( auto const& resource : resources )
+                {
+                    if ( package.TryGetResourceData( resource.first, pData, dataSize ) )
+                    {
+                        for ( size_t i = 0; i < dataSize; i += 4096 )
+                        {
+                            touched ^= pData[i];
+                        }
+                    }
+                }
+
+                package.Close();
+                results.m_isValid = true;
+            }
+        }
+
+        return results;
+    }
+
+    void ResourceDebugView::DrawBenchmarks( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "Resource Benchmarks", &m_isBenchmarksOpen ) )
+        {
+            ImGuiX::TextSeparator( "Resource Package" );
+
+            if ( ImGui::Button( "Run Package Load Benchmark (Package vs Loose Files)" ) )
+            {
+                m_packageLoadBenchmarkResults.emplace_back( RunPackageLoadBenchmark( m_pResourceSystem->GetSettings() ) );
+            }
+
+            if ( !m_packageLoadBenchmarkResults.empty() && ImGui::BeginTable( "PackageLoadBenchmarkTable", 8, ImGuiTableFlags_Borders ) )
+            {
+                ImGui::TableSetupColumn( "Resources" );
+                ImGui::TableSetupColumn( "Size (MB)" );
+                ImGui::TableSetupColumn( "Loose: Files" );
+                ImGui::TableSetupColumn( "Loose: Syscalls" );
+                ImGui::TableSetupColumn( "Loose (ms)" );
+                ImGui::TableSetupColumn( "Package: Files" );
+                ImGui::TableSetupColumn( "Package: Syscalls" );
+                ImGui::TableSetupColumn( "Package (ms)" );
+                ImGui::TableHeadersRow();
+
+                for ( auto const& result : m_packageLoadBenchmarkResults )
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+
+                    if ( !result.m_isValid )
+                    {
+                        ImGui::TextColored( Colors::Red.ToFloat4(), "No resource package found" );
+                        continue;
+                    }
+
+                    ImGui::Text( "%d", result.m_numResources );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.2f", result.m_totalBytes / ( 1024.0f * 1024.0f ) );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_looseNumFilesOpened );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_looseNumSysCalls );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", result.m_looseTime.ToFloat() );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_packageNumFilesOpened );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_packageNumSysCalls );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", result.m_packageTime.ToFloat() );
+                }
+
+                ImGui::EndTable();
+            }
+
+            //-------------------------------------------------------------------------
+
+            ImGuiX::TextSeparator( "Map Load" );
+
+            bool isSerialProcessingEnabled = m_pResourceSystem->IsSerialProcessingEnabled();
+            if ( ImGui::Checkbox( "Serial Request Processing (No Pipelining)", &isSerialProcessingEnabled ) )
+            {
+                m_pResourceSystem->SetSerialProcessingEnabled( isSerialProcessingEnabled );
+            }
+
+            ImGui::TextWrapped( "Load the same map (e.g. via the map loader) with each mode, every completed burst of requests is recorded below." );
+
+            auto const& busyPeriods = m_pResourceSystem->GetBusyPeriodHistory();
+            if ( !busyPeriods.empty() && ImGui::BeginTable( "MapLoadBenchmarkTable", 4, ImGuiTableFlags_Borders ) )
+            {
+                ImGui::TableSetupColumn( "Mode" );
+                ImGui::TableSetupColumn( "Completed Requests" );
+                ImGui::TableSetupColumn( "Time (ms)" );
+                ImGui::TableSetupColumn( "Requests/s" );
+                ImGui::TableHeadersRow();
+
+                for ( auto const& busyPeriod : busyPeriods )
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text( busyPeriod.m_wasSerialProcessing ? "Serial" : "Pipelined" );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", busyPeriod.m_numCompletedRequests );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.2f", busyPeriod.m_time.ToFloat() );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.1f", ( busyPeriod.m_time > 0.0f ) ? busyPeriod.m_numCompletedRequests / busyPeriod.m_time.ToSeconds().ToFloat() : 0.0f );
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
     }
 
     //-------------------------------------------------------------------------
@@ -169,6 +372,11 @@ namespace EE::Resource
         {
             ImGui::Text( "Num Resources Loaded: %d", pResourceSystem->m_resourceRecords.size() );
 
+            auto const& stats = pResourceSystem->GetStats();
+            ImGui::Text( "Requests In Flight: %d (Peak: %d)", stats.m_numRequestsInFlight, stats.m_peakRequestsInFlight );
+            ImGui::Text( "Processing Passes: %d, Parallel Stage Requests: %d", stats.m_numProcessingPasses, stats.m_numParallelStageRequests );
+            ImGui::Text( "Current Load Time: %.2fms, Last Load Time: %.2fms (Completed Requests: %d)", stats.m_currentBusyPeriodTime.ToFloat(), stats.m_lastBusyPeriodTime.ToFloat(), stats.m_numRequestsCompletedInBusyPeriod );
+
             ImGui::Separator();
 
             if ( ImGui::BeginTable( "Resource Reference Tracker Table", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable ) )
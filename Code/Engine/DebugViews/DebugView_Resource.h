@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
@@ -8,6 +9,7 @@
 namespace EE::Resource
 {
     class ResourceSystem;
+    class ResourceSettings;
 
     //-------------------------------------------------------------------------
 
@@ -15,6 +17,20 @@ namespace EE::Resource
     {
         EE_REGISTER_TYPE( ResourceDebugView );
 
+        // The cost of reading every resource in the package via the loose compiled files and via the memory mapped package
+        struct PackageLoadBenchmarkResult
+        {
+            int32_t             m_numResources = 0;
+            uint64_t            m_totalBytes = 0;
+            int32_t             m_looseNumFilesOpened = 0;
+            int32_t             m_looseNumSysCalls = 0;
+            int32_t             m_packageNumFilesOpened = 0;
+            int32_t             m_packageNumSysCalls = 0;
+            Milliseconds        m_looseTime = 0;
+            Milliseconds        m_packageTime = 0;
+            bool                m_isValid = false;
+        };
+
     public:
 
         static void DrawLogWindow( ResourceSystem* pResourceSystem, bool* pIsOpen );
@@ -31,12 +47,19 @@ namespace EE::Resource
         virtual void DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass ) override;
 
         void DrawResourceMenu( EntityWorldUpdateContext const& context );
+        void DrawBenchmarks( EntityWorldUpdateContext const& context );
+
+        static PackageLoadBenchmarkResult RunPackageLoadBenchmark( ResourceSettings const& settings );
 
     private:
 
         ResourceSystem*         m_pResourceSystem = nullptr;
         bool                    m_isHistoryWindowOpen = false;
         bool                    m_isOverviewWindowOpen = false;
+        bool                    m_isBenchmarksOpen = false;
+
+        // Benchmarks
+        TVector<PackageLoadBenchmarkResult>     m_packageLoadBenchmarkResults;
     };
 }
 #endif
\ No newline at end of file
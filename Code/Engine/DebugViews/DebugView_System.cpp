@@ -2,6 +2,13 @@
 #include "System/Imgui/ImguiX.h"
 #include "System/Profiling.h"
 #include "Engine/UpdateContext.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Threading/Threading.h"
+#include "System/Types/StringID.h"
+#include "System/Types/HashMap.h"
+#include "System/Algorithm/Hash.h"
+#include "System/Time/Timers.h"
 #include "System/Log.h"
 
 //-------------------------------------------------------------------------
@@ -68,6 +75,175 @@ namespace EE
         {
             Profiling::OpenProfiler();
         }
+
+        //-------------------------------------------------------------------------
+
+        ImGuiX::TextSeparator( "String IDs" );
+
+        if ( ImGui::MenuItem( "Run StringID Contention Benchmark", nullptr, false, context.GetSystem<TaskSystem>() != nullptr ) )
+        {
+            m_stringIDBenchmarkResults = RunStringIDBenchmark( context.GetSystem<TaskSystem>(), 100000, 1000 );
+            m_hasStringIDBenchmarkResults = true;
+        }
+
+        if ( m_hasStringIDBenchmarkResults )
+        {
+            auto const& results = m_stringIDBenchmarkResults;
+            float const numIDs = float( results.m_numThreads ) * results.m_numIDsPerThread;
+            float const speedup = ( results.m_stringCacheTime > 0.0f ) ? results.m_lockedHashMapTime.ToFloat() / results.m_stringCacheTime.ToFloat() : 0.0f;
+
+            ImGui::Text( "Threads: %d, IDs Per Thread: %d (%d new)", results.m_numThreads, results.m_numIDsPerThread, results.m_numNewIDsPerThread );
+            ImGui::Text( "String Cache: %.3fms (%.1fns per ID)", results.m_stringCacheTime.ToFloat(), results.m_stringCacheTime.ToFloat() * 1000000.0f / numIDs );
+            ImGui::Text( "Locked Hash Map: %.3fms (%.1fns per ID)", results.m_lockedHashMapTime.ToFloat(), results.m_lockedHashMapTime.ToFloat() * 1000000.0f / numIDs );
+            ImGui::Text( "Speedup: %.1fx", speedup );
+        }
+    }
+
+    SystemDebugView::StringIDBenchmarkResults SystemDebugView::RunStringIDBenchmark( TaskSystem* pTaskSystem, int32_t numIDsPerThread, int32_t numNewIDsPerThread )
+    {
+        EE_ASSERT( pTaskSystem != nullptr && numIDsPerThread > 0 && numNewIDsPerThread >= 0 && numNewIDsPerThread <= numIDsPerThread );
+
+        constexpr static int32_t const s_numSharedStrings = 2048;
+
+        // Every run needs new unique strings since the string cache never removes anything
+        static int32_t s_runIdx = 0;
+        s_runIdx++;
+
+        StringIDBenchmarkResults results;
+        results.m_numThreads = (int32_t) pTaskSystem->GetNumThreads();
+        results.m_numIDsPerThread = numIDsPerThread;
+        results.m_numNewIDsPerThread = numNewIDsPerThread;
+
+        // Create the strings up front so that we only measure the ID creation
+        //-------------------------------------------------------------------------
+        // Most IDs are created from a shared set of existing strings (the common case at runtime), a few are new strings that need to be inserted
+
+        TVector<String> sharedStrings;
+        sharedStrings.reserve( s_numSharedStrings );
+        for ( int32_t i = 0; i < s_numSharedStrings; i++ )
+        {
+            sharedStrings.emplace_back( String( String::CtorSprintf(), "StringIDBenchmark_Shared_%d", i ) );
+        }
+
+        // Each set needs its own new strings for both the string cache and the locked hash map
+        auto CreateNewStrings = [&] ( char const* pPrefix )
+        {
+            TVector<TVector<String>> newStrings;
+            newStrings.resize( results.m_numThreads );
+            for ( int32_t setIdx = 0; setIdx < results.m_numThreads; setIdx++ )
+            {
+                newStrings[setIdx].reserve( numNewIDsPerThread );
+                for ( int32_t i = 0; i < numNewIDsPerThread; i++ )
+                {
+                    newStrings[setIdx].emplace_back( String( String::CtorSprintf(), "StringIDBenchmark_%s_Run%d_Set%d_%d", pPrefix, s_runIdx, setIdx, i ) );
+                }
+            }
+            return newStrings;
+        };
+
+        TVector<TVector<String>> const stringCacheNewStrings = CreateNewStrings( "StringCache" );
+        TVector<TVector<String>> const lockedHashMapNewStrings = CreateNewStrings( "HashMap" );
+
+        // Replicates the previous string cache: a single hash map protected by a mutex
+        //-------------------------------------------------------------------------
+
+        struct LockedHashMap
+        {
+            uint32_t Register( char const* pStr )
+            {
+                uint32_t const ID = Hash::GetHash32( pStr );
+                Threading::ScopeLock lock( m_mutex );
+                auto iter = m_strings.find( ID );
+                if ( iter == m_strings.end() )
+                {
+                    m_strings[ID] = String( pStr );
+                }
+                return ID;
+            }
+
+            Threading::Mutex                    m_mutex;
+            THashMap<uint32_t, String>          m_strings;
+        };
+
+        LockedHashMap lockedHashMap;
+        for ( auto const& str : sharedStrings )
+        {
+            StringID const ID( str );
+            lockedHashMap.Register( str.c_str() );
+        }
+
+        // Run each set on its own thread
+        //-------------------------------------------------------------------------
+
+        struct StringIDTask final : public ITaskSet
+        {
+            StringIDTask( TVector<String> const& sharedStrings, TVector<TVector<String>> const& newStrings, LockedHashMap* pLockedHashMap, int32_t numIDsPerSet )
+                : m_sharedStrings( sharedStrings )
+                , m_newStrings( newStrings )
+                , m_pLockedHashMap( pLockedHashMap )
+                , m_numIDsPerSet( numIDsPerSet )
+            {
+                m_SetSize = (uint32_t) newStrings.size();
+                m_MinRange = 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint32_t setIdx = range.start; setIdx < range.end; setIdx++ )
+                {
+                    TVector<String> const& newStrings = m_newStrings[setIdx];
+                    int32_t const newStringInterval = newStrings.empty() ? INT32_MAX : m_numIDsPerSet / (int32_t) newStrings.size();
+
+                    uint32_t checksum = 0;
+                    int32_t newStringIdx = 0;
+                    for ( int32_t i = 0; i < m_numIDsPerSet; i++ )
+                    {
+                        char const* pStr = nullptr;
+                        if ( ( i % newStringInterval ) == 0 && newStringIdx < (int32_t) newStrings.size() )
+                        {
+                            pStr = newStrings[newStringIdx++].c_str();
+                        }
+                        else
+                        {
+                            pStr = m_sharedStrings[( i * 7919 + setIdx * 31 ) % m_sharedStrings.size()].c_str();
+                        }
+
+                        if ( m_pLockedHashMap != nullptr )
+                        {
+                            checksum += m_pLockedHashMap->Register( pStr );
+                        }
+                        else
+                        {
+                            checksum += StringID( pStr ).GetID();
+                        }
+                    }
+
+                    m_checksum += checksum;
+                }
+            }
+
+            TVector<String> const&              m_sharedStrings;
+            TVector<TVector<String>> const&     m_newStrings;
+            LockedHashMap*                      m_pLockedHashMap = nullptr;
+            int32_t                             m_numIDsPerSet = 0;
+            std::atomic<uint32_t>               m_checksum = 0;     // Prevents the work from being optimized away
+        };
+
+        {
+            StringIDTask task( sharedStrings, stringCacheNewStrings, nullptr, numIDsPerThread );
+            ScopedTimer<PlatformClock> timer( results.m_stringCacheTime );
+            pTaskSystem->ScheduleTask( &task );
+            pTaskSystem->WaitForTask( &task );
+        }
+
+        {
+            StringIDTask task( sharedStrings, lockedHashMapNewStrings, &lockedHashMap, numIDsPerThread );
+            ScopedTimer<PlatformClock> timer( results.m_lockedHashMapTime );
+            pTaskSystem->ScheduleTask( &task );
+            pTaskSystem->WaitForTask( &task );
+        }
+
+        return results;
     }
 
     //-------------------------------------------------------------------------
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
@@ -8,6 +9,7 @@
 namespace EE
 {
     class UpdateContext;
+    class TaskSystem;
 
     //-------------------------------------------------------------------------
 
@@ -15,6 +17,16 @@ namespace EE
     {
         EE_REGISTER_TYPE( SystemDebugView );
 
+        // Results of creating StringIDs from all threads simultaneously with the string cache and with a mutex protected hash map (the previous implementation)
+        struct StringIDBenchmarkResults
+        {
+            int32_t                     m_numThreads = 0;
+            int32_t                     m_numIDsPerThread = 0;
+            int32_t                     m_numNewIDsPerThread = 0;
+            Milliseconds                m_stringCacheTime = 0;
+            Milliseconds                m_lockedHashMapTime = 0;
+        };
+
     public:
 
         static void DrawFrameLimiterCombo( UpdateContext& context );
@@ -27,6 +39,13 @@ namespace EE
 
         virtual void DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass ) override {};
         void DrawMenu( EntityWorldUpdateContext const& context );
+
+        static StringIDBenchmarkResults RunStringIDBenchmark( TaskSystem* pTaskSystem, int32_t numIDsPerThread, int32_t numNewIDsPerThread );
+
+    private:
+
+        StringIDBenchmarkResults                            m_stringIDBenchmarkResults;
+        bool                                                m_hasStringIDBenchmarkResults = false;
     };
 
     //-------------------------------------------------------------------------
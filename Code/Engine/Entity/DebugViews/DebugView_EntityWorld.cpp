@@ -2,16 +2,25 @@
 #include "System/Imgui/ImguiX.h"
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "Engine/Entity/EntityWorld.h"
-#include "Engine/Entity/EntitySystem.h"
+#include "Engine/Entity/Entity.h"
 #include "Engine/UpdateContext.h"
 #include "Engine/Entity/EntityWorldManager.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Math/MathRandom.h"
+#include "System/Memory/FrameArena.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE
 {
+    static char const* const g_stageNames[] = { "Frame Start", "Pre-Physics", "Physics", "Post-Physics", "Frame End", "Paused" };
+    static_assert( sizeof( g_stageNames ) / sizeof( g_stageNames[0] ) == (int32_t) UpdateStage::NumStages, "Stage names out of sync" );
+
+    //-------------------------------------------------------------------------
+
     EntityDebugView::EntityDebugView()
     {
         m_menus.emplace_back( DebugMenu( "Engine/World", [this] ( EntityWorldUpdateContext const& context ) { DrawMenu( context ); } ) );
@@ -32,6 +41,30 @@ namespace EE
             if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
             DrawMapLoader( context );
         }
+
+        if ( m_isWorldSystemSchedulerOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawWorldSystemScheduler( context );
+        }
+
+        if ( m_isEntityHierarchyStatsOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawEntityHierarchyStats( context );
+        }
+
+        if ( m_isFrameArenaStatsOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawFrameArenaStats( context );
+        }
+
+        if ( m_isBenchmarksOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawBenchmarks( context );
+        }
     }
 
     void EntityDebugView::DrawMenu( EntityWorldUpdateContext const& context )
@@ -45,6 +78,414 @@ namespace EE
         {
             m_isMapLoaderOpen = true;
         }
+
+        if ( ImGui::MenuItem( "Show World System Scheduler" ) )
+        {
+            m_isWorldSystemSchedulerOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Show Entity Hierarchy Update Stats" ) )
+        {
+            m_isEntityHierarchyStatsOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Show Frame Arena Stats" ) )
+        {
+            m_isFrameArenaStatsOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Show Benchmarks" ) )
+        {
+            m_isBenchmarksOpen = true;
+        }
+
+        ImGui::Separator();
+
+        bool useBatchedUpdates = m_pWorld->IsUsingBatchedEntityUpdates();
+        if ( ImGui::MenuItem( "Batched Entity Updates", nullptr, &useBatchedUpdates ) )
+        {
+            const_cast<EntityWorld*>( m_pWorld )->SetUseBatchedEntityUpdates( useBatchedUpdates );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // World System Scheduler
+    //-------------------------------------------------------------------------
+
+    void EntityDebugView::DrawWorldSystemScheduler( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "World System Scheduler", &m_isWorldSystemSchedulerOpen ) )
+        {
+            auto const& scheduler = m_pWorld->GetWorldSystemScheduler();
+
+            bool isSerial = scheduler.GetMode() == EntityModel::WorldSystemScheduler::Mode::Serial;
+            if ( ImGui::Checkbox( "Serial Update (Debug)", &isSerial ) )
+            {
+                const_cast<EntityWorld*>( m_pWorld )->SetWorldSystemUpdateMode( isSerial ? EntityModel::WorldSystemScheduler::Mode::Serial : EntityModel::WorldSystemScheduler::Mode::Parallel );
+            }
+
+            //-------------------------------------------------------------------------
+
+            for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+            {
+                auto const& graph = scheduler.GetStageGraph( (UpdateStage) stageIdx );
+                if ( graph.m_nodes.empty() )
+                {
+                    continue;
+                }
+
+                ImGui::Separator();
+                ImGui::Text( "%s - Elapsed: %.3fms, Total System Time: %.3fms, Critical Path: %.3fms", g_stageNames[stageIdx], graph.m_elapsedTime.ToFloat(), graph.m_totalSystemTime.ToFloat(), graph.m_criticalPathTime.ToFloat() );
+
+                ImGui::Indent();
+                for ( auto waveIdx = 0u; waveIdx < graph.m_waves.size(); waveIdx++ )
+                {
+                    ImGui::Text( "Wave %u:", waveIdx );
+                    ImGui::Indent();
+                    for ( int16_t nodeIdx : graph.m_waves[waveIdx] )
+                    {
+                        auto const& node = graph.m_nodes[nodeIdx];
+                        bool const isOnCriticalPath = VectorContains( graph.m_criticalPath, nodeIdx );
+                        ImGui::TextColored( isOnCriticalPath ? ImGuiX::ImColors::Orange : ImGuiX::ImColors::White, "%s - %.3fms%s", node.m_pSystem->GetTypeInfo()->GetTypeName(), node.m_lastUpdateTime.ToFloat(), node.m_pSystem->GetDataAccess().IsDeclared() ? "" : " (Exclusive)" );
+                    }
+                    ImGui::Unindent();
+                }
+                ImGui::Unindent();
+            }
+        }
+        ImGui::End();
+    }
+
+    //-------------------------------------------------------------------------
+    // Entity Hierarchy Updates
+    //-------------------------------------------------------------------------
+
+    void EntityDebugView::DrawEntityHierarchyStats( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "Entity Hierarchy Updates", &m_isEntityHierarchyStatsOpen ) )
+        {
+            for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+            {
+                auto const& stats = m_pWorld->GetEntityHierarchyUpdateStats( (UpdateStage) stageIdx );
+                if ( stats.m_levels.empty() )
+                {
+                    continue;
+                }
+
+                ImGui::Separator();
+                ImGui::Text( "%s - Chains: %u, Largest Chain: %u entities", g_stageNames[stageIdx], stats.m_numChains, stats.m_largestChainSize );
+
+                ImGui::Indent();
+                for ( auto levelIdx = 0u; levelIdx < stats.m_levels.size(); levelIdx++ )
+                {
+                    auto const& level = stats.m_levels[levelIdx];
+                    ImGui::Text( "Level %u: %u entities - %.3fms", levelIdx, level.m_numEntities, level.m_updateTime.ToFloat() );
+                }
+                ImGui::Unindent();
+            }
+        }
+        ImGui::End();
+    }
+
+    //-------------------------------------------------------------------------
+    // Frame Arenas
+    //-------------------------------------------------------------------------
+
+    void EntityDebugView::DrawFrameArenaStats( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "Frame Arenas", &m_isFrameArenaStatsOpen ) )
+        {
+            auto const& frameArenas = m_pWorld->GetFrameArenas();
+            for ( uint32_t i = 0; i < frameArenas.GetNumArenas(); i++ )
+            {
+                auto pArena = frameArenas.GetArena( i );
+                auto const& stats = pArena->GetLastFrameStats();
+                bool const hasOverflowed = stats.m_numOverflowAllocations > 0;
+
+                ImGui::TextColored( hasOverflowed ? ImGuiX::ImColors::Orange : ImGuiX::ImColors::White, "Thread %u - Allocations: %u, Used: %.2fKB / %.2fKB, Overflow: %u (%.2fKB), High Water Mark: %.2fKB", i, stats.m_numAllocations, stats.m_usedBytes / 1024.0f, pArena->GetCapacity() / 1024.0f, stats.m_numOverflowAllocations, stats.m_overflowBytes / 1024.0f, pArena->GetHighWaterMark() / 1024.0f );
+            }
+        }
+        ImGui::End();
+    }
+
+    //-------------------------------------------------------------------------
+    // Benchmarks
+    //-------------------------------------------------------------------------
+
+    void EntityUpdateBenchmarkSystemA::Update( EntityWorldUpdateContext const& ctx ) { UpdateState( ctx.GetDeltaTime(), 1.0f ); }
+    void EntityUpdateBenchmarkSystemB::Update( EntityWorldUpdateContext const& ctx ) { UpdateState( ctx.GetDeltaTime(), 2.0f ); }
+    void EntityUpdateBenchmarkSystemC::Update( EntityWorldUpdateContext const& ctx ) { UpdateState( ctx.GetDeltaTime(), 3.0f ); }
+    void EntityUpdateBenchmarkSystemD::Update( EntityWorldUpdateContext const& ctx ) { UpdateState( ctx.GetDeltaTime(), 4.0f ); }
+
+    //-------------------------------------------------------------------------
+
+    EntityDebugView::EntityUpdateBenchmarkResult EntityDebugView::RunEntityUpdateBenchmark( EntityWorldUpdateContext const& context, int32_t numEntities, int32_t numFrames )
+    {
+        EE_ASSERT( numEntities > 0 && numFrames > 0 );
+
+        TaskSystem* pTaskSystem = context.GetSystem<TaskSystem>();
+        EE_ASSERT( pTaskSystem != nullptr );
+
+        EntityUpdateBenchmarkResult results;
+        results.m_numEntities = numEntities;
+
+        // Create entities - each entity has 1 to 4 benchmark systems, the entities are never added to a map so they are never registered with the world
+        //-------------------------------------------------------------------------
+
+        TypeSystem::TypeInfo const* const systemTypes[] = { EntityUpdateBenchmarkSystemA::s_pTypeInfo, EntityUpdateBenchmarkSystemB::s_pTypeInfo, EntityUpdateBenchmarkSystemC::s_pTypeInfo, EntityUpdateBenchmarkSystemD::s_pTypeInfo };
+
+        Math::RNG rng( 0 );
+
+        TVector<Entity*> entities;
+        entities.reserve( numEntities );
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            auto pEntity = entities.emplace_back( EE::New<Entity>() );
+            for ( int32_t typeIdx = 0; typeIdx < 4; typeIdx++ )
+            {
+                if ( typeIdx == 0 || rng.GetUInt( 0, 1 ) == 1 )
+                {
+                    pEntity->CreateSystemImmediate( systemTypes[typeIdx] );
+                    results.m_numSystems++;
+                }
+            }
+
+            pEntity->GenerateSystemUpdateList();
+        }
+
+        // Per entity update - same as the entity world's default path
+        //-------------------------------------------------------------------------
+
+        {
+            EntityModel::EntityHierarchyUpdater hierarchyUpdater;
+
+            ScopedTimer<PlatformClock> timer( results.m_perEntityUpdateTime );
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                hierarchyUpdater.Update( pTaskSystem, context, entities );
+            }
+        }
+
+        // Batched update - the batch build cost is not included since batches are only rebuilt when the update list changes
+        //-------------------------------------------------------------------------
+
+        {
+            EntityModel::EntityUpdateBatches updateBatches;
+            updateBatches.Rebuild( entities );
+
+            ScopedTimer<PlatformClock> timer( results.m_batchedUpdateTime );
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                updateBatches.Update( pTaskSystem, context );
+            }
+        }
+
+        // Clean up - the entities own and destroy their systems
+        //-------------------------------------------------------------------------
+
+        for ( auto& pEntity : entities )
+        {
+            EE::Delete( pEntity );
+        }
+
+        results.m_perEntityUpdateTime = results.m_perEntityUpdateTime.ToFloat() / numFrames;
+        results.m_batchedUpdateTime = results.m_batchedUpdateTime.ToFloat() / numFrames;
+        return results;
+    }
+
+    EntityDebugView::FrameArenaBenchmarkResult EntityDebugView::RunFrameArenaBenchmark( TaskSystem* pTaskSystem, int32_t numContainersPerThread, int32_t numFrames )
+    {
+        EE_ASSERT( pTaskSystem != nullptr && numContainersPerThread > 0 && numFrames > 0 );
+
+        FrameArenaBenchmarkResult results;
+        results.m_numContainersPerThread = numContainersPerThread;
+
+        // Each task builds a set of scratch containers of random sizes (i.e. like the per-frame query/result lists in the world systems)
+        // The heap path uses regular vectors, the arena path uses the same frame arena set setup as the entity world
+        //-------------------------------------------------------------------------
+
+        struct ScratchTask final : public ITaskSet
+        {
+            ScratchTask( Memory::FrameArenaSet* pArenas, int32_t numContainers, uint32_t numThreads )
+                : m_pArenas( pArenas )
+                , m_numContainers( numContainers )
+            {
+                m_SetSize = numThreads;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                Math::RNG rng( threadnum + 1 );
+
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    for ( int32_t c = 0; c < m_numContainers; c++ )
+                    {
+                        int32_t const numElements = (int32_t) rng.GetUInt( 4, 256 );
+
+                        if ( m_pArenas != nullptr )
+                        {
+                            TFrameVector<Vector> scratch( Memory::FrameArenaAllocator( m_pArenas->GetArena( threadnum ) ) );
+                            for ( int32_t e = 0; e < numElements; e++ )
+                            {
+                                scratch.emplace_back( Vector( (float) e ) );
+                            }
+                        }
+                        else
+                        {
+                            TVector<Vector> scratch;
+                            for ( int32_t e = 0; e < numElements; e++ )
+                            {
+                                scratch.emplace_back( Vector( (float) e ) );
+                            }
+                        }
+                    }
+                }
+            }
+
+            Memory::FrameArenaSet*  m_pArenas = nullptr;
+            int32_t                 m_numContainers = 0;
+        };
+
+        uint32_t const numThreads = pTaskSystem->GetNumThreads();
+
+        // Heap path
+        //-------------------------------------------------------------------------
+
+        {
+            ScopedTimer<PlatformClock> timer( results.m_heapTime );
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                ScratchTask scratchTask( nullptr, numContainersPerThread, numThreads );
+                pTaskSystem->ScheduleTask( &scratchTask );
+                pTaskSystem->WaitForTask( &scratchTask );
+            }
+        }
+
+        // Arena path - the arenas are reset every frame, same as the entity world
+        //-------------------------------------------------------------------------
+
+        Memory::FrameArenaSet arenas;
+        arenas.Initialize( numThreads, 1024 * 1024 );
+
+        {
+            ScopedTimer<PlatformClock> timer( results.m_arenaTime );
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                ScratchTask scratchTask( &arenas, numContainersPerThread, numThreads );
+                pTaskSystem->ScheduleTask( &scratchTask );
+                pTaskSystem->WaitForTask( &scratchTask );
+                arenas.Reset();
+            }
+        }
+
+        for ( uint32_t i = 0; i < arenas.GetNumArenas(); i++ )
+        {
+            auto const& stats = arenas.GetArena( i )->GetLastFrameStats();
+            results.m_numArenaAllocations += (int32_t) stats.m_numAllocations;
+            results.m_numArenaOverflowAllocations += (int32_t) stats.m_numOverflowAllocations;
+        }
+
+        arenas.Shutdown();
+
+        // Every arena allocation is a vector growth, so the heap path performs the same number of global allocations
+        results.m_numHeapAllocations = results.m_numArenaAllocations;
+
+        results.m_heapTime = results.m_heapTime.ToFloat() / numFrames;
+        results.m_arenaTime = results.m_arenaTime.ToFloat() / numFrames;
+        return results;
+    }
+
+    void EntityDebugView::DrawBenchmarks( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "Entity Benchmarks", &m_isBenchmarksOpen ) )
+        {
+            ImGuiX::TextSeparator( "Entity Update" );
+
+            if ( ImGui::Button( "Run Entity Update Benchmark (1k/10k/50k Entities)" ) )
+            {
+                m_entityUpdateBenchmarkResults.clear();
+                for ( int32_t numEntities : { 1000, 10000, 50000 } )
+                {
+                    m_entityUpdateBenchmarkResults.emplace_back( RunEntityUpdateBenchmark( context, numEntities, 60 ) );
+                }
+            }
+
+            if ( !m_entityUpdateBenchmarkResults.empty() && ImGui::BeginTable( "EntityUpdateBenchmarkTable", 5, ImGuiTableFlags_Borders ) )
+            {
+                ImGui::TableSetupColumn( "Entities" );
+                ImGui::TableSetupColumn( "Systems" );
+                ImGui::TableSetupColumn( "Per Entity (ms)" );
+                ImGui::TableSetupColumn( "Batched (ms)" );
+                ImGui::TableSetupColumn( "Speedup" );
+                ImGui::TableHeadersRow();
+
+                for ( auto const& result : m_entityUpdateBenchmarkResults )
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_numEntities );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_numSystems );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", result.m_perEntityUpdateTime.ToFloat() );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", result.m_batchedUpdateTime.ToFloat() );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.2fx", ( result.m_batchedUpdateTime > 0.0f ) ? result.m_perEntityUpdateTime.ToFloat() / result.m_batchedUpdateTime.ToFloat() : 0.0f );
+                }
+
+                ImGui::EndTable();
+            }
+
+            //-------------------------------------------------------------------------
+
+            ImGuiX::TextSeparator( "Frame Arena" );
+
+            if ( ImGui::Button( "Run Frame Arena Stress Benchmark (100/1k/5k Containers Per Thread)" ) )
+            {
+                m_frameArenaBenchmarkResults.clear();
+                for ( int32_t numContainers : { 100, 1000, 5000 } )
+                {
+                    m_frameArenaBenchmarkResults.emplace_back( RunFrameArenaBenchmark( context.GetSystem<TaskSystem>(), numContainers, 60 ) );
+                }
+            }
+
+            if ( !m_frameArenaBenchmarkResults.empty() && ImGui::BeginTable( "FrameArenaBenchmarkTable", 6, ImGuiTableFlags_Borders ) )
+            {
+                ImGui::TableSetupColumn( "Containers/Thread" );
+                ImGui::TableSetupColumn( "Heap Allocs/Frame" );
+                ImGui::TableSetupColumn( "Arena Allocs/Frame (Overflow)" );
+                ImGui::TableSetupColumn( "Heap (ms)" );
+                ImGui::TableSetupColumn( "Arena (ms)" );
+                ImGui::TableSetupColumn( "Speedup" );
+                ImGui::TableHeadersRow();
+
+                for ( auto const& result : m_frameArenaBenchmarkResults )
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_numContainersPerThread );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_numHeapAllocations );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d (%d)", result.m_numArenaAllocations, result.m_numArenaOverflowAllocations );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", result.m_heapTime.ToFloat() );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", result.m_arenaTime.ToFloat() );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.2fx", ( result.m_arenaTime > 0.0f ) ? result.m_heapTime.ToFloat() / result.m_arenaTime.ToFloat() : 0.0f );
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
     }
 
     //-------------------------------------------------------------------------
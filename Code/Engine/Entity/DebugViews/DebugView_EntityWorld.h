@@ -1,23 +1,98 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "Engine/Entity/EntitySystem.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE
 {
+    class TaskSystem;
     class EntityWorldManager;
     class Entity;
     class EntityComponent;
     class SpatialEntityComponent;
 
+    //-------------------------------------------------------------------------
+    // Entity Update Benchmark Systems
+    //-------------------------------------------------------------------------
+    // Minimal systems used by the entity update benchmark, each type updates its own small state every stage so that the cost is dominated
+    // by the dispatch and memory access pattern. Their priorities differ per type to match the ordering of real entity update lists.
+
+    class EE_ENGINE_API EntityUpdateBenchmarkSystem : public EntitySystem
+    {
+        EE_REGISTER_TYPE( EntityUpdateBenchmarkSystem );
+
+    protected:
+
+        virtual void RegisterComponent( EntityComponent* pComponent ) override {}
+        virtual void UnregisterComponent( EntityComponent* pComponent ) override {}
+
+        inline void UpdateState( Seconds deltaTime, float scale )
+        {
+            for ( auto& value : m_state )
+            {
+                value = value * 0.99f + deltaTime.ToFloat() * scale;
+            }
+        }
+
+    private:
+
+        float                   m_state[8] = {};
+    };
+
+    class EE_ENGINE_API EntityUpdateBenchmarkSystemA final : public EntityUpdateBenchmarkSystem
+    {
+        EE_REGISTER_ENTITY_SYSTEM( EntityUpdateBenchmarkSystemA, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::FrameEnd, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::Paused, UpdatePriority::Highest ) );
+        virtual void Update( EntityWorldUpdateContext const& ctx ) override;
+    };
+
+    class EE_ENGINE_API EntityUpdateBenchmarkSystemB final : public EntityUpdateBenchmarkSystem
+    {
+        EE_REGISTER_ENTITY_SYSTEM( EntityUpdateBenchmarkSystemB, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::High ), RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::High ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::High ), RequiresUpdate( UpdateStage::FrameEnd, UpdatePriority::High ), RequiresUpdate( UpdateStage::Paused, UpdatePriority::High ) );
+        virtual void Update( EntityWorldUpdateContext const& ctx ) override;
+    };
+
+    class EE_ENGINE_API EntityUpdateBenchmarkSystemC final : public EntityUpdateBenchmarkSystem
+    {
+        EE_REGISTER_ENTITY_SYSTEM( EntityUpdateBenchmarkSystemC, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Medium ), RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Medium ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Medium ), RequiresUpdate( UpdateStage::FrameEnd, UpdatePriority::Medium ), RequiresUpdate( UpdateStage::Paused, UpdatePriority::Medium ) );
+        virtual void Update( EntityWorldUpdateContext const& ctx ) override;
+    };
+
+    class EE_ENGINE_API EntityUpdateBenchmarkSystemD final : public EntityUpdateBenchmarkSystem
+    {
+        EE_REGISTER_ENTITY_SYSTEM( EntityUpdateBenchmarkSystemD, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Low ), RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Low ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Low ), RequiresUpdate( UpdateStage::FrameEnd, UpdatePriority::Low ), RequiresUpdate( UpdateStage::Paused, UpdatePriority::Low ) );
+        virtual void Update( EntityWorldUpdateContext const& ctx ) override;
+    };
+
     //-------------------------------------------------------------------------
 
     class EntityDebugView : public EntityWorldDebugView
     {
         EE_REGISTER_TYPE( EntityDebugView );
 
+        // Average per frame cost of updating a set of benchmark entities through the per-entity and the batched update paths
+        struct EntityUpdateBenchmarkResult
+        {
+            int32_t             m_numEntities = 0;
+            int32_t             m_numSystems = 0;
+            Milliseconds        m_perEntityUpdateTime = 0;
+            Milliseconds        m_batchedUpdateTime = 0;
+        };
+
+        // Average per frame cost of building a burst of temporary containers on every thread via the global allocator and via the frame arenas
+        struct FrameArenaBenchmarkResult
+        {
+            int32_t             m_numContainersPerThread = 0;
+            int32_t             m_numHeapAllocations = 0;
+            int32_t             m_numArenaAllocations = 0;
+            int32_t             m_numArenaOverflowAllocations = 0;
+            Milliseconds        m_heapTime = 0;
+            Milliseconds        m_arenaTime = 0;
+        };
+
     public:
 
         EntityDebugView();
@@ -29,6 +104,13 @@ namespace EE
         void DrawMenu( EntityWorldUpdateContext const& context );
         void DrawWorldBrowser( EntityWorldUpdateContext const& context );
         void DrawMapLoader( EntityWorldUpdateContext const& context );
+        void DrawWorldSystemScheduler( EntityWorldUpdateContext const& context );
+        void DrawEntityHierarchyStats( EntityWorldUpdateContext const& context );
+        void DrawFrameArenaStats( EntityWorldUpdateContext const& context );
+        void DrawBenchmarks( EntityWorldUpdateContext const& context );
+
+        static EntityUpdateBenchmarkResult RunEntityUpdateBenchmark( EntityWorldUpdateContext const& context, int32_t numEntities, int32_t numFrames );
+        static FrameArenaBenchmarkResult RunFrameArenaBenchmark( TaskSystem* pTaskSystem, int32_t numContainersPerThread, int32_t numFrames );
 
         void DrawComponentEntry( EntityComponent const* pComponent );
         void DrawSpatialComponentTree( SpatialEntityComponent const* pComponent );
@@ -37,10 +119,18 @@ namespace EE
 
         bool                    m_isWorldBrowserOpen = false;
         bool                    m_isMapLoaderOpen = false;
+        bool                    m_isWorldSystemSchedulerOpen = false;
+        bool                    m_isEntityHierarchyStatsOpen = false;
+        bool                    m_isFrameArenaStatsOpen = false;
+        bool                    m_isBenchmarksOpen = false;
 
         // Browser Data
         TVector<Entity*>        m_entities;
         Entity*                 m_pSelectedEntity = nullptr;
+
+        // Benchmarks
+        TVector<EntityUpdateBenchmarkResult>    m_entityUpdateBenchmarkResults;
+        TVector<FrameArenaBenchmarkResult>      m_frameArenaBenchmarkResults;
     };
 }
 #endif
\ No newline at end of file
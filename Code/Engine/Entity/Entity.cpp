@@ -341,6 +341,7 @@ namespace EE
                 {
                     CreateSystemImmediate( (TypeSystem::TypeInfo const*) action.m_ptr );
                     GenerateSystemUpdateList();
+                    initializationContext.m_entityUpdateListChanged = true;
                     m_deferredActions.erase( m_deferredActions.begin() + i );
                     i--;
                 }
@@ -350,6 +351,7 @@ namespace EE
                 {
                     DestroySystemImmediate( (TypeSystem::TypeInfo const*) action.m_ptr );
                     GenerateSystemUpdateList();
+                    initializationContext.m_entityUpdateListChanged = true;
                     m_deferredActions.erase( m_deferredActions.begin() + i );
                     i--;
                 }
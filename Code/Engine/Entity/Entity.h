@@ -37,6 +37,7 @@ namespace EE
         struct SerializedEntityDescriptor;
         class SerializedEntityCollection;
         struct Serializer;
+        class EntityUpdateBatches;
 
         #if EE_DEVELOPMENT_TOOLS
         class EntityStructureEditor;
@@ -55,9 +56,11 @@ namespace EE
 
         friend EntityModel::Serializer;
         friend EntityModel::EntityMap;
+        friend EntityModel::EntityUpdateBatches;
 
         #if EE_DEVELOPMENT_TOOLS
         friend EntityModel::EntityStructureEditor;
+        friend class EntityDebugView;
         #endif
 
         using SystemUpdateList = TVector<EntitySystem*>;
@@ -95,6 +95,9 @@ namespace EE::EntityModel
         Threading::LockFreeQueue<Entity*>                           m_registerForEntityUpdate;
         Threading::LockFreeQueue<Entity*>                           m_unregisterForEntityUpdate;
 
+        // Set whenever the update list or the systems of a registered entity change - used to invalidate any cached update data
+        std::atomic<bool>                                           m_entityUpdateListChanged = false;
+
     private:
 
         TVector<IEntityWorldSystem*> const&                         m_worldSystems;
@@ -39,6 +39,9 @@ namespace EE::EntityModel
         StringID                                                    m_attachmentSocketID;
         bool                                                        m_isSpatialComponent = false;
 
+        // Not-serialized - created when the owning collection is loaded, this is not updated if the descriptor is modified
+        TypeSystem::TypeInstantiationProgram                        m_instantiationProgram;
+
         #if EE_DEVELOPMENT_TOOLS
         ComponentID                                                 m_transientComponentID; // WARNING: this is not serialized, and it is only stored for undo/redo support in the tools
         #endif
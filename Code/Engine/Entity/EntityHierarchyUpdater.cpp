@@ -0,0 +1,118 @@
+#include "EntityHierarchyUpdater.h"
+#include "Entity.h"
+#include "EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Timers.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    #if EE_DEVELOPMENT_TOOLS
+    static uint32_t CalculateChainSize( Entity const* pEntity )
+    {
+        uint32_t chainSize = 1;
+        for ( auto pAttachedEntity : pEntity->GetAttachedEntities() )
+        {
+            chainSize += CalculateChainSize( pAttachedEntity );
+        }
+        return chainSize;
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    void EntityHierarchyUpdater::Update( TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context, TVector<Entity*> const& rootEntities )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+        EE_ASSERT( m_nextLevel.size_approx() == 0 );
+
+        struct EntityLevelUpdateTask final : public ITaskSet
+        {
+            EntityLevelUpdateTask( EntityWorldUpdateContext const& context, TVector<Entity*> const& entities, Threading::LockFreeQueue<Entity*>& nextLevel, bool isRootLevel )
+                : m_context( context )
+                , m_entities( entities )
+                , m_nextLevel( nextLevel )
+                , m_isRootLevel( isRootLevel )
+            {
+                m_SetSize = (uint32_t) entities.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    auto pEntity = m_entities[i];
+
+                    // Ignore any entities with spatial parents in the root level, these will be updated after their parents
+                    if ( m_isRootLevel && pEntity->HasSpatialParent() )
+                    {
+                        continue;
+                    }
+
+                    EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
+                    pEntity->UpdateSystems( m_context );
+
+                    // Attached entities can only be updated once we have completed
+                    if ( pEntity->HasAttachedEntities() )
+                    {
+                        auto const& attachedEntities = pEntity->GetAttachedEntities();
+                        m_nextLevel.enqueue_bulk( attachedEntities.data(), attachedEntities.size() );
+                    }
+                }
+            }
+
+        private:
+
+            EntityWorldUpdateContext const&              m_context;
+            TVector<Entity*> const&                      m_entities;
+            Threading::LockFreeQueue<Entity*>&           m_nextLevel;
+            bool                                         m_isRootLevel = false;
+        };
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        Stats& stats = m_stats[(int8_t) context.GetUpdateStage()];
+        stats = Stats();
+
+        for ( auto pEntity : rootEntities )
+        {
+            if ( !pEntity->HasSpatialParent() && pEntity->HasAttachedEntities() )
+            {
+                stats.m_numChains++;
+                stats.m_largestChainSize = Math::Max( stats.m_largestChainSize, CalculateChainSize( pEntity ) );
+            }
+        }
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        TVector<Entity*> const* pLevelEntities = &rootEntities;
+        while ( !pLevelEntities->empty() )
+        {
+            bool const isRootLevel = ( pLevelEntities == &rootEntities );
+
+            #if EE_DEVELOPMENT_TOOLS
+            LevelStats& levelStats = stats.m_levels.emplace_back();
+            levelStats.m_numEntities = (uint32_t) pLevelEntities->size();
+            ScopedTimer<PlatformClock> levelTimer( levelStats.m_updateTime );
+            #endif
+
+            {
+                EE_PROFILE_SCOPE_ENTITY( "Update Entity Level" );
+                EntityLevelUpdateTask levelUpdateTask( context, *pLevelEntities, m_nextLevel, isRootLevel );
+                pTaskSystem->ScheduleTask( &levelUpdateTask );
+                pTaskSystem->WaitForTask( &levelUpdateTask );
+            }
+
+            // Gather the next level
+            size_t const numAttachedEntities = m_nextLevel.size_approx();
+            m_currentLevel.resize( numAttachedEntities );
+            size_t const numDequeued = m_nextLevel.try_dequeue_bulk( m_currentLevel.data(), numAttachedEntities );
+            EE_ASSERT( numDequeued == numAttachedEntities );
+            pLevelEntities = &m_currentLevel;
+        }
+    }
+}
\ No newline at end of file
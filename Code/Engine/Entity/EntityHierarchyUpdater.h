@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/UpdateStage.h"
+#include "System/Threading/Threading.h"
+#include "System/Types/Arrays.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Entity Hierarchy Updater
+//-------------------------------------------------------------------------
+// Updates a set of root entities and all their attached entities one attachment depth level at a time.
+// Each level is run as a parallel wave and entities discover their attached children while updating, so
+// a child is only ever updated after its parent has completed. This avoids a single large attachment chain
+// (e.g. a vehicle with passengers and weapons) stalling the worker that it was assigned to.
+
+namespace EE
+{
+    class Entity;
+    class EntityWorldUpdateContext;
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API EntityHierarchyUpdater
+    {
+    public:
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct LevelStats
+        {
+            uint32_t                                    m_numEntities = 0;
+            Milliseconds                                m_updateTime = 0.0f;
+        };
+
+        struct Stats
+        {
+            TInlineVector<LevelStats, 8>                m_levels;
+            uint32_t                                    m_numChains = 0;            // Number of root entities with attached entities
+            uint32_t                                    m_largestChainSize = 0;     // Number of entities in the largest chain (including the root)
+        };
+        #endif
+
+    public:
+
+        // Update the supplied root entities and then all their attached entities, level by level
+        // Any entities in the root list that have a spatial parent are skipped, they will be updated as part of their parent's chain
+        void Update( TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context, TVector<Entity*> const& rootEntities );
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline Stats const& GetStats( UpdateStage stage ) const { EE_ASSERT( stage < UpdateStage::NumStages ); return m_stats[(int8_t) stage]; }
+        #endif
+
+    private:
+
+        TVector<Entity*>                                m_currentLevel;
+        Threading::LockFreeQueue<Entity*>               m_nextLevel;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Stats                                           m_stats[(int8_t) UpdateStage::NumStages];
+        #endif
+    };
+}
\ No newline at end of file
@@ -115,6 +115,8 @@ namespace EE::EntityModel
 
     void EntityMap::AddEntity( Entity* pEntity )
     {
+        Threading::RecursiveScopeLock lock( m_mutex );
+
         // Ensure that the entity to add, is not already part of a collection and that it is not initialized
         EE_ASSERT( pEntity != nullptr && !pEntity->IsAddedToMap() && !pEntity->HasRequestedComponentLoad() );
         EE_ASSERT( !VectorContains( m_entitiesToLoad, pEntity ) );
@@ -135,8 +137,6 @@ namespace EE::EntityModel
         // Add entity
         //-------------------------------------------------------------------------
 
-        Threading::RecursiveScopeLock lock( m_mutex );
-
         pEntity->m_mapID = m_ID;
         m_entities.emplace_back( pEntity );
         m_entitiesToLoad.emplace_back( pEntity );
@@ -607,6 +607,7 @@ namespace EE::EntityModel
                 EE_ASSERT( pEntity != nullptr && pEntity->m_updateRegistrationStatus == Entity::UpdateRegistrationStatus::QueuedForUnregister );
                 initializationContext.m_entityUpdateList.erase_first_unsorted( pEntity );
                 pEntity->m_updateRegistrationStatus = Entity::UpdateRegistrationStatus::Unregistered;
+                initializationContext.m_entityUpdateListChanged = true;
             }
 
             //-------------------------------------------------------------------------
@@ -619,6 +620,7 @@ namespace EE::EntityModel
                 EE_ASSERT( !pEntity->HasSpatialParent() ); // Attached entities are not allowed to be directly updated
                 initializationContext.m_entityUpdateList.push_back( pEntity );
                 pEntity->m_updateRegistrationStatus = Entity::UpdateRegistrationStatus::Registered;
+                initializationContext.m_entityUpdateListChanged = true;
             }
         }
 
@@ -40,7 +40,16 @@ namespace EE::EntityModel
 
         for ( EntityModel::SerializedComponentDescriptor const& componentDesc : entityDesc.m_components )
         {
-            auto pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry );
+            // Use the precomputed instantiation program if we have one, this avoids resolving the property paths for every component
+            EntityComponent* pEntityComponent = nullptr;
+            if ( componentDesc.m_instantiationProgram.IsValid() )
+            {
+                pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry, componentDesc.m_instantiationProgram );
+            }
+            else
+            {
+                pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry );
+            }
             EE_ASSERT( pEntityComponent != nullptr );
 
             TypeSystem::TypeInfo const* pTypeInfo = pEntityComponent->GetTypeInfo();
@@ -11,6 +11,7 @@ namespace EE
     class SystemRegistry;
     class EntityWorldUpdateContext;
     class EntityComponent;
+    namespace EntityModel { class EntityUpdateBatches; }
 
     //-------------------------------------------------------------------------
 
@@ -19,6 +20,7 @@ namespace EE
         EE_REGISTER_TYPE( EntitySystem );
 
         friend class Entity;
+        friend EntityModel::EntityUpdateBatches;
 
     public:
 
@@ -0,0 +1,121 @@
+#include "EntityUpdateBatches.h"
+#include "Entity.h"
+#include "EntitySystem.h"
+#include "EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+#include <eastl/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    void EntityUpdateBatches::Rebuild( TVector<Entity*> const& entityUpdateList )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Rebuild Entity Update Batches" );
+
+        Clear();
+
+        for ( auto pEntity : entityUpdateList )
+        {
+            EE_ASSERT( !pEntity->HasSpatialParent() );
+
+            if ( pEntity->HasAttachedEntities() )
+            {
+                m_chainRootEntities.emplace_back( pEntity );
+                continue;
+            }
+
+            for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+            {
+                auto& levels = m_stageLevels[stageIdx];
+                auto const& systemUpdateList = pEntity->m_systemUpdateLists[stageIdx];
+
+                if ( levels.size() < systemUpdateList.size() )
+                {
+                    levels.resize( systemUpdateList.size() );
+                }
+
+                for ( size_t i = 0; i < systemUpdateList.size(); i++ )
+                {
+                    levels[i].m_systems.emplace_back( systemUpdateList[i] );
+                }
+            }
+        }
+
+        // Group each level by system type, this doesn't affect the update order of any entity's systems since each level has at most one system per entity
+        auto comparator = [] ( EntitySystem* const& pSystemA, EntitySystem* const& pSystemB )
+        {
+            return pSystemA->GetTypeID().GetID() < pSystemB->GetTypeID().GetID();
+        };
+
+        for ( auto& levels : m_stageLevels )
+        {
+            for ( auto& level : levels )
+            {
+                eastl::stable_sort( level.m_systems.begin(), level.m_systems.end(), comparator );
+
+                level.m_numSystemTypes = 1;
+                for ( size_t i = 1; i < level.m_systems.size(); i++ )
+                {
+                    if ( level.m_systems[i]->GetTypeID() != level.m_systems[i - 1]->GetTypeID() )
+                    {
+                        level.m_numSystemTypes++;
+                    }
+                }
+            }
+        }
+    }
+
+    void EntityUpdateBatches::Clear()
+    {
+        for ( auto& levels : m_stageLevels )
+        {
+            levels.clear();
+        }
+
+        m_chainRootEntities.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityUpdateBatches::Update( TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+
+        struct SystemLevelUpdateTask final : public ITaskSet
+        {
+            SystemLevelUpdateTask( EntityWorldUpdateContext const& context, TVector<EntitySystem*> const& systems )
+                : m_context( context )
+                , m_systems( systems )
+            {
+                m_SetSize = (uint32_t) systems.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ENTITY( "Update System Level" );
+
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    m_systems[i]->Update( m_context );
+                }
+            }
+
+        private:
+
+            EntityWorldUpdateContext const&         m_context;
+            TVector<EntitySystem*> const&           m_systems;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Each level needs to complete before the next one to preserve the per-entity system order
+        for ( auto const& level : m_stageLevels[(int8_t) context.GetUpdateStage()] )
+        {
+            SystemLevelUpdateTask levelUpdateTask( context, level.m_systems );
+            pTaskSystem->ScheduleTask( &levelUpdateTask );
+            pTaskSystem->WaitForTask( &levelUpdateTask );
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/UpdateStage.h"
+#include "System/TypeSystem/TypeID.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Entity Update Batches
+//-------------------------------------------------------------------------
+// An alternative to the per-entity update path: systems are grouped by their position in their entity's update list
+// (i.e. the first system of every entity, then the second, etc...) and each group is sorted by system type. Each group
+// is dispatched as a single parallel range so the per-entity pointer chase with mixed virtual calls turns into long
+// runs of a single system type.
+//
+// Since each group only contains a single system per entity and the groups are run in order, every entity's systems
+// are updated in exactly the same order as on the per-entity path, this includes systems with equal priorities.
+//
+// Note: the batches are arrays of system pointers, the system data itself is not reorganized (i.e. no SoA layout).
+//
+// Entities with attached entities are excluded from the batches and need to be updated through the hierarchy updater,
+// since attached entities need to run after all their parent's systems. They can be updated concurrently with the batches.
+
+namespace EE
+{
+    class Entity;
+    class EntitySystem;
+    class EntityWorldUpdateContext;
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API EntityUpdateBatches
+    {
+    public:
+
+        // All the systems at the same position in their entity's update list, sorted by system type
+        struct UpdateLevel
+        {
+            TVector<EntitySystem*>                  m_systems;
+            uint32_t                                m_numSystemTypes = 0;
+        };
+
+    public:
+
+        // Regenerate all batches from the current entity update list
+        void Rebuild( TVector<Entity*> const& entityUpdateList );
+
+        // Release all batches
+        void Clear();
+
+        // Run all batched system updates for the current stage - this does not update the chain root entities
+        void Update( TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context );
+
+        inline TVector<UpdateLevel> const& GetLevels( UpdateStage stage ) const { EE_ASSERT( stage < UpdateStage::NumStages ); return m_stageLevels[(int8_t) stage]; }
+        inline TVector<Entity*> const& GetChainRootEntities() const { return m_chainRootEntities; }
+
+    private:
+
+        TVector<UpdateLevel>                        m_stageLevels[(int8_t) UpdateStage::NumStages];
+        TVector<Entity*>                            m_chainRootEntities;
+    };
+}
\ No newline at end of file
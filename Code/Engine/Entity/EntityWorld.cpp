@@ -2,6 +2,7 @@
 #include "EntityWorldUpdateContext.h"
 #include "EntityWorldDebugView.h"
 #include "System/Resource/ResourceSystem.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/Profiling.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include <eastl/sort.h>
@@ -90,6 +91,13 @@ namespace EE
             }
         }
 
+        m_worldSystemScheduler.Initialize( m_systemUpdateLists );
+
+        // Create the per-thread frame arenas
+        //-------------------------------------------------------------------------
+
+        m_frameArenas.Initialize( m_pTaskSystem->GetNumThreads(), s_frameArenaCapacityPerThread );
+
         // Create and initialize the persistent map
         //-------------------------------------------------------------------------
 
@@ -122,6 +130,9 @@ namespace EE
         // Shutdown all world systems
         //-------------------------------------------------------------------------
 
+        m_worldSystemScheduler.Shutdown();
+        m_entityUpdateBatches.Clear();
+
         for( auto pWorldSystem : m_worldSystems )
         {
             // Remove from update lists
@@ -144,6 +155,7 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        m_frameArenas.Shutdown();
         m_pTaskSystem = nullptr;
         m_initialized = false;
     }
@@ -198,6 +210,28 @@ namespace EE
     // Frame Update
     //-------------------------------------------------------------------------
 
+    void EntityWorld::SetUseBatchedEntityUpdates( bool useBatchedUpdates )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        if ( m_useBatchedEntityUpdates == useBatchedUpdates )
+        {
+            return;
+        }
+
+        m_useBatchedEntityUpdates = useBatchedUpdates;
+
+        // Force a rebuild on the next update since the batches are not maintained while disabled
+        if ( m_useBatchedEntityUpdates )
+        {
+            m_initializationContext.m_entityUpdateListChanged = true;
+        }
+        else
+        {
+            m_entityUpdateBatches.Clear();
+        }
+    }
+
     void EntityWorld::UpdateLoading()
     {
         EE_PROFILE_SCOPE_ENTITY( "World Loading" );
@@ -225,61 +259,6 @@ namespace EE
         EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( !m_isSuspended );
 
-        struct EntityUpdateTask final : public ITaskSet
-        {
-            EntityUpdateTask( EntityWorldUpdateContext const& context, TVector<Entity*>& updateList )
-                : m_context( context )
-                , m_updateList( updateList )
-            {
-                m_SetSize = (uint32_t) updateList.size();
-            }
-
-            // Only used for spatial dependency chain updates
-            inline void RecursiveEntityUpdate( Entity* pEntity )
-            {
-                pEntity->UpdateSystems( m_context );
-
-                for ( auto pAttachedEntity : pEntity->GetAttachedEntities() )
-                {
-                    RecursiveEntityUpdate( pAttachedEntity );
-                }
-            }
-
-            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
-            {
-                for ( uint64_t i = range.start; i < range.end; ++i )
-                {
-                    auto pEntity = m_updateList[i];
-
-                    // Ignore any entities with spatial parents, these will be updated by their parents
-                    if ( pEntity->HasSpatialParent() )
-                    {
-                        continue;
-                    }
-
-                    //-------------------------------------------------------------------------
-
-                    if ( pEntity->HasAttachedEntities() )
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity Chain" );
-                        RecursiveEntityUpdate( pEntity );
-                    }
-                    else // Direct entity update
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
-                        pEntity->UpdateSystems( m_context );
-                    }
-                }
-            }
-
-        private:
-
-            EntityWorldUpdateContext const&              m_context;
-            TVector<Entity*>&                            m_updateList;
-        };
-
-        //-------------------------------------------------------------------------
-
         UpdateStage const updateStage = context.GetUpdateStage();
         bool const isWorldPaused = IsPaused() && !m_timeStepRequested;
 
@@ -302,23 +281,51 @@ namespace EE
         // Update entities
         //-------------------------------------------------------------------------
 
-        EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList );
-        m_pTaskSystem->ScheduleTask( &entityUpdateTask );
-        m_pTaskSystem->WaitForTask( &entityUpdateTask );
+        if ( m_useBatchedEntityUpdates )
+        {
+            if ( m_initializationContext.m_entityUpdateListChanged.exchange( false ) )
+            {
+                m_entityUpdateBatches.Rebuild( m_entityUpdateList );
+            }
+
+            // The chains never share entities with the batches, so the chains are updated alongside the batches rather than after them
+            struct ChainUpdateTask final : public ITaskSet
+            {
+                ChainUpdateTask( EntityModel::EntityHierarchyUpdater& hierarchyUpdater, TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context, TVector<Entity*> const& chainRootEntities )
+                    : m_hierarchyUpdater( hierarchyUpdater )
+                    , m_pTaskSystem( pTaskSystem )
+                    , m_context( context )
+                    , m_chainRootEntities( chainRootEntities )
+                {}
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    m_hierarchyUpdater.Update( m_pTaskSystem, m_context, m_chainRootEntities );
+                }
 
-        // Force execution on main thread for debugging purposes
-        //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
+            private:
 
-        // Update systems
-        //-------------------------------------------------------------------------
+                EntityModel::EntityHierarchyUpdater&    m_hierarchyUpdater;
+                TaskSystem*                             m_pTaskSystem = nullptr;
+                EntityWorldUpdateContext const&         m_context;
+                TVector<Entity*> const&                 m_chainRootEntities;
+            };
 
-        for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
+            ChainUpdateTask chainUpdateTask( m_hierarchyUpdater, m_pTaskSystem, entityWorldUpdateContext, m_entityUpdateBatches.GetChainRootEntities() );
+            m_pTaskSystem->ScheduleTask( &chainUpdateTask );
+            m_entityUpdateBatches.Update( m_pTaskSystem, entityWorldUpdateContext );
+            m_pTaskSystem->WaitForTask( &chainUpdateTask );
+        }
+        else
         {
-            EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
-            EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
-            pSystem->UpdateSystem( entityWorldUpdateContext );
+            m_hierarchyUpdater.Update( m_pTaskSystem, entityWorldUpdateContext, m_entityUpdateList );
         }
 
+        // Update systems
+        //-------------------------------------------------------------------------
+
+        m_worldSystemScheduler.Update( m_pTaskSystem, entityWorldUpdateContext );
+
         //-------------------------------------------------------------------------
 
         if ( updateStage == UpdateStage::FrameEnd )
@@ -327,6 +334,24 @@ namespace EE
         }
     }
 
+    void EntityWorld::EndFrame()
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+        m_frameArenas.Reset();
+    }
+
+    Memory::FrameArena* EntityWorld::GetFrameArenaForCurrentThread() const
+    {
+        // Threads that are not owned by the task system do not get an arena, frame containers fall back to the global allocator
+        uint32_t const threadIdx = m_pTaskSystem->GetCurrentThreadIdx();
+        if ( threadIdx == uint32_t( InvalidIndex ) )
+        {
+            return nullptr;
+        }
+
+        return const_cast<Memory::FrameArenaSet&>( m_frameArenas ).GetArena( threadIdx );
+    }
+
     //-------------------------------------------------------------------------
     // Maps
     //-------------------------------------------------------------------------
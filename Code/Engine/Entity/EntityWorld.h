@@ -1,9 +1,13 @@
 #pragma once
 
 #include "EntityWorldSystem.h"
+#include "EntityWorldSystemScheduler.h"
+#include "EntityUpdateBatches.h"
+#include "EntityHierarchyUpdater.h"
 #include "EntityContexts.h"
 #include "Entity.h"
 #include "EntityMap.h"
+#include "System/Memory/FrameArena.h"
 #include "System/Render/RenderViewport.h"
 #include "System/Types/Arrays.h"
 #include "System/Drawing/DebugDrawingSystem.h"
@@ -59,6 +63,26 @@ namespace EE
         // Run entity and system updates
         void Update( UpdateContext const& context );
 
+        // Are entity systems updated in per-type batches rather than per entity
+        inline bool IsUsingBatchedEntityUpdates() const { return m_useBatchedEntityUpdates; }
+
+        // Switch between the per-entity update path and the per-system-type batched update path
+        void SetUseBatchedEntityUpdates( bool useBatchedUpdates );
+
+        // Get the current entity update batches - only valid when using batched entity updates
+        inline EntityModel::EntityUpdateBatches const& GetEntityUpdateBatches() const { return m_entityUpdateBatches; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Get the attachment chain update stats for the last update of the specified stage
+        inline EntityModel::EntityHierarchyUpdater::Stats const& GetEntityHierarchyUpdateStats( UpdateStage stage ) const { return m_hierarchyUpdater.GetStats( stage ); }
+        #endif
+
+        // Called at the end of the frame, releases all per-frame temporary allocations
+        void EndFrame();
+
+        // Get the per-thread frame arenas for this world
+        inline Memory::FrameArenaSet const& GetFrameArenas() const { return m_frameArenas; }
+
         // This function will handle all actual loading/unloading operations for the world/maps.
         // Any queued requests will be handled here as will any requests to the resource system.
         void UpdateLoading();
@@ -72,6 +96,12 @@ namespace EE
         template<typename T>
         inline T* GetWorldSystem() const { return reinterpret_cast<T*>( GetWorldSystem( T::s_entitySystemID ) ); }
 
+        // Get the scheduler responsible for the world system updates
+        inline EntityModel::WorldSystemScheduler const& GetWorldSystemScheduler() const { return m_worldSystemScheduler; }
+
+        // Should the world systems be updated in parallel (based on their declared data access) or serially on the main thread
+        inline void SetWorldSystemUpdateMode( EntityModel::WorldSystemScheduler::Mode mode ) { m_worldSystemScheduler.SetMode( mode ); }
+
         //-------------------------------------------------------------------------
         // Input
         //-------------------------------------------------------------------------
@@ -269,6 +299,13 @@ namespace EE
 
     private:
 
+        // Get the frame arena for the calling thread - only valid during world updates
+        Memory::FrameArena* GetFrameArenaForCurrentThread() const;
+
+    private:
+
+        static constexpr size_t const                                           s_frameArenaCapacityPerThread = 1024 * 1024;
+
         EntityWorldID                                                           m_worldID = UUID::GenerateID();
         TaskSystem*                                                             m_pTaskSystem = nullptr;
         Input::InputState                                                       m_inputState;
@@ -286,6 +323,11 @@ namespace EE
         // Entities
         TVector<Entity*>                                                        m_entityUpdateList;
         TVector<IEntityWorldSystem*>                                            m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        EntityModel::WorldSystemScheduler                                       m_worldSystemScheduler;
+        EntityModel::EntityUpdateBatches                                        m_entityUpdateBatches;
+        EntityModel::EntityHierarchyUpdater                                     m_hierarchyUpdater;
+        Memory::FrameArenaSet                                                   m_frameArenas;
+        bool                                                                    m_useBatchedEntityUpdates = false;
 
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
@@ -73,7 +73,10 @@ namespace EE
 
     void EntityWorldManager::EndFrame()
     {
-        // Do Nothing
+        for ( auto& pWorld : m_worlds )
+        {
+            pWorld->EndFrame();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -18,7 +18,82 @@ namespace EE
     class EntityWorldUpdateContext;
     class Entity;
     class EntityComponent;
-    namespace EntityModel { class EntityMap; }
+    namespace EntityModel { class EntityMap; class WorldSystemScheduler; }
+
+    //-------------------------------------------------------------------------
+    // World System Data Access
+    //-------------------------------------------------------------------------
+    // World systems can optionally declare the data they touch during their update.
+    // Systems within a stage that have declared their access and that do not conflict will be updated concurrently.
+    // Systems that do not declare their access are assumed to require exclusive access to the world.
+    //
+    // Note: Accesses are matched on the exact type ID, so when data is shared via a component hierarchy, declare the base type.
+    //       A world system always implicitly writes to itself.
+    //       Systems that add or remove entities from the world's maps during their update need to declare an entity map write.
+
+    struct WorldSystemDataAccess
+    {
+        enum class Target : uint8_t
+        {
+            Component,
+            WorldSystem,
+            EntityMaps
+        };
+
+        enum class Mode : uint8_t
+        {
+            Read,
+            Write
+        };
+
+    public:
+
+        WorldSystemDataAccess() = default;
+        WorldSystemDataAccess( Target target, uint32_t ID, Mode mode ) : m_ID( ID ), m_target( target ), m_mode( mode ) {}
+
+        // Do these two accesses touch the same data and is at least one of them a write
+        inline bool ConflictsWith( WorldSystemDataAccess const& rhs ) const
+        {
+            return m_target == rhs.m_target && m_ID == rhs.m_ID && ( m_mode == Mode::Write || rhs.m_mode == Mode::Write );
+        }
+
+    public:
+
+        uint32_t                                m_ID = 0;
+        Target                                  m_target = Target::Component;
+        Mode                                    m_mode = Mode::Write;
+    };
+
+    template<typename T> inline WorldSystemDataAccess ReadsComponent() { return WorldSystemDataAccess( WorldSystemDataAccess::Target::Component, T::GetStaticTypeID(), WorldSystemDataAccess::Mode::Read ); }
+    template<typename T> inline WorldSystemDataAccess WritesComponent() { return WorldSystemDataAccess( WorldSystemDataAccess::Target::Component, T::GetStaticTypeID(), WorldSystemDataAccess::Mode::Write ); }
+    template<typename T> inline WorldSystemDataAccess ReadsWorldSystem() { return WorldSystemDataAccess( WorldSystemDataAccess::Target::WorldSystem, T::s_entitySystemID, WorldSystemDataAccess::Mode::Read ); }
+    template<typename T> inline WorldSystemDataAccess WritesWorldSystem() { return WorldSystemDataAccess( WorldSystemDataAccess::Target::WorldSystem, T::s_entitySystemID, WorldSystemDataAccess::Mode::Write ); }
+    inline WorldSystemDataAccess WritesEntityMaps() { return WorldSystemDataAccess( WorldSystemDataAccess::Target::EntityMaps, 0, WorldSystemDataAccess::Mode::Write ); }
+
+    //-------------------------------------------------------------------------
+
+    struct WorldSystemDataAccessList
+    {
+        // Create a declared access list, an empty argument list means that the system touches no external data
+        template<typename... Args>
+        static WorldSystemDataAccessList Declare( Args&&... args )
+        {
+            WorldSystemDataAccessList list;
+            list.m_isDeclared = true;
+            ( list.m_accesses.emplace_back( std::forward<Args>( args ) ), ... );
+            return list;
+        }
+
+        // Has the system declared its data access - undeclared systems always run exclusively
+        inline bool IsDeclared() const { return m_isDeclared; }
+
+        inline TInlineVector<WorldSystemDataAccess, 8> const& GetAccesses() const { return m_accesses; }
+
+    private:
+
+        TInlineVector<WorldSystemDataAccess, 8>     m_accesses;
+        bool                                        m_isDeclared = false;
+    };
 
     //-------------------------------------------------------------------------
 
@@ -28,11 +103,19 @@ namespace EE
 
         friend class EntityWorld;
         friend EntityModel::EntityMap;
+        friend EntityModel::WorldSystemScheduler;
 
     public:
 
         virtual uint32_t GetSystemID() const = 0;
 
+        // Get the data this system accesses during its update - used to determine which systems can be updated concurrently
+        virtual WorldSystemDataAccessList const& GetDataAccess() const
+        {
+            static WorldSystemDataAccessList const undeclaredAccess;
+            return undeclaredAccess;
+        }
+
     protected:
 
         // Get the required update stages and priorities for this component
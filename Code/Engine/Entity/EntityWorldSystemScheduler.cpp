@@ -0,0 +1,254 @@
+#include "EntityWorldSystemScheduler.h"
+#include "EntityWorldSystem.h"
+#include "EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Timers.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    static bool DoSystemsConflict( IEntityWorldSystem* pSystemA, IEntityWorldSystem* pSystemB )
+    {
+        EE_ASSERT( pSystemA != nullptr && pSystemB != nullptr && pSystemA != pSystemB );
+
+        auto const& accessListA = pSystemA->GetDataAccess();
+        auto const& accessListB = pSystemB->GetDataAccess();
+
+        // Undeclared systems require exclusive access
+        if ( !accessListA.IsDeclared() || !accessListB.IsDeclared() )
+        {
+            return true;
+        }
+
+        // Every system implicitly writes to itself
+        WorldSystemDataAccess const selfAccessA( WorldSystemDataAccess::Target::WorldSystem, pSystemA->GetSystemID(), WorldSystemDataAccess::Mode::Write );
+        WorldSystemDataAccess const selfAccessB( WorldSystemDataAccess::Target::WorldSystem, pSystemB->GetSystemID(), WorldSystemDataAccess::Mode::Write );
+
+        for ( auto const& accessB : accessListB.GetAccesses() )
+        {
+            if ( selfAccessA.ConflictsWith( accessB ) )
+            {
+                return true;
+            }
+        }
+
+        for ( auto const& accessA : accessListA.GetAccesses() )
+        {
+            if ( selfAccessB.ConflictsWith( accessA ) )
+            {
+                return true;
+            }
+
+            for ( auto const& accessB : accessListB.GetAccesses() )
+            {
+                if ( accessA.ConflictsWith( accessB ) )
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void WorldSystemScheduler::Initialize( TVector<IEntityWorldSystem*> const* pSystemUpdateLists )
+    {
+        EE_ASSERT( pSystemUpdateLists != nullptr );
+
+        for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+        {
+            auto const& updateList = pSystemUpdateLists[stageIdx];
+            auto& graph = m_stageGraphs[stageIdx];
+            EE_ASSERT( graph.m_nodes.empty() );
+
+            // Create nodes and dependencies
+            //-------------------------------------------------------------------------
+            // A system depends on all higher priority systems that it conflicts with
+
+            int16_t const numSystems = (int16_t) updateList.size();
+            graph.m_nodes.resize( numSystems );
+
+            for ( int16_t i = 0; i < numSystems; i++ )
+            {
+                SystemNode& node = graph.m_nodes[i];
+                node.m_pSystem = updateList[i];
+                node.m_wave = 0;
+
+                for ( int16_t j = 0; j < i; j++ )
+                {
+                    if ( DoSystemsConflict( updateList[j], updateList[i] ) )
+                    {
+                        node.m_dependencies.emplace_back( j );
+                        node.m_wave = Math::Max( node.m_wave, int16_t( graph.m_nodes[j].m_wave + 1 ) );
+                    }
+                }
+            }
+
+            // Create waves
+            //-------------------------------------------------------------------------
+
+            for ( int16_t i = 0; i < numSystems; i++ )
+            {
+                int16_t const wave = graph.m_nodes[i].m_wave;
+                if ( wave >= (int16_t) graph.m_waves.size() )
+                {
+                    graph.m_waves.resize( wave + 1 );
+                }
+
+                graph.m_waves[wave].emplace_back( i );
+            }
+        }
+    }
+
+    void WorldSystemScheduler::Shutdown()
+    {
+        for ( auto& graph : m_stageGraphs )
+        {
+            graph = StageGraph();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void WorldSystemScheduler::UpdateSystem( SystemNode& node, EntityWorldUpdateContext const& context )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update World System" );
+        EE_ASSERT( node.m_pSystem->GetRequiredUpdatePriorities().IsStageEnabled( context.GetUpdateStage() ) );
+
+        #if EE_DEVELOPMENT_TOOLS
+        ScopedTimer<PlatformClock> timer( node.m_lastUpdateTime );
+        #endif
+
+        node.m_pSystem->UpdateSystem( context );
+    }
+
+    void WorldSystemScheduler::Update( TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+
+        struct WorldSystemWaveTask final : public ITaskSet
+        {
+            WorldSystemWaveTask( WorldSystemScheduler* pScheduler, EntityWorldUpdateContext const& context, StageGraph& graph, TInlineVector<int16_t, 8> const& wave )
+                : m_pScheduler( pScheduler )
+                , m_context( context )
+                , m_graph( graph )
+                , m_wave( wave )
+            {
+                m_SetSize = (uint32_t) wave.size();
+                m_MinRange = 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    m_pScheduler->UpdateSystem( m_graph.m_nodes[m_wave[i]], m_context );
+                }
+            }
+
+        private:
+
+            WorldSystemScheduler*                   m_pScheduler = nullptr;
+            EntityWorldUpdateContext const&         m_context;
+            StageGraph&                             m_graph;
+            TInlineVector<int16_t, 8> const&        m_wave;
+        };
+
+        //-------------------------------------------------------------------------
+
+        EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
+
+        auto& graph = m_stageGraphs[(int8_t) context.GetUpdateStage()];
+
+        #if EE_DEVELOPMENT_TOOLS
+        Timer<PlatformClock> stageTimer;
+        #endif
+
+        if ( m_mode == Mode::Serial )
+        {
+            for ( auto& node : graph.m_nodes )
+            {
+                UpdateSystem( node, context );
+            }
+        }
+        else
+        {
+            for ( auto const& wave : graph.m_waves )
+            {
+                // Avoid the scheduling overhead for single system waves
+                if ( wave.size() == 1 )
+                {
+                    UpdateSystem( graph.m_nodes[wave[0]], context );
+                }
+                else
+                {
+                    WorldSystemWaveTask waveTask( this, context, graph, wave );
+                    pTaskSystem->ScheduleTask( &waveTask );
+                    pTaskSystem->WaitForTask( &waveTask );
+                }
+            }
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        graph.m_elapsedTime = stageTimer.GetElapsedTimeMilliseconds();
+        CalculateCriticalPath( graph );
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    void WorldSystemScheduler::CalculateCriticalPath( StageGraph& graph )
+    {
+        graph.m_criticalPath.clear();
+        graph.m_criticalPathTime = 0.0f;
+        graph.m_totalSystemTime = 0.0f;
+
+        int16_t const numSystems = (int16_t) graph.m_nodes.size();
+        if ( numSystems == 0 )
+        {
+            return;
+        }
+
+        // Nodes are topologically sorted, so a single forward pass is enough to get the most expensive chain to each node
+        TInlineVector<float, 16> pathCosts;
+        TInlineVector<int16_t, 16> pathPredecessors;
+        pathCosts.resize( numSystems, 0.0f );
+        pathPredecessors.resize( numSystems, InvalidIndex );
+
+        int16_t endNodeIdx = 0;
+        for ( int16_t i = 0; i < numSystems; i++ )
+        {
+            SystemNode const& node = graph.m_nodes[i];
+            graph.m_totalSystemTime += node.m_lastUpdateTime;
+
+            for ( int16_t dependencyIdx : node.m_dependencies )
+            {
+                if ( pathCosts[dependencyIdx] > pathCosts[i] )
+                {
+                    pathCosts[i] = pathCosts[dependencyIdx];
+                    pathPredecessors[i] = dependencyIdx;
+                }
+            }
+
+            pathCosts[i] += node.m_lastUpdateTime.ToFloat();
+
+            if ( pathCosts[i] > pathCosts[endNodeIdx] )
+            {
+                endNodeIdx = i;
+            }
+        }
+
+        // Walk the chain backwards
+        graph.m_criticalPathTime = pathCosts[endNodeIdx];
+        for ( int16_t nodeIdx = endNodeIdx; nodeIdx != InvalidIndex; nodeIdx = pathPredecessors[nodeIdx] )
+        {
+            graph.m_criticalPath.insert( graph.m_criticalPath.begin(), nodeIdx );
+        }
+    }
+    #endif
+}
\ No newline at end of file
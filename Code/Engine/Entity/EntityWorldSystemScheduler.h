@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/UpdateStage.h"
+#include "System/Types/Arrays.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// World System Scheduler
+//-------------------------------------------------------------------------
+// Builds a per-stage dependency graph for all world systems based on their declared data access.
+// Systems are ordered by priority, and a system only depends on higher priority systems whose access conflicts with its own.
+// Each stage graph is split into waves (the longest dependency chain to each system) and each wave is executed in parallel.
+//
+// A serial mode is provided for debugging, this will run all systems on the main thread in strict priority order.
+
+namespace EE
+{
+    class TaskSystem;
+    class IEntityWorldSystem;
+    class EntityWorldUpdateContext;
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API WorldSystemScheduler
+    {
+    public:
+
+        enum class Mode : uint8_t
+        {
+            Parallel,
+            Serial,
+        };
+
+        struct SystemNode
+        {
+            IEntityWorldSystem*                         m_pSystem = nullptr;
+            TInlineVector<int16_t, 4>                   m_dependencies;         // The indices of the systems that need to complete before we can run
+            int16_t                                     m_wave = 0;             // The wave this system will run in
+
+            #if EE_DEVELOPMENT_TOOLS
+            Milliseconds                                m_lastUpdateTime = 0.0f;
+            #endif
+        };
+
+        struct StageGraph
+        {
+            TVector<SystemNode>                         m_nodes;                // All systems for this stage in priority order
+            TVector<TInlineVector<int16_t, 8>>          m_waves;                // The system indices for each wave
+
+            #if EE_DEVELOPMENT_TOOLS
+            TInlineVector<int16_t, 8>                   m_criticalPath;         // The most expensive dependency chain of the last update
+            Milliseconds                                m_criticalPathTime = 0.0f;
+            Milliseconds                                m_totalSystemTime = 0.0f;
+            Milliseconds                                m_elapsedTime = 0.0f;
+            #endif
+        };
+
+    public:
+
+        // Build the dependency graphs for all stages - the update lists are expected to be sorted by priority
+        void Initialize( TVector<IEntityWorldSystem*> const* pSystemUpdateLists );
+        void Shutdown();
+
+        // Run all world system updates for the current stage
+        void Update( TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context );
+
+        inline Mode GetMode() const { return m_mode; }
+        inline void SetMode( Mode mode ) { m_mode = mode; }
+
+        inline StageGraph const& GetStageGraph( UpdateStage stage ) const { EE_ASSERT( stage < UpdateStage::NumStages ); return m_stageGraphs[(int8_t) stage]; }
+
+    private:
+
+        void UpdateSystem( SystemNode& node, EntityWorldUpdateContext const& context );
+
+        #if EE_DEVELOPMENT_TOOLS
+        void CalculateCriticalPath( StageGraph& graph );
+        #endif
+
+    private:
+
+        StageGraph                                      m_stageGraphs[(int8_t) UpdateStage::NumStages];
+        Mode                                            m_mode = Mode::Parallel;
+    };
+}
\ No newline at end of file
@@ -54,6 +54,11 @@ namespace EE
         return m_pWorld->GetInputState();
     }
 
+    Memory::FrameArena* EntityWorldUpdateContext::GetFrameArena() const
+    {
+        return m_pWorld->GetFrameArenaForCurrentThread();
+    }
+
     float EntityWorldUpdateContext::GetTimeScale() const
     {
         return m_pWorld->GetTimeScale();
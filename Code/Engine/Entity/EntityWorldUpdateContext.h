@@ -13,6 +13,7 @@ namespace EE
     namespace Render { class Viewport; }
     namespace EntityModel{ class EntityMap; }
     namespace Drawing { class DrawingSystem; class DrawContext; }
+    namespace Memory { class FrameArena; }
 
     //-------------------------------------------------------------------------
 
@@ -53,6 +54,11 @@ namespace EE
         // Get the input state for this world
         Input::InputState const* GetInputState() const;
 
+        // Get the frame arena for the calling thread - threadsafe since each thread has its own arena
+        // Allocations are released in bulk at the end of the frame, so never hold on to this memory across frames!
+        // Returns null for threads not owned by the task system, the frame arena allocators fall back to the global allocator in that case
+        Memory::FrameArena* GetFrameArena() const;
+
         // Get the debug drawing context for this world - threadsafe
         #if EE_DEVELOPMENT_TOOLS
         [[nodiscard]] Drawing::DrawContext GetDrawingContext() const;
@@ -1,5 +1,6 @@
 #include "ResourceLoader_EntityCollection.h"
 #include "System/Serialization/BinarySerialization.h"
+#include "System/Profiling.h"
 
 //-------------------------------------------------------------------------
 
@@ -37,6 +38,22 @@ namespace EE::EntityModel
             pCollectionDesc = pEC;
         }
 
+        // Create the component instantiation programs
+        //-------------------------------------------------------------------------
+        // This needs to happen at load time since the programs depend on the type layouts of the running build
+
+        {
+            EE_PROFILE_SCOPE_ENTITY( "Create Component Instantiation Programs" );
+
+            for ( auto& entityDesc : pCollectionDesc->m_entityDescriptors )
+            {
+                for ( auto& componentDesc : entityDesc.m_components )
+                {
+                    componentDesc.CreateInstantiationProgram( *m_pTypeRegistry, componentDesc.m_instantiationProgram );
+                }
+            }
+        }
+
         // Set loaded resource
         pResourceRecord->SetResourceData( pCollectionDesc );
         return true;
@@ -3,6 +3,9 @@
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "System/Imgui/ImguiX.h"
+#include "System/Math/MathRandom.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
@@ -93,6 +96,28 @@ namespace EE::Navmesh
             ImGui::EndMenu();
         }
         #endif
+
+        //-------------------------------------------------------------------------
+
+        if ( ImGui::BeginMenu( "Native Navmesh" ) )
+        {
+            ImGui::Checkbox( "Draw Native Navmesh", &pNavmeshWorldSystem->m_drawNativeNavmesh );
+
+            NavmeshWorldSystem::QueryStats const stats = pNavmeshWorldSystem->GetQueryStats();
+            float const averageQueryTime = ( stats.m_numPathQueries > 0 ) ? stats.m_totalPathQueryTime.ToFloat() / stats.m_numPathQueries : 0.0f;
+            float const averageNodesExpanded = ( stats.m_numPathQueries > 0 ) ? float( stats.m_numNodesExpanded ) / stats.m_numPathQueries : 0.0f;
+
+            ImGui::Text( "Path Queries: %d (%d failed)", stats.m_numPathQueries, stats.m_numFailedPathQueries );
+            ImGui::Text( "Average Query Time: %.3fms (max: %.3fms)", averageQueryTime, stats.m_maxPathQueryTime.ToFloat() );
+            ImGui::Text( "Average Nodes Expanded: %.1f", averageNodesExpanded );
+
+            if ( ImGui::Button( "Reset Query Stats" ) )
+            {
+                pNavmeshWorldSystem->ResetQueryStats();
+            }
+
+            ImGui::EndMenu();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -117,9 +142,208 @@ namespace EE::Navmesh
     void NavmeshDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
         DrawNavmeshRuntimeSettings( m_pNavmeshWorldSystem );
+
+        ImGui::Separator();
+
+        if ( ImGui::MenuItem( "Show Benchmarks" ) )
+        {
+            m_isBenchmarksOpen = true;
+        }
     }
 
     void NavmeshDebugView::DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass )
-    {}
+    {
+        if ( m_isBenchmarksOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawBenchmarks( context );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Benchmarks
+    //-------------------------------------------------------------------------
+
+    NavmeshDebugView::PathQueryBenchmarkResult NavmeshDebugView::RunPathQueryBenchmark( TaskSystem* pTaskSystem, NavmeshGraph const* pGraph, int32_t numQueries )
+    {
+        EE_ASSERT( pTaskSystem != nullptr && pGraph != nullptr && pGraph->IsValid() && numQueries > 0 );
+
+        uint32_t const numThreads = pTaskSystem->GetNumThreads();
+
+        PathQueryBenchmarkResult results;
+        results.m_numPolygons = pGraph->GetNumPolygons();
+        results.m_numQueries = numQueries;
+        results.m_numThreads = (int32_t) numThreads;
+
+        // Generate the query endpoints up front from a fixed seed, so results are comparable between runs on the same navmesh
+        //-------------------------------------------------------------------------
+
+        TVector<Float3> startPositions;
+        TVector<Float3> endPositions;
+        startPositions.resize( numQueries );
+        endPositions.resize( numQueries );
+
+        Math::RNG rng( 1 );
+        uint32_t const maxPolygonIdx = uint32_t( pGraph->GetNumPolygons() - 1 );
+        for ( int32_t i = 0; i < numQueries; i++ )
+        {
+            startPositions[i] = pGraph->GetPolygon( (int32_t) rng.GetUInt( 0, maxPolygonIdx ) ).m_centroid;
+            endPositions[i] = pGraph->GetPolygon( (int32_t) rng.GetUInt( 0, maxPolygonIdx ) ).m_centroid;
+        }
+
+        Float3 const searchExtents = NavmeshWorldSystem::s_defaultSearchExtents.ToFloat3();
+
+        // Each thread gets its own query, same as the query pool in the world system
+        //-------------------------------------------------------------------------
+
+        TVector<NavmeshQuery*> queries;
+        for ( uint32_t i = 0; i < numThreads; i++ )
+        {
+            queries.emplace_back( EE::New<NavmeshQuery>( pGraph ) );
+        }
+
+        // Single threaded - also gathers the search stats
+        //-------------------------------------------------------------------------
+
+        {
+            TVector<Float3> path;
+            int64_t numNodesExpanded = 0;
+            int64_t numPathPoints = 0;
+
+            {
+                ScopedTimer<PlatformClock> timer( results.m_singleThreadedTime );
+                for ( int32_t i = 0; i < numQueries; i++ )
+                {
+                    if ( queries[0]->FindPath( startPositions[i], endPositions[i], searchExtents, path ) )
+                    {
+                        results.m_numSucceededQueries++;
+                        numPathPoints += path.size();
+                    }
+
+                    numNodesExpanded += queries[0]->GetNumNodesExpandedByLastSearch();
+                }
+            }
+
+            results.m_averageNodesExpanded = float( numNodesExpanded ) / numQueries;
+            results.m_averagePathLength = ( results.m_numSucceededQueries > 0 ) ? float( numPathPoints ) / results.m_numSucceededQueries : 0.0f;
+        }
+
+        // Multi threaded
+        //-------------------------------------------------------------------------
+
+        struct PathQueryTask final : public ITaskSet
+        {
+            PathQueryTask( TVector<NavmeshQuery*> const& queries, TVector<Float3> const& startPositions, TVector<Float3> const& endPositions, Float3 const& searchExtents )
+                : m_queries( queries )
+                , m_startPositions( startPositions )
+                , m_endPositions( endPositions )
+                , m_searchExtents( searchExtents )
+            {
+                m_SetSize = (uint32_t) startPositions.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                TVector<Float3> path;
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    m_queries[threadnum]->FindPath( m_startPositions[i], m_endPositions[i], m_searchExtents, path );
+                }
+            }
+
+            TVector<NavmeshQuery*> const&   m_queries;
+            TVector<Float3> const&          m_startPositions;
+            TVector<Float3> const&          m_endPositions;
+            Float3                          m_searchExtents;
+        };
+
+        {
+            PathQueryTask queryTask( queries, startPositions, endPositions, searchExtents );
+            ScopedTimer<PlatformClock> timer( results.m_multiThreadedTime );
+            pTaskSystem->ScheduleTask( &queryTask );
+            pTaskSystem->WaitForTask( &queryTask );
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( auto pQuery : queries )
+        {
+            EE::Delete( pQuery );
+        }
+
+        return results;
+    }
+
+    void NavmeshDebugView::DrawBenchmarks( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "Navmesh Benchmarks", &m_isBenchmarksOpen ) )
+        {
+            ImGuiX::TextSeparator( "Path Queries" );
+
+            // Benchmark the largest native navmesh in the world
+            NavmeshGraph const* pGraph = nullptr;
+            for ( auto const& registeredNavmesh : m_pNavmeshWorldSystem->m_registeredNavmeshes )
+            {
+                if ( registeredNavmesh.m_pGraph != nullptr && registeredNavmesh.m_pGraph->IsValid() )
+                {
+                    if ( pGraph == nullptr || registeredNavmesh.m_pGraph->GetNumPolygons() > pGraph->GetNumPolygons() )
+                    {
+                        pGraph = registeredNavmesh.m_pGraph;
+                    }
+                }
+            }
+
+            if ( pGraph == nullptr )
+            {
+                ImGui::Text( "No native navmesh loaded!" );
+            }
+            else if ( ImGui::Button( "Run Path Query Benchmark (100/1k/10k Queries)" ) )
+            {
+                m_pathQueryBenchmarkResults.clear();
+                for ( int32_t numQueries : { 100, 1000, 10000 } )
+                {
+                    m_pathQueryBenchmarkResults.emplace_back( RunPathQueryBenchmark( context.GetSystem<TaskSystem>(), pGraph, numQueries ) );
+                }
+            }
+
+            if ( !m_pathQueryBenchmarkResults.empty() && ImGui::BeginTable( "PathQueryBenchmarkTable", 7, ImGuiTableFlags_Borders ) )
+            {
+                ImGui::TableSetupColumn( "Polygons" );
+                ImGui::TableSetupColumn( "Queries (Succeeded)" );
+                ImGui::TableSetupColumn( "Avg Nodes Expanded" );
+                ImGui::TableSetupColumn( "Avg Path Points" );
+                ImGui::TableSetupColumn( "1 Thread (Queries/s)" );
+                ImGui::TableSetupColumn( "All Threads (Queries/s)" );
+                ImGui::TableSetupColumn( "Speedup" );
+                ImGui::TableHeadersRow();
+
+                for ( auto const& result : m_pathQueryBenchmarkResults )
+                {
+                    float const singleThreadedThroughput = ( result.m_singleThreadedTime > 0.0f ) ? result.m_numQueries / result.m_singleThreadedTime.ToSeconds().ToFloat() : 0.0f;
+                    float const multiThreadedThroughput = ( result.m_multiThreadedTime > 0.0f ) ? result.m_numQueries / result.m_multiThreadedTime.ToSeconds().ToFloat() : 0.0f;
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", result.m_numPolygons );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d (%d)", result.m_numQueries, result.m_numSucceededQueries );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.1f", result.m_averageNodesExpanded );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.1f", result.m_averagePathLength );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.0f (%.3fms)", singleThreadedThroughput, result.m_singleThreadedTime.ToFloat() );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.0f (%.3fms, %d threads)", multiThreadedThroughput, result.m_multiThreadedTime.ToFloat(), result.m_numThreads );
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.2fx", ( result.m_multiThreadedTime > 0.0f ) ? result.m_singleThreadedTime.ToFloat() / result.m_multiThreadedTime.ToFloat() : 0.0f );
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
 }
 #endif
\ No newline at end of file
@@ -3,14 +3,20 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Physics/PhysicsSystem.h"
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Navmesh
 {
     class NavmeshSystem;
     class NavmeshWorldSystem;
+    class NavmeshGraph;
 
     //-------------------------------------------------------------------------
 
@@ -18,6 +24,19 @@ namespace EE::Navmesh
     {
         EE_REGISTER_TYPE( NavmeshDebugView );
 
+        // Throughput of a fixed set of random path queries between polygons of a native navmesh, run on a single thread and across all task threads
+        struct PathQueryBenchmarkResult
+        {
+            int32_t             m_numPolygons = 0;
+            int32_t             m_numQueries = 0;
+            int32_t             m_numSucceededQueries = 0;
+            int32_t             m_numThreads = 0;
+            float               m_averageNodesExpanded = 0.0f;
+            float               m_averagePathLength = 0.0f;
+            Milliseconds        m_singleThreadedTime = 0;
+            Milliseconds        m_multiThreadedTime = 0;
+        };
+
     public:
 
         static void DrawNavmeshRuntimeSettings( NavmeshWorldSystem* pNavmeshWorldSystem );
@@ -33,10 +52,15 @@ namespace EE::Navmesh
         virtual void DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass ) override;
 
         void DrawMenu( EntityWorldUpdateContext const& context );
+        void DrawBenchmarks( EntityWorldUpdateContext const& context );
+
+        static PathQueryBenchmarkResult RunPathQueryBenchmark( TaskSystem* pTaskSystem, NavmeshGraph const* pGraph, int32_t numQueries );
 
     private:
 
-        NavmeshWorldSystem*     m_pNavmeshWorldSystem = nullptr;
+        NavmeshWorldSystem*                     m_pNavmeshWorldSystem = nullptr;
+        bool                                    m_isBenchmarksOpen = false;
+        TVector<PathQueryBenchmarkResult>       m_pathQueryBenchmarkResults;
     };
 }
 #endif
\ No newline at end of file
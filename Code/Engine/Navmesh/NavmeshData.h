@@ -1,9 +1,13 @@
 #pragma once
 
 #include "Engine/_Module/API.h"
+#include "Engine/Navmesh/NavmeshGraph.h"
 #include "System/Resource/IResource.h"
 
 //-------------------------------------------------------------------------
+// Navmesh Data
+//-------------------------------------------------------------------------
+// Contains the native polygon graph and, when NavPower is available, the NavPower graph image
 
 namespace EE::Navmesh
 {
@@ -13,15 +17,17 @@ namespace EE::Navmesh
         friend class NavmeshGenerator;
         friend class NavmeshLoader;
 
-        EE_SERIALIZE( m_graphImage );
+        EE_SERIALIZE( m_graphImage, m_graph );
 
     public:
 
-        virtual bool IsValid() const override { return !m_graphImage.empty(); }
+        virtual bool IsValid() const override { return !m_graphImage.empty() || m_graph.IsValid(); }
         inline Blob const& GetGraphImage() const { return m_graphImage; }
+        inline NavmeshGraph const& GetGraph() const { return m_graph; }
 
     private:
 
-        Blob   m_graphImage;
+        Blob            m_graphImage;
+        NavmeshGraph    m_graph;
     };
 }
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include "NavmeshGraph.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Navmesh
+{
+    static float Cross2D( Float2 const& a, Float2 const& b, Float2 const& c )
+    {
+        return ( b.m_x - a.m_x ) * ( c.m_y - a.m_y ) - ( b.m_y - a.m_y ) * ( c.m_x - a.m_x );
+    }
+
+    //-------------------------------------------------------------------------
+
+    float NavmeshGraph::GetPolygonHeight( int32_t polygonIdx, Float2 const& position ) const
+    {
+        Polygon const& polygon = GetPolygon( polygonIdx );
+        Float3 const* pVertices = GetPolygonVertices( polygon );
+
+        // Find the fan triangle containing the point and interpolate its height
+        constexpr static float const epsilon = 1.0e-4f;
+        for ( uint16_t i = 1; i < polygon.m_numVertices - 1; i++ )
+        {
+            Float3 const& a = pVertices[0];
+            Float3 const& b = pVertices[i];
+            Float3 const& c = pVertices[i + 1];
+
+            float const area = Cross2D( a, b, c );
+            if ( Math::Abs( area ) < Math::Epsilon )
+            {
+                continue;
+            }
+
+            float const u = Cross2D( b, c, position ) / area;
+            float const v = Cross2D( c, a, position ) / area;
+            float const w = 1.0f - u - v;
+            if ( u >= -epsilon && v >= -epsilon && w >= -epsilon )
+            {
+                return a.m_z * u + b.m_z * v + c.m_z * w;
+            }
+        }
+
+        return polygon.m_centroid.m_z;
+    }
+
+    bool NavmeshGraph::IsPointInPolygon( int32_t polygonIdx, Float2 const& position ) const
+    {
+        Polygon const& polygon = GetPolygon( polygonIdx );
+        Float3 const* pVertices = GetPolygonVertices( polygon );
+
+        for ( uint16_t i = 0, j = polygon.m_numVertices - 1; i < polygon.m_numVertices; j = i++ )
+        {
+            if ( Cross2D( pVertices[j], pVertices[i], position ) < -Math::Epsilon )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    Float3 NavmeshGraph::GetClosestPointOnPolygon( int32_t polygonIdx, Float3 const& position ) const
+    {
+        if ( IsPointInPolygon( polygonIdx, position ) )
+        {
+            return Float3( position.m_x, position.m_y, GetPolygonHeight( polygonIdx, position ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        Polygon const& polygon = GetPolygon( polygonIdx );
+        Float3 const* pVertices = GetPolygonVertices( polygon );
+
+        Float3 closestPoint = pVertices[0];
+        float closestDistanceSq = FLT_MAX;
+        for ( uint16_t i = 0, j = polygon.m_numVertices - 1; i < polygon.m_numVertices; j = i++ )
+        {
+            Float3 const& a = pVertices[j];
+            Float3 const& b = pVertices[i];
+
+            // Project onto the edge in 2D and interpolate the height along the edge
+            Float2 const edge( b.m_x - a.m_x, b.m_y - a.m_y );
+            float const edgeLengthSq = edge.m_x * edge.m_x + edge.m_y * edge.m_y;
+            float t = 0.0f;
+            if ( edgeLengthSq > Math::Epsilon )
+            {
+                t = ( ( position.m_x - a.m_x ) * edge.m_x + ( position.m_y - a.m_y ) * edge.m_y ) / edgeLengthSq;
+                t = Math::Clamp( t, 0.0f, 1.0f );
+            }
+
+            Float3 const pointOnEdge = a + ( b - a ) * t;
+            Float3 const delta = pointOnEdge - position;
+            float const distanceSq = delta.m_x * delta.m_x + delta.m_y * delta.m_y + delta.m_z * delta.m_z;
+            if ( distanceSq < closestDistanceSq )
+            {
+                closestDistanceSq = distanceSq;
+                closestPoint = pointOnEdge;
+            }
+        }
+
+        return closestPoint;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool NavmeshGraph::GetGridCellRange( Float2 const& min, Float2 const& max, Int2& outMinCell, Int2& outMaxCell ) const
+    {
+        if ( m_gridDimensions.m_x <= 0 || m_gridDimensions.m_y <= 0 )
+        {
+            return false;
+        }
+
+        outMinCell.m_x = (int32_t) Math::Floor( ( min.m_x - m_gridOrigin.m_x ) / m_gridCellSize );
+        outMinCell.m_y = (int32_t) Math::Floor( ( min.m_y - m_gridOrigin.m_y ) / m_gridCellSize );
+        outMaxCell.m_x = (int32_t) Math::Floor( ( max.m_x - m_gridOrigin.m_x ) / m_gridCellSize );
+        outMaxCell.m_y = (int32_t) Math::Floor( ( max.m_y - m_gridOrigin.m_y ) / m_gridCellSize );
+
+        if ( outMaxCell.m_x < 0 || outMaxCell.m_y < 0 || outMinCell.m_x >= m_gridDimensions.m_x || outMinCell.m_y >= m_gridDimensions.m_y )
+        {
+            return false;
+        }
+
+        outMinCell.m_x = Math::Max( outMinCell.m_x, 0 );
+        outMinCell.m_y = Math::Max( outMinCell.m_y, 0 );
+        outMaxCell.m_x = Math::Min( outMaxCell.m_x, m_gridDimensions.m_x - 1 );
+        outMaxCell.m_y = Math::Min( outMaxCell.m_y, m_gridDimensions.m_y - 1 );
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Math/BoundingVolumes.h"
+#include "System/Serialization/BinarySerialization.h"
+
+//-------------------------------------------------------------------------
+// Navmesh Graph
+//-------------------------------------------------------------------------
+// The native runtime navmesh format, a flat polygon graph used when we dont have any navmesh middleware
+//
+// All polygons are convex and wound counter-clockwise when viewed from above (Z-up)
+// Polygon vertices and links are stored contiguously per polygon so that a polygon and its connectivity can be read in a single linear pass
+// Each link stores its portal (the shared edge segment) so path queries never need to look at the neighbour's vertices
+// A uniform 2D grid of polygon indices is stored alongside the graph to accelerate point lookups
+
+namespace EE::Navmesh
+{
+    class EE_ENGINE_API NavmeshGraph
+    {
+        friend class NavmeshBuilder;
+        friend class NavmeshQuery;
+
+        EE_SERIALIZE( m_vertices, m_polygons, m_links, m_bounds, m_gridOrigin, m_gridCellSize, m_gridDimensions, m_gridCellOffsets, m_gridPolygonIndices );
+
+    public:
+
+        struct Polygon
+        {
+            EE_SERIALIZE( m_centroid, m_firstVertexIdx, m_firstLinkIdx, m_numVertices, m_numLinks );
+
+            Float3                      m_centroid = Float3::Zero;
+            uint32_t                    m_firstVertexIdx = 0;
+            uint32_t                    m_firstLinkIdx = 0;
+            uint16_t                    m_numVertices = 0;
+            uint16_t                    m_numLinks = 0;
+        };
+
+        // A connection to a neighbouring polygon, the portal left/right are relative to the direction of travel out of the owning polygon
+        struct Link
+        {
+            EE_SERIALIZE( m_portalLeft, m_portalRight, m_neighbourIdx );
+
+            Float3                      m_portalLeft = Float3::Zero;
+            Float3                      m_portalRight = Float3::Zero;
+            int32_t                     m_neighbourIdx = InvalidIndex;
+        };
+
+    public:
+
+        inline bool IsValid() const { return !m_polygons.empty(); }
+        inline AABB const& GetBounds() const { return m_bounds; }
+
+        inline int32_t GetNumPolygons() const { return (int32_t) m_polygons.size(); }
+        inline Polygon const& GetPolygon( int32_t polygonIdx ) const { EE_ASSERT( polygonIdx >= 0 && polygonIdx < m_polygons.size() ); return m_polygons[polygonIdx]; }
+        inline Float3 const* GetPolygonVertices( Polygon const& polygon ) const { return &m_vertices[polygon.m_firstVertexIdx]; }
+        inline Link const* GetPolygonLinks( Polygon const& polygon ) const { return m_links.empty() ? nullptr : &m_links[polygon.m_firstLinkIdx]; }
+
+        // Get the height of the polygon surface at the specified 2D position, the position is expected to be within the polygon
+        float GetPolygonHeight( int32_t polygonIdx, Float2 const& position ) const;
+
+        // Is the specified 2D position inside the polygon
+        bool IsPointInPolygon( int32_t polygonIdx, Float2 const& position ) const;
+
+        // Get the closest point on the polygon to the specified position
+        Float3 GetClosestPointOnPolygon( int32_t polygonIdx, Float3 const& position ) const;
+
+        // Get the inclusive range of grid cells that overlap the specified 2D area, returns false if the area is outside the grid
+        bool GetGridCellRange( Float2 const& min, Float2 const& max, Int2& outMinCell, Int2& outMaxCell ) const;
+
+        // Get the polygons overlapping a given grid cell
+        inline uint32_t const* GetGridCellPolygons( Int2 const& cell, uint32_t& outNumPolygons ) const
+        {
+            int32_t const cellIdx = cell.m_y * m_gridDimensions.m_x + cell.m_x;
+            EE_ASSERT( cellIdx >= 0 && cellIdx + 1 < (int32_t) m_gridCellOffsets.size() );
+            uint32_t const startIdx = m_gridCellOffsets[cellIdx];
+            outNumPolygons = m_gridCellOffsets[cellIdx + 1] - startIdx;
+            return m_gridPolygonIndices.data() + startIdx;
+        }
+
+    private:
+
+        TVector<Float3>                 m_vertices;
+        TVector<Polygon>                m_polygons;
+        TVector<Link>                   m_links;
+        AABB                            m_bounds;
+
+        // Spatial lookup grid
+        Float2                          m_gridOrigin = Float2::Zero;
+        float                           m_gridCellSize = 0.0f;
+        Int2                            m_gridDimensions = Int2( 0, 0 );
+        TVector<uint32_t>               m_gridCellOffsets;                  // Per cell start offset into the polygon index list ( num cells + 1 )
+        TVector<uint32_t>               m_gridPolygonIndices;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,499 @@
+#include "NavmeshPathRequestService.h"
+#include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Memory/FrameArena.h"
+#include "System/Algorithm/Hash.h"
+#include "System/Time/Timers.h"
+#include "System/Profiling.h"
+#include "EASTL/sort.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Navmesh
+{
+    namespace
+    {
+        struct PathSearch
+        {
+            TVector<Vector>                 m_path;
+            Milliseconds                    m_searchTime = 0;
+            int32_t                         m_requestIdx = InvalidIndex;
+            bool                            m_wasProcessed = false;
+            bool                            m_succeeded = false;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Each worker pulls the next search (in priority order) until we run out of searches or exceed the frame budget
+        struct PathSearchTask final : public ITaskSet
+        {
+            PathSearchTask( NavmeshWorldSystem* pNavmeshSystem, TFrameVector<PathSearch>& searches, TFrameVector<Vector> const& startPositions, TFrameVector<Vector> const& endPositions, Milliseconds budget, uint32_t numThreads )
+                : m_pNavmeshSystem( pNavmeshSystem )
+                , m_searches( searches )
+                , m_startPositions( startPositions )
+                , m_endPositions( endPositions )
+                , m_budget( budget )
+            {
+                m_SetSize = Math::Min( numThreads, (uint32_t) searches.size() );
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_NAVIGATION( "Path Request Searches" );
+
+                int32_t const numSearches = (int32_t) m_searches.size();
+                while ( true )
+                {
+                    int32_t const searchIdx = m_nextSearchIdx.fetch_add( 1 );
+                    if ( searchIdx >= numSearches )
+                    {
+                        break;
+                    }
+
+                    // Always run the first search so that we are guaranteed to make progress
+                    if ( searchIdx > 0 && m_timer.GetElapsedTimeMilliseconds() > m_budget )
+                    {
+                        break;
+                    }
+
+                    PathSearch& search = m_searches[searchIdx];
+                    {
+                        ScopedTimer<PlatformClock> searchTimer( search.m_searchTime );
+                        search.m_succeeded = m_pNavmeshSystem->FindPath( m_startPositions[searchIdx], m_endPositions[searchIdx], search.m_path );
+                    }
+                    search.m_wasProcessed = true;
+                }
+            }
+
+        private:
+
+            NavmeshWorldSystem*             m_pNavmeshSystem = nullptr;
+            TFrameVector<PathSearch>&       m_searches;
+            TFrameVector<Vector> const&     m_startPositions;
+            TFrameVector<Vector> const&     m_endPositions;
+            Milliseconds                    m_budget;
+            Timer<PlatformClock>            m_timer;
+            std::atomic<int32_t>            m_nextSearchIdx = 0;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+
+    PathRequestService::PathRequestService( NavmeshWorldSystem* pNavmeshSystem )
+        : m_pNavmeshSystem( pNavmeshSystem )
+    {
+        EE_ASSERT( m_pNavmeshSystem != nullptr );
+    }
+
+    uint64_t PathRequestService::GetCacheKey( Vector const& startPosition, Vector const& endPosition )
+    {
+        // The goal needs to match closely, the start only needs to be in the same neighbourhood since the path start is fixed up per request
+        float const goalScale = 1.0f / s_cacheQuantizationSize;
+        float const startScale = 1.0f / s_cacheStartNeighbourhoodSize;
+        int32_t const quantizedPositions[6] =
+        {
+            Math::FloorToInt( endPosition.m_x * goalScale ), Math::FloorToInt( endPosition.m_y * goalScale ), Math::FloorToInt( endPosition.m_z * goalScale ),
+            Math::FloorToInt( startPosition.m_x * startScale ), Math::FloorToInt( startPosition.m_y * startScale ), Math::FloorToInt( startPosition.m_z * startScale )
+        };
+
+        return Hash::XXHash::GetHash64( quantizedPositions, sizeof( quantizedPositions ) );
+    }
+
+    void PathRequestService::FixupPathStart( TVector<Vector>& path, Vector const& startPosition )
+    {
+        if ( path.size() < 2 )
+        {
+            if ( !path.empty() )
+            {
+                path[0] = startPosition;
+            }
+            return;
+        }
+
+        // Find the closest leading segment to the start position, we only need to check the part of the path within the start neighbourhood
+        int32_t closestSegmentIdx = 0;
+        float closestDistanceSq = FLT_MAX;
+        float pathLength = 0.0f;
+        int32_t const numSegments = (int32_t) path.size() - 1;
+        for ( int32_t i = 0; i < numSegments && pathLength <= ( 2.0f * s_cacheStartNeighbourhoodSize ); i++ )
+        {
+            Vector const segment = path[i + 1] - path[i];
+            float const segmentLengthSq = segment.GetLengthSquared3();
+            float const t = ( segmentLengthSq > Math::Epsilon ) ? Math::Clamp( ( startPosition - path[i] ).GetDot3( segment ) / segmentLengthSq, 0.0f, 1.0f ) : 0.0f;
+            float const distanceSq = startPosition.GetDistanceSquared3( path[i] + segment * t );
+            if ( distanceSq < closestDistanceSq )
+            {
+                closestDistanceSq = distanceSq;
+                closestSegmentIdx = i;
+            }
+
+            pathLength += Math::Sqrt( segmentLengthSq );
+        }
+
+        // Replace everything up to the closest segment with the start position i.e. go straight to the end of that segment
+        path.erase( path.begin(), path.begin() + closestSegmentIdx );
+        path[0] = startPosition;
+    }
+
+    //-------------------------------------------------------------------------
+
+    PathRequestHandle PathRequestService::RequestPath( Vector const& startPosition, Vector const& endPosition, PathRequestPriority priority, PathRequestCallback&& callback )
+    {
+        Threading::ScopeLock lock( m_requestMutex );
+
+        PathRequest& request = m_pendingRequests.emplace_back();
+        request.m_handle.m_ID = m_nextRequestID++;
+        request.m_startPosition = startPosition;
+        request.m_endPosition = endPosition;
+        request.m_callback = eastl::move( callback );
+        request.m_cacheKey = GetCacheKey( startPosition, endPosition );
+        request.m_submissionTime = PlatformClock::GetTime();
+        request.m_sequenceIdx = m_nextSequenceIdx++;
+        request.m_priority = priority;
+
+        // Handle ID wrap-around, zero is reserved for invalid handles
+        if ( m_nextRequestID == 0 )
+        {
+            m_nextRequestID = 1;
+        }
+
+        if ( !request.m_callback )
+        {
+            m_polledRequests[request.m_handle.m_ID] = PolledRequest();
+        }
+
+        return request.m_handle;
+    }
+
+    void PathRequestService::CancelRequest( PathRequestHandle const& handle )
+    {
+        if ( !handle.IsValid() )
+        {
+            return;
+        }
+
+        Threading::ScopeLock lock( m_requestMutex );
+
+        m_polledRequests.erase( handle.m_ID );
+
+        for ( auto iter = m_pendingRequests.begin(); iter != m_pendingRequests.end(); ++iter )
+        {
+            if ( iter->m_handle == handle )
+            {
+                m_pendingRequests.erase( iter );
+                return;
+            }
+        }
+
+        // The request might be in the middle of being processed, so make sure we dont call its callback
+        if ( m_isProcessing )
+        {
+            m_cancelledRequestIDs.emplace_back( handle.m_ID );
+        }
+    }
+
+    PathRequestStatus PathRequestService::GetRequestResult( PathRequestHandle const& handle, TVector<Vector>& outPath )
+    {
+        Threading::ScopeLock lock( m_requestMutex );
+
+        auto iter = m_polledRequests.find( handle.m_ID );
+        if ( iter == m_polledRequests.end() )
+        {
+            return PathRequestStatus::Invalid;
+        }
+
+        PathRequestStatus const status = iter->second.m_status;
+        if ( status != PathRequestStatus::Pending )
+        {
+            outPath = eastl::move( iter->second.m_path );
+            m_polledRequests.erase( iter );
+        }
+
+        return status;
+    }
+
+    void PathRequestService::CompleteRequest( PathRequest const& request, bool succeeded, TVector<Vector> const& path )
+    {
+        PathRequestStatus const status = succeeded ? PathRequestStatus::Succeeded : PathRequestStatus::Failed;
+
+        {
+            Threading::ScopeLock lock( m_requestMutex );
+
+            // Cancelled requests are dropped without being recorded in the latency stats
+            auto cancelledIter = VectorFind( m_cancelledRequestIDs, request.m_handle.m_ID );
+            if ( cancelledIter != m_cancelledRequestIDs.end() )
+            {
+                m_cancelledRequestIDs.erase_unsorted( cancelledIter );
+                return;
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            Milliseconds const latency = Nanoseconds( PlatformClock::GetTime().ToU64() - request.m_submissionTime.ToU64() ).ToMilliseconds();
+            m_latencySamples[m_nextLatencySampleIdx] = latency.ToFloat();
+            m_nextLatencySampleIdx = ( m_nextLatencySampleIdx + 1 ) % s_numLatencySamples;
+            m_numLatencySamples = Math::Min( m_numLatencySamples + 1, s_numLatencySamples );
+            #endif
+
+            if ( !request.m_callback )
+            {
+                // If the entry no longer exists, the request was cancelled
+                auto polledIter = m_polledRequests.find( request.m_handle.m_ID );
+                if ( polledIter != m_polledRequests.end() )
+                {
+                    polledIter->second.m_path = path;
+                    polledIter->second.m_status = status;
+                    polledIter->second.m_completionFrameIdx = m_frameIdx;
+                }
+                return;
+            }
+        }
+
+        // Callbacks are called outside the lock so that they are free to issue new requests
+        request.m_callback( request.m_handle, status, path );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void PathRequestService::Update( TaskSystem* pTaskSystem, Memory::FrameArena* pFrameArena )
+    {
+        EE_PROFILE_SCOPE_NAVIGATION( "Process Path Requests" );
+
+        Timer<PlatformClock> processingTimer;
+        m_frameIdx++;
+
+        // Remove expired cache entries
+        for ( auto iter = m_pathCache.begin(); iter != m_pathCache.end(); )
+        {
+            if ( ( m_frameIdx - iter->second.m_frameIdx ) > s_cacheLifetimeFrames )
+            {
+                iter = m_pathCache.erase( iter );
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        // Take all the pending requests and remove any unretrieved results
+        {
+            Threading::ScopeLock lock( m_requestMutex );
+
+            for ( auto iter = m_polledRequests.begin(); iter != m_polledRequests.end(); )
+            {
+                if ( iter->second.m_status != PathRequestStatus::Pending && ( m_frameIdx - iter->second.m_completionFrameIdx ) > s_polledResultLifetimeFrames )
+                {
+                    iter = m_polledRequests.erase( iter );
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+
+            m_processingRequests.clear();
+            m_processingRequests.swap( m_pendingRequests );
+            m_isProcessing = !m_processingRequests.empty();
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        Stats frameStats;
+        #endif
+
+        if ( !m_processingRequests.empty() )
+        {
+            auto comparator = [] ( PathRequest const& a, PathRequest const& b )
+            {
+                if ( a.m_priority != b.m_priority )
+                {
+                    return a.m_priority > b.m_priority;
+                }
+
+                return a.m_sequenceIdx < b.m_sequenceIdx;
+            };
+
+            eastl::sort( m_processingRequests.begin(), m_processingRequests.end(), comparator );
+
+            // Resolve requests from the cache, and coalesce requests with the same key so that they share a single search
+            //-------------------------------------------------------------------------
+
+            int32_t const numRequests = (int32_t) m_processingRequests.size();
+            Memory::FrameArenaAllocator const frameAllocator( pFrameArena );
+            TFrameVector<int32_t> requestSearchIndices( numRequests, InvalidIndex, frameAllocator );
+            TFrameVector<PathSearch> searches( frameAllocator );
+            TFrameVector<Vector> searchStartPositions( frameAllocator );
+            TFrameVector<Vector> searchEndPositions( frameAllocator );
+            searches.reserve( numRequests );
+            searchStartPositions.reserve( numRequests );
+            searchEndPositions.reserve( numRequests );
+            TFrameHashMap<uint64_t, int32_t> keyToSearchIdx( frameAllocator );
+            keyToSearchIdx.reserve( numRequests );
+
+            for ( int32_t i = 0; i < numRequests; i++ )
+            {
+                PathRequest const& request = m_processingRequests[i];
+
+                auto cacheIter = m_pathCache.find( request.m_cacheKey );
+                if ( cacheIter != m_pathCache.end() )
+                {
+                    continue;
+                }
+
+                auto searchIter = keyToSearchIdx.find( request.m_cacheKey );
+                if ( searchIter != keyToSearchIdx.end() )
+                {
+                    requestSearchIndices[i] = searchIter->second;
+                    continue;
+                }
+
+                int32_t const searchIdx = (int32_t) searches.size();
+                searches.emplace_back().m_requestIdx = i;
+                searchStartPositions.emplace_back( request.m_startPosition );
+                searchEndPositions.emplace_back( request.m_endPosition );
+                keyToSearchIdx[request.m_cacheKey] = searchIdx;
+                requestSearchIndices[i] = searchIdx;
+            }
+
+            // Run the searches
+            //-------------------------------------------------------------------------
+
+            if ( !searches.empty() )
+            {
+                Milliseconds const remainingBudget = m_frameBudget - processingTimer.GetElapsedTimeMilliseconds();
+                PathSearchTask searchTask( m_pNavmeshSystem, searches, searchStartPositions, searchEndPositions, remainingBudget, pTaskSystem->GetNumThreads() );
+                pTaskSystem->ScheduleTask( &searchTask );
+                pTaskSystem->WaitForTask( &searchTask );
+
+                for ( PathSearch const& search : searches )
+                {
+                    if ( search.m_wasProcessed )
+                    {
+                        CachedPath& cachedPath = m_pathCache[m_processingRequests[search.m_requestIdx].m_cacheKey];
+                        cachedPath.m_path = search.m_path;
+                        cachedPath.m_frameIdx = m_frameIdx;
+                        cachedPath.m_succeeded = search.m_succeeded;
+
+                        #if EE_DEVELOPMENT_TOOLS
+                        frameStats.m_numSearchesLastFrame++;
+                        frameStats.m_searchCostLastFrame += search.m_searchTime;
+                        #endif
+                    }
+                }
+            }
+
+            // Complete all resolved requests and carry over the rest
+            //-------------------------------------------------------------------------
+
+            // Requests cancelled during this update are dropped rather than carried over, since the cancelled IDs are cleared at the end of the update
+            auto CarryOverRequest = [&] ( PathRequest& request )
+            {
+                Threading::ScopeLock lock( m_requestMutex );
+
+                auto cancelledIter = VectorFind( m_cancelledRequestIDs, request.m_handle.m_ID );
+                if ( cancelledIter != m_cancelledRequestIDs.end() )
+                {
+                    m_cancelledRequestIDs.erase_unsorted( cancelledIter );
+                    return;
+                }
+
+                m_pendingRequests.emplace_back( eastl::move( request ) );
+
+                #if EE_DEVELOPMENT_TOOLS
+                frameStats.m_numCarriedOverLastFrame++;
+                #endif
+            };
+
+            TVector<Vector> sharedPath;
+            for ( int32_t i = 0; i < numRequests; i++ )
+            {
+                PathRequest& request = m_processingRequests[i];
+                int32_t const searchIdx = requestSearchIndices[i];
+
+                // Request that ran the search
+                if ( searchIdx != InvalidIndex && searches[searchIdx].m_requestIdx == i )
+                {
+                    if ( searches[searchIdx].m_wasProcessed )
+                    {
+                        CompleteRequest( request, searches[searchIdx].m_succeeded, searches[searchIdx].m_path );
+                    }
+                    else
+                    {
+                        CarryOverRequest( request );
+                    }
+                    continue;
+                }
+
+                // Requests that share another request's path (cached or from this frame), the start of the path is replaced with the request's own start position
+                auto cacheIter = m_pathCache.find( request.m_cacheKey );
+                if ( cacheIter == m_pathCache.end() )
+                {
+                    CarryOverRequest( request );
+                    continue;
+                }
+
+                sharedPath = cacheIter->second.m_path;
+                FixupPathStart( sharedPath, request.m_startPosition );
+
+                CompleteRequest( request, cacheIter->second.m_succeeded, sharedPath );
+
+                #if EE_DEVELOPMENT_TOOLS
+                frameStats.m_numCacheHitsLastFrame++;
+                #endif
+            }
+
+            m_processingRequests.clear();
+        }
+
+        //-------------------------------------------------------------------------
+
+        {
+            Threading::ScopeLock lock( m_requestMutex );
+            m_isProcessing = false;
+            m_cancelledRequestIDs.clear();
+
+            #if EE_DEVELOPMENT_TOOLS
+            frameStats.m_numPendingRequests = (int32_t) m_pendingRequests.size();
+            frameStats.m_processingTimeLastFrame = processingTimer.GetElapsedTimeMilliseconds();
+            m_stats = frameStats;
+            #endif
+        }
+    }
+
+    void PathRequestService::ClearCache()
+    {
+        m_pathCache.clear();
+    }
+
+    void PathRequestService::Reset()
+    {
+        Threading::ScopeLock lock( m_requestMutex );
+        m_pendingRequests.clear();
+        m_polledRequests.clear();
+        m_cancelledRequestIDs.clear();
+        m_pathCache.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    PathRequestService::Stats PathRequestService::GetStats() const
+    {
+        Threading::ScopeLock lock( m_requestMutex );
+
+        Stats stats = m_stats;
+        if ( m_numLatencySamples > 0 )
+        {
+            TArray<float, s_numLatencySamples> sortedSamples = m_latencySamples;
+            eastl::sort( sortedSamples.begin(), sortedSamples.begin() + m_numLatencySamples );
+
+            auto GetPercentile = [&] ( float percentile ) { return sortedSamples[Math::RoundToInt( percentile * ( m_numLatencySamples - 1 ) )]; };
+            stats.m_latencyP50 = GetPercentile( 0.5f );
+            stats.m_latencyP90 = GetPercentile( 0.9f );
+            stats.m_latencyP99 = GetPercentile( 0.99f );
+            stats.m_latencyMax = sortedSamples[m_numLatencySamples - 1];
+        }
+
+        return stats;
+    }
+    #endif
+}
\ No newline at end of file
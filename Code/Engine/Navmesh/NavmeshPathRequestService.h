@@ -0,0 +1,200 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Math/Vector.h"
+#include "System/Types/Arrays.h"
+#include "System/Types/Function.h"
+#include "System/Types/HashMap.h"
+#include "System/Threading/Threading.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Path Request Service
+//-------------------------------------------------------------------------
+// Asynchronous path queries against the native navmesh graphs of a world
+//
+// Requests can be submitted from any thread and are processed once per frame by the navmesh world system
+// Requests are processed in priority order (FIFO within a priority) across the task system workers until the frame budget is exhausted
+// Any unprocessed requests are carried over to the next frame, at least one search is always run per frame so we are guaranteed to make progress
+//
+// Results are delivered either through the completion callback (called from the navmesh world system update) or by polling the request handle
+// Requests with a callback are not pollable, polled results are discarded if they are not retrieved within a few frames
+//
+// Recently found paths are cached using the quantized goal and a coarse start neighbourhood, so that groups of AI moving to a shared goal only need a single search
+// The start of a shared path is adjusted for each requester when the result is handed out
+
+namespace EE { class TaskSystem; }
+namespace EE::Memory { class FrameArena; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Navmesh
+{
+    class NavmeshWorldSystem;
+
+    //-------------------------------------------------------------------------
+
+    struct PathRequestHandle
+    {
+        inline bool IsValid() const { return m_ID != 0; }
+        inline void Clear() { m_ID = 0; }
+
+        inline bool operator==( PathRequestHandle const& rhs ) const { return m_ID == rhs.m_ID; }
+        inline bool operator!=( PathRequestHandle const& rhs ) const { return m_ID != rhs.m_ID; }
+
+    public:
+
+        uint32_t                        m_ID = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    enum class PathRequestStatus : uint8_t
+    {
+        Invalid = 0,                    // Unknown request i.e. never issued, cancelled, expired or already retrieved
+        Pending,
+        Succeeded,
+        Failed,
+    };
+
+    // Higher priority requests are processed first
+    enum class PathRequestPriority : uint8_t
+    {
+        Low = 0,
+        Normal,
+        High,
+    };
+
+    using PathRequestCallback = TFunction<void( PathRequestHandle handle, PathRequestStatus status, TVector<Vector> const& path )>;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API PathRequestService
+    {
+        struct PathRequest
+        {
+            PathRequestHandle           m_handle;
+            Vector                      m_startPosition;
+            Vector                      m_endPosition;
+            PathRequestCallback         m_callback;
+            uint64_t                    m_cacheKey = 0;
+            Nanoseconds                 m_submissionTime;
+            uint32_t                    m_sequenceIdx = 0;
+            PathRequestPriority         m_priority = PathRequestPriority::Normal;
+        };
+
+        struct PolledRequest
+        {
+            TVector<Vector>             m_path;
+            uint64_t                    m_completionFrameIdx = 0;
+            PathRequestStatus           m_status = PathRequestStatus::Pending;
+        };
+
+        struct CachedPath
+        {
+            TVector<Vector>             m_path;
+            uint64_t                    m_frameIdx = 0;
+            bool                        m_succeeded = false;
+        };
+
+    public:
+
+        // The default wall-clock time we are allowed to spend on path searches each frame
+        constexpr static float const s_defaultFrameBudgetMS = 2.0f;
+
+        // The size of the grid cells used to quantize the request goal for the path cache
+        constexpr static float const s_cacheQuantizationSize = 0.5f;
+
+        // The size of the grid cells used to group request start positions for the path cache, requests starting in the same cell share a path
+        constexpr static float const s_cacheStartNeighbourhoodSize = 4.0f;
+
+        // How many frames a cached path remains valid for
+        constexpr static uint64_t const s_cacheLifetimeFrames = 30;
+
+        // How many frames a completed (polled) request is kept around for before being discarded
+        constexpr static uint64_t const s_polledResultLifetimeFrames = 30;
+
+        #if EE_DEVELOPMENT_TOOLS
+        constexpr static int32_t const s_numLatencySamples = 256;
+
+        struct Stats
+        {
+            int32_t                     m_numPendingRequests = 0;
+            int32_t                     m_numSearchesLastFrame = 0;
+            int32_t                     m_numCacheHitsLastFrame = 0;
+            int32_t                     m_numCarriedOverLastFrame = 0;
+            Milliseconds                m_searchCostLastFrame = 0;          // Sum of all search times across all workers
+            Milliseconds                m_processingTimeLastFrame = 0;      // Wall-clock time spent processing requests
+            Milliseconds                m_latencyP50 = 0;                   // Queue latency percentiles, from submission to completion
+            Milliseconds                m_latencyP90 = 0;
+            Milliseconds                m_latencyP99 = 0;
+            Milliseconds                m_latencyMax = 0;
+        };
+        #endif
+
+    public:
+
+        PathRequestService( NavmeshWorldSystem* pNavmeshSystem );
+
+        // Queue a path request, the callback is optional, if not supplied the result needs to be polled for via 'GetRequestResult'
+        PathRequestHandle RequestPath( Vector const& startPosition, Vector const& endPosition, PathRequestPriority priority = PathRequestPriority::Normal, PathRequestCallback&& callback = PathRequestCallback() );
+
+        // Cancel a pending request or discard a completed one, callbacks will not be called for cancelled requests
+        void CancelRequest( PathRequestHandle const& handle );
+
+        // Get the result of a polled request, once a completed result has been retrieved the handle becomes invalid
+        PathRequestStatus GetRequestResult( PathRequestHandle const& handle, TVector<Vector>& outPath );
+
+        // Set the wall-clock time we are allowed to spend on path searches each frame
+        inline void SetFrameBudget( Milliseconds budget ) { m_frameBudget = budget; }
+        inline Milliseconds GetFrameBudget() const { return m_frameBudget; }
+
+        // Process the queued requests, this is called by the navmesh world system once per frame
+        // All the per-frame scratch data is allocated from the supplied frame arena (if any)
+        void Update( TaskSystem* pTaskSystem, Memory::FrameArena* pFrameArena = nullptr );
+
+        // Clear all cached paths, needs to be called whenever the set of navmeshes changes
+        void ClearCache();
+
+        // Drop all requests and cached data, callbacks will not be called
+        void Reset();
+
+        #if EE_DEVELOPMENT_TOOLS
+        Stats GetStats() const;
+        #endif
+
+    private:
+
+        static uint64_t GetCacheKey( Vector const& startPosition, Vector const& endPosition );
+
+        // Adjust a path found for another start position in the same neighbourhood so that it begins at the specified start position
+        static void FixupPathStart( TVector<Vector>& path, Vector const& startPosition );
+
+        void CompleteRequest( PathRequest const& request, bool succeeded, TVector<Vector> const& path );
+
+    private:
+
+        NavmeshWorldSystem*                         m_pNavmeshSystem = nullptr;
+        Milliseconds                                m_frameBudget = s_defaultFrameBudgetMS;
+
+        mutable Threading::Mutex                    m_requestMutex;
+        TVector<PathRequest>                        m_pendingRequests;
+        THashMap<uint32_t, PolledRequest>           m_polledRequests;
+        TVector<uint32_t>                           m_cancelledRequestIDs;      // Cancelled requests that are currently being processed
+        uint32_t                                    m_nextRequestID = 1;
+        uint32_t                                    m_nextSequenceIdx = 0;
+        bool                                        m_isProcessing = false;
+
+        // Only accessed during the update
+        TVector<PathRequest>                        m_processingRequests;
+        THashMap<uint64_t, CachedPath>              m_pathCache;
+        uint64_t                                    m_frameIdx = 0;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Stats                                       m_stats;
+        TArray<float, s_numLatencySamples>          m_latencySamples;
+        int32_t                                     m_numLatencySamples = 0;
+        int32_t                                     m_nextLatencySampleIdx = 0;
+        #endif
+    };
+}
\ No newline at end of file
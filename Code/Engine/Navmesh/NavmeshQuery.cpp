@@ -0,0 +1,423 @@
+#include "NavmeshQuery.h"
+#include <EASTL/heap.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Navmesh
+{
+    // Positive if c is to the left of the line a->b when viewed from above
+    static float Cross2D( Float3 const& a, Float3 const& b, Float3 const& c )
+    {
+        return ( b.m_x - a.m_x ) * ( c.m_y - a.m_y ) - ( b.m_y - a.m_y ) * ( c.m_x - a.m_x );
+    }
+
+    static float Distance( Float3 const& a, Float3 const& b )
+    {
+        Float3 const delta = b - a;
+        return Math::Sqrt( delta.m_x * delta.m_x + delta.m_y * delta.m_y + delta.m_z * delta.m_z );
+    }
+
+    static bool IsNearEqual2D( Float3 const& a, Float3 const& b )
+    {
+        float const dx = b.m_x - a.m_x;
+        float const dy = b.m_y - a.m_y;
+        return ( dx * dx + dy * dy ) < ( 1.0e-3f * 1.0e-3f );
+    }
+
+    //-------------------------------------------------------------------------
+
+    NavmeshQuery::NavmeshQuery( NavmeshGraph const* pGraph )
+        : m_pGraph( pGraph )
+    {
+        EE_ASSERT( m_pGraph != nullptr && m_pGraph->IsValid() );
+        m_nodes.resize( m_pGraph->GetNumPolygons() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t NavmeshQuery::FindNearestPolygon( Float3 const& position, Float3 const& searchExtents, Float3& outNearestPoint ) const
+    {
+        Int2 minCell, maxCell;
+        if ( !m_pGraph->GetGridCellRange( Float2( position.m_x - searchExtents.m_x, position.m_y - searchExtents.m_y ), Float2( position.m_x + searchExtents.m_x, position.m_y + searchExtents.m_y ), minCell, maxCell ) )
+        {
+            return InvalidIndex;
+        }
+
+        //-------------------------------------------------------------------------
+
+        int32_t nearestPolygonIdx = InvalidIndex;
+        float nearestDistanceSq = FLT_MAX;
+
+        for ( int32_t y = minCell.m_y; y <= maxCell.m_y; y++ )
+        {
+            for ( int32_t x = minCell.m_x; x <= maxCell.m_x; x++ )
+            {
+                uint32_t numPolygons = 0;
+                uint32_t const* pPolygonIndices = m_pGraph->GetGridCellPolygons( Int2( x, y ), numPolygons );
+                for ( uint32_t i = 0; i < numPolygons; i++ )
+                {
+                    int32_t const polygonIdx = (int32_t) pPolygonIndices[i];
+                    Float3 const closestPoint = m_pGraph->GetClosestPointOnPolygon( polygonIdx, position );
+                    Float3 const delta = closestPoint - position;
+                    if ( Math::Abs( delta.m_x ) > searchExtents.m_x || Math::Abs( delta.m_y ) > searchExtents.m_y || Math::Abs( delta.m_z ) > searchExtents.m_z )
+                    {
+                        continue;
+                    }
+
+                    float const distanceSq = delta.m_x * delta.m_x + delta.m_y * delta.m_y + delta.m_z * delta.m_z;
+                    if ( distanceSq < nearestDistanceSq )
+                    {
+                        nearestDistanceSq = distanceSq;
+                        nearestPolygonIdx = polygonIdx;
+                        outNearestPoint = closestPoint;
+                    }
+                }
+            }
+        }
+
+        return nearestPolygonIdx;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool NavmeshQuery::FindPath( Float3 const& startPosition, Float3 const& endPosition, Float3 const& searchExtents, TVector<Float3>& outPath )
+    {
+        outPath.clear();
+
+        Float3 startOnNavmesh, endOnNavmesh;
+        int32_t const startPolygonIdx = FindNearestPolygon( startPosition, searchExtents, startOnNavmesh );
+        int32_t const endPolygonIdx = FindNearestPolygon( endPosition, searchExtents, endOnNavmesh );
+        if ( startPolygonIdx == InvalidIndex || endPolygonIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        if ( !FindPolygonPath( startPolygonIdx, endPolygonIdx, startOnNavmesh, endOnNavmesh ) )
+        {
+            return false;
+        }
+
+        StringPull( startOnNavmesh, endOnNavmesh, outPath );
+        return true;
+    }
+
+    bool NavmeshQuery::FindPolygonPath( int32_t startPolygonIdx, int32_t endPolygonIdx, Float3 const& startPosition, Float3 const& endPosition )
+    {
+        m_polygonPath.clear();
+        m_openList.clear();
+        m_numNodesExpanded = 0;
+
+        if ( startPolygonIdx == endPolygonIdx )
+        {
+            m_polygonPath.emplace_back( startPolygonIdx );
+            return true;
+        }
+
+        // Search IDs let us skip clearing the node array for every search
+        m_searchID++;
+        if ( m_searchID == 0 )
+        {
+            for ( auto& node : m_nodes )
+            {
+                node.m_searchID = 0;
+            }
+            m_searchID = 1;
+        }
+
+        //-------------------------------------------------------------------------
+
+        SearchNode& startNode = m_nodes[startPolygonIdx];
+        startNode.m_position = startPosition;
+        startNode.m_cost = 0.0f;
+        startNode.m_parentIdx = InvalidIndex;
+        startNode.m_searchID = m_searchID;
+        startNode.m_isClosed = false;
+
+        m_openList.push_back( { Distance( startPosition, endPosition ), startPolygonIdx } );
+
+        bool pathFound = false;
+        while ( !m_openList.empty() )
+        {
+            eastl::pop_heap( m_openList.begin(), m_openList.end() );
+            OpenListEntry const entry = m_openList.back();
+            m_openList.pop_back();
+
+            // We dont update entries in place, so skip any stale entries for already expanded nodes
+            SearchNode& currentNode = m_nodes[entry.m_polygonIdx];
+            if ( currentNode.m_isClosed )
+            {
+                continue;
+            }
+
+            currentNode.m_isClosed = true;
+            m_numNodesExpanded++;
+
+            if ( entry.m_polygonIdx == endPolygonIdx )
+            {
+                pathFound = true;
+                break;
+            }
+
+            //-------------------------------------------------------------------------
+
+            NavmeshGraph::Polygon const& polygon = m_pGraph->GetPolygon( entry.m_polygonIdx );
+            NavmeshGraph::Link const* pLinks = m_pGraph->GetPolygonLinks( polygon );
+            for ( uint16_t i = 0; i < polygon.m_numLinks; i++ )
+            {
+                NavmeshGraph::Link const& link = pLinks[i];
+                SearchNode& neighbourNode = m_nodes[link.m_neighbourIdx];
+                if ( neighbourNode.m_searchID != m_searchID )
+                {
+                    neighbourNode.m_cost = FLT_MAX;
+                    neighbourNode.m_parentIdx = InvalidIndex;
+                    neighbourNode.m_searchID = m_searchID;
+                    neighbourNode.m_isClosed = false;
+                }
+                else if ( neighbourNode.m_isClosed )
+                {
+                    continue;
+                }
+
+                // Polygons are entered at the middle of the portal
+                Float3 const entryPosition = ( link.m_portalLeft + link.m_portalRight ) * 0.5f;
+                float cost = currentNode.m_cost + Distance( currentNode.m_position, entryPosition );
+                float heuristic = Distance( entryPosition, endPosition );
+                if ( link.m_neighbourIdx == endPolygonIdx )
+                {
+                    cost += heuristic;
+                    heuristic = 0.0f;
+                }
+
+                if ( cost < neighbourNode.m_cost )
+                {
+                    neighbourNode.m_position = entryPosition;
+                    neighbourNode.m_cost = cost;
+                    neighbourNode.m_parentIdx = entry.m_polygonIdx;
+
+                    m_openList.push_back( { cost + heuristic, link.m_neighbourIdx } );
+                    eastl::push_heap( m_openList.begin(), m_openList.end() );
+                }
+            }
+        }
+
+        if ( !pathFound )
+        {
+            return false;
+        }
+
+        // Reconstruct the polygon path
+        //-------------------------------------------------------------------------
+
+        int32_t polygonIdx = endPolygonIdx;
+        while ( polygonIdx != InvalidIndex )
+        {
+            m_polygonPath.emplace_back( polygonIdx );
+            polygonIdx = m_nodes[polygonIdx].m_parentIdx;
+        }
+
+        eastl::reverse( m_polygonPath.begin(), m_polygonPath.end() );
+        return true;
+    }
+
+    NavmeshGraph::Link const* NavmeshQuery::FindLink( int32_t fromPolygonIdx, int32_t toPolygonIdx ) const
+    {
+        NavmeshGraph::Polygon const& polygon = m_pGraph->GetPolygon( fromPolygonIdx );
+        NavmeshGraph::Link const* pLinks = m_pGraph->GetPolygonLinks( polygon );
+        for ( uint16_t i = 0; i < polygon.m_numLinks; i++ )
+        {
+            if ( pLinks[i].m_neighbourIdx == toPolygonIdx )
+            {
+                return &pLinks[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    void NavmeshQuery::StringPull( Float3 const& startPosition, Float3 const& endPosition, TVector<Float3>& outPath )
+    {
+        // Collect portals, the start and end positions are degenerate portals
+        //-------------------------------------------------------------------------
+
+        m_portals.clear();
+        m_portals.push_back( { startPosition, startPosition, InvalidIndex } );
+
+        for ( size_t i = 1; i < m_polygonPath.size(); i++ )
+        {
+            NavmeshGraph::Link const* pLink = FindLink( m_polygonPath[i - 1], m_polygonPath[i] );
+            EE_ASSERT( pLink != nullptr );
+            m_portals.emplace_back( *pLink );
+        }
+
+        m_portals.push_back( { endPosition, endPosition, InvalidIndex } );
+
+        // Simple stupid funnel algorithm
+        //-------------------------------------------------------------------------
+
+        Float3 portalApex = m_portals[0].m_portalLeft;
+        Float3 portalLeft = m_portals[0].m_portalLeft;
+        Float3 portalRight = m_portals[0].m_portalRight;
+        int32_t apexIdx = 0, leftIdx = 0, rightIdx = 0;
+
+        outPath.emplace_back( portalApex );
+
+        int32_t const numPortals = (int32_t) m_portals.size();
+        for ( int32_t i = 1; i < numPortals; i++ )
+        {
+            Float3 const& left = m_portals[i].m_portalLeft;
+            Float3 const& right = m_portals[i].m_portalRight;
+
+            // Try to narrow the funnel from the right
+            if ( Cross2D( portalApex, portalRight, right ) >= 0.0f )
+            {
+                if ( IsNearEqual2D( portalApex, portalRight ) || Cross2D( portalApex, portalLeft, right ) < 0.0f )
+                {
+                    portalRight = right;
+                    rightIdx = i;
+                }
+                else // Right crossed over left, so left becomes the new apex
+                {
+                    portalApex = portalLeft;
+                    apexIdx = leftIdx;
+                    outPath.emplace_back( portalApex );
+
+                    portalLeft = portalRight = portalApex;
+                    leftIdx = rightIdx = apexIdx;
+                    i = apexIdx;
+                    continue;
+                }
+            }
+
+            // Try to narrow the funnel from the left
+            if ( Cross2D( portalApex, portalLeft, left ) <= 0.0f )
+            {
+                if ( IsNearEqual2D( portalApex, portalLeft ) || Cross2D( portalApex, portalRight, left ) > 0.0f )
+                {
+                    portalLeft = left;
+                    leftIdx = i;
+                }
+                else // Left crossed over right, so right becomes the new apex
+                {
+                    portalApex = portalRight;
+                    apexIdx = rightIdx;
+                    outPath.emplace_back( portalApex );
+
+                    portalLeft = portalRight = portalApex;
+                    leftIdx = rightIdx = apexIdx;
+                    i = apexIdx;
+                    continue;
+                }
+            }
+        }
+
+        if ( !IsNearEqual2D( outPath.back(), endPosition ) )
+        {
+            outPath.emplace_back( endPosition );
+        }
+        else
+        {
+            outPath.back() = endPosition;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool NavmeshQuery::Raycast( Float3 const& startPosition, Float3 const& endPosition, Float3 const& searchExtents, NavmeshRaycastResult& outResult ) const
+    {
+        outResult = NavmeshRaycastResult();
+
+        Float3 startOnNavmesh;
+        int32_t currentPolygonIdx = FindNearestPolygon( startPosition, searchExtents, startOnNavmesh );
+        if ( currentPolygonIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        // Walk the polygons along the ray in 2D, exiting each polygon via the edge the ray leaves through
+        //-------------------------------------------------------------------------
+
+        Float2 const rayStart( startOnNavmesh.m_x, startOnNavmesh.m_y );
+        Float2 const rayDelta( endPosition.m_x - startOnNavmesh.m_x, endPosition.m_y - startOnNavmesh.m_y );
+        float currentFraction = 0.0f;
+
+        int32_t const maxIterations = m_pGraph->GetNumPolygons();
+        for ( int32_t iteration = 0; iteration < maxIterations; iteration++ )
+        {
+            NavmeshGraph::Polygon const& polygon = m_pGraph->GetPolygon( currentPolygonIdx );
+            Float3 const* pVertices = m_pGraph->GetPolygonVertices( polygon );
+
+            float exitFraction = 1.0f;
+            bool exitsPolygon = false;
+            for ( uint16_t i = 0, j = polygon.m_numVertices - 1; i < polygon.m_numVertices; j = i++ )
+            {
+                // Outward normal of a counter-clockwise edge
+                Float2 const edge( pVertices[i].m_x - pVertices[j].m_x, pVertices[i].m_y - pVertices[j].m_y );
+                Float2 const normal( edge.m_y, -edge.m_x );
+
+                float const denominator = normal.m_x * rayDelta.m_x + normal.m_y * rayDelta.m_y;
+                if ( denominator > Math::Epsilon )
+                {
+                    float const numerator = normal.m_x * ( pVertices[j].m_x - rayStart.m_x ) + normal.m_y * ( pVertices[j].m_y - rayStart.m_y );
+                    float const t = numerator / denominator;
+                    if ( t < exitFraction )
+                    {
+                        exitFraction = t;
+                        exitsPolygon = true;
+                    }
+                }
+            }
+
+            // The ray ends in this polygon
+            if ( !exitsPolygon )
+            {
+                Float2 const rayEnd( rayStart.m_x + rayDelta.m_x, rayStart.m_y + rayDelta.m_y );
+                outResult.m_hitPosition = m_pGraph->GetClosestPointOnPolygon( currentPolygonIdx, Float3( rayEnd, endPosition.m_z ) );
+                return true;
+            }
+
+            exitFraction = Math::Max( exitFraction, currentFraction );
+            Float3 const exitPoint( rayStart.m_x + rayDelta.m_x * exitFraction, rayStart.m_y + rayDelta.m_y * exitFraction, 0.0f );
+
+            // Find the portal we are exiting through
+            int32_t nextPolygonIdx = InvalidIndex;
+            NavmeshGraph::Link const* pLinks = m_pGraph->GetPolygonLinks( polygon );
+            for ( uint16_t i = 0; i < polygon.m_numLinks; i++ )
+            {
+                Float3 const& left = pLinks[i].m_portalLeft;
+                Float3 const& right = pLinks[i].m_portalRight;
+                Float2 const portal( left.m_x - right.m_x, left.m_y - right.m_y );
+                float const portalLengthSq = portal.m_x * portal.m_x + portal.m_y * portal.m_y;
+                if ( portalLengthSq < Math::Epsilon )
+                {
+                    continue;
+                }
+
+                float const t = ( ( exitPoint.m_x - right.m_x ) * portal.m_x + ( exitPoint.m_y - right.m_y ) * portal.m_y ) / portalLengthSq;
+                if ( t >= -Math::LargeEpsilon && t <= 1.0f + Math::LargeEpsilon && Math::Abs( Cross2D( right, left, exitPoint ) ) / Math::Sqrt( portalLengthSq ) < 1.0e-3f )
+                {
+                    nextPolygonIdx = pLinks[i].m_neighbourIdx;
+                    break;
+                }
+            }
+
+            // We've hit the boundary of the navmesh
+            if ( nextPolygonIdx == InvalidIndex )
+            {
+                outResult.m_hasHit = true;
+                outResult.m_hitFraction = exitFraction;
+                outResult.m_hitPosition = Float3( exitPoint.m_x, exitPoint.m_y, m_pGraph->GetPolygonHeight( currentPolygonIdx, exitPoint ) );
+                return true;
+            }
+
+            currentPolygonIdx = nextPolygonIdx;
+            currentFraction = exitFraction;
+        }
+
+        // We failed to terminate, treat this as a hit at the last valid position
+        outResult.m_hasHit = true;
+        outResult.m_hitFraction = currentFraction;
+        Float3 const lastPoint( rayStart.m_x + rayDelta.m_x * currentFraction, rayStart.m_y + rayDelta.m_y * currentFraction, 0.0f );
+        outResult.m_hitPosition = Float3( lastPoint.m_x, lastPoint.m_y, m_pGraph->GetPolygonHeight( currentPolygonIdx, lastPoint ) );
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "NavmeshGraph.h"
+
+//-------------------------------------------------------------------------
+// Navmesh Query
+//-------------------------------------------------------------------------
+// Runs spatial and path queries against a native navmesh graph
+// The query owns all the search state needed (sized to the graph) so that no allocations are needed per query
+// Queries are NOT thread-safe, each concurrent user needs its own query object
+
+namespace EE::Navmesh
+{
+    struct NavmeshRaycastResult
+    {
+        Float3                          m_hitPosition = Float3::Zero;
+        float                           m_hitFraction = 1.0f;
+        bool                            m_hasHit = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API NavmeshQuery
+    {
+        struct SearchNode
+        {
+            Float3                      m_position;                     // The point at which we entered this polygon
+            float                       m_cost = 0.0f;
+            int32_t                     m_parentIdx = InvalidIndex;
+            uint32_t                    m_searchID = 0;
+            bool                        m_isClosed = false;
+        };
+
+        struct OpenListEntry
+        {
+            // Inverted so that the std heap functions produce a min-heap
+            inline bool operator<( OpenListEntry const& rhs ) const { return m_totalCost > rhs.m_totalCost; }
+
+            float                       m_totalCost;
+            int32_t                     m_polygonIdx;
+        };
+
+    public:
+
+        NavmeshQuery( NavmeshGraph const* pGraph );
+
+        inline NavmeshGraph const* GetGraph() const { return m_pGraph; }
+
+        // Find the closest polygon to the specified position within the search extents, returns InvalidIndex if nothing was found
+        int32_t FindNearestPolygon( Float3 const& position, Float3 const& searchExtents, Float3& outNearestPoint ) const;
+
+        // Find a string-pulled path between the two positions, both positions are first snapped to the navmesh using the search extents
+        // The resulting path includes the (snapped) start and end positions
+        bool FindPath( Float3 const& startPosition, Float3 const& endPosition, Float3 const& searchExtents, TVector<Float3>& outPath );
+
+        // Cast a ray along the surface of the navmesh in 2D, returns false if the start position isnt on the navmesh
+        bool Raycast( Float3 const& startPosition, Float3 const& endPosition, Float3 const& searchExtents, NavmeshRaycastResult& outResult ) const;
+
+        // Get the number of polygons that were expanded by the last path search
+        inline int32_t GetNumNodesExpandedByLastSearch() const { return m_numNodesExpanded; }
+
+    private:
+
+        // A* search across the polygon graph, fills the polygon path
+        bool FindPolygonPath( int32_t startPolygonIdx, int32_t endPolygonIdx, Float3 const& startPosition, Float3 const& endPosition );
+
+        // Run the funnel algorithm over the portals of the polygon path
+        void StringPull( Float3 const& startPosition, Float3 const& endPosition, TVector<Float3>& outPath );
+
+        NavmeshGraph::Link const* FindLink( int32_t fromPolygonIdx, int32_t toPolygonIdx ) const;
+
+    private:
+
+        NavmeshGraph const*             m_pGraph = nullptr;
+        TVector<SearchNode>             m_nodes;
+        TVector<OpenListEntry>          m_openList;
+        TVector<int32_t>                m_polygonPath;
+        TVector<NavmeshGraph::Link>     m_portals;
+        uint32_t                        m_searchID = 0;
+        int32_t                         m_numNodesExpanded = 0;
+    };
+}
\ No newline at end of file
@@ -7,11 +7,18 @@
 #include "System/Render/RenderViewport.h"
 #include "System/Profiling.h"
 #include "System/Math/BoundingVolumes.h"
+#include "System/Drawing/DebugDrawing.h"
+#include "System/Time/Timers.h"
+#include "System/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Navmesh
 {
+    Vector const NavmeshWorldSystem::s_defaultSearchExtents( 2.0f, 2.0f, 4.0f );
+
+    //-------------------------------------------------------------------------
+
     void NavmeshWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {
         #if EE_ENABLE_NAVPOWER
@@ -31,8 +38,10 @@ namespace EE::Navmesh
 
     void NavmeshWorldSystem::ShutdownSystem()
     {
-        #if EE_ENABLE_NAVPOWER
         EE_ASSERT( m_registeredNavmeshes.empty() );
+        m_pathRequestService.Reset();
+
+        #if EE_ENABLE_NAVPOWER
 
         #if EE_DEVELOPMENT_TOOLS
         bfx::SetRenderer( m_pInstance, nullptr );
@@ -76,63 +85,100 @@ namespace EE::Navmesh
     {
         EE_ASSERT( pComponent != nullptr );
 
+        NavmeshData const* pData = pComponent->m_pNavmeshData.GetPtr();
+        EE_ASSERT( pData != nullptr && pData->IsValid() );
+
+        Transform const& componentWorldTransform = pComponent->GetWorldTransform();
+
+        RegisteredNavmesh registeredNavmesh( pComponent->GetID() );
+        registeredNavmesh.m_worldTransform = componentWorldTransform;
+
+        // Native graph
+        //-------------------------------------------------------------------------
+
+        if ( pData->GetGraph().IsValid() )
+        {
+            registeredNavmesh.m_pGraph = &pData->GetGraph();
+            registeredNavmesh.m_worldBounds = registeredNavmesh.m_pGraph->GetBounds().GetTransformed( componentWorldTransform );
+        }
+
         #if EE_ENABLE_NAVPOWER
 
         // Copy resource
         //-------------------------------------------------------------------------
         // NavPower operates on the resource in place so we need to make a copy
 
-        NavmeshData const* pData = pComponent->m_pNavmeshData.GetPtr();
-        EE_ASSERT( pData != nullptr && pData->IsValid() );
+        if ( !pData->GetGraphImage().empty() )
+        {
+            size_t const requiredMemory = sizeof( char ) * pData->GetGraphImage().size();
+            char* pNavmesh = (char*) EE::Alloc( requiredMemory );
+            memcpy( pNavmesh, pData->GetGraphImage().data(), requiredMemory );
 
-        size_t const requiredMemory = sizeof( char ) * pData->GetGraphImage().size();
-        char* pNavmesh = (char*) EE::Alloc( requiredMemory );
-        memcpy( pNavmesh, pData->GetGraphImage().data(), requiredMemory );
+            // Add resource
+            //-------------------------------------------------------------------------
 
-        // Add resource
-        //-------------------------------------------------------------------------
+            bfx::ResourceOffset offset;
+            offset.m_positionOffset = ToBfx( componentWorldTransform.GetTranslation() );
+            offset.m_rotationOffset = ToBfx( componentWorldTransform.GetRotation() );
 
-        Transform const& componentWorldTransform = pComponent->GetWorldTransform();
+            bfx::SpaceHandle space = bfx::GetDefaultSpaceHandle( m_pInstance );
+            bfx::AddResource( space, pNavmesh, offset );
 
-        bfx::ResourceOffset offset;
-        offset.m_positionOffset = ToBfx( componentWorldTransform.GetTranslation() );
-        offset.m_rotationOffset = ToBfx( componentWorldTransform.GetRotation() );
+            registeredNavmesh.m_pNavmesh = pNavmesh;
+        }
 
-        bfx::SpaceHandle space = bfx::GetDefaultSpaceHandle( m_pInstance );
-        bfx::AddResource( space, pNavmesh, offset );
+        #endif
 
         // Add record
-        m_registeredNavmeshes.emplace_back( RegisteredNavmesh( pComponent->GetID(), pNavmesh ) );
-
-        #endif
+        m_registeredNavmeshes.emplace_back( eastl::move( registeredNavmesh ) );
+        m_pathRequestService.ClearCache();
     }
 
     void NavmeshWorldSystem::UnregisterNavmesh( NavmeshComponent* pComponent )
     {
         EE_ASSERT( pComponent != nullptr );
-        #if EE_ENABLE_NAVPOWER
 
         for ( auto i = 0u; i < m_registeredNavmeshes.size(); i++ )
         {
-            if ( pComponent->GetID() == m_registeredNavmeshes[i].m_componentID )
+            RegisteredNavmesh& registeredNavmesh = m_registeredNavmeshes[i];
+            if ( pComponent->GetID() == registeredNavmesh.m_componentID )
             {
-                bfx::SpaceHandle space = bfx::GetDefaultSpaceHandle( m_pInstance );
-                bfx::RemoveResource( space, m_registeredNavmeshes[i].m_pNavmesh );
+                #if EE_ENABLE_NAVPOWER
+                if ( registeredNavmesh.m_pNavmesh != nullptr )
+                {
+                    bfx::SpaceHandle space = bfx::GetDefaultSpaceHandle( m_pInstance );
+                    bfx::RemoveResource( space, registeredNavmesh.m_pNavmesh );
+                    EE::Free( registeredNavmesh.m_pNavmesh );
+                }
+                #endif
 
                 //-------------------------------------------------------------------------
 
-                EE::Free( m_registeredNavmeshes[i].m_pNavmesh );
-                m_registeredNavmeshes.erase_unsorted( m_registeredNavmeshes.begin() + i );
+                {
+                    Threading::ScopeLock lock( m_queryPoolMutex );
+                    for ( auto pQuery : registeredNavmesh.m_freeQueries )
+                    {
+                        EE::Delete( pQuery );
+                    }
+                    m_registeredNavmeshes.erase_unsorted( m_registeredNavmeshes.begin() + i );
+                }
+
+                m_pathRequestService.ClearCache();
                 return;
             }
         }
 
         EE_UNREACHABLE_CODE();
-        #endif
     }
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccessList const& NavmeshWorldSystem::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( ReadsComponent<NavmeshComponent>() );
+        return accessList;
+    }
+
     void NavmeshWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         #if EE_ENABLE_NAVPOWER
@@ -163,6 +209,21 @@ namespace EE::Navmesh
         #endif
 
         #endif
+
+        //-------------------------------------------------------------------------
+
+        m_pathRequestService.Update( ctx.GetSystem<TaskSystem>(), ctx.GetFrameArena() );
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_drawNativeNavmesh )
+        {
+            EE_PROFILE_SCOPE_NAVIGATION( "Native Navmesh Debug Drawing" );
+            Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
+            DrawNativeNavmeshes( drawingCtx );
+        }
+        #endif
     }
 
     AABB NavmeshWorldSystem::GetNavmeshBounds( uint32_t layerIdx ) const
@@ -177,8 +238,234 @@ namespace EE::Navmesh
             bounds.m_center = FromBfx( center );
             bounds.m_extents = FromBfx( extents );
         }
+        #else
+        // The native builder only generates the default layer
+        if ( layerIdx == 0 )
+        {
+            for ( auto const& registeredNavmesh : m_registeredNavmeshes )
+            {
+                if ( registeredNavmesh.m_pGraph != nullptr )
+                {
+                    bounds = bounds.IsValid() ? AABB::GetCombinedBox( bounds, registeredNavmesh.m_worldBounds ) : registeredNavmesh.m_worldBounds;
+                }
+            }
+        }
         #endif
 
         return bounds;
     }
+
+    //-------------------------------------------------------------------------
+    // Native Queries
+    //-------------------------------------------------------------------------
+
+    bool NavmeshWorldSystem::HasNativeNavmesh() const
+    {
+        for ( auto const& registeredNavmesh : m_registeredNavmeshes )
+        {
+            if ( registeredNavmesh.m_pGraph != nullptr )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    NavmeshWorldSystem::RegisteredNavmesh* NavmeshWorldSystem::FindNavmeshForPosition( Vector const& position, Vector const& searchExtents )
+    {
+        for ( auto& registeredNavmesh : m_registeredNavmeshes )
+        {
+            if ( registeredNavmesh.m_pGraph != nullptr && registeredNavmesh.m_worldBounds.Overlaps( AABB( position, searchExtents ) ) )
+            {
+                return &registeredNavmesh;
+            }
+        }
+
+        return nullptr;
+    }
+
+    NavmeshQuery* NavmeshWorldSystem::AcquireQuery( RegisteredNavmesh* pNavmesh )
+    {
+        EE_ASSERT( pNavmesh != nullptr && pNavmesh->m_pGraph != nullptr );
+
+        {
+            Threading::ScopeLock lock( m_queryPoolMutex );
+            if ( !pNavmesh->m_freeQueries.empty() )
+            {
+                NavmeshQuery* pQuery = pNavmesh->m_freeQueries.back();
+                pNavmesh->m_freeQueries.pop_back();
+                return pQuery;
+            }
+        }
+
+        // Create a new query outside of the lock, since this allocates the search state for the entire graph
+        return EE::New<NavmeshQuery>( pNavmesh->m_pGraph );
+    }
+
+    void NavmeshWorldSystem::ReleaseQuery( RegisteredNavmesh* pNavmesh, NavmeshQuery* pQuery )
+    {
+        EE_ASSERT( pNavmesh != nullptr && pQuery != nullptr && pQuery->GetGraph() == pNavmesh->m_pGraph );
+        Threading::ScopeLock lock( m_queryPoolMutex );
+        pNavmesh->m_freeQueries.emplace_back( pQuery );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool NavmeshWorldSystem::FindNearestPoint( Vector const& position, Vector const& searchExtents, Vector& outNearestPoint )
+    {
+        RegisteredNavmesh* pNavmesh = FindNavmeshForPosition( position, searchExtents );
+        if ( pNavmesh == nullptr )
+        {
+            return false;
+        }
+
+        // Queries run in the local space of the navmesh
+        Float3 const localPosition = pNavmesh->m_worldTransform.InverseTransformPoint( position );
+        Float3 const localSearchExtents = pNavmesh->m_worldTransform.InverseRotateVector( searchExtents ).Abs();
+
+        NavmeshQuery* pQuery = AcquireQuery( pNavmesh );
+        Float3 nearestPoint;
+        bool const result = pQuery->FindNearestPolygon( localPosition, localSearchExtents, nearestPoint ) != InvalidIndex;
+        ReleaseQuery( pNavmesh, pQuery );
+
+        if ( result )
+        {
+            outNearestPoint = pNavmesh->m_worldTransform.TransformPoint( nearestPoint );
+        }
+
+        return result;
+    }
+
+    bool NavmeshWorldSystem::FindPath( Vector const& startPosition, Vector const& endPosition, TVector<Vector>& outPath, Vector const& searchExtents )
+    {
+        EE_PROFILE_SCOPE_NAVIGATION( "Navmesh Find Path" );
+
+        outPath.clear();
+
+        RegisteredNavmesh* pNavmesh = FindNavmeshForPosition( startPosition, searchExtents );
+        if ( pNavmesh == nullptr )
+        {
+            return false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        Float3 const localStartPosition = pNavmesh->m_worldTransform.InverseTransformPoint( startPosition );
+        Float3 const localEndPosition = pNavmesh->m_worldTransform.InverseTransformPoint( endPosition );
+        Float3 const localSearchExtents = pNavmesh->m_worldTransform.InverseRotateVector( searchExtents ).Abs();
+
+        TVector<Float3> path;
+        bool result = false;
+
+        NavmeshQuery* pQuery = AcquireQuery( pNavmesh );
+
+        #if EE_DEVELOPMENT_TOOLS
+        Milliseconds queryTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( queryTime );
+            result = pQuery->FindPath( localStartPosition, localEndPosition, localSearchExtents, path );
+        }
+
+        {
+            Threading::ScopeLock lock( m_queryStatsMutex );
+            m_queryStats.m_numPathQueries++;
+            m_queryStats.m_numFailedPathQueries += result ? 0 : 1;
+            m_queryStats.m_numNodesExpanded += pQuery->GetNumNodesExpandedByLastSearch();
+            m_queryStats.m_totalPathQueryTime += queryTime;
+            m_queryStats.m_maxPathQueryTime = Math::Max( m_queryStats.m_maxPathQueryTime.ToFloat(), queryTime.ToFloat() );
+        }
+        #else
+        result = pQuery->FindPath( localStartPosition, localEndPosition, localSearchExtents, path );
+        #endif
+
+        ReleaseQuery( pNavmesh, pQuery );
+
+        //-------------------------------------------------------------------------
+
+        if ( result )
+        {
+            outPath.reserve( path.size() );
+            for ( Float3 const& point : path )
+            {
+                outPath.emplace_back( pNavmesh->m_worldTransform.TransformPoint( point ) );
+            }
+        }
+
+        return result;
+    }
+
+    bool NavmeshWorldSystem::Raycast( Vector const& startPosition, Vector const& endPosition, NavmeshRaycastResult& outResult, Vector const& searchExtents )
+    {
+        RegisteredNavmesh* pNavmesh = FindNavmeshForPosition( startPosition, searchExtents );
+        if ( pNavmesh == nullptr )
+        {
+            return false;
+        }
+
+        Float3 const localStartPosition = pNavmesh->m_worldTransform.InverseTransformPoint( startPosition );
+        Float3 const localEndPosition = pNavmesh->m_worldTransform.InverseTransformPoint( endPosition );
+        Float3 const localSearchExtents = pNavmesh->m_worldTransform.InverseRotateVector( searchExtents ).Abs();
+
+        NavmeshQuery* pQuery = AcquireQuery( pNavmesh );
+        bool const result = pQuery->Raycast( localStartPosition, localEndPosition, localSearchExtents, outResult );
+        ReleaseQuery( pNavmesh, pQuery );
+
+        if ( result )
+        {
+            outResult.m_hitPosition = pNavmesh->m_worldTransform.TransformPoint( outResult.m_hitPosition );
+        }
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    NavmeshWorldSystem::QueryStats NavmeshWorldSystem::GetQueryStats() const
+    {
+        Threading::ScopeLock lock( m_queryStatsMutex );
+        return m_queryStats;
+    }
+
+    void NavmeshWorldSystem::ResetQueryStats()
+    {
+        Threading::ScopeLock lock( m_queryStatsMutex );
+        m_queryStats = QueryStats();
+    }
+
+    void NavmeshWorldSystem::DrawNativeNavmeshes( Drawing::DrawContext& drawingContext ) const
+    {
+        for ( auto const& registeredNavmesh : m_registeredNavmeshes )
+        {
+            NavmeshGraph const* pGraph = registeredNavmesh.m_pGraph;
+            if ( pGraph == nullptr )
+            {
+                continue;
+            }
+
+            int32_t const numPolygons = pGraph->GetNumPolygons();
+            for ( int32_t polygonIdx = 0; polygonIdx < numPolygons; polygonIdx++ )
+            {
+                NavmeshGraph::Polygon const& polygon = pGraph->GetPolygon( polygonIdx );
+                Float3 const* pVertices = pGraph->GetPolygonVertices( polygon );
+
+                for ( uint16_t i = 0, j = polygon.m_numVertices - 1; i < polygon.m_numVertices; j = i++ )
+                {
+                    Vector const start = registeredNavmesh.m_worldTransform.TransformPoint( pVertices[j] );
+                    Vector const end = registeredNavmesh.m_worldTransform.TransformPoint( pVertices[i] );
+                    drawingContext.DrawLine( start, end, Colors::Cyan, 1.0f, Drawing::EnableDepthTest );
+                }
+
+                NavmeshGraph::Link const* pLinks = pGraph->GetPolygonLinks( polygon );
+                for ( uint16_t i = 0; i < polygon.m_numLinks; i++ )
+                {
+                    Vector const start = registeredNavmesh.m_worldTransform.TransformPoint( pLinks[i].m_portalLeft );
+                    Vector const end = registeredNavmesh.m_worldTransform.TransformPoint( pLinks[i].m_portalRight );
+                    drawingContext.DrawLine( start, end, Colors::LimeGreen, 2.0f, Drawing::EnableDepthTest );
+                }
+            }
+        }
+    }
+    #endif
 }
\ No newline at end of file
@@ -2,8 +2,12 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Navmesh/NavPower.h"
+#include "Engine/Navmesh/NavmeshQuery.h"
+#include "Engine/Navmesh/NavmeshPathRequestService.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Engine/UpdateContext.h"
+#include "System/Threading/Threading.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 // Navmesh World System
@@ -11,8 +15,11 @@
 // This is the main system responsible for managing navmesh within a specific world
 // Manages navmesh registration, obstacles creation/destruction, etc...
 // Primarily also needed to get the space handle needed for any queries ( GetSpaceHandle )
+// Also provides the query API for the native navmesh graphs, these queries are available with or without NavPower
+// Path queries can also be issued asynchronously via the path request service, which is updated as part of this system
 
 namespace EE { struct AABB; }
+namespace EE::Drawing { class DrawContext; }
 
 //-------------------------------------------------------------------------
 
@@ -31,11 +38,31 @@ namespace EE::Navmesh
 
         struct RegisteredNavmesh
         {
-            RegisteredNavmesh( ComponentID const& ID, char* pNavmesh ) : m_componentID( ID ), m_pNavmesh( pNavmesh ) { EE_ASSERT( ID.IsValid() && pNavmesh != nullptr ); }
+            RegisteredNavmesh( ComponentID const& ID ) : m_componentID( ID ) { EE_ASSERT( ID.IsValid() ); }
+
+            ComponentID                 m_componentID;
+            char*                       m_pNavmesh = nullptr;               // NavPower copy of the graph image
+            NavmeshGraph const*         m_pGraph = nullptr;                 // Native graph, owned by the navmesh resource
+            Transform                   m_worldTransform;
+            AABB                        m_worldBounds;
+            TVector<NavmeshQuery*>      m_freeQueries;                      // Pooled native queries, each concurrent user needs its own
+        };
+
+    public:
 
-            ComponentID     m_componentID;
-            char*           m_pNavmesh;
+        #if EE_DEVELOPMENT_TOOLS
+        struct QueryStats
+        {
+            int32_t                     m_numPathQueries = 0;
+            int32_t                     m_numFailedPathQueries = 0;
+            int32_t                     m_numNodesExpanded = 0;
+            Milliseconds                m_totalPathQueryTime = 0;
+            Milliseconds                m_maxPathQueryTime = 0;
         };
+        #endif
+
+        // The default extents used to find the navmesh for a given query position
+        static Vector const s_defaultSearchExtents;
 
     public:
 
@@ -51,6 +78,29 @@ namespace EE::Navmesh
         EE_FORCE_INLINE bfx::SpaceHandle GetSpaceHandle() const { return bfx::GetDefaultSpaceHandle( m_pInstance ); }
         #endif
 
+        // Native Queries - all positions are in world space and all queries are thread-safe
+        //-------------------------------------------------------------------------
+
+        // Do we have any native navmesh graphs to query
+        bool HasNativeNavmesh() const;
+
+        // Find the closest point on the navmesh within the search extents of the specified position
+        bool FindNearestPoint( Vector const& position, Vector const& searchExtents, Vector& outNearestPoint );
+
+        // Find a string-pulled path between the two positions, the path includes the start and end positions snapped to the navmesh
+        bool FindPath( Vector const& startPosition, Vector const& endPosition, TVector<Vector>& outPath, Vector const& searchExtents = s_defaultSearchExtents );
+
+        // Cast a ray along the navmesh surface from the start position towards the end position, returns false if the start position isnt on the navmesh
+        bool Raycast( Vector const& startPosition, Vector const& endPosition, NavmeshRaycastResult& outResult, Vector const& searchExtents = s_defaultSearchExtents );
+
+        // Get the service used to issue asynchronous, budgeted path requests
+        inline PathRequestService* GetPathRequestService() { return &m_pathRequestService; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        QueryStats GetQueryStats() const;
+        void ResetQueryStats();
+        #endif
+
     private:
 
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
@@ -63,6 +113,17 @@ namespace EE::Navmesh
         void UnregisterNavmesh( NavmeshComponent* pComponent );
 
         void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemDataAccessList const& GetDataAccess() const override;
+
+        // Find the native navmesh overlapping the given world position
+        RegisteredNavmesh* FindNavmeshForPosition( Vector const& position, Vector const& searchExtents );
+
+        NavmeshQuery* AcquireQuery( RegisteredNavmesh* pNavmesh );
+        void ReleaseQuery( RegisteredNavmesh* pNavmesh, NavmeshQuery* pQuery );
+
+        #if EE_DEVELOPMENT_TOOLS
+        void DrawNativeNavmeshes( Drawing::DrawContext& drawingContext ) const;
+        #endif
 
     private:
 
@@ -79,5 +140,13 @@ namespace EE::Navmesh
 
         TVector<NavmeshComponent*>                      m_navmeshComponents;
         TVector<RegisteredNavmesh>                      m_registeredNavmeshes;
+        Threading::Mutex                                m_queryPoolMutex;
+        PathRequestService                              m_pathRequestService{ this };
+
+        #if EE_DEVELOPMENT_TOOLS
+        QueryStats                                      m_queryStats;
+        mutable Threading::Mutex                        m_queryStatsMutex;
+        bool                                            m_drawNativeNavmesh = false;
+        #endif
     };
 }
\ No newline at end of file
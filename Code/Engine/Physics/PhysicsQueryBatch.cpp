@@ -0,0 +1,288 @@
+#include "PhysicsQueryBatch.h"
+#include "PhysicsScene.h"
+#include "PhysX.h"
+
+#include <PxScene.h>
+
+//-------------------------------------------------------------------------
+
+using namespace physx;
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    QueryBatch::QueryBatch( Memory::FrameArena* pFrameArena, uint32_t numQueries, uint32_t numOverlapHits )
+        : m_queries( Memory::FrameArenaAllocator( pFrameArena ) )
+        , m_results( Memory::FrameArenaAllocator( pFrameArena ) )
+        , m_filters( Memory::FrameArenaAllocator( pFrameArena ) )
+        , m_overlapHits( Memory::FrameArenaAllocator( pFrameArena ) )
+    {
+        Reserve( numQueries, numOverlapHits );
+    }
+
+    void QueryBatch::Reserve( uint32_t numQueries, uint32_t numOverlapHits )
+    {
+        m_queries.reserve( numQueries );
+        m_results.reserve( numQueries );
+        m_overlapHits.reserve( numOverlapHits );
+    }
+
+    void QueryBatch::Reset()
+    {
+        m_queries.clear();
+        m_results.clear();
+        m_filters.clear();
+        m_overlapHits.clear();
+        m_numExecutedQueries = 0;
+    }
+
+    int32_t QueryBatch::AddFilter( QueryFilter const& filter )
+    {
+        m_filters.emplace_back( filter );
+        return (int32_t) m_filters.size() - 1;
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t QueryBatch::AddQuery( QueryType type, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, Float3 const& shapeDimensions, int32_t filterIdx, uint32_t maxOverlapHits )
+    {
+        EE_ASSERT( filterIdx >= 0 && filterIdx < (int32_t) m_filters.size() );
+
+        Query& query = m_queries.emplace_back();
+        query.m_type = type;
+        query.m_orientation = orientation;
+        query.m_start = start;
+        query.m_unitDirection = unitDirection;
+        query.m_distance = distance;
+        query.m_shapeDimensions = shapeDimensions;
+        query.m_filterIdx = filterIdx;
+        query.m_maxOverlapHits = maxOverlapHits;
+
+        QueryResult& result = m_results.emplace_back();
+        result.m_start = start;
+        result.m_end = ( distance > 0.0f ) ? Vector::MultiplyAdd( unitDirection, Vector( distance ), start ) : start;
+
+        // Reserve the overlap hits now, so that the hit buffer never changes during execution
+        if ( maxOverlapHits > 0 )
+        {
+            result.m_firstOverlapHitIdx = (uint32_t) m_overlapHits.size();
+            m_overlapHits.resize( m_overlapHits.size() + maxOverlapHits );
+        }
+
+        return (int32_t) m_queries.size() - 1;
+    }
+
+    int32_t QueryBatch::AddRayCast( Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+        return AddQuery( QueryType::RayCast, Quaternion::Identity, start, unitDirection, distance, Float3::Zero, filterIdx, 0 );
+    }
+
+    int32_t QueryBatch::AddRayCast( Vector const& start, Vector const& end, int32_t filterIdx )
+    {
+        Vector unitDirection; float distance;
+        ( end - start ).ToDirectionAndLength3( unitDirection, distance );
+        EE_ASSERT( !unitDirection.IsNearZero3() );
+        return AddQuery( QueryType::RayCast, Quaternion::Identity, start, unitDirection, distance, Float3::Zero, filterIdx, 0 );
+    }
+
+    int32_t QueryBatch::AddSphereSweep( float radius, Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+        return AddQuery( QueryType::SphereSweep, Quaternion::Identity, start, unitDirection, distance, Float3( radius, 0.0f, 0.0f ), filterIdx, 0 );
+    }
+
+    int32_t QueryBatch::AddSphereSweep( float radius, Vector const& start, Vector const& end, int32_t filterIdx )
+    {
+        Vector unitDirection; float distance;
+        ( end - start ).ToDirectionAndLength3( unitDirection, distance );
+        EE_ASSERT( !unitDirection.IsNearZero3() );
+        return AddQuery( QueryType::SphereSweep, Quaternion::Identity, start, unitDirection, distance, Float3( radius, 0.0f, 0.0f ), filterIdx, 0 );
+    }
+
+    int32_t QueryBatch::AddCapsuleSweep( float cylinderPortionHalfHeight, float radius, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+        return AddQuery( QueryType::CapsuleSweep, orientation, start, unitDirection, distance, Float3( cylinderPortionHalfHeight, radius, 0.0f ), filterIdx, 0 );
+    }
+
+    int32_t QueryBatch::AddCylinderSweep( float halfHeight, float radius, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+        EE_ASSERT( SharedMeshes::s_pUnitCylinderMesh != nullptr );
+        return AddQuery( QueryType::CylinderSweep, orientation, start, unitDirection, distance, Float3( halfHeight, radius, 0.0f ), filterIdx, 0 );
+    }
+
+    int32_t QueryBatch::AddBoxSweep( Vector const& halfExtents, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx )
+    {
+        EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+        return AddQuery( QueryType::BoxSweep, orientation, start, unitDirection, distance, halfExtents.ToFloat3(), filterIdx, 0 );
+    }
+
+    int32_t QueryBatch::AddSphereOverlap( float radius, Vector const& position, int32_t filterIdx, uint32_t maxHits )
+    {
+        EE_ASSERT( maxHits > 0 );
+        return AddQuery( QueryType::SphereOverlap, Quaternion::Identity, position, Vector::Zero, 0.0f, Float3( radius, 0.0f, 0.0f ), filterIdx, maxHits );
+    }
+
+    int32_t QueryBatch::AddCapsuleOverlap( float cylinderPortionHalfHeight, float radius, Quaternion const& orientation, Vector const& position, int32_t filterIdx, uint32_t maxHits )
+    {
+        EE_ASSERT( maxHits > 0 );
+        return AddQuery( QueryType::CapsuleOverlap, orientation, position, Vector::Zero, 0.0f, Float3( cylinderPortionHalfHeight, radius, 0.0f ), filterIdx, maxHits );
+    }
+
+    int32_t QueryBatch::AddCylinderOverlap( float halfHeight, float radius, Quaternion const& orientation, Vector const& position, int32_t filterIdx, uint32_t maxHits )
+    {
+        EE_ASSERT( maxHits > 0 );
+        EE_ASSERT( SharedMeshes::s_pUnitCylinderMesh != nullptr );
+        return AddQuery( QueryType::CylinderOverlap, orientation, position, Vector::Zero, 0.0f, Float3( halfHeight, radius, 0.0f ), filterIdx, maxHits );
+    }
+
+    int32_t QueryBatch::AddBoxOverlap( Vector const& halfExtents, Quaternion const& orientation, Vector const& position, int32_t filterIdx, uint32_t maxHits )
+    {
+        EE_ASSERT( maxHits > 0 );
+        return AddQuery( QueryType::BoxOverlap, orientation, position, Vector::Zero, 0.0f, halfExtents.ToFloat3(), filterIdx, maxHits );
+    }
+
+    //-------------------------------------------------------------------------
+
+    static void SetSweepResult( PxSweepBuffer const& buffer, float sweepDistance, QueryResult& result )
+    {
+        result.m_hasBlock = buffer.hasBlock;
+        if ( !buffer.hasBlock )
+        {
+            result.m_finalShapePosition = result.m_end;
+            result.m_remainingDistance = 0.0f;
+            return;
+        }
+
+        result.m_hitPosition = FromPx( buffer.block.position );
+        result.m_hitNormal = FromPx( buffer.block.normal );
+        result.m_hitDistance = buffer.block.distance;
+        result.m_pHitActor = buffer.block.actor;
+        result.m_pHitShape = buffer.block.shape;
+        result.m_hadInitialOverlap = buffer.block.hadInitialOverlap();
+
+        // Calculate the final shape position and remaining distance (including the separation distance)
+        if ( result.m_hadInitialOverlap )
+        {
+            result.m_finalShapePosition = result.m_start;
+            result.m_remainingDistance = sweepDistance;
+        }
+        else
+        {
+            Vector const sweepDirection = ( result.m_end - result.m_start ).GetNormalized3();
+            float const finalSweepDistance = Math::Max( 0.0f, ( buffer.block.distance - Scene::s_sweepSeperationDistance ) );
+            result.m_finalShapePosition = Vector::MultiplyAdd( sweepDirection, Vector( finalSweepDistance ), result.m_start );
+            result.m_remainingDistance = sweepDistance - finalSweepDistance;
+        }
+    }
+
+    void QueryBatch::ExecuteQueries( PxScene* pScene, int32_t startIdx, int32_t endIdx )
+    {
+        EE_ASSERT( pScene != nullptr );
+        EE_ASSERT( startIdx >= 0 && endIdx <= (int32_t) m_queries.size() );
+
+        for ( int32_t i = startIdx; i < endIdx; i++ )
+        {
+            Query const& query = m_queries[i];
+            QueryResult& result = m_results[i];
+            QueryFilter& filter = m_filters[query.m_filterIdx];
+
+            PxTransform const pose( ToPx( query.m_start ), ToPx( query.m_orientation ) );
+            PxVec3 const unitDirection = ToPx( query.m_unitDirection );
+
+            switch ( query.m_type )
+            {
+                case QueryType::RayCast:
+                {
+                    PxRaycastBuffer buffer;
+                    pScene->raycast( pose.p, unitDirection, query.m_distance, buffer, filter.m_hitFlags, filter.m_filterData, &filter );
+                    result.m_hasBlock = buffer.hasBlock;
+                    if ( buffer.hasBlock )
+                    {
+                        result.m_hitPosition = FromPx( buffer.block.position );
+                        result.m_hitNormal = FromPx( buffer.block.normal );
+                        result.m_hitDistance = buffer.block.distance;
+                        result.m_pHitActor = buffer.block.actor;
+                        result.m_pHitShape = buffer.block.shape;
+                    }
+                }
+                break;
+
+                case QueryType::SphereSweep:
+                {
+                    PxSweepBuffer buffer;
+                    PxSphereGeometry const geo( query.m_shapeDimensions.m_x );
+                    pScene->sweep( geo, pose, unitDirection, query.m_distance, buffer, filter.m_hitFlags, filter.m_filterData, &filter );
+                    SetSweepResult( buffer, query.m_distance, result );
+                }
+                break;
+
+                case QueryType::CapsuleSweep:
+                {
+                    PxSweepBuffer buffer;
+                    PxCapsuleGeometry const geo( query.m_shapeDimensions.m_y, query.m_shapeDimensions.m_x );
+                    pScene->sweep( geo, pose, unitDirection, query.m_distance, buffer, filter.m_hitFlags, filter.m_filterData, &filter );
+                    SetSweepResult( buffer, query.m_distance, result );
+                }
+                break;
+
+                case QueryType::CylinderSweep:
+                {
+                    PxSweepBuffer buffer;
+                    PxConvexMeshGeometry const geo( SharedMeshes::s_pUnitCylinderMesh, PxMeshScale( PxVec3( 2.0f * query.m_shapeDimensions.m_x, 2.0f * query.m_shapeDimensions.m_y, 2.0f * query.m_shapeDimensions.m_y ) ) );
+                    pScene->sweep( geo, pose, unitDirection, query.m_distance, buffer, filter.m_hitFlags, filter.m_filterData, &filter );
+                    SetSweepResult( buffer, query.m_distance, result );
+                }
+                break;
+
+                case QueryType::BoxSweep:
+                {
+                    PxSweepBuffer buffer;
+                    PxBoxGeometry const geo( query.m_shapeDimensions.m_x, query.m_shapeDimensions.m_y, query.m_shapeDimensions.m_z );
+                    pScene->sweep( geo, pose, unitDirection, query.m_distance, buffer, filter.m_hitFlags, filter.m_filterData, &filter );
+                    SetSweepResult( buffer, query.m_distance, result );
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case QueryType::SphereOverlap:
+                case QueryType::CapsuleOverlap:
+                case QueryType::CylinderOverlap:
+                case QueryType::BoxOverlap:
+                {
+                    // Set the no block value for overlaps
+                    PxQueryFilterData filterData = filter.m_filterData;
+                    filterData.flags |= PxQueryFlag::eNO_BLOCK;
+
+                    PxOverlapBuffer buffer( m_overlapHits.data() + result.m_firstOverlapHitIdx, query.m_maxOverlapHits );
+                    Float3 const& dimensions = query.m_shapeDimensions;
+
+                    if ( query.m_type == QueryType::SphereOverlap )
+                    {
+                        pScene->overlap( PxSphereGeometry( dimensions.m_x ), pose, buffer, filterData, &filter );
+                    }
+                    else if ( query.m_type == QueryType::CapsuleOverlap )
+                    {
+                        pScene->overlap( PxCapsuleGeometry( dimensions.m_y, dimensions.m_x ), pose, buffer, filterData, &filter );
+                    }
+                    else if ( query.m_type == QueryType::CylinderOverlap )
+                    {
+                        PxConvexMeshGeometry const geo( SharedMeshes::s_pUnitCylinderMesh, PxMeshScale( PxVec3( 2.0f * dimensions.m_x, 2.0f * dimensions.m_y, 2.0f * dimensions.m_y ) ) );
+                        pScene->overlap( geo, pose, buffer, filterData, &filter );
+                    }
+                    else
+                    {
+                        pScene->overlap( PxBoxGeometry( dimensions.m_x, dimensions.m_y, dimensions.m_z ), pose, buffer, filterData, &filter );
+                    }
+
+                    result.m_numOverlapHits = buffer.getNbTouches();
+                }
+                break;
+            }
+        }
+    }
+}
\ No newline at end of file
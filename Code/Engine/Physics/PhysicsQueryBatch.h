@@ -0,0 +1,161 @@
+#pragma once
+
+#include "Engine/Physics/PhysicsQuery.h"
+#include "System/Memory/FrameArena.h"
+
+//-------------------------------------------------------------------------
+// Physics Query Batch
+//-------------------------------------------------------------------------
+// A preallocated set of heterogeneous scene queries (ray casts, sweeps and overlaps) that are executed together
+// Results are stored in contiguous buffers, sweeps and ray casts only record the closest blocking hit
+// Overlap hits for all queries are stored in a single shared buffer, each overlap query reserves a fixed number of hits
+//
+// Queries can be added after a batch has been executed, only the newly added queries are executed on the next execution
+// This allows dependent query chains (e.g. character sweeps) to reuse a single batch and its storage
+//
+// Batches are executed via the physics scene - see 'Scene::ExecuteQueryBatch'
+//
+// Batches that only live for a single frame can be backed by a frame arena, the storage then needs no individual frees
+
+namespace EE::Physics
+{
+    class Scene;
+
+    //-------------------------------------------------------------------------
+
+    enum class QueryType : uint8_t
+    {
+        RayCast = 0,
+        SphereSweep,
+        CapsuleSweep,
+        CylinderSweep,
+        BoxSweep,
+        SphereOverlap,
+        CapsuleOverlap,
+        CylinderOverlap,
+        BoxOverlap,
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct QueryResult
+    {
+        inline bool HasBlock() const { return m_hasBlock; }
+        inline bool HadInitialOverlap() const { return m_hasBlock && m_hadInitialOverlap; }
+
+        // The position of the swept shape after the sweep (including the separation distance), the end of the sweep if nothing was hit
+        inline Vector const& GetShapePosition() const { return m_finalShapePosition; }
+        inline float GetRemainingDistance() const { return m_remainingDistance; }
+
+        inline Vector const& GetHitPosition() const { EE_ASSERT( m_hasBlock ); return m_hitPosition; }
+        inline Vector const& GetHitNormal() const { EE_ASSERT( m_hasBlock ); return m_hitNormal; }
+        inline float GetHitDistance() const { EE_ASSERT( m_hasBlock ); return m_hitDistance; }
+
+    public:
+
+        Vector                          m_start = Vector::Zero;                     // Sweep/Ray start or overlap position
+        Vector                          m_end = Vector::Zero;                       // Sweep/Ray end or overlap position
+        Vector                          m_hitPosition = Vector::Zero;
+        Vector                          m_hitNormal = Vector::Zero;
+        Vector                          m_finalShapePosition = Vector::Zero;
+        float                           m_hitDistance = 0.0f;                       // The distance along the sweep to the hit or the penetration depth for initial overlaps
+        float                           m_remainingDistance = 0.0f;
+        physx::PxRigidActor*            m_pHitActor = nullptr;
+        physx::PxShape*                 m_pHitShape = nullptr;
+        uint32_t                        m_firstOverlapHitIdx = 0;
+        uint32_t                        m_numOverlapHits = 0;
+        bool                            m_hasBlock = false;
+        bool                            m_hadInitialOverlap = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API QueryBatch
+    {
+        friend class Scene;
+
+        struct Query
+        {
+            Quaternion                  m_orientation = Quaternion::Identity;
+            Vector                      m_start;
+            Vector                      m_unitDirection;
+            Float3                      m_shapeDimensions;                          // Sphere: radius, Capsule/Cylinder: half-height and radius, Box: half-extents
+            float                       m_distance = 0.0f;
+            int32_t                     m_filterIdx = InvalidIndex;
+            uint32_t                    m_maxOverlapHits = 0;
+            QueryType                   m_type;
+        };
+
+    public:
+
+        // The default number of overlap hits reserved per overlap query
+        constexpr static uint32_t const s_defaultMaxOverlapHits = 32;
+
+    public:
+
+        QueryBatch() = default;
+        QueryBatch( uint32_t numQueries, uint32_t numOverlapHits = 0 ) { Reserve( numQueries, numOverlapHits ); }
+
+        // Create a batch whose storage is allocated from the supplied frame arena, the batch must not outlive the arena's next reset
+        QueryBatch( Memory::FrameArena* pFrameArena, uint32_t numQueries, uint32_t numOverlapHits = 0 );
+
+        void Reserve( uint32_t numQueries, uint32_t numOverlapHits = 0 );
+
+        // Clear all queries, results and filters - storage is retained
+        void Reset();
+
+        inline int32_t GetNumQueries() const { return (int32_t) m_queries.size(); }
+        inline int32_t GetNumPendingQueries() const { return (int32_t) m_queries.size() - m_numExecutedQueries; }
+
+        // Filters
+        //-------------------------------------------------------------------------
+        // Filters can be shared between multiple queries
+
+        int32_t AddFilter( QueryFilter const& filter );
+
+        // Queries - each function returns the index of the query's result
+        //-------------------------------------------------------------------------
+        // NOTE!!! Make sure to always use the Physics world transform for the shape and not the component transforms directly!!!!
+        // Note: the capsule and cylinder half-heights are along the X-axis
+
+        int32_t AddRayCast( Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx );
+        int32_t AddRayCast( Vector const& start, Vector const& end, int32_t filterIdx );
+
+        int32_t AddSphereSweep( float radius, Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx );
+        int32_t AddSphereSweep( float radius, Vector const& start, Vector const& end, int32_t filterIdx );
+        int32_t AddCapsuleSweep( float cylinderPortionHalfHeight, float radius, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx );
+        int32_t AddCylinderSweep( float halfHeight, float radius, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx );
+        int32_t AddBoxSweep( Vector const& halfExtents, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, int32_t filterIdx );
+
+        // Note: Overlap results will never have the block hit set!
+        int32_t AddSphereOverlap( float radius, Vector const& position, int32_t filterIdx, uint32_t maxHits = s_defaultMaxOverlapHits );
+        int32_t AddCapsuleOverlap( float cylinderPortionHalfHeight, float radius, Quaternion const& orientation, Vector const& position, int32_t filterIdx, uint32_t maxHits = s_defaultMaxOverlapHits );
+        int32_t AddCylinderOverlap( float halfHeight, float radius, Quaternion const& orientation, Vector const& position, int32_t filterIdx, uint32_t maxHits = s_defaultMaxOverlapHits );
+        int32_t AddBoxOverlap( Vector const& halfExtents, Quaternion const& orientation, Vector const& position, int32_t filterIdx, uint32_t maxHits = s_defaultMaxOverlapHits );
+
+        // Results
+        //-------------------------------------------------------------------------
+
+        inline bool HasExecuted( int32_t queryIdx ) const { EE_ASSERT( queryIdx >= 0 && queryIdx < GetNumQueries() ); return queryIdx < m_numExecutedQueries; }
+        inline QueryResult const& GetResult( int32_t queryIdx ) const { EE_ASSERT( HasExecuted( queryIdx ) ); return m_results[queryIdx]; }
+        inline TFrameVector<QueryResult> const& GetResults() const { return m_results; }
+
+        inline physx::PxOverlapHit const* GetOverlapHits( QueryResult const& result ) const { return m_overlapHits.data() + result.m_firstOverlapHitIdx; }
+
+    private:
+
+        int32_t AddQuery( QueryType type, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, Float3 const& shapeDimensions, int32_t filterIdx, uint32_t maxOverlapHits );
+
+        // Run the specified range of queries, the caller is responsible for the scene locks
+        void ExecuteQueries( physx::PxScene* pScene, int32_t startIdx, int32_t endIdx );
+
+    private:
+
+        // A null arena allocator falls back to the global allocator
+        TFrameVector<Query>                 m_queries;
+        TFrameVector<QueryResult>           m_results;
+        TFrameVector<QueryFilter>           m_filters;
+        TFrameVector<physx::PxOverlapHit>   m_overlapHits;
+        int32_t                             m_numExecutedQueries = 0;
+    };
+}
\ No newline at end of file
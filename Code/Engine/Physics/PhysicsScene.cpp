@@ -1,5 +1,8 @@
 #include "PhysicsScene.h"
 #include "PhysicsRagdoll.h"
+#include "PhysicsQueryBatch.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
 
 #include <PxScene.h>
 
@@ -56,4 +59,76 @@ namespace EE::Physics
         m_pScene->unlockWrite();
         EE_DEVELOPMENT_TOOLS_ONLY( m_writeLockAcquired = false );
     }
+
+    //-------------------------------------------------------------------------
+
+    void Scene::ExecuteQueryBatch( QueryBatch& batch )
+    {
+        EE_DEVELOPMENT_TOOLS_ONLY( EE_ASSERT( m_readLockCount > 0 ) );
+
+        int32_t const numQueries = batch.GetNumQueries();
+        batch.ExecuteQueries( m_pScene, batch.m_numExecutedQueries, numQueries );
+        batch.m_numExecutedQueries = numQueries;
+    }
+
+    void Scene::ExecuteQueryBatch( TaskSystem* pTaskSystem, QueryBatch& batch )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+        EE_PROFILE_SCOPE_PHYSICS( "Execute Query Batch" );
+
+        // The minimum number of queries that each worker executes, small batches are not worth the scheduling cost
+        constexpr static uint32_t const minQueriesPerWorker = 16;
+
+        int32_t const numPendingQueries = batch.GetNumPendingQueries();
+        if ( numPendingQueries <= 0 )
+        {
+            return;
+        }
+
+        if ( numPendingQueries < ( 2 * minQueriesPerWorker ) || pTaskSystem->GetNumThreads() <= 1 )
+        {
+            AcquireReadLock();
+            ExecuteQueryBatch( batch );
+            ReleaseReadLock();
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        // The scene requires each thread to hold its own read lock
+        struct QueryBatchTask final : public ITaskSet
+        {
+            QueryBatchTask( Scene* pScene, QueryBatch& batch, int32_t firstQueryIdx, uint32_t numQueries )
+                : m_pScene( pScene )
+                , m_batch( batch )
+                , m_firstQueryIdx( firstQueryIdx )
+            {
+                m_SetSize = numQueries;
+                m_MinRange = minQueriesPerWorker;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Execute Queries" );
+
+                m_pScene->AcquireReadLock();
+                m_batch.ExecuteQueries( m_pScene->m_pScene, m_firstQueryIdx + (int32_t) range.start, m_firstQueryIdx + (int32_t) range.end );
+                m_pScene->ReleaseReadLock();
+            }
+
+        private:
+
+            Scene*                          m_pScene = nullptr;
+            QueryBatch&                     m_batch;
+            int32_t                         m_firstQueryIdx = 0;
+        };
+
+        //-------------------------------------------------------------------------
+
+        QueryBatchTask task( this, batch, batch.m_numExecutedQueries, (uint32_t) numPendingQueries );
+        pTaskSystem->ScheduleTask( &task );
+        pTaskSystem->WaitForTask( &task );
+
+        batch.m_numExecutedQueries = batch.GetNumQueries();
+    }
 }
\ No newline at end of file
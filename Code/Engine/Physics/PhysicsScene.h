@@ -10,6 +10,7 @@
 namespace EE
 {
     class StringID;
+    class TaskSystem;
 }
 
 //-------------------------------------------------------------------------
@@ -17,6 +18,7 @@ namespace EE
 namespace EE::Physics
 {
     class Ragdoll;
+    class QueryBatch;
     struct RagdollDefinition;
 
     //-------------------------------------------------------------------------
@@ -50,6 +52,17 @@ namespace EE::Physics
 
         Ragdoll* CreateRagdoll( RagdollDefinition const* pDefinition, StringID const& profileID, uint64_t userID );
 
+        // Query Batches
+        //-------------------------------------------------------------------------
+        // Only the queries added since the last execution of the batch are executed
+
+        // Execute all pending queries in the batch on the calling thread, the user is expected to have acquired the read lock
+        void ExecuteQueryBatch( QueryBatch& batch );
+
+        // Execute all pending queries in the batch across the task system workers, this will acquire the read locks
+        // Each worker only acquires the read lock once for its whole range of queries, small batches are executed on the calling thread
+        void ExecuteQueryBatch( TaskSystem* pTaskSystem, QueryBatch& batch );
+
         // Queries
         //-------------------------------------------------------------------------
         // The  versions of the queries allow you to provide your own result container, generally only useful if you hit the 32 hit limit the default results provides
@@ -534,6 +534,12 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
     
+    WorldSystemDataAccessList const& PhysicsWorldSystem::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( WritesComponent<PhysicsShapeComponent>(), WritesComponent<CharacterComponent>() );
+        return accessList;
+    }
+
     void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         PxScene* pPxScene = m_pScene->m_pScene;
@@ -84,6 +84,7 @@ namespace EE::Physics
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual WorldSystemDataAccessList const& GetDataAccess() const override final;
 
         bool CreateActorAndShape( PhysicsShapeComponent* pComponent ) const;
         physx::PxRigidActor* CreateActor( PhysicsShapeComponent* pComponent ) const;
@@ -137,6 +137,12 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccessList const& PlayerManager::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( WritesComponent<Player::PlayerComponent>(), ReadsComponent<Player::PlayerSpawnComponent>(), WritesEntityMaps() );
+        return accessList;
+    }
+
     void PlayerManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.GetUpdateStage() == UpdateStage::FrameStart )
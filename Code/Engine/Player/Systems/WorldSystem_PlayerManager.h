@@ -51,6 +51,7 @@ namespace EE
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemDataAccessList const& GetDataAccess() const override;
 
         bool TrySpawnPlayer( EntityWorldUpdateContext const& ctx );
 
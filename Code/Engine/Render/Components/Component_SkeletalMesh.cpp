@@ -1,5 +1,6 @@
 #include "Component_SkeletalMesh.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationPoseKernels.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Profiling.h"
 
@@ -68,6 +69,8 @@ namespace EE::Render
         m_boneTransforms.clear();
         m_skinningTransforms.clear();
         m_animToMeshBoneMap.clear();
+        m_isInView = true;
+        m_areSkinningTransformsDirty = false;
         MeshComponent::Shutdown();
     }
 
@@ -134,14 +137,14 @@ namespace EE::Render
         EE_ASSERT( !m_animToMeshBoneMap.empty() );
         EE_ASSERT( pPose != nullptr && pPose->HasGlobalTransforms() );
 
+        TVector<Transform> const& globalTransforms = pPose->GetGlobalTransforms();
         int32_t const numAnimBones = pPose->GetNumBones();
         for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
         {
             int32_t const meshBoneIdx = m_animToMeshBoneMap[animBoneIdx];
             if ( meshBoneIdx != InvalidIndex )
             {
-                Transform const boneTransform = pPose->GetGlobalTransform( animBoneIdx );
-                m_boneTransforms[meshBoneIdx] = boneTransform;
+                m_boneTransforms[meshBoneIdx] = globalTransforms[animBoneIdx];
             }
         }
     }
@@ -169,7 +172,15 @@ namespace EE::Render
 
         NotifySocketsUpdated();
         UpdateBounds();
-        UpdateSkinningTransforms();
+
+        // The skinning is deferred to the renderer, which only updates meshes that are in view and does so for all of them in a single parallel job
+        m_areSkinningTransformsDirty = true;
+    }
+
+    bool SkeletalMeshComponent::UpdateViewVisibility( bool isInView )
+    {
+        m_isInView = isInView;
+        return m_isInView && m_areSkinningTransformsDirty;
     }
 
     //-------------------------------------------------------------------------
@@ -182,11 +193,20 @@ namespace EE::Render
         EE_ASSERT( m_skinningTransforms.size() == numBones );
 
         auto const& inverseBindPose = m_mesh->GetInverseBindPose();
-        for ( auto i = 0; i < numBones; i++ )
+        if ( Animation::PoseKernels::IsEnabled() )
+        {
+            Animation::PoseKernels::CalculateSkinningTransforms( inverseBindPose.data(), m_boneTransforms.data(), m_skinningTransforms.data(), (int32_t) numBones );
+        }
+        else
         {
-            Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
-            m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+            for ( auto i = 0; i < numBones; i++ )
+            {
+                Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
+                m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+            }
         }
+
+        m_areSkinningTransformsDirty = false;
     }
 
     void SkeletalMeshComponent::GenerateAnimationBoneMap()
@@ -16,6 +16,8 @@ namespace EE::Render
     {
         EE_REGISTER_ENTITY_COMPONENT( SkeletalMeshComponent );
 
+        friend class RendererWorldSystem;
+
     public:
 
         using MeshComponent::MeshComponent;
@@ -51,13 +53,16 @@ namespace EE::Render
             m_boneTransforms[boneIdx] = transform;
         }
 
-        // This function will finalize the pose, run any procedural bone solvers and generate the skinning transforms
+        // This function will finalize the pose, run any procedural bone solvers and flag the skinning transforms for update
         // Only run this function once per frame once you have set the final global pose
         void FinalizePose();
 
         // Get the skinning transforms for this mesh - these are the global transforms relative to the bind pose
         inline TVector<Matrix> const& GetSkinningTransforms() const { return m_skinningTransforms; }
 
+        // Was this mesh in view the last time it was culled by the renderer. Skinning transforms are only updated for meshes that are in view.
+        inline bool WasInView() const { return m_isInView; }
+
         // Animation Pose
         //-------------------------------------------------------------------------
 
@@ -83,6 +88,10 @@ namespace EE::Render
         void UpdateSkinningTransforms();
         void GenerateAnimationBoneMap();
 
+        // Called by the renderer once it has culled this mesh, returns whether the skinning transforms need to be updated before rendering
+        // The renderer updates the skinning transforms of all the visible meshes together, see RendererWorldSystem::UpdateSkinningTransforms
+        bool UpdateViewVisibility( bool isInView );
+
         virtual OBB CalculateLocalBounds() const override final;
 
         virtual void Initialize() override;
@@ -98,6 +107,8 @@ namespace EE::Render
         TVector<int32_t>                                m_animToMeshBoneMap;
         TVector<Transform>                              m_boneTransforms;
         TVector<Matrix>                                 m_skinningTransforms;
+        bool                                            m_isInView = true;
+        bool                                            m_areSkinningTransformsDirty = false;
     };
 
     //-------------------------------------------------------------------------
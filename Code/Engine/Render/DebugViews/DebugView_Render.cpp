@@ -3,6 +3,12 @@
 #include "Engine/Render/Components/Component_Lights.h"
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Render/RenderViewport.h"
+#include "System/Math/AABBTree.h"
+#include "System/Math/CullingBVH.h"
+#include "System/Math/MathRandom.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Timers.h"
 #include "System/Imgui/ImguiX.h"
 
 //-------------------------------------------------------------------------
@@ -60,11 +66,274 @@ namespace EE::Render
 
         ImGui::Checkbox( "Show Static Mesh Bounds", &m_pWorldRendererSystem->m_showStaticMeshBounds );
 
+        ImGuiX::TextSeparator( "Culling" );
+
+        RendererWorldSystem::CullingStats const& stats = m_pWorldRendererSystem->GetCullingStats();
+        ImGui::Text( "Static Mobility Meshes: %d (%d in frustum)", stats.m_numStaticMobilityMeshes, stats.m_numVisibleStaticMobilityMeshes );
+        ImGui::Text( "Frustum Cull Time: %.3fms", stats.m_staticMobilityCullTime.ToFloat() );
+        ImGui::Text( "Last BVH Build Time: %.3fms", stats.m_bvhBuildTime.ToFloat() );
+
+        ImGui::Checkbox( "Compare With View AABB Cull", &m_pWorldRendererSystem->m_compareCullingWithViewAABB );
+        if ( m_pWorldRendererSystem->m_compareCullingWithViewAABB )
+        {
+            int32_t const numFalsePositives = stats.m_numVisibleStaticMobilityMeshesWithViewAABB - stats.m_numVisibleStaticMobilityMeshes;
+            float const falsePositiveRate = ( stats.m_numVisibleStaticMobilityMeshesWithViewAABB > 0 ) ? float( numFalsePositives ) / stats.m_numVisibleStaticMobilityMeshesWithViewAABB : 0.0f;
+            ImGui::Text( "View AABB Cull Time: %.3fms", stats.m_viewAABBCullTime.ToFloat() );
+            ImGui::Text( "View AABB False Positives: %d (%.1f%%)", numFalsePositives, falsePositiveRate * 100 );
+        }
+
+        if ( ImGui::Button( "Run Culling Benchmark (100k Instances)" ) )
+        {
+            m_cullingBenchmarkResults = RunCullingBenchmark( context.GetSystem<TaskSystem>(), context.GetViewport()->GetViewVolume(), 100000 );
+            m_hasCullingBenchmarkResults = true;
+        }
+
+        if ( m_hasCullingBenchmarkResults )
+        {
+            auto const& results = m_cullingBenchmarkResults;
+            int32_t const numFalsePositives = results.m_numViewAABBResults - results.m_numInFrustum;
+            float const falsePositiveRate = ( results.m_numViewAABBResults > 0 ) ? float( numFalsePositives ) / results.m_numViewAABBResults : 0.0f;
+            float const speedup = ( results.m_bvhParallelCullTime > 0.0f ) ? results.m_viewAABBCullTime.ToFloat() / results.m_bvhParallelCullTime.ToFloat() : 0.0f;
+
+            ImGui::Text( "Instances: %d, In Frustum: %d, BVH Nodes: %d", results.m_numInstances, results.m_numInFrustum, results.m_numBVHNodes );
+            ImGui::Text( "Tree Build: %.3fms, BVH Build: %.3fms", results.m_treeBuildTime.ToFloat(), results.m_bvhBuildTime.ToFloat() );
+            ImGui::Text( "View AABB Cull: %.3fms - %d results, %d false positives (%.1f%%)", results.m_viewAABBCullTime.ToFloat(), results.m_numViewAABBResults, numFalsePositives, falsePositiveRate * 100 );
+            ImGui::Text( "BVH Frustum Cull: %.3fms (parallel: %.3fms, %.1fx) - %d results", results.m_bvhCullTime.ToFloat(), results.m_bvhParallelCullTime.ToFloat(), speedup, results.m_numBVHResults );
+        }
+
+        if ( ImGui::Button( "Run AABB Tree Benchmark (100k Instances, 5k Moving)" ) )
+        {
+            m_aabbTreeBenchmarkResults = RunAABBTreeBenchmark( context.GetSystem<TaskSystem>(), 100000, 5000 );
+            m_hasAABBTreeBenchmarkResults = true;
+        }
+
+        if ( m_hasAABBTreeBenchmarkResults )
+        {
+            auto const& results = m_aabbTreeBenchmarkResults;
+            ImGui::Text( "Instances: %d, Moving: %d", results.m_numInstances, results.m_numMovingInstances );
+            ImGui::Text( "Build - Incremental: %.3fms, Bulk: %.3fms, Parallel Bulk: %.3fms", results.m_incrementalBuildTime.ToFloat(), results.m_bulkBuildTime.ToFloat(), results.m_parallelBulkBuildTime.ToFloat() );
+            ImGui::Text( "Update Per Frame - Reinsert: %.3fms, Refit: %.3fms", results.m_reinsertUpdateTime.ToFloat(), results.m_refitUpdateTime.ToFloat() );
+            ImGui::Text( "Incremental Tree - SAH Cost: %.1f, Query: %.4fms", results.m_incrementalSAHCost, results.m_incrementalQueryTime.ToFloat() );
+            ImGui::Text( "Bulk Tree - SAH Cost: %.1f, Query: %.4fms", results.m_bulkSAHCost, results.m_bulkQueryTime.ToFloat() );
+            ImGui::Text( "Reinserted Tree - SAH Cost: %.1f, Query: %.4fms", results.m_reinsertSAHCost, results.m_reinsertQueryTime.ToFloat() );
+            ImGui::Text( "Refit Tree - SAH Cost: %.1f, Query: %.4fms", results.m_refitSAHCost, results.m_refitQueryTime.ToFloat() );
+        }
+
         ImGuiX::TextSeparator( "Skeletal Meshes" );
 
         ImGui::Checkbox( "Show Skeletal Mesh Bounds", &m_pWorldRendererSystem->m_showSkeletalMeshBounds );
         ImGui::Checkbox( "Show Skeletal Mesh Bones", &m_pWorldRendererSystem->m_showSkeletalMeshBones );
         ImGui::Checkbox( "Show Skeletal Bind Poses", &m_pWorldRendererSystem->m_showSkeletalMeshBindPoses );
+
+        ImGui::Text( "Skinned Meshes: %d", stats.m_numSkinnedSkeletalMeshes );
+        ImGui::Text( "Skinning Time: %.3fms", stats.m_skinningTime.ToFloat() );
+    }
+
+    RenderDebugView::CullingBenchmarkResults RenderDebugView::RunCullingBenchmark( TaskSystem* pTaskSystem, Math::ViewVolume const& viewVolume, int32_t numInstances )
+    {
+        EE_ASSERT( pTaskSystem != nullptr && numInstances > 0 );
+
+        constexpr static int32_t const s_numIterations = 16;
+
+        CullingBenchmarkResults results;
+        results.m_numInstances = numInstances;
+
+        // Scatter random boxes around the view, the world extent covers the view volume so that we get a mix of visible and culled instances
+        //-------------------------------------------------------------------------
+
+        Math::RNG rng( 0 );
+        AABB const viewBounds = viewVolume.GetAABB();
+        Vector const worldCenter = viewBounds.m_center;
+        Float3 const viewExtents = viewBounds.m_extents.ToFloat3();
+        float const worldExtent = Math::Min( Math::Max( viewExtents.m_x, Math::Max( viewExtents.m_y, viewExtents.m_z ) ), 1000.0f );
+
+        TVector<AABB> instanceBounds;
+        instanceBounds.reserve( numInstances );
+        for ( int32_t i = 0; i < numInstances; i++ )
+        {
+            Vector const center = worldCenter + Vector( rng.GetFloat( -worldExtent, worldExtent ), rng.GetFloat( -worldExtent, worldExtent ), rng.GetFloat( -worldExtent, worldExtent ) );
+            Vector const extents( rng.GetFloat( 0.25f, 4.0f ), rng.GetFloat( 0.25f, 4.0f ), rng.GetFloat( 0.25f, 4.0f ) );
+            instanceBounds.emplace_back( center, extents );
+        }
+
+        // Build
+        //-------------------------------------------------------------------------
+
+        Math::AABBTree tree;
+        {
+            ScopedTimer<PlatformClock> timer( results.m_treeBuildTime );
+            for ( int32_t i = 0; i < numInstances; i++ )
+            {
+                tree.InsertBox( instanceBounds[i], uint64_t( i + 1 ) ); // User data cannot be zero
+            }
+        }
+
+        Math::CullingBVH bvh;
+        {
+            ScopedTimer<PlatformClock> timer( results.m_bvhBuildTime );
+            bvh.Build( tree );
+        }
+        results.m_numBVHNodes = bvh.GetNumNodes();
+
+        // Reference result
+        //-------------------------------------------------------------------------
+
+        for ( auto const& bounds : instanceBounds )
+        {
+            if ( viewVolume.Contains( bounds ) )
+            {
+                results.m_numInFrustum++;
+            }
+        }
+
+        // Cull
+        //-------------------------------------------------------------------------
+
+        TVector<uint64_t> cullResults;
+        cullResults.reserve( numInstances );
+
+        Timer<PlatformClock> timer;
+        for ( int32_t i = 0; i < s_numIterations; i++ )
+        {
+            tree.FindOverlaps( viewBounds, cullResults );
+        }
+        results.m_viewAABBCullTime = timer.GetElapsedTimeMilliseconds().ToFloat() / s_numIterations;
+        results.m_numViewAABBResults = (int32_t) cullResults.size();
+
+        timer.Start();
+        for ( int32_t i = 0; i < s_numIterations; i++ )
+        {
+            bvh.Cull( viewVolume, cullResults );
+        }
+        results.m_bvhCullTime = timer.GetElapsedTimeMilliseconds().ToFloat() / s_numIterations;
+
+        timer.Start();
+        for ( int32_t i = 0; i < s_numIterations; i++ )
+        {
+            bvh.Cull( pTaskSystem, viewVolume, cullResults );
+        }
+        results.m_bvhParallelCullTime = timer.GetElapsedTimeMilliseconds().ToFloat() / s_numIterations;
+        results.m_numBVHResults = (int32_t) cullResults.size();
+
+        return results;
+    }
+
+    RenderDebugView::AABBTreeBenchmarkResults RenderDebugView::RunAABBTreeBenchmark( TaskSystem* pTaskSystem, int32_t numInstances, int32_t numMovingInstances )
+    {
+        EE_ASSERT( pTaskSystem != nullptr && numInstances > 0 && numMovingInstances <= numInstances );
+
+        constexpr static int32_t const s_numFrames = 32;
+        constexpr static int32_t const s_numQueries = 1024;
+        constexpr static float const s_worldExtent = 1000.0f;
+        constexpr static float const s_maxMoveDistancePerFrame = 0.5f;
+        constexpr static float const s_fatMargin = 1.0f;
+
+        AABBTreeBenchmarkResults results;
+        results.m_numInstances = numInstances;
+        results.m_numMovingInstances = numMovingInstances;
+
+        Math::RNG rng( 0 );
+        auto GetRandomPoint = [&rng] ( float extent ) { return Vector( rng.GetFloat( -extent, extent ), rng.GetFloat( -extent, extent ), rng.GetFloat( -extent, extent ) ); };
+        auto GetRandomOffset = [&rng] ( float extent ) { return Vector( rng.GetFloat( -extent, extent ), rng.GetFloat( -extent, extent ), rng.GetFloat( -extent, extent ), 0.0f ); };
+
+        TVector<AABB> boxes;
+        TVector<uint64_t> userData;
+        boxes.reserve( numInstances );
+        userData.reserve( numInstances );
+        for ( int32_t i = 0; i < numInstances; i++ )
+        {
+            Vector const extents( rng.GetFloat( 0.25f, 4.0f ), rng.GetFloat( 0.25f, 4.0f ), rng.GetFloat( 0.25f, 4.0f ) );
+            boxes.emplace_back( GetRandomPoint( s_worldExtent ), extents );
+            userData.emplace_back( uint64_t( i + 1 ) ); // User data cannot be zero
+        }
+
+        TVector<AABB> queryBoxes;
+        queryBoxes.reserve( s_numQueries );
+        for ( int32_t i = 0; i < s_numQueries; i++ )
+        {
+            queryBoxes.emplace_back( GetRandomPoint( s_worldExtent ), Vector( 25.0f ) );
+        }
+
+        TVector<uint64_t> queryResults;
+        auto MeasureQueryTime = [&] ( Math::AABBTree const& tree )
+        {
+            Timer<PlatformClock> timer;
+            for ( auto const& queryBox : queryBoxes )
+            {
+                tree.FindOverlaps( queryBox, queryResults );
+            }
+            return Milliseconds( timer.GetElapsedTimeMilliseconds().ToFloat() / s_numQueries );
+        };
+
+        // Build
+        //-------------------------------------------------------------------------
+
+        Math::AABBTree incrementalTree;
+        {
+            ScopedTimer<PlatformClock> timer( results.m_incrementalBuildTime );
+            for ( int32_t i = 0; i < numInstances; i++ )
+            {
+                incrementalTree.InsertBox( boxes[i], userData[i] );
+            }
+        }
+
+        Math::AABBTree bulkTree;
+        {
+            ScopedTimer<PlatformClock> timer( results.m_bulkBuildTime );
+            bulkTree.Build( boxes, userData );
+        }
+
+        Math::AABBTree reinsertTree;
+        {
+            ScopedTimer<PlatformClock> timer( results.m_parallelBulkBuildTime );
+            reinsertTree.Build( boxes, userData, pTaskSystem );
+        }
+
+        Math::AABBTree refitTree( s_fatMargin );
+        refitTree.Build( boxes, userData, pTaskSystem );
+
+        results.m_incrementalSAHCost = incrementalTree.CalculateSAHCost();
+        results.m_bulkSAHCost = bulkTree.CalculateSAHCost();
+        results.m_incrementalQueryTime = MeasureQueryTime( incrementalTree );
+        results.m_bulkQueryTime = MeasureQueryTime( bulkTree );
+
+        // Move the first N instances a little every frame, and update both trees
+        //-------------------------------------------------------------------------
+
+        Milliseconds totalReinsertTime = 0;
+        Milliseconds totalRefitTime = 0;
+        for ( int32_t frameIdx = 0; frameIdx < s_numFrames; frameIdx++ )
+        {
+            for ( int32_t i = 0; i < numMovingInstances; i++ )
+            {
+                boxes[i].Translate( GetRandomOffset( s_maxMoveDistancePerFrame ) );
+            }
+
+            Timer<PlatformClock> timer;
+            for ( int32_t i = 0; i < numMovingInstances; i++ )
+            {
+                reinsertTree.RemoveBox( userData[i] );
+                reinsertTree.InsertBox( boxes[i], userData[i] );
+            }
+            totalReinsertTime += timer.GetElapsedTimeMilliseconds();
+
+            timer.Start();
+            for ( int32_t i = 0; i < numMovingInstances; i++ )
+            {
+                refitTree.UpdateBox( boxes[i], userData[i] );
+            }
+            refitTree.Optimize( 128 );
+            totalRefitTime += timer.GetElapsedTimeMilliseconds();
+        }
+
+        results.m_reinsertUpdateTime = totalReinsertTime.ToFloat() / s_numFrames;
+        results.m_refitUpdateTime = totalRefitTime.ToFloat() / s_numFrames;
+        results.m_reinsertSAHCost = reinsertTree.CalculateSAHCost();
+        results.m_refitSAHCost = refitTree.CalculateSAHCost();
+        results.m_reinsertQueryTime = MeasureQueryTime( reinsertTree );
+        results.m_refitQueryTime = MeasureQueryTime( refitTree );
+
+        return results;
     }
 
     void RenderDebugView::DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass )
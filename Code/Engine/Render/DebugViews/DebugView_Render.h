@@ -2,10 +2,16 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
+namespace EE { class TaskSystem; }
+namespace EE::Math { class ViewVolume; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Render
 {
     class RendererWorldSystem;
@@ -17,6 +23,41 @@ namespace EE::Render
     {
         EE_REGISTER_TYPE( RenderDebugView );
 
+        // Results of culling a synthetic set of static instances with both the view AABB tree query and the frustum BVH
+        struct CullingBenchmarkResults
+        {
+            int32_t                     m_numInstances = 0;
+            int32_t                     m_numBVHNodes = 0;
+            int32_t                     m_numInFrustum = 0;             // Brute force reference result
+            int32_t                     m_numViewAABBResults = 0;
+            int32_t                     m_numBVHResults = 0;
+            Milliseconds                m_treeBuildTime = 0;
+            Milliseconds                m_bvhBuildTime = 0;
+            Milliseconds                m_viewAABBCullTime = 0;         // Average per cull
+            Milliseconds                m_bvhCullTime = 0;              // Average per cull
+            Milliseconds                m_bvhParallelCullTime = 0;      // Average per cull
+        };
+
+        // Results of building, updating and querying a synthetic set of boxes with the different AABB tree construction/update paths
+        struct AABBTreeBenchmarkResults
+        {
+            int32_t                     m_numInstances = 0;
+            int32_t                     m_numMovingInstances = 0;
+            Milliseconds                m_incrementalBuildTime = 0;
+            Milliseconds                m_bulkBuildTime = 0;
+            Milliseconds                m_parallelBulkBuildTime = 0;
+            Milliseconds                m_reinsertUpdateTime = 0;       // Average per frame
+            Milliseconds                m_refitUpdateTime = 0;          // Average per frame, includes the incremental optimization
+            float                       m_incrementalSAHCost = 0;
+            float                       m_bulkSAHCost = 0;
+            float                       m_reinsertSAHCost = 0;
+            float                       m_refitSAHCost = 0;
+            Milliseconds                m_incrementalQueryTime = 0;     // Average per query
+            Milliseconds                m_bulkQueryTime = 0;            // Average per query
+            Milliseconds                m_reinsertQueryTime = 0;        // Average per query
+            Milliseconds                m_refitQueryTime = 0;           // Average per query
+        };
+
     public:
 
         static void DrawRenderVisualizationModesMenu( EntityWorld const* pWorld );
@@ -34,9 +75,16 @@ namespace EE::Render
 
         void DrawRenderMenu( EntityWorldUpdateContext const& context );
 
+        static CullingBenchmarkResults RunCullingBenchmark( TaskSystem* pTaskSystem, Math::ViewVolume const& viewVolume, int32_t numInstances );
+        static AABBTreeBenchmarkResults RunAABBTreeBenchmark( TaskSystem* pTaskSystem, int32_t numInstances, int32_t numMovingInstances );
+
     private:
 
         RendererWorldSystem*            m_pWorldRendererSystem = nullptr;
+        CullingBenchmarkResults         m_cullingBenchmarkResults;
+        bool                            m_hasCullingBenchmarkResults = false;
+        AABBTreeBenchmarkResults        m_aabbTreeBenchmarkResults;
+        bool                            m_hasAABBTreeBenchmarkResults = false;
     };
 }
 #endif
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include "System/Render/RenderCoreResources.h"
 #include "System/Render/RenderViewport.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Timers.h"
 #include "System/Profiling.h"
 #include "System/Log.h"
 
@@ -149,7 +151,7 @@ namespace EE::Render
             else
             {
                 m_staticStaticMeshComponents.Add( pMeshComponent );
-                m_staticMobilityTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
+                m_staticMobilityInsertList.emplace_back( pMeshComponent );
             }
         }
     }
@@ -186,7 +188,18 @@ namespace EE::Render
             else
             {
                 m_staticStaticMeshComponents.Remove( pMeshComponent->GetID() );
-                m_staticMobilityTree.RemoveBox( pMeshComponent );
+
+                // The component might not have been added to the tree yet
+                int32_t const insertListIdx = VectorFindIndex( m_staticMobilityInsertList, pMeshComponent );
+                if ( insertListIdx != InvalidIndex )
+                {
+                    m_staticMobilityInsertList.erase_unsorted( m_staticMobilityInsertList.begin() + insertListIdx );
+                }
+                else
+                {
+                    m_staticMobilityTree.RemoveBox( pMeshComponent );
+                    m_isStaticMobilityBVHDirty = true;
+                }
             }
         }
 
@@ -236,8 +249,63 @@ namespace EE::Render
         m_registeredSkeletalMeshComponents.Remove( pMeshComponent->GetID() );
     }
 
+    void RendererWorldSystem::UpdateSkinningTransforms( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        #if EE_DEVELOPMENT_TOOLS
+        ScopedTimer<PlatformClock> timer( m_cullingStats.m_skinningTime );
+        m_cullingStats.m_numSkinnedSkeletalMeshes = (int32_t) m_skinningUpdateList.size();
+        #endif
+
+        if ( m_skinningUpdateList.empty() )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct SkinningTask final : public ITaskSet
+        {
+            SkinningTask( TVector<SkeletalMeshComponent*> const& meshComponents )
+                : m_meshComponents( meshComponents )
+            {
+                m_SetSize = (uint32_t) meshComponents.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_RENDER( "Update Skinning Transforms" );
+
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    m_meshComponents[i]->UpdateSkinningTransforms();
+                }
+            }
+
+        private:
+
+            TVector<SkeletalMeshComponent*> const&          m_meshComponents;
+        };
+
+        //-------------------------------------------------------------------------
+
+        auto pTaskSystem = ctx.GetSystem<TaskSystem>();
+        SkinningTask skinningTask( m_skinningUpdateList );
+        pTaskSystem->ScheduleTask( &skinningTask );
+        pTaskSystem->WaitForTask( &skinningTask );
+
+        m_skinningUpdateList.clear();
+    }
+
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccessList const& RendererWorldSystem::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( ReadsComponent<StaticMeshComponent>(), WritesComponent<SkeletalMeshComponent>() );
+        return accessList;
+    }
+
     void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         EE_PROFILE_FUNCTION_RENDER();
@@ -249,6 +317,44 @@ namespace EE::Render
 
         EE_ASSERT( ( ctx.GetUpdateStage() == UpdateStage::Paused ) ? ctx.IsWorldPaused() : true );
 
+        //-------------------------------------------------------------------------
+        // Static Mobility Tree Inserts
+        //-------------------------------------------------------------------------
+        // Large batches of new components (i.e. map loads) are bulk built since that is both faster and results in a better tree than inserting one by one
+
+        if ( !m_staticMobilityInsertList.empty() )
+        {
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh Tree Inserts" );
+
+            constexpr static int32_t const s_minBulkBuildSize = 64;
+            int32_t const numPendingInserts = (int32_t) m_staticMobilityInsertList.size();
+            if ( numPendingInserts >= s_minBulkBuildSize && numPendingInserts >= m_staticMobilityTree.GetNumLeaves() )
+            {
+                TVector<AABB> boxes;
+                TVector<uint64_t> userData;
+                boxes.reserve( m_staticStaticMeshComponents.size() );
+                userData.reserve( m_staticStaticMeshComponents.size() );
+
+                for ( auto pMeshComponent : m_staticStaticMeshComponents )
+                {
+                    boxes.emplace_back( pMeshComponent->GetWorldBounds().GetAABB() );
+                    userData.emplace_back( reinterpret_cast<uint64_t>( pMeshComponent ) );
+                }
+
+                m_staticMobilityTree.Build( boxes, userData, ctx.GetSystem<TaskSystem>() );
+            }
+            else
+            {
+                for ( auto pMeshComponent : m_staticMobilityInsertList )
+                {
+                    m_staticMobilityTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
+                }
+            }
+
+            m_staticMobilityInsertList.clear();
+            m_isStaticMobilityBVHDirty = true;
+        }
+
         //-------------------------------------------------------------------------
         // Mobility Updates
         //-------------------------------------------------------------------------
@@ -270,6 +376,8 @@ namespace EE::Render
                 m_staticStaticMeshComponents.Add( pMeshComponent );
                 m_staticMobilityTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
             }
+
+            m_isStaticMobilityBVHDirty = true;
         }
 
         m_mobilityUpdateList.clear();
@@ -283,22 +391,52 @@ namespace EE::Render
                 EE_LOG_ENTITY_ERROR( pMeshComponent, "Render", "Someone moved a mesh with static mobility: %s with entity ID %u. This should not be done!", pMeshComponent->GetNameID().c_str(), pMeshComponent->GetEntityID().m_value );
             }
 
-            m_staticMobilityTree.RemoveBox( pMeshComponent );
-            m_staticMobilityTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
+            m_isStaticMobilityBVHDirty |= m_staticMobilityTree.UpdateBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
         }
 
         m_staticMobilityTransformUpdateList.clear();
 
+        // Since we need to rebuild the BVH anyway, use this opportunity to improve the tree quality
+        if ( m_isStaticMobilityBVHDirty )
+        {
+            m_staticMobilityTree.Optimize( 32 );
+        }
+
+        // Flatten the static mobility tree for culling
+        //-------------------------------------------------------------------------
+
+        if ( m_isStaticMobilityBVHDirty )
+        {
+            EE_PROFILE_SCOPE_RENDER( "Rebuild Static Mesh BVH" );
+
+            #if EE_DEVELOPMENT_TOOLS
+            ScopedTimer<PlatformClock> timer( m_cullingStats.m_bvhBuildTime );
+            #endif
+
+            m_staticMobilityBVH.Build( m_staticMobilityTree );
+            m_isStaticMobilityBVHDirty = false;
+        }
+
         //-------------------------------------------------------------------------
         // Culling
         //-------------------------------------------------------------------------
 
-        AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
+        Math::ViewVolume const& viewVolume = ctx.GetViewport()->GetViewVolume();
 
         m_visibleStaticMeshComponents.clear();
         {
-            EE_PROFILE_SCOPE_RENDER( "Static Mesh AABB Cull" );
-            m_staticMobilityTree.FindOverlaps( viewBounds, m_visibleStaticMeshComponents );
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh Frustum Cull" );
+
+            #if EE_DEVELOPMENT_TOOLS
+            ScopedTimer<PlatformClock> timer( m_cullingStats.m_staticMobilityCullTime );
+            #endif
+
+            m_staticMobilityBVH.Cull( ctx.GetSystem<TaskSystem>(), viewVolume, m_visibleStaticMeshComponents );
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_cullingStats.m_numStaticMobilityMeshes = m_staticMobilityBVH.GetNumLeaves();
+            m_cullingStats.m_numVisibleStaticMobilityMeshes = (int32_t) m_visibleStaticMeshComponents.size();
+            #endif
 
             for ( int32_t i = int32_t( m_visibleStaticMeshComponents.size() ) - 1; i >= 0 ; i-- )
             {
@@ -309,19 +447,37 @@ namespace EE::Render
             }
         }
 
-        for ( auto pMeshComponent : m_dynamicStaticMeshComponents )
+        // Run the old view AABB query so we can compare the cost and the number of false positives
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_compareCullingWithViewAABB )
+        {
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh AABB Cull" );
+
+            TVector<StaticMeshComponent*> viewAABBResults;
+            {
+                ScopedTimer<PlatformClock> timer( m_cullingStats.m_viewAABBCullTime );
+                m_staticMobilityTree.FindOverlaps( viewVolume.GetAABB(), viewAABBResults );
+            }
+            m_cullingStats.m_numVisibleStaticMobilityMeshesWithViewAABB = (int32_t) viewAABBResults.size();
+        }
+        #endif
+
         {
             EE_PROFILE_SCOPE_RENDER( "Static Mesh Dynamic Cull" );
 
-            if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
+            for ( auto pMeshComponent : m_dynamicStaticMeshComponents )
             {
-                m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
+                if ( pMeshComponent->IsVisible() && viewVolume.Contains( pMeshComponent->GetWorldBounds().GetAABB() ) )
+                {
+                    m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
+                }
             }
         }
 
         //-------------------------------------------------------------------------
 
         m_visibleSkeletalMeshComponents.clear();
+        m_skinningUpdateList.clear();
 
         for ( auto const& meshGroup : m_skeletalMeshGroups )
         {
@@ -329,13 +485,23 @@ namespace EE::Render
 
             for ( auto pMeshComponent : meshGroup.m_components )
             {
-                if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
+                bool const isInView = pMeshComponent->IsVisible() && viewVolume.Contains( pMeshComponent->GetWorldBounds().GetAABB() );
+
+                // This lets the animation skip skinning (and drop its LOD) for meshes that are out of view
+                if ( pMeshComponent->UpdateViewVisibility( isInView ) )
+                {
+                    m_skinningUpdateList.emplace_back( pMeshComponent );
+                }
+
+                if ( isInView )
                 {
                     m_visibleSkeletalMeshComponents.emplace_back( pMeshComponent );
                 }
             }
         }
 
+        UpdateSkinningTransforms( ctx );
+
         //-------------------------------------------------------------------------
         // Debug
         //-------------------------------------------------------------------------
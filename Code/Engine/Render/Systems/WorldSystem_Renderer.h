@@ -6,6 +6,8 @@
 #include "Engine/Render/Mesh/SkeletalMesh.h"
 #include "System/Render/RenderDevice.h"
 #include "System/Math/AABBTree.h"
+#include "System/Math/CullingBVH.h"
+#include "System/Time/Time.h"
 #include "System/Types/Event.h"
 #include "System/Systems.h"
 #include "System/Types/IDVector.h"
@@ -46,6 +48,20 @@ namespace EE::Render
         };
         #endif
 
+        #if EE_DEVELOPMENT_TOOLS
+        struct CullingStats
+        {
+            int32_t                                             m_numStaticMobilityMeshes = 0;
+            int32_t                                             m_numVisibleStaticMobilityMeshes = 0;
+            int32_t                                             m_numVisibleStaticMobilityMeshesWithViewAABB = 0;   // Only calculated when the comparison is enabled
+            Milliseconds                                        m_staticMobilityCullTime = 0;
+            Milliseconds                                        m_viewAABBCullTime = 0;                             // Only calculated when the comparison is enabled
+            Milliseconds                                        m_bvhBuildTime = 0;
+            int32_t                                             m_numSkinnedSkeletalMeshes = 0;
+            Milliseconds                                        m_skinningTime = 0;
+        };
+        #endif
+
     private:
 
         // Track all instances of a given mesh together - to limit the number of vertex buffer changes
@@ -69,6 +85,7 @@ namespace EE::Render
         #if EE_DEVELOPMENT_TOOLS
         void SetVisualizationMode( VisualizationMode mode ) { m_visualizationMode = mode; }
         VisualizationMode GetVisualizationMode() { return m_visualizationMode; }
+        CullingStats const& GetCullingStats() const { return m_cullingStats; }
         #endif
 
     private:
@@ -79,6 +96,7 @@ namespace EE::Render
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual WorldSystemDataAccessList const& GetDataAccess() const override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
 
@@ -96,6 +114,9 @@ namespace EE::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // Update the skinning transforms for all visible skeletal meshes with a new pose in a single parallel job
+        void UpdateSkinningTransforms( EntityWorldUpdateContext const& ctx );
+
     private:
 
         // Static meshes
@@ -108,12 +129,16 @@ namespace EE::Render
         Threading::Mutex                                                m_mobilityUpdateListLock;               // Mobility switches can occur on any thread so the list needs to be threadsafe. We use a simple lock for now since we dont expect too many switches
         TVector<StaticMeshComponent*>                                   m_mobilityUpdateList;                   // A list of all components that switched mobility during this frame, will results in an update of the various spatial data structures next frame
         TVector<StaticMeshComponent*>                                   m_staticMobilityTransformUpdateList;    // A list of all static mobility components that have moved during this frame, will results in an update of the various spatial data structures next frame
+        TVector<StaticMeshComponent*>                                   m_staticMobilityInsertList;             // A list of all newly registered static mobility components that still need to be added to the tree
         Math::AABBTree                                                  m_staticMobilityTree;
+        Math::CullingBVH                                                m_staticMobilityBVH;                    // Flattened version of the static mobility tree used for culling, rebuilt whenever the tree changes
+        bool                                                            m_isStaticMobilityBVHDirty = false;
 
         // Skeletal meshes
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
+        TVector<SkeletalMeshComponent*>                                 m_skinningUpdateList;                   // All visible skeletal meshes whose pose changed since they were last skinned
 
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
@@ -128,6 +153,8 @@ namespace EE::Render
         bool                                                            m_showSkeletalMeshBounds = false;
         bool                                                            m_showSkeletalMeshBones = false;
         bool                                                            m_showSkeletalMeshBindPoses = false;
+        bool                                                            m_compareCullingWithViewAABB = false;
+        CullingStats                                                    m_cullingStats;
         #endif
     };
 }
\ No newline at end of file
@@ -320,6 +320,7 @@ namespace EE
         m_resourceSystem.RegisterResourceLoader( &m_boneMaskLoader );
         m_resourceSystem.RegisterResourceLoader( &m_animationClipLoader );
         m_resourceSystem.RegisterResourceLoader( &m_graphLoader );
+        m_resourceSystem.RegisterResourceLoader( &m_motionMatchingDatabaseLoader );
 
         //-------------------------------------------------------------------------
 
@@ -363,6 +364,7 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        m_resourceSystem.UnregisterResourceLoader( &m_motionMatchingDatabaseLoader );
         m_resourceSystem.UnregisterResourceLoader( &m_animationClipLoader );
         m_resourceSystem.UnregisterResourceLoader( &m_graphLoader );
         m_resourceSystem.UnregisterResourceLoader( &m_boneMaskLoader );
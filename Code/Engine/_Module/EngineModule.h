@@ -14,6 +14,7 @@
 #include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationClip.h"
 #include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationGraph.h"
 #include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationBoneMask.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationMotionMatchingDatabase.h"
 #include "Engine/Navmesh/ResourceLoaders/ResourceLoader_Navmesh.h"
 #include "Engine/Navmesh/NavmeshSystem.h"
 #include "Engine/Render/RendererRegistry.h"
@@ -118,6 +119,7 @@ namespace EE
         Animation::BoneMaskLoader                       m_boneMaskLoader;
         Animation::AnimationClipLoader                  m_animationClipLoader;
         Animation::GraphLoader                          m_graphLoader;
+        Animation::MotionMatchingDatabaseLoader         m_motionMatchingDatabaseLoader;
 
         // Physics
         Physics::PhysicsSystem                          m_physicsSystem;
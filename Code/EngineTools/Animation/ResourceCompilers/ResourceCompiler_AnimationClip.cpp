@@ -21,6 +21,7 @@ namespace EE::Animation
     {
         TypeSystem::TypeDescriptorCollection            m_collection;
         TInlineVector<SyncTrack::EventMarker, 10>       m_syncEventMarkers;
+        AnimationClip::EventIndex                       m_eventIndex;
     };
 
     //-------------------------------------------------------------------------
@@ -148,6 +149,7 @@ namespace EE::Animation
 
         AnimationClip animData;
         animData.m_skeleton = resourceDescriptor.m_skeleton;
+        animData.m_dataLayout = resourceDescriptor.m_dataLayout;
 
         TransferAndCompressAnimationData( *pRawAnimation, animData, resourceDescriptor.m_limitFrameRange );
 
@@ -170,6 +172,7 @@ namespace EE::Animation
         archive << hdr << animData;
         archive << eventData.m_syncEventMarkers;
         archive << eventData.m_collection;
+        archive << eventData.m_eventIndex;
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
         {
@@ -333,7 +336,7 @@ namespace EE::Animation
         animClip.m_rootMotion.m_averageLinearVelocity = totalDistance / animClip.GetDuration();
         animClip.m_rootMotion.m_averageAngularVelocity = totalRotation / animClip.GetDuration();
 
-        // Compress raw data
+        // Calculate compression settings
         //-------------------------------------------------------------------------
 
         static constexpr float const defaultQuantizationRangeLength = 0.1f;
@@ -342,24 +345,6 @@ namespace EE::Animation
         {
             TrackCompressionSettings trackSettings;
 
-            // Record offset into data for this track
-            trackSettings.m_trackStartIndex = (uint32_t) animClip.m_compressedPoseData.size();
-
-            //-------------------------------------------------------------------------
-            // Rotation
-            //-------------------------------------------------------------------------
-
-            for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
-            {
-                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdx];
-                Quaternion const rotation = rawBoneTransform.GetRotation();
-
-                Quantization::EncodedQuaternion const encodedQuat( rotation );
-                animClip.m_compressedPoseData.push_back( encodedQuat.GetData0() );
-                animClip.m_compressedPoseData.push_back( encodedQuat.GetData1() );
-                animClip.m_compressedPoseData.push_back( encodedQuat.GetData2() );
-            }
-
             //-------------------------------------------------------------------------
             // Translation
             //-------------------------------------------------------------------------
@@ -391,38 +376,6 @@ namespace EE::Animation
                 trackSettings.m_translationRangeZ = { rawTranslationValueRangeZ.m_begin, Math::IsNearZero( rawTranslationValueRangeLengthZ ) ? defaultQuantizationRangeLength : rawTranslationValueRangeLengthZ };
             }
 
-            //-------------------------------------------------------------------------
-
-            if ( trackSettings.IsTranslationTrackStatic() )
-            {
-                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[0];
-                Vector const& translation = rawBoneTransform.GetTranslation();
-
-                uint16_t const m_x = Quantization::EncodeFloat( translation.m_x, trackSettings.m_translationRangeX.m_rangeStart, trackSettings.m_translationRangeX.m_rangeLength );
-                uint16_t const m_y = Quantization::EncodeFloat( translation.m_y, trackSettings.m_translationRangeY.m_rangeStart, trackSettings.m_translationRangeY.m_rangeLength );
-                uint16_t const m_z = Quantization::EncodeFloat( translation.m_z, trackSettings.m_translationRangeZ.m_rangeStart, trackSettings.m_translationRangeZ.m_rangeLength );
-
-                animClip.m_compressedPoseData.push_back( m_x );
-                animClip.m_compressedPoseData.push_back( m_y );
-                animClip.m_compressedPoseData.push_back( m_z );
-            }
-            else // Store frames
-            {
-                for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
-                {
-                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdx];
-                    Vector const& translation = rawBoneTransform.GetTranslation();
-
-                    uint16_t const m_x = Quantization::EncodeFloat( translation.m_x, trackSettings.m_translationRangeX.m_rangeStart, trackSettings.m_translationRangeX.m_rangeLength );
-                    uint16_t const m_y = Quantization::EncodeFloat( translation.m_y, trackSettings.m_translationRangeY.m_rangeStart, trackSettings.m_translationRangeY.m_rangeLength );
-                    uint16_t const m_z = Quantization::EncodeFloat( translation.m_z, trackSettings.m_translationRangeZ.m_rangeStart, trackSettings.m_translationRangeZ.m_rangeLength );
-
-                    animClip.m_compressedPoseData.push_back( m_x );
-                    animClip.m_compressedPoseData.push_back( m_y );
-                    animClip.m_compressedPoseData.push_back( m_z );
-                }
-            }
-
             //-------------------------------------------------------------------------
             // Scale
             //-------------------------------------------------------------------------
@@ -445,25 +398,129 @@ namespace EE::Animation
 
             //-------------------------------------------------------------------------
 
-            if ( trackSettings.IsScaleTrackStatic() )
+            animClip.m_trackCompressionSettings.emplace_back( trackSettings );
+        }
+
+        // Compress raw data
+        //-------------------------------------------------------------------------
+
+        auto WriteRotation = [&animClip] ( Transform const& rawBoneTransform )
+        {
+            Quantization::EncodedQuaternion const encodedQuat( rawBoneTransform.GetRotation() );
+            animClip.m_compressedPoseData.push_back( encodedQuat.GetData0() );
+            animClip.m_compressedPoseData.push_back( encodedQuat.GetData1() );
+            animClip.m_compressedPoseData.push_back( encodedQuat.GetData2() );
+        };
+
+        auto WriteTranslation = [&animClip] ( Transform const& rawBoneTransform, TrackCompressionSettings const& trackSettings )
+        {
+            Vector const& translation = rawBoneTransform.GetTranslation();
+            animClip.m_compressedPoseData.push_back( Quantization::EncodeFloat( translation.m_x, trackSettings.m_translationRangeX.m_rangeStart, trackSettings.m_translationRangeX.m_rangeLength ) );
+            animClip.m_compressedPoseData.push_back( Quantization::EncodeFloat( translation.m_y, trackSettings.m_translationRangeY.m_rangeStart, trackSettings.m_translationRangeY.m_rangeLength ) );
+            animClip.m_compressedPoseData.push_back( Quantization::EncodeFloat( translation.m_z, trackSettings.m_translationRangeZ.m_rangeStart, trackSettings.m_translationRangeZ.m_rangeLength ) );
+        };
+
+        auto WriteScale = [&animClip] ( Transform const& rawBoneTransform, TrackCompressionSettings const& trackSettings )
+        {
+            animClip.m_compressedPoseData.push_back( Quantization::EncodeFloat( rawBoneTransform.GetScale(), trackSettings.m_scaleRange.m_rangeStart, trackSettings.m_scaleRange.m_rangeLength ) );
+        };
+
+        //-------------------------------------------------------------------------
+
+        if ( animClip.m_dataLayout == AnimationClip::DataLayout::TrackMajor )
+        {
+            // Each track stores all of its rotation key-frames, followed by its translation and scale key-frames (or a single value for static tracks)
+            for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
             {
-                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[0];
-                uint16_t const m_x = Quantization::EncodeFloat( rawBoneTransform.GetScale(), trackSettings.m_scaleRange.m_rangeStart, trackSettings.m_scaleRange.m_rangeLength );
-                animClip.m_compressedPoseData.push_back( m_x );
+                auto& trackSettings = animClip.m_trackCompressionSettings[boneIdx];
+                trackSettings.m_trackStartIndex = (uint32_t) animClip.m_compressedPoseData.size();
+
+                for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
+                {
+                    WriteRotation( rawTrackData[boneIdx].m_localTransforms[frameIdx] );
+                }
+
+                if ( trackSettings.IsTranslationTrackStatic() )
+                {
+                    WriteTranslation( rawTrackData[boneIdx].m_localTransforms[0], trackSettings );
+                }
+                else // Store frames
+                {
+                    for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
+                    {
+                        WriteTranslation( rawTrackData[boneIdx].m_localTransforms[frameIdx], trackSettings );
+                    }
+                }
+
+                if ( trackSettings.IsScaleTrackStatic() )
+                {
+                    WriteScale( rawTrackData[boneIdx].m_localTransforms[0], trackSettings );
+                }
+                else // Store frames
+                {
+                    for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
+                    {
+                        WriteScale( rawTrackData[boneIdx].m_localTransforms[frameIdx], trackSettings );
+                    }
+                }
             }
-            else // Store frames
+        }
+        else // Frame Major
+        {
+            // Static values for all tracks are stored first
+            for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
             {
-                for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
+                auto& trackSettings = animClip.m_trackCompressionSettings[boneIdx];
+                trackSettings.m_staticDataStartIndex = (uint32_t) animClip.m_compressedPoseData.size();
+
+                if ( trackSettings.IsTranslationTrackStatic() )
                 {
-                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdx];
-                    uint16_t const m_x = Quantization::EncodeFloat( rawBoneTransform.GetScale(), trackSettings.m_scaleRange.m_rangeStart, trackSettings.m_scaleRange.m_rangeLength );
-                    animClip.m_compressedPoseData.push_back( m_x );
+                    WriteTranslation( rawTrackData[boneIdx].m_localTransforms[0], trackSettings );
+                }
+
+                if ( trackSettings.IsScaleTrackStatic() )
+                {
+                    WriteScale( rawTrackData[boneIdx].m_localTransforms[0], trackSettings );
                 }
             }
 
-            //-------------------------------------------------------------------------
+            // Calculate the offset of each track within a frame
+            uint32_t frameDataStride = 0;
+            for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                auto& trackSettings = animClip.m_trackCompressionSettings[boneIdx];
+                trackSettings.m_trackStartIndex = frameDataStride;
+                frameDataStride += 3;
+                frameDataStride += trackSettings.IsTranslationTrackStatic() ? 0 : 3;
+                frameDataStride += trackSettings.IsScaleTrackStatic() ? 0 : 1;
+            }
 
-            animClip.m_trackCompressionSettings.emplace_back( trackSettings );
+            animClip.m_frameDataStartIndex = (uint32_t) animClip.m_compressedPoseData.size();
+            animClip.m_frameDataStride = frameDataStride;
+
+            // Store all the animated values for all tracks for each frame contiguously
+            for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
+            {
+                for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    auto const& trackSettings = animClip.m_trackCompressionSettings[boneIdx];
+                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdx];
+
+                    WriteRotation( rawBoneTransform );
+
+                    if ( !trackSettings.IsTranslationTrackStatic() )
+                    {
+                        WriteTranslation( rawBoneTransform, trackSettings );
+                    }
+
+                    if ( !trackSettings.IsScaleTrackStatic() )
+                    {
+                        WriteScale( rawBoneTransform, trackSettings );
+                    }
+                }
+            }
+
+            EE_ASSERT( animClip.m_compressedPoseData.size() == animClip.m_frameDataStartIndex + ( animClip.m_numFrames * frameDataStride ) );
         }
     }
 
@@ -614,6 +671,36 @@ namespace EE::Animation
             outEventData.m_collection.m_descriptors.emplace_back( TypeSystem::TypeDescriptor( *m_pTypeRegistry, pEvent ) );
         }
 
+        // Generate event index
+        //-------------------------------------------------------------------------
+
+        AnimationClip::EventIndex& eventIndex = outEventData.m_eventIndex;
+        int32_t const numEvents = (int32_t) events.size();
+
+        float maxEndTime = -FLT_MAX;
+        for ( auto const& pEvent : events )
+        {
+            maxEndTime = Math::Max( maxEndTime, pEvent->GetTimeRange().m_end );
+            eventIndex.m_maxEndTimes.emplace_back( maxEndTime );
+        }
+
+        int32_t const numBitWords = eventIndex.GetNumBitWords();
+        TVector<TypeSystem::TypeID> eventTypeIDs;
+        for ( int32_t i = 0; i < numEvents; i++ )
+        {
+            TypeSystem::TypeID const typeID = events[i]->GetTypeID();
+            int32_t typeIdx = VectorFindIndex( eventTypeIDs, typeID );
+            if ( typeIdx == InvalidIndex )
+            {
+                typeIdx = (int32_t) eventTypeIDs.size();
+                eventTypeIDs.emplace_back( typeID );
+                eventIndex.m_typeFirstEventIndices.emplace_back( i );
+                eventIndex.m_typeEventBits.resize( eventIndex.m_typeEventBits.size() + numBitWords, 0 );
+            }
+
+            eventIndex.m_typeEventBits[typeIdx * numBitWords + ( i / 64 )] |= ( 1ull << ( i % 64 ) );
+        }
+
         eastl::sort( outEventData.m_syncEventMarkers.begin(), outEventData.m_syncEventMarkers.end() );
 
         // Free allocated memory
@@ -0,0 +1,336 @@
+#include "ResourceCompiler_AnimationMotionMatchingDatabase.h"
+#include "EngineTools/Animation/ResourceDescriptors/ResourceDescriptor_AnimationMotionMatchingDatabase.h"
+#include "EngineTools/Animation/ResourceDescriptors/ResourceDescriptor_AnimationClip.h"
+#include "EngineTools/Animation/ResourceDescriptors/ResourceDescriptor_AnimationSkeleton.h"
+#include "EngineTools/RawAssets/RawAssetReader.h"
+#include "EngineTools/RawAssets/RawAnimation.h"
+#include "EngineTools/RawAssets/RawSkeleton.h"
+#include "Engine/Animation/AnimationMotionMatching.h"
+#include "System/Resource/ResourcePtr.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/Math/MathHelpers.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    MotionMatchingDatabaseCompiler::MotionMatchingDatabaseCompiler()
+        : Resource::Compiler( "Motion Matching Database Compiler", s_version )
+    {
+        m_outputTypes.push_back( MotionMatchingDatabase::GetStaticResourceTypeID() );
+    }
+
+    Resource::CompilationResult MotionMatchingDatabaseCompiler::Compile( Resource::CompileContext const& ctx ) const
+    {
+        MotionMatchingDatabaseResourceDescriptor resourceDescriptor;
+
+        Serialization::TypeArchiveReader typeReader( *m_pTypeRegistry );
+        if ( !typeReader.ReadFromFile( ctx.m_inputFilePath ) )
+        {
+            return Error( "Failed to read resource descriptor file: %s", ctx.m_inputFilePath.c_str() );
+        }
+
+        if ( !typeReader.ReadType( &resourceDescriptor ) )
+        {
+            return Error( "Failed to read resource descriptor from input file: %s", ctx.m_inputFilePath.c_str() );
+        }
+
+        if ( !resourceDescriptor.IsValid() )
+        {
+            return Error( "Invalid motion matching database descriptor, a skeleton, at least one clip and both foot bones need to be set!" );
+        }
+
+        // Read Skeleton Data
+        //-------------------------------------------------------------------------
+
+        // Convert the skeleton resource path to a physical file path
+        if ( !resourceDescriptor.m_skeleton.GetResourceID().IsValid() )
+        {
+            return Error( "Invalid skeleton resource ID" );
+        }
+
+        ResourcePath const& skeletonPath = resourceDescriptor.m_skeleton.GetResourcePath();
+        FileSystem::Path skeletonDescriptorFilePath;
+        if ( !ConvertResourcePathToFilePath( skeletonPath, skeletonDescriptorFilePath ) )
+        {
+            return Error( "Invalid skeleton data path: %s", skeletonPath.c_str() );
+        }
+
+        if ( !FileSystem::Exists( skeletonDescriptorFilePath ) )
+        {
+            return Error( "Invalid skeleton descriptor file path: %s", skeletonDescriptorFilePath.ToString().c_str() );
+        }
+
+        SkeletonResourceDescriptor skeletonResourceDescriptor;
+        if ( !Resource::ResourceDescriptor::TryReadFromFile( *m_pTypeRegistry, skeletonDescriptorFilePath, skeletonResourceDescriptor ) )
+        {
+            return Error( "Failed to read skeleton resource descriptor from input file: %s", ctx.m_inputFilePath.c_str() );
+        }
+
+        FileSystem::Path skeletonFilePath;
+        if ( !ConvertResourcePathToFilePath( skeletonResourceDescriptor.m_skeletonPath, skeletonFilePath ) )
+        {
+            return Error( "Invalid skeleton FBX data path: %s", skeletonResourceDescriptor.m_skeletonPath.GetString().c_str() );
+        }
+
+        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); } };
+        auto pRawSkeleton = RawAssets::ReadSkeleton( readerCtx, skeletonFilePath, skeletonResourceDescriptor.m_skeletonRootBoneName );
+        if ( pRawSkeleton == nullptr || !pRawSkeleton->IsValid() )
+        {
+            return Error( "Failed to read skeleton file: %s", skeletonFilePath.ToString().c_str() );
+        }
+
+        if ( pRawSkeleton->GetBoneIndex( resourceDescriptor.m_leftFootBoneID ) == InvalidIndex || pRawSkeleton->GetBoneIndex( resourceDescriptor.m_rightFootBoneID ) == InvalidIndex )
+        {
+            return Error( "Invalid foot bones specified: %s, %s", resourceDescriptor.m_leftFootBoneID.c_str(), resourceDescriptor.m_rightFootBoneID.c_str() );
+        }
+
+        if ( resourceDescriptor.m_hipBoneID.IsValid() && pRawSkeleton->GetBoneIndex( resourceDescriptor.m_hipBoneID ) == InvalidIndex )
+        {
+            return Error( "Invalid hip bone specified: %s", resourceDescriptor.m_hipBoneID.c_str() );
+        }
+
+        // Extract features for all clips
+        //-------------------------------------------------------------------------
+
+        bool hasWarnings = false;
+
+        MotionMatchingDatabase database;
+        database.m_skeleton = resourceDescriptor.m_skeleton;
+
+        TVector<MotionMatchingDatabase::Entry> entries;
+        TVector<int32_t> clipFirstEntryIndices;
+        TVector<float> rawFeatures;
+
+        int32_t const numClips = (int32_t) resourceDescriptor.m_clips.size();
+        for ( int32_t clipIdx = 0; clipIdx < numClips; clipIdx++ )
+        {
+            TResourcePtr<AnimationClip> const& clip = resourceDescriptor.m_clips[clipIdx];
+            if ( !clip.IsSet() )
+            {
+                return Error( "Unset clip in database (index: %d)", clipIdx );
+            }
+
+            // Read the clip descriptor, we need to extract the same frames as the clip compiler
+            FileSystem::Path clipDescriptorFilePath;
+            if ( !ConvertResourcePathToFilePath( clip.GetResourcePath(), clipDescriptorFilePath ) )
+            {
+                return Error( "Invalid clip path: %s", clip.GetResourcePath().c_str() );
+            }
+
+            AnimationClipResourceDescriptor clipResourceDescriptor;
+            if ( !Resource::ResourceDescriptor::TryReadFromFile( *m_pTypeRegistry, clipDescriptorFilePath, clipResourceDescriptor ) )
+            {
+                return Error( "Failed to read clip resource descriptor: %s", clipDescriptorFilePath.ToString().c_str() );
+            }
+
+            if ( clipResourceDescriptor.m_skeleton.GetResourceID() != resourceDescriptor.m_skeleton.GetResourceID() )
+            {
+                return Error( "Clip '%s' uses a different skeleton to the database!", clip.GetResourcePath().c_str() );
+            }
+
+            if ( clipResourceDescriptor.m_regenerateRootMotion )
+            {
+                Warning( "Clip '%s' regenerates its root motion, the trajectory features are extracted from the source root motion and may not match the clip!", clip.GetResourcePath().c_str() );
+                hasWarnings = true;
+            }
+
+            FileSystem::Path animationFilePath;
+            if ( !ConvertResourcePathToFilePath( clipResourceDescriptor.m_animationPath, animationFilePath ) || !FileSystem::Exists( animationFilePath ) )
+            {
+                return Error( "Invalid animation file path: %s", clipResourceDescriptor.m_animationPath.c_str() );
+            }
+
+            TUniquePtr<RawAssets::RawAnimation> pRawAnimation = RawAssets::ReadAnimation( readerCtx, animationFilePath, *pRawSkeleton, clipResourceDescriptor.m_animationName );
+            if ( pRawAnimation == nullptr )
+            {
+                return Error( "Failed to read animation from source file: %s", animationFilePath.ToString().c_str() );
+            }
+
+            // Apply the clip's frame limits (inclusive range)
+            IntRange frameRange( 0, pRawAnimation->GetNumFrames() );
+            if ( clipResourceDescriptor.m_limitFrameRange.IsSet() )
+            {
+                frameRange.m_begin = Math::Clamp( clipResourceDescriptor.m_limitFrameRange.m_begin, 0, (int32_t) pRawAnimation->GetNumFrames() );
+                frameRange.m_end = Math::Clamp( clipResourceDescriptor.m_limitFrameRange.m_end + 1, 0, (int32_t) pRawAnimation->GetNumFrames() );
+                if ( !frameRange.IsValid() || frameRange.GetLength() == 0 )
+                {
+                    return Error( "Invalid frame limit range set on clip: %s", clip.GetResourcePath().c_str() );
+                }
+            }
+
+            // Exclude the end of the clip, we always keep at least one frame so every clip can be queried
+            int32_t const numExcludedFrames = (int32_t) Math::Ceiling( resourceDescriptor.m_endOfClipExclusionTime * pRawAnimation->GetSamplingFrameRate() );
+            int32_t const numSearchableFrames = Math::Max( 1, frameRange.GetLength() - numExcludedFrames );
+
+            clipFirstEntryIndices.emplace_back( (int32_t) entries.size() );
+            for ( int32_t i = 0; i < numSearchableFrames; i++ )
+            {
+                entries.emplace_back( clipIdx, i );
+            }
+
+            ExtractFeatures( resourceDescriptor, *pRawAnimation, frameRange, numSearchableFrames, rawFeatures );
+            database.m_clips.emplace_back( clip );
+        }
+
+        // Build search data
+        //-------------------------------------------------------------------------
+
+        float const featureWeights[(int32_t) MotionMatchingFeature::NumFeatures] =
+        {
+            resourceDescriptor.m_trajectoryPositionWeight,
+            resourceDescriptor.m_trajectoryFacingWeight,
+            resourceDescriptor.m_footPositionWeight,
+            resourceDescriptor.m_footVelocityWeight,
+            resourceDescriptor.m_hipBoneID.IsValid() ? resourceDescriptor.m_hipVelocityWeight : 0.0f,
+        };
+
+        database.Build( entries, clipFirstEntryIndices, rawFeatures, featureWeights );
+
+        // Serialize
+        //-------------------------------------------------------------------------
+
+        Resource::ResourceHeader hdr( s_version, MotionMatchingDatabase::GetStaticResourceTypeID() );
+        hdr.AddInstallDependency( resourceDescriptor.m_skeleton.GetResourceID() );
+        for ( auto const& clip : database.m_clips )
+        {
+            hdr.AddInstallDependency( clip.GetResourceID() );
+        }
+
+        Serialization::BinaryOutputArchive archive;
+        archive << hdr << database;
+
+        if ( archive.WriteToFile( ctx.m_outputFilePath ) )
+        {
+            if ( hasWarnings )
+            {
+                return CompilationSucceededWithWarnings( ctx );
+            }
+            else
+            {
+                return CompilationSucceeded( ctx );
+            }
+        }
+        else
+        {
+            return CompilationFailed( ctx );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MotionMatchingDatabaseCompiler::ExtractFeatures( MotionMatchingDatabaseResourceDescriptor const& resourceDescriptor, RawAssets::RawAnimation const& rawAnimation, IntRange const& frameRange, int32_t numSearchableFrames, TVector<float>& outRawFeatures ) const
+    {
+        RawAssets::RawSkeleton const& rawSkeleton = rawAnimation.GetSkeleton();
+        auto const& tracks = rawAnimation.GetTrackData();
+        auto const& rootMotion = rawAnimation.GetRootMotion();
+
+        int32_t const leftFootBoneIdx = rawSkeleton.GetBoneIndex( resourceDescriptor.m_leftFootBoneID );
+        int32_t const rightFootBoneIdx = rawSkeleton.GetBoneIndex( resourceDescriptor.m_rightFootBoneID );
+        int32_t const hipBoneIdx = resourceDescriptor.m_hipBoneID.IsValid() ? rawSkeleton.GetBoneIndex( resourceDescriptor.m_hipBoneID ) : InvalidIndex;
+
+        int32_t const firstFrameIdx = frameRange.m_begin;
+        int32_t const lastFrameIdx = frameRange.m_end - 1;
+        float const frameRate = rawAnimation.GetSamplingFrameRate();
+
+        // The root track has been set to identity during import, so the global transforms need to be rebuilt from the local transforms to get character space transforms
+        auto GetCharacterSpacePosition = [&] ( int32_t boneIdx, int32_t frameIdx )
+        {
+            Transform characterSpaceTransform = tracks[boneIdx].m_localTransforms[frameIdx];
+            int32_t parentIdx = rawSkeleton.GetParentBoneIndex( boneIdx );
+            while ( parentIdx != InvalidIndex )
+            {
+                characterSpaceTransform = characterSpaceTransform * tracks[parentIdx].m_localTransforms[frameIdx];
+                parentIdx = rawSkeleton.GetParentBoneIndex( parentIdx );
+            }
+
+            return characterSpaceTransform.GetTranslation();
+        };
+
+        // Root transforms past the end of the range are linearly extrapolated using the last frame's displacement
+        auto GetRootTransform = [&] ( int32_t frameIdx )
+        {
+            if ( frameIdx <= lastFrameIdx )
+            {
+                return rootMotion[frameIdx];
+            }
+
+            Transform extrapolated = rootMotion[lastFrameIdx];
+            if ( lastFrameIdx > firstFrameIdx )
+            {
+                Vector const lastFrameDisplacement = rootMotion[lastFrameIdx].GetTranslation() - rootMotion[lastFrameIdx - 1].GetTranslation();
+                extrapolated.SetTranslation( extrapolated.GetTranslation() + ( lastFrameDisplacement * float( frameIdx - lastFrameIdx ) ) );
+            }
+
+            return extrapolated;
+        };
+
+        // Character space velocity of a bone i.e. the world space velocity rotated into the character's frame
+        auto GetCharacterSpaceVelocity = [&] ( int32_t boneIdx, int32_t frameIdx )
+        {
+            int32_t const prevFrameIdx = Math::Max( frameIdx - 1, firstFrameIdx );
+            int32_t const nextFrameIdx = Math::Min( frameIdx + 1, lastFrameIdx );
+            if ( prevFrameIdx == nextFrameIdx )
+            {
+                return Vector::Zero;
+            }
+
+            Vector const prevPosition = rootMotion[prevFrameIdx].TransformPoint( GetCharacterSpacePosition( boneIdx, prevFrameIdx ) );
+            Vector const nextPosition = rootMotion[nextFrameIdx].TransformPoint( GetCharacterSpacePosition( boneIdx, nextFrameIdx ) );
+            Vector const worldVelocity = ( nextPosition - prevPosition ) * ( frameRate / ( nextFrameIdx - prevFrameIdx ) );
+            return rootMotion[frameIdx].InverseRotateVector( worldVelocity );
+        };
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < numSearchableFrames; i++ )
+        {
+            int32_t const frameIdx = firstFrameIdx + i;
+            Transform const& rootTransform = rootMotion[frameIdx];
+
+            size_t const featureOffset = outRawFeatures.size();
+            outRawFeatures.resize( featureOffset + MotionMatchingDatabase::s_numFeatureDimensions, 0.0f );
+            float* pFeatures = &outRawFeatures[featureOffset];
+
+            // Trajectory
+            for ( int32_t s = 0; s < MotionMatchingDatabase::s_numTrajectorySamples; s++ )
+            {
+                int32_t const sampleFrameIdx = frameIdx + (int32_t) Math::Round( MotionMatchingDatabase::s_trajectorySampleTimes[s] * frameRate );
+                Transform const sampleTransform = GetRootTransform( sampleFrameIdx );
+
+                Vector const position = rootTransform.InverseTransformPoint( sampleTransform.GetTranslation() );
+                Vector const facing = rootTransform.InverseRotateVector( sampleTransform.GetForwardVector() );
+
+                pFeatures[MotionMatchingDatabase::s_trajectoryPositionOffset + ( s * 2 )] = position.GetX();
+                pFeatures[MotionMatchingDatabase::s_trajectoryPositionOffset + ( s * 2 ) + 1] = position.GetY();
+                pFeatures[MotionMatchingDatabase::s_trajectoryFacingOffset + ( s * 2 )] = facing.GetX();
+                pFeatures[MotionMatchingDatabase::s_trajectoryFacingOffset + ( s * 2 ) + 1] = facing.GetY();
+            }
+
+            // Feet
+            Vector const leftFootPosition = GetCharacterSpacePosition( leftFootBoneIdx, frameIdx );
+            Vector const rightFootPosition = GetCharacterSpacePosition( rightFootBoneIdx, frameIdx );
+            Vector const leftFootVelocity = GetCharacterSpaceVelocity( leftFootBoneIdx, frameIdx );
+            Vector const rightFootVelocity = GetCharacterSpaceVelocity( rightFootBoneIdx, frameIdx );
+
+            for ( int32_t c = 0; c < 3; c++ )
+            {
+                pFeatures[MotionMatchingDatabase::s_footPositionOffset + c] = leftFootPosition[c];
+                pFeatures[MotionMatchingDatabase::s_footPositionOffset + 3 + c] = rightFootPosition[c];
+                pFeatures[MotionMatchingDatabase::s_footVelocityOffset + c] = leftFootVelocity[c];
+                pFeatures[MotionMatchingDatabase::s_footVelocityOffset + 3 + c] = rightFootVelocity[c];
+            }
+
+            // Hips
+            if ( hipBoneIdx != InvalidIndex )
+            {
+                Vector const hipVelocity = GetCharacterSpaceVelocity( hipBoneIdx, frameIdx );
+                for ( int32_t c = 0; c < 3; c++ )
+                {
+                    pFeatures[MotionMatchingDatabase::s_hipVelocityOffset + c] = hipVelocity[c];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "EngineTools/Resource/ResourceCompiler.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::RawAssets { class RawAnimation; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    struct MotionMatchingDatabaseResourceDescriptor;
+
+    //-------------------------------------------------------------------------
+
+    class MotionMatchingDatabaseCompiler : public Resource::Compiler
+    {
+        EE_REGISTER_TYPE( MotionMatchingDatabaseCompiler );
+        static const int32_t s_version = 1;
+
+    public:
+
+        MotionMatchingDatabaseCompiler();
+
+    private:
+
+        virtual Resource::CompilationResult Compile( Resource::CompileContext const& ctx ) const final;
+
+        // Extract the raw features for every searchable frame in the specified frame range of an animation
+        void ExtractFeatures( MotionMatchingDatabaseResourceDescriptor const& resourceDescriptor, RawAssets::RawAnimation const& rawAnimation, IntRange const& frameRange, int32_t numSearchableFrames, TVector<float>& outRawFeatures ) const;
+    };
+}
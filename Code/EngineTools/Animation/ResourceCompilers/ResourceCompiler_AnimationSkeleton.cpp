@@ -52,6 +52,34 @@ namespace EE::Animation
             skeleton.m_boneIDs.push_back( boneData.m_name );
             skeleton.m_parentIndices.push_back( boneData.m_parentBoneIdx );
             skeleton.m_localReferencePose.push_back( Transform( boneData.m_localTransform.GetRotation(), boneData.m_localTransform.GetTranslation(), boneData.m_localTransform.GetScale() ) );
+            skeleton.m_boneFlags.emplace_back( TBitFlags<BoneFlags>() );
+        }
+
+        // Set LOD flags
+        //-------------------------------------------------------------------------
+
+        bool hasWarnings = false;
+        for ( auto const& highLODBoneID : resourceDescriptor.m_highLODBones )
+        {
+            int32_t const boneIdx = skeleton.GetBoneIndex( highLODBoneID );
+            if ( boneIdx == InvalidIndex )
+            {
+                Warning( "High LOD bone '%s' not found in skeleton", highLODBoneID.c_str() );
+                hasWarnings = true;
+                continue;
+            }
+
+            skeleton.m_boneFlags[boneIdx].SetFlag( BoneFlags::HighLOD );
+        }
+
+        // Parents always precede their children, so a single pass is enough to propagate the flag down the hierarchy
+        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = skeleton.m_parentIndices[boneIdx];
+            if ( parentIdx != InvalidIndex && skeleton.m_boneFlags[parentIdx].IsFlagSet( BoneFlags::HighLOD ) )
+            {
+                skeleton.m_boneFlags[boneIdx].SetFlag( BoneFlags::HighLOD );
+            }
         }
 
         // Serialize skeleton
@@ -62,7 +90,7 @@ namespace EE::Animation
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
         {
-            return CompilationSucceeded( ctx );
+            return hasWarnings ? CompilationSucceededWithWarnings( ctx ) : CompilationSucceeded( ctx );
         }
         else
         {
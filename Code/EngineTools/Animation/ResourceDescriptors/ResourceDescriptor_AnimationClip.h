@@ -41,5 +41,6 @@ namespace EE::Animation
         EE_EXPOSE EulerAngles                 m_rootMotionGenerationPreRotation;
         EE_EXPOSE bool                        m_generateTestAdditive = false; // This is to generate an additive pose (based on the reference pose) so that we can test the rest of the code (remove once we have a proper additive import pipeline)
         EE_EXPOSE IntRange                    m_limitFrameRange;
+        EE_EXPOSE AnimationClip::DataLayout   m_dataLayout = AnimationClip::DataLayout::FrameMajor; // Frame major data is faster to sample full poses from, track major is faster for sampling individual bones
     };
 }
\ No newline at end of file
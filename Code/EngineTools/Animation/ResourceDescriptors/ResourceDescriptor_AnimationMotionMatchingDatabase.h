@@ -0,0 +1,53 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "EngineTools/Resource/ResourceDescriptor.h"
+#include "Engine/Animation/AnimationMotionMatching.h"
+#include "Engine/Animation/AnimationSkeleton.h"
+#include "Engine/Animation/AnimationClip.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    struct EE_ENGINETOOLS_API MotionMatchingDatabaseResourceDescriptor final : public Resource::ResourceDescriptor
+    {
+        EE_REGISTER_TYPE( MotionMatchingDatabaseResourceDescriptor );
+
+        virtual bool IsValid() const override { return m_skeleton.IsSet() && !m_clips.empty() && m_leftFootBoneID.IsValid() && m_rightFootBoneID.IsValid(); }
+        virtual bool IsUserCreateableDescriptor() const override { return true; }
+        virtual ResourceTypeID GetCompiledResourceTypeID() const override { return MotionMatchingDatabase::GetStaticResourceTypeID(); }
+
+        virtual void GetCompileDependencies( TVector<ResourceID>& outDependencies ) override
+        {
+            if ( m_skeleton.IsSet() )
+            {
+                outDependencies.emplace_back( m_skeleton.GetResourceID() );
+            }
+
+            for ( auto const& clip : m_clips )
+            {
+                if ( clip.IsSet() )
+                {
+                    outDependencies.emplace_back( clip.GetResourceID() );
+                }
+            }
+        }
+
+    public:
+
+        EE_EXPOSE TResourcePtr<Skeleton>                    m_skeleton = nullptr;
+        EE_EXPOSE TVector<TResourcePtr<AnimationClip>>      m_clips;
+        EE_EXPOSE StringID                                  m_leftFootBoneID;
+        EE_EXPOSE StringID                                  m_rightFootBoneID;
+        EE_EXPOSE StringID                                  m_hipBoneID; // Optional: if not set, the hip velocity feature is ignored
+        EE_EXPOSE float                                     m_endOfClipExclusionTime = 0.25f; // The frames at the end of each clip that can never be selected by a search
+
+        // Feature weights
+        EE_EXPOSE float                                     m_trajectoryPositionWeight = 1.0f;
+        EE_EXPOSE float                                     m_trajectoryFacingWeight = 1.0f;
+        EE_EXPOSE float                                     m_footPositionWeight = 0.75f;
+        EE_EXPOSE float                                     m_footVelocityWeight = 1.0f;
+        EE_EXPOSE float                                     m_hipVelocityWeight = 1.0f;
+    };
+}
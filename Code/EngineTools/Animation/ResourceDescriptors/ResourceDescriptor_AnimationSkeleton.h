@@ -32,6 +32,9 @@ namespace EE::Animation
         // Optional value that specifies the name of the skeleton hierarchy to use, if it is unset, we use the first skeleton we find
         EE_EXPOSE String                                   m_skeletonRootBoneName;
 
+        // Bones that are only sampled at the high LOD, all their descendants are included as well (e.g. the hands for the fingers)
+        EE_EXPOSE TVector<StringID>                        m_highLODBones;
+
         // Editor-only preview mesh
         EE_EXPOSE TResourcePtr<Render::SkeletalMesh>       m_previewMesh;
     };
@@ -2,6 +2,12 @@
 #include "Animation_ToolsGraph_Definition.h"
 #include "Nodes/Animation_ToolsGraphNode_Parameters.h"
 #include "Nodes/Animation_ToolsGraphNode_Result.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Bools.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_ConstValues.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Floats.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_IDs.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Parameters.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Vectors.h"
 
 //-------------------------------------------------------------------------
 
@@ -53,6 +59,551 @@ namespace EE::Animation
         }
     }
 
+    //-------------------------------------------------------------------------
+    // Value Graph Lowering
+    //-------------------------------------------------------------------------
+    // A value node is pure if it is a control parameter, a constant or a stateless value node whose inputs are all pure
+    // All pure value nodes (excluding parameters and constants) are lowered into the value graph program in dependency order
+
+    namespace
+    {
+        template<typename T>
+        EE_FORCE_INLINE bool IsNodeOfType( GraphNode::Settings const* pSettings )
+        {
+            return TryCast<typename T::Settings>( pSettings ) != nullptr;
+        }
+
+        // Get the load instruction for nodes that are read directly (i.e. control parameters and constants)
+        bool GetLoadOp( GraphNode::Settings const* pSettings, ValueGraphOp& outOp, bool& outIsConstant )
+        {
+            outIsConstant = false;
+
+            if ( IsNodeOfType<ControlParameterBoolNode>( pSettings ) ) { outOp = ValueGraphOp::LoadBool; return true; }
+            if ( IsNodeOfType<ControlParameterIDNode>( pSettings ) ) { outOp = ValueGraphOp::LoadID; return true; }
+            if ( IsNodeOfType<ControlParameterIntNode>( pSettings ) ) { outOp = ValueGraphOp::LoadInt; return true; }
+            if ( IsNodeOfType<ControlParameterFloatNode>( pSettings ) ) { outOp = ValueGraphOp::LoadFloat; return true; }
+            if ( IsNodeOfType<ControlParameterVectorNode>( pSettings ) ) { outOp = ValueGraphOp::LoadVector; return true; }
+
+            outIsConstant = true;
+
+            if ( IsNodeOfType<ConstBoolNode>( pSettings ) ) { outOp = ValueGraphOp::LoadBool; return true; }
+            if ( IsNodeOfType<ConstIDNode>( pSettings ) ) { outOp = ValueGraphOp::LoadID; return true; }
+            if ( IsNodeOfType<ConstIntNode>( pSettings ) ) { outOp = ValueGraphOp::LoadInt; return true; }
+            if ( IsNodeOfType<ConstFloatNode>( pSettings ) ) { outOp = ValueGraphOp::LoadFloat; return true; }
+            if ( IsNodeOfType<ConstVectorNode>( pSettings ) ) { outOp = ValueGraphOp::LoadVector; return true; }
+
+            return false;
+        }
+
+        // Get the inputs for all node types that can be lowered, returns false for unsupported node types
+        bool GetLowerableNodeInputs( GraphNode::Settings const* pSettings, TInlineVector<int16_t, 4>& outInputs )
+        {
+            auto AddInput = [&outInputs] ( int16_t nodeIdx ) { if ( nodeIdx != InvalidIndex ) { outInputs.emplace_back( nodeIdx ); } };
+
+            // Virtual Parameters
+            if ( auto pNodeSettings = TryCast<VirtualParameterBoolNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_childNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<VirtualParameterIDNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_childNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<VirtualParameterIntNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_childNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<VirtualParameterFloatNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_childNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<VirtualParameterVectorNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_childNodeIdx ); return true; }
+
+            // Bools
+            if ( auto pNodeSettings = TryCast<AndNode::Settings>( pSettings ) ) { for ( auto idx : pNodeSettings->m_conditionNodeIndices ) { AddInput( idx ); } return true; }
+            if ( auto pNodeSettings = TryCast<OrNode::Settings>( pSettings ) ) { for ( auto idx : pNodeSettings->m_conditionNodeIndices ) { AddInput( idx ); } return true; }
+            if ( auto pNodeSettings = TryCast<NotNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+
+            // Floats
+            if ( auto pNodeSettings = TryCast<FloatRemapNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<FloatClampNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<FloatAbsNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<FloatCurveNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<FloatMathNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdxA ); AddInput( pNodeSettings->m_inputValueNodeIdxB ); return true; }
+            if ( auto pNodeSettings = TryCast<FloatComparisonNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); AddInput( pNodeSettings->m_comparandValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<FloatRangeComparisonNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<FloatSwitchNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_switchValueNodeIdx ); AddInput( pNodeSettings->m_trueValueNodeIdx ); AddInput( pNodeSettings->m_falseValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<FloatAngleMathNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+
+            // IDs
+            if ( auto pNodeSettings = TryCast<IDComparisonNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<IDToFloatNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+
+            // Vectors
+            if ( auto pNodeSettings = TryCast<VectorInfoNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<VectorNegateNode::Settings>( pSettings ) ) { AddInput( pNodeSettings->m_inputValueNodeIdx ); return true; }
+            if ( auto pNodeSettings = TryCast<VectorCreateNode::Settings>( pSettings ) )
+            {
+                AddInput( pNodeSettings->m_inputVectorValueNodeIdx );
+                AddInput( pNodeSettings->m_inputValueXNodeIdx );
+                AddInput( pNodeSettings->m_inputValueYNodeIdx );
+                AddInput( pNodeSettings->m_inputValueZNodeIdx );
+                return true;
+            }
+
+            return false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        class ValueGraphLowering
+        {
+            enum class State : uint8_t
+            {
+                Unknown,
+                Lowerable,
+                NotLowerable,
+            };
+
+        public:
+
+            ValueGraphLowering( TVector<GraphNode::Settings*> const& nodeSettings )
+                : m_nodeSettings( nodeSettings )
+            {
+                m_states.resize( nodeSettings.size(), State::Unknown );
+                m_registers.resize( nodeSettings.size(), InvalidIndex );
+                m_loadSegments.resize( nodeSettings.size(), InvalidIndex );
+            }
+
+            void Lower()
+            {
+                // Find all lowered nodes that are inputs to other lowered nodes
+                // Parameters and constants are only loaded when used by a lowered node so are never roots
+                TVector<bool> isLoweredNodeInput( m_nodeSettings.size(), false );
+                TInlineVector<int16_t, 4> inputs;
+                int16_t const numNodes = (int16_t) m_nodeSettings.size();
+                for ( int16_t i = 0; i < numNodes; i++ )
+                {
+                    inputs.clear();
+                    if ( GetLowerableNodeInputs( m_nodeSettings[i], inputs ) && IsLowerable( i ) )
+                    {
+                        for ( auto inputIdx : inputs )
+                        {
+                            isLoweredNodeInput[inputIdx] = true;
+                        }
+                    }
+                }
+
+                // Each remaining lowered node is the output of a value subgraph and gets its own segment
+                // Nodes that are shared between subgraphs are only emitted once, the segments that reuse them depend on the segment that emitted them
+                for ( int16_t i = 0; i < numNodes; i++ )
+                {
+                    inputs.clear();
+                    if ( !isLoweredNodeInput[i] && GetLowerableNodeInputs( m_nodeSettings[i], inputs ) && IsLowerable( i ) )
+                    {
+                        BeginSegment();
+                        EmitNode( i );
+                        EndSegment();
+                    }
+                }
+            }
+
+        private:
+
+            bool IsLowerable( int16_t nodeIdx )
+            {
+                EE_ASSERT( nodeIdx >= 0 && nodeIdx < m_nodeSettings.size() );
+
+                if ( m_states[nodeIdx] == State::Unknown )
+                {
+                    m_states[nodeIdx] = State::NotLowerable;
+
+                    ValueGraphOp loadOp;
+                    bool isConstant;
+                    TInlineVector<int16_t, 4> inputs;
+                    if ( GetLoadOp( m_nodeSettings[nodeIdx], loadOp, isConstant ) )
+                    {
+                        m_states[nodeIdx] = State::Lowerable;
+                    }
+                    else if ( GetLowerableNodeInputs( m_nodeSettings[nodeIdx], inputs ) )
+                    {
+                        bool areAllInputsLowerable = true;
+                        for ( auto inputIdx : inputs )
+                        {
+                            areAllInputsLowerable &= IsLowerable( inputIdx );
+                        }
+
+                        m_states[nodeIdx] = areAllInputsLowerable ? State::Lowerable : State::NotLowerable;
+                    }
+                }
+
+                return m_states[nodeIdx] == State::Lowerable;
+            }
+
+            inline int16_t AllocateRegister()
+            {
+                EE_ASSERT( m_numRegisters < 0x7FFF );
+                m_registerSegments.emplace_back( (int16_t) InvalidIndex );
+                return m_numRegisters++;
+            }
+
+            void BeginSegment()
+            {
+                EE_ASSERT( m_currentSegmentIdx == InvalidIndex && m_segments.size() < 0x7FFF );
+                m_currentSegmentIdx = (int16_t) m_segments.size();
+
+                ValueGraphProgram::Segment& segment = m_segments.emplace_back();
+                segment.m_firstInstructionIdx = (int32_t) m_instructions.size();
+                segment.m_firstDependencyIdx = (int32_t) m_segmentDependencies.size();
+            }
+
+            void EndSegment()
+            {
+                EE_ASSERT( m_currentSegmentIdx != InvalidIndex );
+                ValueGraphProgram::Segment& segment = m_segments[m_currentSegmentIdx];
+                segment.m_numInstructions = (int32_t) m_instructions.size() - segment.m_firstInstructionIdx;
+                segment.m_numDependencies = (int32_t) m_segmentDependencies.size() - segment.m_firstDependencyIdx;
+
+                // Nodes that only alias registers from other segments or from the initialization instructions don't need a segment
+                if ( segment.m_numInstructions == 0 )
+                {
+                    m_segmentDependencies.resize( segment.m_firstDependencyIdx );
+                    m_segments.pop_back();
+                }
+
+                m_currentSegmentIdx = InvalidIndex;
+            }
+
+            // Reusing a register written by another segment requires that segment to be executed first
+            void AddSegmentDependency( int16_t reg )
+            {
+                int16_t const segmentIdx = m_registerSegments[reg];
+                if ( segmentIdx == InvalidIndex || segmentIdx == m_currentSegmentIdx )
+                {
+                    return;
+                }
+
+                int32_t const firstDependencyIdx = m_segments[m_currentSegmentIdx].m_firstDependencyIdx;
+                for ( int32_t i = firstDependencyIdx; i < (int32_t) m_segmentDependencies.size(); i++ )
+                {
+                    if ( m_segmentDependencies[i] == segmentIdx )
+                    {
+                        return;
+                    }
+                }
+
+                m_segmentDependencies.emplace_back( segmentIdx );
+            }
+
+            inline void Emit( TVector<ValueGraphInstruction>& stream, ValueGraphOp op, int16_t nodeIdx, int16_t result, int16_t a = InvalidIndex, int16_t b = InvalidIndex, int16_t c = InvalidIndex, float immediate = 0.0f )
+            {
+                if ( &stream == &m_instructions )
+                {
+                    EE_ASSERT( m_currentSegmentIdx != InvalidIndex );
+                    m_registerSegments[result] = m_currentSegmentIdx;
+                }
+
+                ValueGraphInstruction& instruction = stream.emplace_back();
+                instruction.m_op = op;
+                instruction.m_nodeIdx = nodeIdx;
+                instruction.m_result = result;
+                instruction.m_a = a;
+                instruction.m_b = b;
+                instruction.m_c = c;
+                instruction.m_immediate = immediate;
+            }
+
+            // Immediates are set once at initialization
+            inline int16_t EmitImmediate( int16_t nodeIdx, ValueGraphOp op, float value )
+            {
+                int16_t const result = AllocateRegister();
+                Emit( m_initializationInstructions, op, nodeIdx, result, InvalidIndex, InvalidIndex, InvalidIndex, value );
+                return result;
+            }
+
+            // N-ary conditions are lowered to a chain of binary operations
+            int16_t EmitConditions( int16_t nodeIdx, ValueGraphOp op, TInlineVector<int16_t, 4> const& conditionNodeIndices, bool emptyResult )
+            {
+                if ( conditionNodeIndices.empty() )
+                {
+                    return EmitImmediate( nodeIdx, ValueGraphOp::SetBool, emptyResult ? 1.0f : 0.0f );
+                }
+
+                if ( conditionNodeIndices.size() == 1 )
+                {
+                    return EmitNode( conditionNodeIndices[0] );
+                }
+
+                int16_t const a = EmitNode( conditionNodeIndices[0] );
+                int16_t const b = EmitNode( conditionNodeIndices[1] );
+                int16_t const result = AllocateRegister();
+                Emit( m_instructions, op, nodeIdx, result, a, b );
+
+                for ( size_t i = 2; i < conditionNodeIndices.size(); i++ )
+                {
+                    int16_t const c = EmitNode( conditionNodeIndices[i] );
+                    Emit( m_instructions, op, nodeIdx, result, result, c );
+                }
+
+                return result;
+            }
+
+            // Emit the instructions for a node (and all its inputs), returns the register containing the node's value
+            int16_t EmitNode( int16_t nodeIdx )
+            {
+                EE_ASSERT( m_states[nodeIdx] == State::Lowerable );
+
+                GraphNode::Settings const* pSettings = m_nodeSettings[nodeIdx];
+
+                // Parameters and constants
+                //-------------------------------------------------------------------------
+
+                // Per-update loads are repeated in every segment that uses them (into the same register) rather than creating a dependency
+                ValueGraphOp loadOp;
+                bool isConstant;
+                if ( GetLoadOp( pSettings, loadOp, isConstant ) )
+                {
+                    if ( m_registers[nodeIdx] == InvalidIndex )
+                    {
+                        m_registers[nodeIdx] = AllocateRegister();
+                        Emit( isConstant ? m_initializationInstructions : m_instructions, loadOp, nodeIdx, m_registers[nodeIdx] );
+                        m_loadSegments[nodeIdx] = isConstant ? InvalidIndex : m_currentSegmentIdx;
+                    }
+                    else if ( m_loadSegments[nodeIdx] != InvalidIndex && m_loadSegments[nodeIdx] != m_currentSegmentIdx )
+                    {
+                        Emit( m_instructions, loadOp, nodeIdx, m_registers[nodeIdx] );
+                        m_loadSegments[nodeIdx] = m_currentSegmentIdx;
+                    }
+
+                    return m_registers[nodeIdx];
+                }
+
+                if ( m_registers[nodeIdx] != InvalidIndex )
+                {
+                    AddSegmentDependency( m_registers[nodeIdx] );
+                    return m_registers[nodeIdx];
+                }
+
+                // Lowered nodes
+                //-------------------------------------------------------------------------
+
+                int16_t result = InvalidIndex;
+                GraphValueType valueType = GraphValueType::Unknown;
+
+                // Virtual parameters simply alias their child's register
+                if ( auto pNodeSettings = TryCast<VirtualParameterBoolNode::Settings>( pSettings ) )
+                {
+                    result = EmitNode( pNodeSettings->m_childNodeIdx );
+                    valueType = GraphValueType::Bool;
+                }
+                else if ( auto pNodeSettings = TryCast<VirtualParameterIDNode::Settings>( pSettings ) )
+                {
+                    result = EmitNode( pNodeSettings->m_childNodeIdx );
+                    valueType = GraphValueType::ID;
+                }
+                else if ( auto pNodeSettings = TryCast<VirtualParameterIntNode::Settings>( pSettings ) )
+                {
+                    result = EmitNode( pNodeSettings->m_childNodeIdx );
+                    valueType = GraphValueType::Int;
+                }
+                else if ( auto pNodeSettings = TryCast<VirtualParameterFloatNode::Settings>( pSettings ) )
+                {
+                    result = EmitNode( pNodeSettings->m_childNodeIdx );
+                    valueType = GraphValueType::Float;
+                }
+                else if ( auto pNodeSettings = TryCast<VirtualParameterVectorNode::Settings>( pSettings ) )
+                {
+                    result = EmitNode( pNodeSettings->m_childNodeIdx );
+                    valueType = GraphValueType::Vector;
+                }
+
+                // Bools
+                //-------------------------------------------------------------------------
+
+                else if ( auto pNodeSettings = TryCast<AndNode::Settings>( pSettings ) )
+                {
+                    result = EmitConditions( nodeIdx, ValueGraphOp::And, pNodeSettings->m_conditionNodeIndices, true );
+                    valueType = GraphValueType::Bool;
+                }
+                else if ( auto pNodeSettings = TryCast<OrNode::Settings>( pSettings ) )
+                {
+                    result = EmitConditions( nodeIdx, ValueGraphOp::Or, pNodeSettings->m_conditionNodeIndices, false );
+                    valueType = GraphValueType::Bool;
+                }
+                else if ( auto pNodeSettings = TryCast<NotNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ValueGraphOp::Not, nodeIdx, result, a );
+                    valueType = GraphValueType::Bool;
+                }
+
+                // Floats
+                //-------------------------------------------------------------------------
+
+                else if ( auto pNodeSettings = TryCast<FloatRemapNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ValueGraphOp::FloatRemap, nodeIdx, result, a );
+                    valueType = GraphValueType::Float;
+                }
+                else if ( auto pNodeSettings = TryCast<FloatClampNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ValueGraphOp::FloatClamp, nodeIdx, result, a );
+                    valueType = GraphValueType::Float;
+                }
+                else if ( auto pNodeSettings = TryCast<FloatAbsNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ValueGraphOp::FloatAbs, nodeIdx, result, a );
+                    valueType = GraphValueType::Float;
+                }
+                else if ( auto pNodeSettings = TryCast<FloatCurveNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ValueGraphOp::FloatCurve, nodeIdx, result, a );
+                    valueType = GraphValueType::Float;
+                }
+                else if ( auto pNodeSettings = TryCast<FloatMathNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdxA );
+                    int16_t const b = ( pNodeSettings->m_inputValueNodeIdxB != InvalidIndex ) ? EmitNode( pNodeSettings->m_inputValueNodeIdxB ) : EmitImmediate( nodeIdx, ValueGraphOp::SetFloat, pNodeSettings->m_valueB );
+                    result = AllocateRegister();
+
+                    static ValueGraphOp const mathOps[] = { ValueGraphOp::FloatAdd, ValueGraphOp::FloatSub, ValueGraphOp::FloatMul, ValueGraphOp::FloatDiv };
+                    Emit( m_instructions, mathOps[(uint8_t) pNodeSettings->m_operator], nodeIdx, result, a, b );
+
+                    if ( pNodeSettings->m_returnAbsoluteResult )
+                    {
+                        Emit( m_instructions, ValueGraphOp::FloatAbs, nodeIdx, result, result );
+                    }
+
+                    valueType = GraphValueType::Float;
+                }
+                else if ( auto pNodeSettings = TryCast<FloatComparisonNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    int16_t const b = ( pNodeSettings->m_comparandValueNodeIdx != InvalidIndex ) ? EmitNode( pNodeSettings->m_comparandValueNodeIdx ) : EmitImmediate( nodeIdx, ValueGraphOp::SetFloat, pNodeSettings->m_comparisonValue );
+                    result = AllocateRegister();
+
+                    static ValueGraphOp const comparisonOps[] = { ValueGraphOp::FloatGreaterThanEqual, ValueGraphOp::FloatLessThanEqual, ValueGraphOp::FloatNearEqual, ValueGraphOp::FloatGreaterThan, ValueGraphOp::FloatLessThan };
+                    Emit( m_instructions, comparisonOps[(uint8_t) pNodeSettings->m_comparison], nodeIdx, result, a, b, InvalidIndex, pNodeSettings->m_epsilon );
+                    valueType = GraphValueType::Bool;
+                }
+                else if ( auto pNodeSettings = TryCast<FloatRangeComparisonNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, pNodeSettings->m_isInclusiveCheck ? ValueGraphOp::FloatInRangeInclusive : ValueGraphOp::FloatInRangeExclusive, nodeIdx, result, a );
+                    valueType = GraphValueType::Bool;
+                }
+                else if ( auto pNodeSettings = TryCast<FloatSwitchNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_switchValueNodeIdx );
+                    int16_t const b = EmitNode( pNodeSettings->m_trueValueNodeIdx );
+                    int16_t const c = EmitNode( pNodeSettings->m_falseValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ValueGraphOp::FloatSelect, nodeIdx, result, a, b, c );
+                    valueType = GraphValueType::Float;
+                }
+                else if ( auto pNodeSettings = TryCast<FloatAngleMathNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+
+                    static ValueGraphOp const angleOps[] = { ValueGraphOp::FloatClampTo180, ValueGraphOp::FloatClampTo360, ValueGraphOp::FloatFlipHemisphere, ValueGraphOp::FloatFlipHemisphereNegate };
+                    Emit( m_instructions, angleOps[(uint8_t) pNodeSettings->m_operation], nodeIdx, result, a );
+                    valueType = GraphValueType::Float;
+                }
+
+                // IDs
+                //-------------------------------------------------------------------------
+
+                else if ( auto pNodeSettings = TryCast<IDComparisonNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ( pNodeSettings->m_comparison == IDComparisonNode::Comparison::Matches ) ? ValueGraphOp::IDMatches : ValueGraphOp::IDDoesntMatch, nodeIdx, result, a );
+                    valueType = GraphValueType::Bool;
+                }
+                else if ( auto pNodeSettings = TryCast<IDToFloatNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ValueGraphOp::IDToFloat, nodeIdx, result, a );
+                    valueType = GraphValueType::Float;
+                }
+
+                // Vectors
+                //-------------------------------------------------------------------------
+
+                else if ( auto pNodeSettings = TryCast<VectorInfoNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+
+                    static ValueGraphOp const infoOps[] = { ValueGraphOp::VectorX, ValueGraphOp::VectorY, ValueGraphOp::VectorZ, ValueGraphOp::VectorW, ValueGraphOp::VectorLength, ValueGraphOp::VectorAngleHorizontal, ValueGraphOp::VectorAngleVertical };
+                    Emit( m_instructions, infoOps[(uint8_t) pNodeSettings->m_desiredInfo], nodeIdx, result, a );
+                    valueType = GraphValueType::Float;
+                }
+                else if ( auto pNodeSettings = TryCast<VectorNegateNode::Settings>( pSettings ) )
+                {
+                    int16_t const a = EmitNode( pNodeSettings->m_inputValueNodeIdx );
+                    result = AllocateRegister();
+                    Emit( m_instructions, ValueGraphOp::VectorNegate, nodeIdx, result, a );
+                    valueType = GraphValueType::Vector;
+                }
+                else if ( auto pNodeSettings = TryCast<VectorCreateNode::Settings>( pSettings ) )
+                {
+                    int16_t const vectorInput = ( pNodeSettings->m_inputVectorValueNodeIdx != InvalidIndex ) ? EmitNode( pNodeSettings->m_inputVectorValueNodeIdx ) : InvalidIndex;
+                    int16_t const xInput = ( pNodeSettings->m_inputValueXNodeIdx != InvalidIndex ) ? EmitNode( pNodeSettings->m_inputValueXNodeIdx ) : InvalidIndex;
+                    int16_t const yInput = ( pNodeSettings->m_inputValueYNodeIdx != InvalidIndex ) ? EmitNode( pNodeSettings->m_inputValueYNodeIdx ) : InvalidIndex;
+                    int16_t const zInput = ( pNodeSettings->m_inputValueZNodeIdx != InvalidIndex ) ? EmitNode( pNodeSettings->m_inputValueZNodeIdx ) : InvalidIndex;
+                    result = AllocateRegister();
+
+                    if ( vectorInput != InvalidIndex )
+                    {
+                        Emit( m_instructions, ValueGraphOp::VectorCopy, nodeIdx, result, vectorInput );
+                    }
+                    else
+                    {
+                        Emit( m_instructions, ValueGraphOp::VectorZero, nodeIdx, result );
+                    }
+
+                    if ( xInput != InvalidIndex ) { Emit( m_instructions, ValueGraphOp::VectorSetX, nodeIdx, result, xInput ); }
+                    if ( yInput != InvalidIndex ) { Emit( m_instructions, ValueGraphOp::VectorSetY, nodeIdx, result, yInput ); }
+                    if ( zInput != InvalidIndex ) { Emit( m_instructions, ValueGraphOp::VectorSetZ, nodeIdx, result, zInput ); }
+
+                    valueType = GraphValueType::Vector;
+                }
+
+                //-------------------------------------------------------------------------
+
+                EE_ASSERT( result != InvalidIndex && valueType != GraphValueType::Unknown );
+                m_registers[nodeIdx] = result;
+
+                ValueGraphProgram::CompiledNode& compiledNode = m_compiledNodes.emplace_back();
+                compiledNode.m_nodeIdx = nodeIdx;
+                compiledNode.m_register = result;
+                compiledNode.m_segmentIdx = m_registerSegments[result];
+                compiledNode.m_valueType = valueType;
+
+                return result;
+            }
+
+        public:
+
+            TVector<ValueGraphInstruction>                  m_initializationInstructions;
+            TVector<ValueGraphInstruction>                  m_instructions;
+            TVector<ValueGraphProgram::Segment>             m_segments;
+            TVector<int16_t>                                m_segmentDependencies;
+            TVector<ValueGraphProgram::CompiledNode>        m_compiledNodes;
+            int16_t                                         m_numRegisters = 0;
+
+        private:
+
+            TVector<GraphNode::Settings*> const&            m_nodeSettings;
+            TVector<State>                                  m_states;
+            TVector<int16_t>                                m_registers;
+            TVector<int16_t>                                m_registerSegments;     // The segment that writes each register, invalid for registers only set at initialization
+            TVector<int16_t>                                m_loadSegments;         // The last segment each per-update load was emitted in
+            int16_t                                         m_currentSegmentIdx = InvalidIndex;
+        };
+    }
+
     //-------------------------------------------------------------------------
 
     bool GraphDefinitionCompiler::CompileGraph( ToolsGraphDefinition const& toolsGraph )
@@ -131,8 +682,30 @@ namespace EE::Animation
         m_runtimeGraph.m_nodePaths.swap( m_context.m_compiledNodePaths );
         #endif
 
+        CompileValueGraphProgram();
+
         //-------------------------------------------------------------------------
 
         return m_runtimeGraph.m_rootNodeIdx != InvalidIndex;
     }
+
+    void GraphDefinitionCompiler::CompileValueGraphProgram()
+    {
+        ValueGraphLowering lowering( m_runtimeGraph.m_nodeSettings );
+        lowering.Lower();
+
+        // Nothing to evaluate, leave the program empty so instances use the regular node path
+        if ( lowering.m_compiledNodes.empty() )
+        {
+            return;
+        }
+
+        ValueGraphProgram& program = m_runtimeGraph.m_valueGraphProgram;
+        program.m_initializationInstructions.swap( lowering.m_initializationInstructions );
+        program.m_instructions.swap( lowering.m_instructions );
+        program.m_segments.swap( lowering.m_segments );
+        program.m_segmentDependencies.swap( lowering.m_segmentDependencies );
+        program.m_compiledNodes.swap( lowering.m_compiledNodes );
+        program.m_numRegisters = lowering.m_numRegisters;
+    }
 }
\ No newline at end of file
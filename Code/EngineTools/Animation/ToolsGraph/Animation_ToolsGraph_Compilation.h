@@ -235,7 +235,7 @@ namespace EE::Animation
     {
     public:
 
-        constexpr static const int32_t s_version = 2;
+        constexpr static const int32_t s_version = 4;
 
     public:
 
@@ -247,6 +247,11 @@ namespace EE::Animation
         inline THashMap<UUID, int16_t> const& GetUUIDToRuntimeIndexMap() const { return m_context.m_nodeIDToIndexMap; }
         inline THashMap<int16_t, UUID> const& GetRuntimeIndexToUUIDMap() const { return m_context.m_nodeIndexToIDMap; }
 
+    private:
+
+        // Lower all pure value subgraphs into the runtime graph's value program
+        void CompileValueGraphProgram();
+
     private:
 
         GraphDefinition             m_runtimeGraph;
@@ -0,0 +1,72 @@
+#include "Animation_ToolsGraphNode_MotionMatching.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_MotionMatching.h"
+#include "EngineTools/Animation/ToolsGraph/Animation_ToolsGraph_Compilation.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::GraphNodes
+{
+    void MotionMatchingToolsNode::Initialize( VisualGraph::BaseGraph* pParent )
+    {
+        DataSlotToolsNode::Initialize( pParent );
+        CreateOutputPin( "Pose", GraphValueType::Pose );
+        CreateInputPin( "Desired Velocity (Character)", GraphValueType::Vector );
+        CreateInputPin( "Desired Facing (Character)", GraphValueType::Vector );
+    }
+
+    int16_t MotionMatchingToolsNode::Compile( GraphCompilationContext& context ) const
+    {
+        MotionMatchingNode::Settings* pSettings = nullptr;
+        NodeCompilationState const state = context.GetSettings<MotionMatchingNode>( this, pSettings );
+        if ( state == NodeCompilationState::NeedCompilation )
+        {
+            auto pDesiredVelocityNode = GetConnectedInputNode<FlowToolsNode>( 0 );
+            if ( pDesiredVelocityNode != nullptr )
+            {
+                int16_t const compiledNodeIdx = pDesiredVelocityNode->Compile( context );
+                if ( compiledNodeIdx != InvalidIndex )
+                {
+                    pSettings->m_desiredVelocityValueNodeIdx = compiledNodeIdx;
+                }
+                else
+                {
+                    return InvalidIndex;
+                }
+            }
+            else
+            {
+                context.LogError( this, "Disconnected desired velocity pin!" );
+                return InvalidIndex;
+            }
+
+            auto pDesiredFacingNode = GetConnectedInputNode<FlowToolsNode>( 1 );
+            if ( pDesiredFacingNode != nullptr )
+            {
+                int16_t const compiledNodeIdx = pDesiredFacingNode->Compile( context );
+                if ( compiledNodeIdx != InvalidIndex )
+                {
+                    pSettings->m_desiredFacingValueNodeIdx = compiledNodeIdx;
+                }
+                else
+                {
+                    return InvalidIndex;
+                }
+            }
+
+            //-------------------------------------------------------------------------
+
+            if ( m_maxEvaluatedEntriesPerSearch <= 0 )
+            {
+                context.LogError( this, "The search budget needs to be greater than zero!" );
+                return InvalidIndex;
+            }
+
+            pSettings->m_dataSlotIdx = context.RegisterDataSlotNode( GetID() );
+            pSettings->m_searchInterval = Math::Max( m_searchInterval, 0.0f );
+            pSettings->m_blendTime = Math::Max( m_blendTime, 0.0f );
+            pSettings->m_sameClipTimeTolerance = Math::Max( m_sameClipTimeTolerance, 0.0f );
+            pSettings->m_maxEvaluatedEntriesPerSearch = m_maxEvaluatedEntriesPerSearch;
+        }
+        return pSettings->m_nodeIdx;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "Engine/Animation/AnimationMotionMatching.h"
+#include "Animation_ToolsGraphNode_DataSlot.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::GraphNodes
+{
+    class MotionMatchingToolsNode final : public DataSlotToolsNode
+    {
+        EE_REGISTER_TYPE( MotionMatchingToolsNode );
+
+    public:
+
+        virtual void Initialize( VisualGraph::BaseGraph* pParent ) override;
+
+        virtual GraphValueType GetValueType() const override { return GraphValueType::Pose; }
+        virtual char const* GetTypeName() const override { return "Motion Matching"; }
+        virtual char const* GetCategory() const override { return "Animation"; }
+        virtual TBitFlags<GraphType> GetAllowedParentGraphTypes() const override { return TBitFlags<GraphType>( GraphType::BlendTree ); }
+        virtual int16_t Compile( GraphCompilationContext& context ) const override;
+
+        virtual char const* const GetDefaultSlotName() const override { return "Database"; }
+        virtual ResourceTypeID GetSlotResourceTypeID() const override { return MotionMatchingDatabase::GetStaticResourceTypeID(); }
+
+    private:
+
+        EE_EXPOSE float         m_searchInterval = 0.1f;
+        EE_EXPOSE float         m_blendTime = 0.2f;
+        EE_EXPOSE float         m_sameClipTimeTolerance = 0.2f; // Matches in the current clip closer than this to the current time are ignored
+        EE_EXPOSE int32_t       m_maxEvaluatedEntriesPerSearch = 4096; // The maximum number of database entries evaluated per search
+    };
+}
@@ -0,0 +1,823 @@
+#include "NavmeshBuilder.h"
+#include "Engine/Navmesh/NavmeshGraph.h"
+#include "Engine/Navmesh/Components/Component_Navmesh.h"
+#include "System/Math/BoundingVolumes.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Navmesh
+{
+    // Clip a polygon against an axis-aligned plane, keeping the part where 'sign * ( v[axis] - value ) >= 0'
+    static int32_t ClipPolygon( Float3 const* pInVertices, int32_t numInVertices, Float3* pOutVertices, uint32_t axis, float value, float sign )
+    {
+        int32_t numOutVertices = 0;
+        for ( int32_t i = 0, j = numInVertices - 1; i < numInVertices; j = i++ )
+        {
+            float const distanceJ = sign * ( pInVertices[j][axis] - value );
+            float const distanceI = sign * ( pInVertices[i][axis] - value );
+            bool const isJInside = distanceJ >= 0.0f;
+            bool const isIInside = distanceI >= 0.0f;
+
+            if ( isJInside != isIInside )
+            {
+                float const t = distanceJ / ( distanceJ - distanceI );
+                pOutVertices[numOutVertices++] = pInVertices[j] + ( pInVertices[i] - pInVertices[j] ) * t;
+            }
+
+            if ( isIInside )
+            {
+                pOutVertices[numOutVertices++] = pInVertices[i];
+            }
+        }
+
+        return numOutVertices;
+    }
+
+    //-------------------------------------------------------------------------
+
+    NavmeshBuilder::NavmeshBuilder( NavmeshLayerBuildSettings const& settings )
+        : m_settings( settings )
+    {}
+
+    bool NavmeshBuilder::Build( TVector<BuildTriangle> const& triangles, NavmeshGraph& outGraph )
+    {
+        outGraph = NavmeshGraph();
+        m_stats = Stats();
+        m_errorMessage[0] = 0;
+
+        m_solidColumns.clear();
+        m_solidSpans.clear();
+        m_cells.clear();
+        m_openSpans.clear();
+        m_rects.clear();
+        m_rectSpans.clear();
+
+        if ( triangles.empty() )
+        {
+            Printf( m_errorMessage, 256, "No triangles supplied" );
+            return false;
+        }
+
+        m_cellSize = Math::Max( m_settings.m_voxSize, 0.01f );
+        m_heightTolerance = Math::Max( m_cellSize, m_settings.m_step * 0.5f );
+
+        //-------------------------------------------------------------------------
+
+        if ( !RasterizeTriangles( triangles ) )
+        {
+            return false;
+        }
+
+        BuildOpenSpans();
+        ErodeWalkableArea();
+        BuildRegions();
+        BuildRects();
+        BuildGraph( outGraph );
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Rasterization
+    //-------------------------------------------------------------------------
+
+    bool NavmeshBuilder::RasterizeTriangles( TVector<BuildTriangle> const& triangles )
+    {
+        Float3 boundsMin( FLT_MAX ), boundsMax( -FLT_MAX );
+        for ( auto const& triangle : triangles )
+        {
+            for ( auto const& vertex : triangle.m_vertices )
+            {
+                boundsMin = Float3( Math::Min( boundsMin.m_x, vertex.m_x ), Math::Min( boundsMin.m_y, vertex.m_y ), Math::Min( boundsMin.m_z, vertex.m_z ) );
+                boundsMax = Float3( Math::Max( boundsMax.m_x, vertex.m_x ), Math::Max( boundsMax.m_y, vertex.m_y ), Math::Max( boundsMax.m_z, vertex.m_z ) );
+            }
+        }
+
+        m_origin = boundsMin;
+        m_dimensions.m_x = Math::CeilingToInt( ( boundsMax.m_x - boundsMin.m_x ) / m_cellSize ) + 1;
+        m_dimensions.m_y = Math::CeilingToInt( ( boundsMax.m_y - boundsMin.m_y ) / m_cellSize ) + 1;
+        m_stats.m_gridDimensions = m_dimensions;
+
+        int64_t const numCells = int64_t( m_dimensions.m_x ) * m_dimensions.m_y;
+        if ( numCells > s_maxNumCells )
+        {
+            Printf( m_errorMessage, 256, "Heightfield is too large (%d x %d cells), increase the voxel size", m_dimensions.m_x, m_dimensions.m_y );
+            return false;
+        }
+
+        m_solidColumns.resize( numCells, InvalidIndex );
+
+        //-------------------------------------------------------------------------
+
+        float const walkableThreshold = Math::Cos( Degrees( m_settings.m_maxWalkableSlope ).ToRadians().ToFloat() );
+
+        Float3 clipBufferA[12], clipBufferB[12], rowVertices[12], cellVertices[12];
+
+        for ( auto const& triangle : triangles )
+        {
+            Float3 const& v0 = triangle.m_vertices[0];
+            Float3 const& v1 = triangle.m_vertices[1];
+            Float3 const& v2 = triangle.m_vertices[2];
+
+            Float3 const e0 = v1 - v0;
+            Float3 const e1 = v2 - v0;
+            Float3 const normal( e0.m_y * e1.m_z - e0.m_z * e1.m_y, e0.m_z * e1.m_x - e0.m_x * e1.m_z, e0.m_x * e1.m_y - e0.m_y * e1.m_x );
+            float const normalLength = Math::Sqrt( normal.m_x * normal.m_x + normal.m_y * normal.m_y + normal.m_z * normal.m_z );
+            if ( normalLength < Math::Epsilon )
+            {
+                continue;
+            }
+
+            bool const isWalkable = ( normal.m_z / normalLength ) >= walkableThreshold;
+
+            // Get the cell range covered by the triangle
+            //-------------------------------------------------------------------------
+
+            float const triMinX = Math::Min( v0.m_x, Math::Min( v1.m_x, v2.m_x ) );
+            float const triMaxX = Math::Max( v0.m_x, Math::Max( v1.m_x, v2.m_x ) );
+            float const triMinY = Math::Min( v0.m_y, Math::Min( v1.m_y, v2.m_y ) );
+            float const triMaxY = Math::Max( v0.m_y, Math::Max( v1.m_y, v2.m_y ) );
+
+            int32_t const minX = Math::Clamp( Math::FloorToInt( ( triMinX - m_origin.m_x ) / m_cellSize ), 0, m_dimensions.m_x - 1 );
+            int32_t const maxX = Math::Clamp( Math::FloorToInt( ( triMaxX - m_origin.m_x ) / m_cellSize ), 0, m_dimensions.m_x - 1 );
+            int32_t const minY = Math::Clamp( Math::FloorToInt( ( triMinY - m_origin.m_y ) / m_cellSize ), 0, m_dimensions.m_y - 1 );
+            int32_t const maxY = Math::Clamp( Math::FloorToInt( ( triMaxY - m_origin.m_y ) / m_cellSize ), 0, m_dimensions.m_y - 1 );
+
+            // Clip the triangle to each row and then to each cell, the z-range of the clipped polygon is the span
+            //-------------------------------------------------------------------------
+
+            for ( int32_t y = minY; y <= maxY; y++ )
+            {
+                float const rowMin = m_origin.m_y + y * m_cellSize;
+                int32_t numRowVertices = ClipPolygon( triangle.m_vertices, 3, clipBufferA, 1, rowMin, 1.0f );
+                numRowVertices = ClipPolygon( clipBufferA, numRowVertices, rowVertices, 1, rowMin + m_cellSize, -1.0f );
+                if ( numRowVertices == 0 )
+                {
+                    continue;
+                }
+
+                for ( int32_t x = minX; x <= maxX; x++ )
+                {
+                    float const columnMin = m_origin.m_x + x * m_cellSize;
+                    int32_t numCellVertices = ClipPolygon( rowVertices, numRowVertices, clipBufferB, 0, columnMin, 1.0f );
+                    numCellVertices = ClipPolygon( clipBufferB, numCellVertices, cellVertices, 0, columnMin + m_cellSize, -1.0f );
+                    if ( numCellVertices == 0 )
+                    {
+                        continue;
+                    }
+
+                    float spanMin = cellVertices[0].m_z;
+                    float spanMax = cellVertices[0].m_z;
+                    for ( int32_t i = 1; i < numCellVertices; i++ )
+                    {
+                        spanMin = Math::Min( spanMin, cellVertices[i].m_z );
+                        spanMax = Math::Max( spanMax, cellVertices[i].m_z );
+                    }
+
+                    AddSolidSpan( x, y, spanMin, spanMax, isWalkable );
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void NavmeshBuilder::AddSolidSpan( int32_t x, int32_t y, float min, float max, bool isWalkable )
+    {
+        int32_t const columnIdx = y * m_dimensions.m_x + x;
+
+        SolidSpan newSpan = { min, max, InvalidIndex, isWalkable };
+
+        // Merge with all overlapping spans, the column is kept sorted from bottom to top
+        int32_t previousSpanIdx = InvalidIndex;
+        int32_t currentSpanIdx = m_solidColumns[columnIdx];
+        while ( currentSpanIdx != InvalidIndex )
+        {
+            SolidSpan const& currentSpan = m_solidSpans[currentSpanIdx];
+            if ( currentSpan.m_min > newSpan.m_max )
+            {
+                break;
+            }
+
+            if ( currentSpan.m_max < newSpan.m_min )
+            {
+                previousSpanIdx = currentSpanIdx;
+                currentSpanIdx = currentSpan.m_nextIdx;
+                continue;
+            }
+
+            // The walkable state comes from whichever span defines the top surface
+            if ( Math::Abs( newSpan.m_max - currentSpan.m_max ) <= m_settings.m_step )
+            {
+                newSpan.m_isWalkable |= currentSpan.m_isWalkable;
+            }
+            else if ( currentSpan.m_max > newSpan.m_max )
+            {
+                newSpan.m_isWalkable = currentSpan.m_isWalkable;
+            }
+
+            newSpan.m_min = Math::Min( newSpan.m_min, currentSpan.m_min );
+            newSpan.m_max = Math::Max( newSpan.m_max, currentSpan.m_max );
+
+            // Unlink the merged span
+            int32_t const nextSpanIdx = currentSpan.m_nextIdx;
+            if ( previousSpanIdx == InvalidIndex )
+            {
+                m_solidColumns[columnIdx] = nextSpanIdx;
+            }
+            else
+            {
+                m_solidSpans[previousSpanIdx].m_nextIdx = nextSpanIdx;
+            }
+
+            currentSpanIdx = nextSpanIdx;
+        }
+
+        // Insert the new span
+        newSpan.m_nextIdx = currentSpanIdx;
+        int32_t const newSpanIdx = (int32_t) m_solidSpans.size();
+        m_solidSpans.emplace_back( newSpan );
+
+        if ( previousSpanIdx == InvalidIndex )
+        {
+            m_solidColumns[columnIdx] = newSpanIdx;
+        }
+        else
+        {
+            m_solidSpans[previousSpanIdx].m_nextIdx = newSpanIdx;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Open Spans
+    //-------------------------------------------------------------------------
+
+    void NavmeshBuilder::BuildOpenSpans()
+    {
+        m_cells.resize( m_solidColumns.size() );
+
+        for ( int32_t y = 0; y < m_dimensions.m_y; y++ )
+        {
+            for ( int32_t x = 0; x < m_dimensions.m_x; x++ )
+            {
+                int32_t const columnIdx = y * m_dimensions.m_x + x;
+                Cell& cell = m_cells[columnIdx];
+                cell.m_firstSpanIdx = (uint32_t) m_openSpans.size();
+
+                for ( int32_t spanIdx = m_solidColumns[columnIdx]; spanIdx != InvalidIndex; spanIdx = m_solidSpans[spanIdx].m_nextIdx )
+                {
+                    SolidSpan const& solidSpan = m_solidSpans[spanIdx];
+                    m_stats.m_numSolidSpans++;
+
+                    if ( !solidSpan.m_isWalkable )
+                    {
+                        continue;
+                    }
+
+                    float const floor = solidSpan.m_max;
+                    float const ceiling = ( solidSpan.m_nextIdx != InvalidIndex ) ? m_solidSpans[solidSpan.m_nextIdx].m_min : FLT_MAX;
+                    if ( ceiling - floor < m_settings.m_height )
+                    {
+                        continue;
+                    }
+
+                    OpenSpan& openSpan = m_openSpans.emplace_back();
+                    openSpan.m_floor = floor;
+                    openSpan.m_ceiling = ceiling;
+                    openSpan.m_x = x;
+                    openSpan.m_y = y;
+                }
+
+                cell.m_numSpans = (uint32_t) m_openSpans.size() - cell.m_firstSpanIdx;
+            }
+        }
+
+        m_stats.m_numOpenSpans = (int32_t) m_openSpans.size();
+
+        // Connect neighbouring spans that we can step between
+        //-------------------------------------------------------------------------
+
+        for ( auto& openSpan : m_openSpans )
+        {
+            for ( int32_t direction = 0; direction < 4; direction++ )
+            {
+                int32_t const neighbourX = openSpan.m_x + s_directionOffsetsX[direction];
+                int32_t const neighbourY = openSpan.m_y + s_directionOffsetsY[direction];
+                if ( neighbourX < 0 || neighbourY < 0 || neighbourX >= m_dimensions.m_x || neighbourY >= m_dimensions.m_y )
+                {
+                    continue;
+                }
+
+                Cell const& neighbourCell = m_cells[neighbourY * m_dimensions.m_x + neighbourX];
+                float closestStepHeight = FLT_MAX;
+                for ( uint32_t i = 0; i < neighbourCell.m_numSpans; i++ )
+                {
+                    int32_t const neighbourSpanIdx = neighbourCell.m_firstSpanIdx + i;
+                    OpenSpan const& neighbourSpan = m_openSpans[neighbourSpanIdx];
+
+                    float const stepHeight = Math::Abs( neighbourSpan.m_floor - openSpan.m_floor );
+                    float const clearance = Math::Min( neighbourSpan.m_ceiling, openSpan.m_ceiling ) - Math::Max( neighbourSpan.m_floor, openSpan.m_floor );
+                    if ( stepHeight <= m_settings.m_step && clearance >= m_settings.m_height && stepHeight < closestStepHeight )
+                    {
+                        closestStepHeight = stepHeight;
+                        openSpan.m_neighbours[direction] = neighbourSpanIdx;
+                    }
+                }
+            }
+        }
+    }
+
+    void NavmeshBuilder::ErodeWalkableArea()
+    {
+        // Calculate the distance (in cells) of each span to the edge of the walkable area
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> openList;
+        openList.reserve( m_openSpans.size() );
+
+        int32_t const numOpenSpans = (int32_t) m_openSpans.size();
+        for ( int32_t i = 0; i < numOpenSpans; i++ )
+        {
+            OpenSpan& openSpan = m_openSpans[i];
+            for ( int32_t direction = 0; direction < 4; direction++ )
+            {
+                if ( openSpan.m_neighbours[direction] == InvalidIndex )
+                {
+                    openSpan.m_distanceToEdge = 0;
+                    openList.emplace_back( i );
+                    break;
+                }
+            }
+        }
+
+        for ( size_t openListIdx = 0; openListIdx < openList.size(); openListIdx++ )
+        {
+            OpenSpan const& openSpan = m_openSpans[openList[openListIdx]];
+            for ( int32_t direction = 0; direction < 4; direction++ )
+            {
+                int32_t const neighbourSpanIdx = openSpan.m_neighbours[direction];
+                if ( neighbourSpanIdx != InvalidIndex && m_openSpans[neighbourSpanIdx].m_distanceToEdge > openSpan.m_distanceToEdge + 1 )
+                {
+                    m_openSpans[neighbourSpanIdx].m_distanceToEdge = openSpan.m_distanceToEdge + 1;
+                    openList.emplace_back( neighbourSpanIdx );
+                }
+            }
+        }
+
+        // Remove all spans within the agent radius of the edge, the edge spans are half a cell away from the actual edge
+        //-------------------------------------------------------------------------
+
+        int32_t const radiusInCells = Math::Max( 0, Math::CeilingToInt( m_settings.m_radius / m_cellSize - 0.5f ) );
+        for ( auto& openSpan : m_openSpans )
+        {
+            if ( openSpan.m_distanceToEdge < radiusInCells )
+            {
+                openSpan.m_regionIdx = InvalidIndex;
+                openSpan.m_polygonIdx = InvalidIndex;
+                openSpan.m_distanceToEdge = InvalidIndex;
+            }
+            else
+            {
+                m_stats.m_numWalkableSpans++;
+            }
+        }
+    }
+
+    void NavmeshBuilder::BuildRegions()
+    {
+        auto IsWalkable = [this] ( int32_t spanIdx ) { return spanIdx != InvalidIndex && m_openSpans[spanIdx].m_distanceToEdge != InvalidIndex; };
+
+        // Flood fill connected spans into regions
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> regionSizes;
+        TVector<int32_t> openList;
+
+        int32_t const numOpenSpans = (int32_t) m_openSpans.size();
+        for ( int32_t i = 0; i < numOpenSpans; i++ )
+        {
+            if ( !IsWalkable( i ) || m_openSpans[i].m_regionIdx != InvalidIndex )
+            {
+                continue;
+            }
+
+            int32_t const regionIdx = (int32_t) regionSizes.size();
+            int32_t& regionSize = regionSizes.emplace_back( 0 );
+
+            openList.clear();
+            openList.emplace_back( i );
+            m_openSpans[i].m_regionIdx = regionIdx;
+
+            while ( !openList.empty() )
+            {
+                OpenSpan const& openSpan = m_openSpans[openList.back()];
+                openList.pop_back();
+                regionSize++;
+
+                for ( int32_t direction = 0; direction < 4; direction++ )
+                {
+                    int32_t const neighbourSpanIdx = openSpan.m_neighbours[direction];
+                    if ( IsWalkable( neighbourSpanIdx ) && m_openSpans[neighbourSpanIdx].m_regionIdx == InvalidIndex )
+                    {
+                        m_openSpans[neighbourSpanIdx].m_regionIdx = regionIdx;
+                        openList.emplace_back( neighbourSpanIdx );
+                    }
+                }
+            }
+        }
+
+        // Remove small islands
+        //-------------------------------------------------------------------------
+
+        int32_t const numRegions = (int32_t) regionSizes.size();
+
+        TVector<int32_t> sortedRegions;
+        sortedRegions.reserve( numRegions );
+        for ( int32_t i = 0; i < numRegions; i++ )
+        {
+            sortedRegions.emplace_back( i );
+        }
+
+        eastl::sort( sortedRegions.begin(), sortedRegions.end(), [&regionSizes] ( int32_t a, int32_t b ) { return regionSizes[a] > regionSizes[b]; } );
+
+        float const cellArea = m_cellSize * m_cellSize;
+        TVector<bool> isRegionRemoved( numRegions, false );
+        for ( int32_t i = 0; i < numRegions; i++ )
+        {
+            int32_t const regionIdx = sortedRegions[i];
+            bool const exceedsMaxIslands = m_settings.m_maxNumIslands > 0 && i >= m_settings.m_maxNumIslands;
+            if ( exceedsMaxIslands || ( regionSizes[regionIdx] * cellArea ) < m_settings.m_minIslandSurfaceArea )
+            {
+                isRegionRemoved[regionIdx] = true;
+                m_stats.m_numRemovedIslands++;
+            }
+        }
+
+        for ( auto& openSpan : m_openSpans )
+        {
+            if ( openSpan.m_regionIdx != InvalidIndex && isRegionRemoved[openSpan.m_regionIdx] )
+            {
+                openSpan.m_regionIdx = InvalidIndex;
+                openSpan.m_distanceToEdge = InvalidIndex;
+            }
+        }
+
+        m_stats.m_numRegions = numRegions - m_stats.m_numRemovedIslands;
+    }
+
+    //-------------------------------------------------------------------------
+    // Polygons
+    //-------------------------------------------------------------------------
+
+    bool NavmeshBuilder::CanAddSpanToRect( int32_t spanIdx, int32_t regionIdx ) const
+    {
+        if ( spanIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        OpenSpan const& openSpan = m_openSpans[spanIdx];
+        return openSpan.m_regionIdx == regionIdx && openSpan.m_polygonIdx == InvalidIndex;
+    }
+
+    float NavmeshBuilder::GetRectHeight( Rect const& rect, float cellX, float cellY ) const
+    {
+        // Bilinear interpolation between the corner cell centers, with linear extrapolation outside of them
+        float const u = ( rect.m_width > 1 ) ? cellX / ( rect.m_width - 1 ) : 0.0f;
+        float const v = ( rect.m_height > 1 ) ? cellY / ( rect.m_height - 1 ) : 0.0f;
+        float const bottom = rect.m_cornerHeights[0] + ( rect.m_cornerHeights[1] - rect.m_cornerHeights[0] ) * u;
+        float const top = rect.m_cornerHeights[2] + ( rect.m_cornerHeights[3] - rect.m_cornerHeights[2] ) * u;
+        return bottom + ( top - bottom ) * v;
+    }
+
+    bool NavmeshBuilder::IsRectPlanar( Rect const& rect ) const
+    {
+        for ( int32_t y = 0; y < rect.m_height; y++ )
+        {
+            for ( int32_t x = 0; x < rect.m_width; x++ )
+            {
+                float const floor = m_openSpans[GetRectSpan( rect, x, y )].m_floor;
+                if ( Math::Abs( floor - GetRectHeight( rect, (float) x, (float) y ) ) > m_heightTolerance )
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void NavmeshBuilder::BuildRects()
+    {
+        auto UpdateCornerHeights = [this] ( Rect& rect )
+        {
+            rect.m_cornerHeights[0] = m_openSpans[GetRectSpan( rect, 0, 0 )].m_floor;
+            rect.m_cornerHeights[1] = m_openSpans[GetRectSpan( rect, rect.m_width - 1, 0 )].m_floor;
+            rect.m_cornerHeights[2] = m_openSpans[GetRectSpan( rect, 0, rect.m_height - 1 )].m_floor;
+            rect.m_cornerHeights[3] = m_openSpans[GetRectSpan( rect, rect.m_width - 1, rect.m_height - 1 )].m_floor;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Spans are stored in row order so we always start a rect at its bottom-left cell
+        int32_t const numOpenSpans = (int32_t) m_openSpans.size();
+        for ( int32_t spanIdx = 0; spanIdx < numOpenSpans; spanIdx++ )
+        {
+            OpenSpan const& startSpan = m_openSpans[spanIdx];
+            if ( startSpan.m_regionIdx == InvalidIndex || startSpan.m_polygonIdx != InvalidIndex )
+            {
+                continue;
+            }
+
+            int32_t const regionIdx = startSpan.m_regionIdx;
+
+            Rect rect;
+            rect.m_x = startSpan.m_x;
+            rect.m_y = startSpan.m_y;
+            rect.m_width = 1;
+            rect.m_height = 1;
+            rect.m_firstSpanIdx = (uint32_t) m_rectSpans.size();
+            m_rectSpans.emplace_back( spanIdx );
+            UpdateCornerHeights( rect );
+
+            // Grow along X
+            //-------------------------------------------------------------------------
+
+            while ( rect.m_width < s_maxPolygonDimension )
+            {
+                int32_t const neighbourSpanIdx = m_openSpans[m_rectSpans.back()].m_neighbours[0];
+                if ( !CanAddSpanToRect( neighbourSpanIdx, regionIdx ) )
+                {
+                    break;
+                }
+
+                m_rectSpans.emplace_back( neighbourSpanIdx );
+                rect.m_width++;
+                UpdateCornerHeights( rect );
+
+                if ( !IsRectPlanar( rect ) )
+                {
+                    m_rectSpans.pop_back();
+                    rect.m_width--;
+                    UpdateCornerHeights( rect );
+                    break;
+                }
+            }
+
+            // Grow along Y, a row is only added if all its spans are free and connected to each other
+            //-------------------------------------------------------------------------
+
+            while ( rect.m_height < s_maxPolygonDimension )
+            {
+                size_t const rowStartIdx = m_rectSpans.size();
+                bool canAddRow = true;
+                for ( int32_t x = 0; x < rect.m_width; x++ )
+                {
+                    int32_t const neighbourSpanIdx = m_openSpans[GetRectSpan( rect, x, rect.m_height - 1 )].m_neighbours[1];
+                    if ( !CanAddSpanToRect( neighbourSpanIdx, regionIdx ) )
+                    {
+                        canAddRow = false;
+                        break;
+                    }
+
+                    if ( x > 0 && m_openSpans[m_rectSpans.back()].m_neighbours[0] != neighbourSpanIdx )
+                    {
+                        canAddRow = false;
+                        break;
+                    }
+
+                    m_rectSpans.emplace_back( neighbourSpanIdx );
+                }
+
+                if ( canAddRow )
+                {
+                    rect.m_height++;
+                    UpdateCornerHeights( rect );
+                    if ( !IsRectPlanar( rect ) )
+                    {
+                        rect.m_height--;
+                        canAddRow = false;
+                    }
+                }
+
+                if ( !canAddRow )
+                {
+                    m_rectSpans.resize( rowStartIdx );
+                    UpdateCornerHeights( rect );
+                    break;
+                }
+            }
+
+            // Assign spans
+            //-------------------------------------------------------------------------
+
+            int32_t const polygonIdx = (int32_t) m_rects.size();
+            for ( int32_t i = 0; i < rect.m_width * rect.m_height; i++ )
+            {
+                m_openSpans[m_rectSpans[rect.m_firstSpanIdx + i]].m_polygonIdx = polygonIdx;
+            }
+
+            m_rects.emplace_back( rect );
+        }
+    }
+
+    void NavmeshBuilder::BuildGraph( NavmeshGraph& outGraph )
+    {
+        float const verticalOffset = m_settings.m_verticalOffsetDist;
+        int32_t const numRects = (int32_t) m_rects.size();
+        if ( numRects == 0 )
+        {
+            return;
+        }
+
+        outGraph.m_polygons.reserve( numRects );
+        outGraph.m_vertices.reserve( numRects * 4 );
+
+        Float3 boundsMin( FLT_MAX ), boundsMax( -FLT_MAX );
+
+        for ( int32_t rectIdx = 0; rectIdx < numRects; rectIdx++ )
+        {
+            Rect const& rect = m_rects[rectIdx];
+            float const x0 = m_origin.m_x + rect.m_x * m_cellSize;
+            float const y0 = m_origin.m_y + rect.m_y * m_cellSize;
+            float const x1 = x0 + rect.m_width * m_cellSize;
+            float const y1 = y0 + rect.m_height * m_cellSize;
+
+            auto GetPointOnRect = [&] ( float x, float y )
+            {
+                float const cellX = ( x - x0 ) / m_cellSize - 0.5f;
+                float const cellY = ( y - y0 ) / m_cellSize - 0.5f;
+                return Float3( x, y, GetRectHeight( rect, cellX, cellY ) + verticalOffset );
+            };
+
+            // Vertices
+            //-------------------------------------------------------------------------
+
+            NavmeshGraph::Polygon& polygon = outGraph.m_polygons.emplace_back();
+            polygon.m_firstVertexIdx = (uint32_t) outGraph.m_vertices.size();
+            polygon.m_numVertices = 4;
+            outGraph.m_vertices.emplace_back( GetPointOnRect( x0, y0 ) );
+            outGraph.m_vertices.emplace_back( GetPointOnRect( x1, y0 ) );
+            outGraph.m_vertices.emplace_back( GetPointOnRect( x1, y1 ) );
+            outGraph.m_vertices.emplace_back( GetPointOnRect( x0, y1 ) );
+
+            Float3 centroid = Float3::Zero;
+            for ( uint32_t i = polygon.m_firstVertexIdx; i < polygon.m_firstVertexIdx + 4; i++ )
+            {
+                Float3 const& vertex = outGraph.m_vertices[i];
+                centroid += vertex;
+                boundsMin = Float3( Math::Min( boundsMin.m_x, vertex.m_x ), Math::Min( boundsMin.m_y, vertex.m_y ), Math::Min( boundsMin.m_z, vertex.m_z ) );
+                boundsMax = Float3( Math::Max( boundsMax.m_x, vertex.m_x ), Math::Max( boundsMax.m_y, vertex.m_y ), Math::Max( boundsMax.m_z, vertex.m_z ) );
+            }
+            polygon.m_centroid = centroid / 4.0f;
+
+            // Links
+            //-------------------------------------------------------------------------
+            // Walk each side in counter-clockwise order, grouping consecutive cells with the same neighbouring polygon into a single portal
+            // Since we walk counter-clockwise, the start of each portal is on the right when exiting the polygon
+
+            polygon.m_firstLinkIdx = (uint32_t) outGraph.m_links.size();
+
+            struct SideDesc
+            {
+                int32_t     m_direction;
+                int32_t     m_numCells;
+            };
+
+            SideDesc const sides[4] = { { 3, rect.m_width }, { 0, rect.m_height }, { 1, rect.m_width }, { 2, rect.m_height } };
+            for ( int32_t sideIdx = 0; sideIdx < 4; sideIdx++ )
+            {
+                SideDesc const& side = sides[sideIdx];
+
+                int32_t currentNeighbourIdx = InvalidIndex;
+                Float2 portalStart = Float2::Zero;
+                Float2 portalEnd = Float2::Zero;
+
+                auto FlushPortal = [&] ()
+                {
+                    if ( currentNeighbourIdx != InvalidIndex )
+                    {
+                        NavmeshGraph::Link& link = outGraph.m_links.emplace_back();
+                        link.m_portalRight = GetPointOnRect( portalStart.m_x, portalStart.m_y );
+                        link.m_portalLeft = GetPointOnRect( portalEnd.m_x, portalEnd.m_y );
+                        link.m_neighbourIdx = currentNeighbourIdx;
+                        polygon.m_numLinks++;
+                    }
+                };
+
+                for ( int32_t i = 0; i < side.m_numCells; i++ )
+                {
+                    // Get the cell and the cell edge segment (in counter-clockwise order) for this step along the side
+                    int32_t cellX = 0, cellY = 0;
+                    Float2 segmentStart, segmentEnd;
+                    switch ( side.m_direction )
+                    {
+                        case 3: // South, walking +X
+                        cellX = i; cellY = 0;
+                        segmentStart = Float2( x0 + i * m_cellSize, y0 );
+                        segmentEnd = Float2( x0 + ( i + 1 ) * m_cellSize, y0 );
+                        break;
+
+                        case 0: // East, walking +Y
+                        cellX = rect.m_width - 1; cellY = i;
+                        segmentStart = Float2( x1, y0 + i * m_cellSize );
+                        segmentEnd = Float2( x1, y0 + ( i + 1 ) * m_cellSize );
+                        break;
+
+                        case 1: // North, walking -X
+                        cellX = rect.m_width - 1 - i; cellY = rect.m_height - 1;
+                        segmentStart = Float2( x0 + ( cellX + 1 ) * m_cellSize, y1 );
+                        segmentEnd = Float2( x0 + cellX * m_cellSize, y1 );
+                        break;
+
+                        case 2: // West, walking -Y
+                        cellX = 0; cellY = rect.m_height - 1 - i;
+                        segmentStart = Float2( x0, y0 + ( cellY + 1 ) * m_cellSize );
+                        segmentEnd = Float2( x0, y0 + cellY * m_cellSize );
+                        break;
+                    }
+
+                    int32_t const neighbourSpanIdx = m_openSpans[GetRectSpan( rect, cellX, cellY )].m_neighbours[side.m_direction];
+                    int32_t const neighbourPolygonIdx = ( neighbourSpanIdx != InvalidIndex ) ? m_openSpans[neighbourSpanIdx].m_polygonIdx : InvalidIndex;
+
+                    if ( neighbourPolygonIdx == currentNeighbourIdx )
+                    {
+                        portalEnd = segmentEnd;
+                    }
+                    else
+                    {
+                        FlushPortal();
+                        currentNeighbourIdx = neighbourPolygonIdx;
+                        portalStart = segmentStart;
+                        portalEnd = segmentEnd;
+                    }
+                }
+
+                FlushPortal();
+            }
+
+            m_stats.m_numLinks += polygon.m_numLinks;
+        }
+
+        m_stats.m_numPolygons = numRects;
+        outGraph.m_bounds = AABB::FromMinMax( Vector( boundsMin ), Vector( boundsMax ) );
+
+        // Build spatial lookup grid
+        //-------------------------------------------------------------------------
+
+        outGraph.m_gridCellSize = Math::Max( m_cellSize * 16.0f, 1.0f );
+        outGraph.m_gridOrigin = Float2( boundsMin.m_x, boundsMin.m_y );
+        outGraph.m_gridDimensions.m_x = Math::FloorToInt( ( boundsMax.m_x - boundsMin.m_x ) / outGraph.m_gridCellSize ) + 1;
+        outGraph.m_gridDimensions.m_y = Math::FloorToInt( ( boundsMax.m_y - boundsMin.m_y ) / outGraph.m_gridCellSize ) + 1;
+
+        int32_t const numGridCells = outGraph.m_gridDimensions.m_x * outGraph.m_gridDimensions.m_y;
+        outGraph.m_gridCellOffsets.resize( numGridCells + 1, 0 );
+
+        auto ForEachOverlappedGridCell = [&outGraph] ( NavmeshGraph::Polygon const& polygon, auto&& function )
+        {
+            Float3 const* pVertices = outGraph.GetPolygonVertices( polygon );
+            Float2 polygonMin( pVertices[0].m_x, pVertices[0].m_y ), polygonMax = polygonMin;
+            for ( uint16_t i = 1; i < polygon.m_numVertices; i++ )
+            {
+                polygonMin = Float2( Math::Min( polygonMin.m_x, pVertices[i].m_x ), Math::Min( polygonMin.m_y, pVertices[i].m_y ) );
+                polygonMax = Float2( Math::Max( polygonMax.m_x, pVertices[i].m_x ), Math::Max( polygonMax.m_y, pVertices[i].m_y ) );
+            }
+
+            Int2 minCell, maxCell;
+            if ( outGraph.GetGridCellRange( polygonMin, polygonMax, minCell, maxCell ) )
+            {
+                for ( int32_t y = minCell.m_y; y <= maxCell.m_y; y++ )
+                {
+                    for ( int32_t x = minCell.m_x; x <= maxCell.m_x; x++ )
+                    {
+                        function( y * outGraph.m_gridDimensions.m_x + x );
+                    }
+                }
+            }
+        };
+
+        // Count polygons per cell and convert the counts to offsets
+        for ( auto const& polygon : outGraph.m_polygons )
+        {
+            ForEachOverlappedGridCell( polygon, [&outGraph] ( int32_t cellIdx ) { outGraph.m_gridCellOffsets[cellIdx + 1]++; } );
+        }
+
+        for ( int32_t i = 0; i < numGridCells; i++ )
+        {
+            outGraph.m_gridCellOffsets[i + 1] += outGraph.m_gridCellOffsets[i];
+        }
+
+        // Fill the polygon lists
+        TVector<uint32_t> cellFillCounts( numGridCells, 0 );
+        outGraph.m_gridPolygonIndices.resize( outGraph.m_gridCellOffsets[numGridCells] );
+        for ( uint32_t polygonIdx = 0; polygonIdx < (uint32_t) outGraph.m_polygons.size(); polygonIdx++ )
+        {
+            ForEachOverlappedGridCell( outGraph.m_polygons[polygonIdx], [&] ( int32_t cellIdx )
+            {
+                outGraph.m_gridPolygonIndices[outGraph.m_gridCellOffsets[cellIdx] + cellFillCounts[cellIdx]] = polygonIdx;
+                cellFillCounts[cellIdx]++;
+            } );
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "System/Math/Math.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Native Navmesh Builder
+//-------------------------------------------------------------------------
+// Builds a native navmesh graph from a set of collision triangles:
+//
+// 1) Rasterize the triangles into a heightfield of solid spans
+// 2) Extract the walkable open spans (a walkable surface with enough clearance above it) and connect neighbouring spans within step height
+// 3) Erode the walkable area by the agent radius and flood fill it into connected regions, removing small islands
+// 4) Greedily merge the spans of each region into rectangles that approximate the surface, these become the polygons
+// 5) Build the portals between adjacent polygons and the spatial lookup grid
+//
+// Only the default layer settings are used, there is no support for additional layers
+
+namespace EE::Navmesh
+{
+    class NavmeshGraph;
+    struct NavmeshLayerBuildSettings;
+
+    //-------------------------------------------------------------------------
+
+    class NavmeshBuilder
+    {
+        struct SolidSpan
+        {
+            float                       m_min;
+            float                       m_max;
+            int32_t                     m_nextIdx;
+            bool                        m_isWalkable;
+        };
+
+        struct OpenSpan
+        {
+            float                       m_floor;
+            float                       m_ceiling;
+            int32_t                     m_neighbours[4] = { InvalidIndex, InvalidIndex, InvalidIndex, InvalidIndex };
+            int32_t                     m_distanceToEdge = INT_MAX;
+            int32_t                     m_regionIdx = InvalidIndex;
+            int32_t                     m_polygonIdx = InvalidIndex;
+            int32_t                     m_x;
+            int32_t                     m_y;
+        };
+
+        struct Cell
+        {
+            uint32_t                    m_firstSpanIdx = 0;
+            uint32_t                    m_numSpans = 0;
+        };
+
+        // A rectangular group of open spans, the spans are stored row-major in the rect span list
+        struct Rect
+        {
+            int32_t                     m_x;
+            int32_t                     m_y;
+            int32_t                     m_width;
+            int32_t                     m_height;
+            uint32_t                    m_firstSpanIdx;
+            float                       m_cornerHeights[4];                 // The floor heights of the corner cells (x0y0, x1y0, x0y1, x1y1)
+        };
+
+    public:
+
+        // All triangles are expected to be in world space with counter-clockwise winding
+        struct BuildTriangle
+        {
+            Float3                      m_vertices[3];
+        };
+
+        struct Stats
+        {
+            Int2                        m_gridDimensions = Int2( 0, 0 );
+            int32_t                     m_numSolidSpans = 0;
+            int32_t                     m_numOpenSpans = 0;
+            int32_t                     m_numWalkableSpans = 0;
+            int32_t                     m_numRegions = 0;
+            int32_t                     m_numRemovedIslands = 0;
+            int32_t                     m_numPolygons = 0;
+            int32_t                     m_numLinks = 0;
+        };
+
+        // Directions in the order +X, +Y, -X, -Y
+        constexpr static int32_t const s_directionOffsetsX[4] = { 1, 0, -1, 0 };
+        constexpr static int32_t const s_directionOffsetsY[4] = { 0, 1, 0, -1 };
+
+        // The maximum number of cells along each axis of a polygon
+        constexpr static int32_t const s_maxPolygonDimension = 64;
+
+        // The maximum number of cells in the heightfield, this is here to catch invalid voxel sizes
+        constexpr static int64_t const s_maxNumCells = 64 * 1024 * 1024;
+
+    public:
+
+        NavmeshBuilder( NavmeshLayerBuildSettings const& settings );
+
+        bool Build( TVector<BuildTriangle> const& triangles, NavmeshGraph& outGraph );
+
+        inline Stats const& GetStats() const { return m_stats; }
+        inline char const* GetErrorMessage() const { return m_errorMessage; }
+
+    private:
+
+        bool RasterizeTriangles( TVector<BuildTriangle> const& triangles );
+        void AddSolidSpan( int32_t x, int32_t y, float min, float max, bool isWalkable );
+
+        void BuildOpenSpans();
+        void ErodeWalkableArea();
+        void BuildRegions();
+        void BuildRects();
+        void BuildGraph( NavmeshGraph& outGraph );
+
+        bool CanAddSpanToRect( int32_t spanIdx, int32_t regionIdx ) const;
+        bool IsRectPlanar( Rect const& rect ) const;
+        float GetRectHeight( Rect const& rect, float cellX, float cellY ) const;
+        inline int32_t GetRectSpan( Rect const& rect, int32_t x, int32_t y ) const { return m_rectSpans[rect.m_firstSpanIdx + y * rect.m_width + x]; }
+
+    private:
+
+        NavmeshLayerBuildSettings const&    m_settings;
+        float                               m_cellSize = 0.0f;
+        float                               m_heightTolerance = 0.0f;
+        Float3                              m_origin = Float3::Zero;
+        Int2                                m_dimensions = Int2( 0, 0 );
+
+        TVector<int32_t>                    m_solidColumns;                 // The first solid span for each column
+        TVector<SolidSpan>                  m_solidSpans;
+        TVector<Cell>                       m_cells;
+        TVector<OpenSpan>                   m_openSpans;
+        TVector<Rect>                       m_rects;
+        TVector<int32_t>                    m_rectSpans;
+
+        Stats                               m_stats;
+        char                                m_errorMessage[256] = { 0 };
+    };
+}
\ No newline at end of file
@@ -1,4 +1,3 @@
-#if EE_ENABLE_NAVPOWER
 #include "NavmeshGenerator.h"
 #include "EngineTools/Physics/ResourceDescriptors/ResourceDescriptor_PhysicsMesh.h"
 #include "EngineTools/RawAssets/RawAssetReader.h"
@@ -15,7 +14,10 @@
 #include "System/Resource/ResourceHeader.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "System/Serialization/BinarySerialization.h"
+
+#if EE_ENABLE_NAVPOWER
 #include <bfxSystem.h>
+#endif
 
 //-------------------------------------------------------------------------
 
@@ -35,7 +37,9 @@ namespace EE::Navmesh
 
     NavmeshGenerator::~NavmeshGenerator()
     {
+        #if EE_ENABLE_NAVPOWER
         EE_ASSERT( m_pNavpowerInstance == nullptr );
+        #endif
         EE_ASSERT( m_state != State::Generating );
         EE_ASSERT( !m_isGeneratingAsync );
     }
@@ -52,10 +56,14 @@ namespace EE::Navmesh
 
     void NavmeshGenerator::Generate()
     {
-        EE_ASSERT( m_state != State::Generating && m_pNavpowerInstance == nullptr );
+        EE_ASSERT( m_state != State::Generating );
+
+        #if EE_ENABLE_NAVPOWER
+        EE_ASSERT( m_pNavpowerInstance == nullptr );
+        #endif
 
         m_collisionPrimitives.clear();
-        m_buildFaces.clear();
+        m_buildTriangles.clear();
         m_numCollisionPrimitivesToProcess = 0;
         m_progressMessage[0] = 0;
         m_progress = 0.0f;
@@ -253,7 +261,7 @@ namespace EE::Navmesh
 
                 for ( auto const& geometrySection : pRawMesh->GetGeometrySections() )
                 {
-                    // NavPower expects counterclockwise winding
+                    // The builders expect counterclockwise winding
                     bool flipWinding = geometrySection.m_clockwiseWinding ? true : false;
                     if ( flipWindingDueToScale )
                     {
@@ -269,18 +277,16 @@ namespace EE::Navmesh
                         int32_t const i = t * 3;
                         EE_ASSERT( i <= numIndices - 3 );
 
-                        // NavPower expects counterclockwise winding
+                        // The builders expect counterclockwise winding
                         int32_t const index0 = geometrySection.m_indices[flipWinding ? i + 2 : i];
                         int32_t const index1 = geometrySection.m_indices[i + 1];
                         int32_t const index2 = geometrySection.m_indices[flipWinding ? i : i + 2];
 
                         // Add triangle
-                        auto& buildFace = m_buildFaces.emplace_back( bfx::BuildFace() );
-                        buildFace.m_type = bfx::WALKABLE_FACE;
-
-                        buildFace.m_verts[0] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index0].m_position ) );
-                        buildFace.m_verts[1] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index1].m_position ) );
-                        buildFace.m_verts[2] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index2].m_position ) );
+                        auto& buildTriangle = m_buildTriangles.emplace_back();
+                        buildTriangle.m_vertices[0] = meshTransform.TransformPoint( geometrySection.m_vertices[index0].m_position );
+                        buildTriangle.m_vertices[1] = meshTransform.TransformPoint( geometrySection.m_vertices[index1].m_position );
+                        buildTriangle.m_vertices[2] = meshTransform.TransformPoint( geometrySection.m_vertices[index2].m_position );
                     }
                 }
 
@@ -298,13 +304,46 @@ namespace EE::Navmesh
         Printf( m_progressMessage, 256, "Step 3/4: Building Navmesh" );
         m_progress = 0.0f;
 
-        if ( m_buildFaces.empty() )
+        if ( m_buildTriangles.empty() )
         {
             return true;
         }
 
+        // Native graph
         //-------------------------------------------------------------------------
 
+        NavmeshBuilder builder( m_buildSettings.m_defaultLayerBuildSettings );
+        if ( !builder.Build( m_buildTriangles, navmeshData.m_graph ) )
+        {
+            EE_LOG_ERROR( "Navmesh", "Generation", "Failed to build native navmesh: %s", builder.GetErrorMessage() );
+            return false;
+        }
+
+        NavmeshBuilder::Stats const& stats = builder.GetStats();
+        EE_LOG_MESSAGE( "Navmesh", "Generation", "Native navmesh built: %d x %d cells, %d walkable spans, %d regions (%d islands removed), %d polygons, %d links", stats.m_gridDimensions.m_x, stats.m_gridDimensions.m_y, stats.m_numWalkableSpans, stats.m_numRegions, stats.m_numRemovedIslands, stats.m_numPolygons, stats.m_numLinks );
+
+        if ( !navmeshData.m_graph.IsValid() )
+        {
+            EE_LOG_WARNING( "Navmesh", "Generation", "No walkable surfaces found, the native navmesh is empty!" );
+        }
+
+        m_progress = 0.5f;
+
+        // NavPower graph image
+        //-------------------------------------------------------------------------
+
+        #if EE_ENABLE_NAVPOWER
+        TVector<bfx::BuildFace> buildFaces;
+        buildFaces.reserve( m_buildTriangles.size() );
+        for ( auto const& buildTriangle : m_buildTriangles )
+        {
+            auto& buildFace = buildFaces.emplace_back( bfx::BuildFace() );
+            buildFace.m_type = bfx::WALKABLE_FACE;
+            buildFace.m_verts[0] = ToBfx( buildTriangle.m_vertices[0] );
+            buildFace.m_verts[1] = ToBfx( buildTriangle.m_vertices[1] );
+            buildFace.m_verts[2] = ToBfx( buildTriangle.m_vertices[2] );
+        }
+
         bfx::CustomAllocator* pAllocator = bfx::CreateDLMallocAllocator();
         m_pNavpowerInstance = bfx::SystemCreate( bfx::SystemParams( 2.0f, bfx::Z_UP ), pAllocator );
 
@@ -354,8 +393,8 @@ namespace EE::Navmesh
         bfx::SurfaceNavigationInput surfaceInput;
         surfaceInput.m_globalParams.m_maxNumCores = 16;
 
-        surfaceInput.m_pFaces = m_buildFaces.data();
-        surfaceInput.m_numFaces = (uint32_t) m_buildFaces.size();
+        surfaceInput.m_pFaces = buildFaces.data();
+        surfaceInput.m_numFaces = (uint32_t) buildFaces.size();
         surfaceInput.m_pParams = layerBuildParams.data();
         surfaceInput.m_numParams = (uint32_t) layerBuildParams.size();
 
@@ -386,6 +425,7 @@ namespace EE::Navmesh
         bfx::SystemDestroy( m_pNavpowerInstance );
         bfx::DestroyAllocator( pAllocator );
         m_pNavpowerInstance = nullptr;
+        #endif
 
         return true;
     }
@@ -405,5 +445,4 @@ namespace EE::Navmesh
 
         return false;
     }
-}
-#endif
\ No newline at end of file
+}
\ No newline at end of file
@@ -1,13 +1,16 @@
 #pragma once
-#if EE_ENABLE_NAVPOWER
 
 #include "EngineTools/_Module/API.h"
+#include "EngineTools/Navmesh/NavmeshBuilder.h"
 #include "System/Resource/ResourcePath.h"
 #include "System/FileSystem/FileSystemPath.h"
 #include "System/Math/Transform.h"
 #include "System/Threading/TaskSystem.h"
 #include "System/Types/HashMap.h"
+
+#if EE_ENABLE_NAVPOWER
 #include <bfxBuilder.h>
+#endif
 
 //-------------------------------------------------------------------------
 
@@ -23,11 +26,15 @@ namespace EE::Navmesh
 
     //-------------------------------------------------------------------------
 
-    class NavmeshGenerator : public bfx::BuildProgressMonitor
+    // Generates the native navmesh graph and, if available, the NavPower graph image for a map
+    class NavmeshGenerator
+        #if EE_ENABLE_NAVPOWER
+        : public bfx::BuildProgressMonitor
+        #endif
     {
     public:
 
-        constexpr static uint32_t const s_version = 1;
+        constexpr static uint32_t const s_version = 2;
 
         enum class State
         {
@@ -60,7 +67,9 @@ namespace EE::Navmesh
 
     private:
 
+        #if EE_ENABLE_NAVPOWER
         virtual void BuildProgressUpdate( float percentDone ) override { m_progress = percentDone / 100.0f; }
+        #endif
 
         //-------------------------------------------------------------------------
 
@@ -86,10 +95,12 @@ namespace EE::Navmesh
         NavmeshBuildSettings const&                     m_buildSettings;
         
         // Build transient data
+        #if EE_ENABLE_NAVPOWER
         bfx::Instance*                                  m_pNavpowerInstance = nullptr;
+        #endif
         THashMap<ResourcePath, TVector<CollisionMesh>>  m_collisionPrimitives;
         size_t                                          m_numCollisionPrimitivesToProcess = 0;
-        TVector<bfx::BuildFace>                         m_buildFaces;
+        TVector<NavmeshBuilder::BuildTriangle>          m_buildTriangles;
 
         // Generator state
         char                                            m_progressMessage[256];
@@ -98,6 +109,4 @@ namespace EE::Navmesh
         AsyncTask                                       m_asyncTask;
         bool                                            m_isGeneratingAsync = false;
     };
-}
-
-#endif
\ No newline at end of file
+}
\ No newline at end of file
@@ -34,7 +34,6 @@ namespace EE::Navmesh
         // Update build progress
         //-------------------------------------------------------------------------
 
-        #if EE_ENABLE_NAVPOWER
         if ( m_pGenerator != nullptr )
         {
             auto const state = m_pGenerator->GetState();
@@ -52,7 +51,6 @@ namespace EE::Navmesh
                 EE::Delete( m_pGenerator );
             }
         }
-        #endif
 
         // Dialog pop up
         //-------------------------------------------------------------------------
@@ -69,20 +67,16 @@ namespace EE::Navmesh
             // Generator
             if ( m_pGenerator != nullptr )
             {
-                #if EE_ENABLE_NAVPOWER
                 ImGui::Text( m_pGenerator->GetProgressMessage() );
                 ImGui::ProgressBar( m_pGenerator->GetProgressBarValue(), ImVec2( -1.0f, 0.0f ) );
-                #endif
             }
             else // Build Settings
             {
-                #if EE_ENABLE_NAVPOWER
                 if ( ImGuiX::ColoredButton( ImGuiX::ImColors::Green, ImGuiX::ImColors::White, "Generate", ImVec2( -1, 0 ) ) )
                 {
                     m_pGenerator = EE::New<NavmeshGenerator>( *m_pToolsContext->m_pTypeRegistry, m_pToolsContext->m_pResourceDatabase->GetRawResourceDirectoryPath(), m_navmeshOutputPath, m_entityCollection, m_buildSettings );
                     m_pGenerator->GenerateAsync( *ctx.GetSystem<TaskSystem>() );
                 }
-                #endif
 
                 if ( ImGui::BeginChild( "PG", ImVec2( -1, 0 ) ) )
                 {
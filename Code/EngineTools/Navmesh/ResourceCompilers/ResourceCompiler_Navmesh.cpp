@@ -15,11 +15,7 @@
 namespace EE::Navmesh
 {
     NavmeshCompiler::NavmeshCompiler()
-        #if EE_ENABLE_NAVPOWER
         : Resource::Compiler( "NavmeshCompiler", NavmeshGenerator::s_version )
-        #else
-        : Resource::Compiler( "NavmeshCompiler", 0 )
-        #endif
     {
         m_outputTypes.push_back( NavmeshData::GetStaticResourceTypeID() );
     }
@@ -93,19 +89,21 @@ namespace EE::Navmesh
         // Generate navmesh
         //-------------------------------------------------------------------------
 
-        #if EE_ENABLE_NAVPOWER
         Navmesh::NavmeshGenerator generator( *m_pTypeRegistry, m_rawResourceDirectoryPath, ctx.m_outputFilePath, serializedMap, buildSettings );
 
+        bool generationSucceeded = false;
         {
             ScopedTimer<PlatformClock> timer( elapsedTime );
-            generator.GenerateSync();
+            generationSucceeded = generator.GenerateSync();
+        }
+
+        if ( !generationSucceeded )
+        {
+            return Error( "Navmesh generation failed!" );
         }
 
         Message( "Navmesh built in: %.2fms", elapsedTime.ToFloat() );
 
         return Resource::CompilationResult::Success;
-        #else
-        return Error( "No navmesh middleware present!" );
-        #endif
     }
 }
\ No newline at end of file
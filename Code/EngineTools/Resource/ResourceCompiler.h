@@ -17,6 +17,20 @@ namespace EE::Resource
         SuccessWithWarnings = 1,
     };
 
+    //-------------------------------------------------------------------------
+    // Compiler Worker Protocol
+    //-------------------------------------------------------------------------
+    // The resource compiler can be run as a persistent worker (via the '-worker' arg) that receives requests one line at a time on its stdin
+    // Each request is "<command> <resource path>", the worker then outputs the compilation log followed by the result marker and the result
+
+    namespace CompilerWorkerProtocol
+    {
+        constexpr static char const* const s_compileCommand = "compile";
+        constexpr static char const* const s_packageCommand = "package";
+        constexpr static char const* const s_exitCommand = "exit";
+        constexpr static char const* const s_resultMarker = "@@EE_COMPILATION_RESULT:";
+    }
+
     //-------------------------------------------------------------------------
 
     struct EE_ENGINETOOLS_API CompileContext
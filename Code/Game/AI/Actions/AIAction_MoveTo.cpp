@@ -14,11 +14,7 @@ namespace EE::AI
     // 判断移动到目标点这个动作,是否正在运行中
     bool MoveToAction::IsRunning() const
     {
-        #if EE_ENABLE_NAVPOWER
-        return m_path.IsValid();
-        #else
-        return false;
-        #endif
+        return m_pathRequest.IsValid() || !m_path.empty();
     }
 
     void MoveToAction::Start( BehaviorContext const& ctx, Vector const& goalPosition )
@@ -28,6 +24,16 @@ namespace EE::AI
 
         //-------------------------------------------------------------------------
 
+        m_path.clear();
+        m_currentPathSegmentIdx = InvalidIndex;
+
+        auto pPathRequestService = ctx.m_pNavmeshSystem->GetPathRequestService();
+        if ( m_pathRequest.IsValid() )
+        {
+            pPathRequestService->CancelRequest( m_pathRequest );
+            m_pathRequest.Clear();
+        }
+
         #if EE_ENABLE_NAVPOWER
         auto spaceHandle = ctx.m_pNavmeshSystem->GetSpaceHandle();
 
@@ -39,26 +45,70 @@ namespace EE::AI
         pathOptions.m_forceFirstPosOntoNavGraph = true;
 
         // 基于导航网格的寻路
-        m_path = bfx::CreatePolylinePath( spaceHandle,
+        bfx::PolylinePathRCPtr path = bfx::CreatePolylinePath( spaceHandle,
             Navmesh::ToBfx( ctx.m_pCharacter->GetPosition() ),
             Navmesh::ToBfx( goalPosition ), 0, pathSpec, pathOptions );
-        if ( m_path.IsValid() )
+        if ( path.IsValid() && path.GetNumSegments() > 0 )
+        {
+            m_path.emplace_back( Navmesh::FromBfx( path.GetSurfaceSegment( 0 )->GetStartPos() ) );
+            for ( int32_t i = 0; i < (int32_t) path.GetNumSegments(); i++ )
+            {
+                m_path.emplace_back( Navmesh::FromBfx( path.GetSurfaceSegment( i )->GetEndPos() ) );
+            }
+        }
+
+        // We need at least a single segment to move along
+        if ( m_path.size() >= 2 )
         {
             m_currentPathSegmentIdx = 0;
             m_progressAlongSegment = 0.0f;
         }
         else
         {
-            m_currentPathSegmentIdx = InvalidIndex;
+            m_path.clear();
         }
+        #else
+        // Native paths are found asynchronously, we only start moving once the request completes
+        m_pathRequest = pPathRequestService->RequestPath( ctx.m_pCharacter->GetPosition(), goalPosition );
         #endif
     }
 
+    bool MoveToAction::UpdatePathRequest( BehaviorContext const& ctx )
+    {
+        EE_ASSERT( m_pathRequest.IsValid() );
+
+        Navmesh::PathRequestStatus const status = ctx.m_pNavmeshSystem->GetPathRequestService()->GetRequestResult( m_pathRequest, m_path );
+        if ( status == Navmesh::PathRequestStatus::Pending )
+        {
+            return false;
+        }
+
+        m_pathRequest.Clear();
+
+        // We need at least a single segment to move along
+        if ( status == Navmesh::PathRequestStatus::Succeeded && m_path.size() >= 2 )
+        {
+            m_currentPathSegmentIdx = 0;
+            m_progressAlongSegment = 0.0f;
+        }
+        else
+        {
+            m_path.clear();
+            m_currentPathSegmentIdx = InvalidIndex;
+        }
+
+        return true;
+    }
+
     // 在开启导航的情况下, 需要基于路径行走
     void MoveToAction::Update( BehaviorContext const& ctx )
     {
-        #if EE_ENABLE_NAVPOWER
-        if ( !m_path.IsValid() )
+        if ( m_pathRequest.IsValid() && !UpdatePathRequest( ctx ) )
+        {
+            return;
+        }
+
+        if ( m_path.empty() )
         {
             return;
         }
@@ -73,11 +123,9 @@ namespace EE::AI
         // 获取角色的面向方向
         Vector facingDir = ctx.m_pCharacter->GetForwardVector();
         EE_ASSERT( m_currentPathSegmentIdx != InvalidIndex );
-        // 获取当前路段
-        bfx::SurfaceSegment const* pCurrentSegment = m_path.GetSurfaceSegment( m_currentPathSegmentIdx );
         // 当前路段的起点,终点
-        Vector const currentSegmentStartPos = Navmesh::FromBfx( pCurrentSegment->GetStartPos() );
-        Vector const currentSegmentEndPos = Navmesh::FromBfx( pCurrentSegment->GetEndPos() );
+        Vector const currentSegmentStartPos = m_path[m_currentPathSegmentIdx];
+        Vector const currentSegmentEndPos = m_path[m_currentPathSegmentIdx + 1];
         // 当前位置
         Vector currentPosition;
         if ( !currentSegmentStartPos.IsNearEqual3( currentSegmentEndPos ) )
@@ -102,11 +150,10 @@ namespace EE::AI
         while ( distanceToMove > 0 )
         {
             // 判断当前线段是否为最后一段
-            bool const isLastSegment = m_currentPathSegmentIdx == ( m_path.GetNumSegments() - 1 );
+            bool const isLastSegment = m_currentPathSegmentIdx == ( (int32_t) m_path.size() - 2 );
 
-            bfx::SurfaceSegment const* pSegment = m_path.GetSurfaceSegment( m_currentPathSegmentIdx );
-            Vector segmentStart( Navmesh::FromBfx( pSegment->GetStartPos() ) );
-            Vector segmentEnd( Navmesh::FromBfx( pSegment->GetEndPos() ) );
+            Vector const segmentStart = m_path[m_currentPathSegmentIdx];
+            Vector const segmentEnd = m_path[m_currentPathSegmentIdx + 1];
 
             // Handle zero length segments 特殊处理 0 长度的线段(结束本路段行走)
             Vector const segmentVector( segmentEnd - segmentStart );
@@ -188,8 +235,8 @@ namespace EE::AI
 
         if ( atEndOfPath )
         {
-            m_path.Release();
+            m_path.clear();
+            m_currentPathSegmentIdx = InvalidIndex;
         }
-        #endif
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
-#include "Engine/Navmesh/NavPower.h"
+#include "Engine/Navmesh/NavmeshPathRequestService.h"
 #include "System/Math/Vector.h"
+#include "System/Types/Arrays.h"
 #include "System/Types/Percentage.h"
 
 //-------------------------------------------------------------------------
@@ -23,11 +24,16 @@ namespace EE::AI
 
     private:
 
-        #if EE_ENABLE_NAVPOWER
-        bfx::PolylinePathRCPtr      m_path;
-        #endif
+        // Consume the result of the pending path request, returns false while the request is still pending
+        bool UpdatePathRequest( BehaviorContext const& ctx );
 
-        int32_t                       m_currentPathSegmentIdx = InvalidIndex;
+    private:
+
+        Navmesh::PathRequestHandle  m_pathRequest;
+
+        // The path points, each consecutive pair of points is a path segment
+        TVector<Vector>             m_path;
+        int32_t                     m_currentPathSegmentIdx = InvalidIndex;
         Percentage                  m_progressAlongSegment = 0.0f;
     };
 }
\ No newline at end of file
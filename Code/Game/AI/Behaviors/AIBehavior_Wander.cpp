@@ -32,7 +32,18 @@ namespace EE::AI
             {
                 Vector const boundsMin = navmeshBounds.GetMin();
                 Vector const boundsMax = navmeshBounds.GetMax();
-                Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.m_x, boundsMax.m_x ), Math::GetRandomFloat( boundsMin.m_y, boundsMax.m_y ), navmeshBounds.GetCenter().m_z );
+                Vector moveGoalPosition( Math::GetRandomFloat( boundsMin.m_x, boundsMax.m_x ), Math::GetRandomFloat( boundsMin.m_y, boundsMax.m_y ), navmeshBounds.GetCenter().m_z );
+
+                // Snap the goal onto the navmesh surface, searching the full height of the navmesh
+                if ( ctx.m_pNavmeshSystem->HasNativeNavmesh() )
+                {
+                    Vector const searchExtents( 2.0f, 2.0f, navmeshBounds.GetExtents().m_z + 1.0f );
+                    if ( !ctx.m_pNavmeshSystem->FindNearestPoint( moveGoalPosition, searchExtents, moveGoalPosition ) )
+                    {
+                        m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
+                        return Status::Running;
+                    }
+                }
 
                 m_moveToAction.Start( ctx, moveGoalPosition );
             }
@@ -1,5 +1,6 @@
 #include "DebugView_AI.h"
 #include "Engine/AI/Systems/WorldSystem_AIManager.h"
+#include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntitySystem.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
@@ -20,10 +21,12 @@ namespace EE::AI
     {
         m_pWorld = pWorld;
         m_pAIManager = pWorld->GetWorldSystem<AIManager>();
+        m_pNavmeshSystem = pWorld->GetWorldSystem<Navmesh::NavmeshWorldSystem>();
     }
 
     void AIDebugView::Shutdown()
     {
+        m_pNavmeshSystem = nullptr;
         m_pAIManager = nullptr;
         m_pWorld = nullptr;
     }
@@ -54,6 +57,11 @@ namespace EE::AI
         {
             m_pAIManager->TrySpawnAI( context );
         }
+
+        //-------------------------------------------------------------------------
+
+        ImGuiX::TextSeparator( "Path Requests" );
+        DrawPathRequestStats();
     }
 
     void AIDebugView::DrawOverviewWindow( EntityWorldUpdateContext const& context )
@@ -61,8 +69,28 @@ namespace EE::AI
         if ( ImGui::Begin( "AI Overview", &m_isOverviewWindowOpen ) )
         {
             ImGui::Text( "Num AI: %u", m_pAIManager->m_AIs.size() );
+
+            ImGuiX::TextSeparator( "Path Requests" );
+            DrawPathRequestStats();
         }
         ImGui::End();
     }
+
+    void AIDebugView::DrawPathRequestStats()
+    {
+        Navmesh::PathRequestService* pPathRequestService = m_pNavmeshSystem->GetPathRequestService();
+        Navmesh::PathRequestService::Stats const stats = pPathRequestService->GetStats();
+
+        ImGui::Text( "Pending Requests: %d", stats.m_numPendingRequests );
+        ImGui::Text( "Searches Last Frame: %d (Cache Hits: %d, Carried Over: %d)", stats.m_numSearchesLastFrame, stats.m_numCacheHitsLastFrame, stats.m_numCarriedOverLastFrame );
+        ImGui::Text( "Search Cost Last Frame: %.3fms (Wall-clock: %.3fms)", stats.m_searchCostLastFrame.ToFloat(), stats.m_processingTimeLastFrame.ToFloat() );
+        ImGui::Text( "Queue Latency: P50 %.2fms, P90 %.2fms, P99 %.2fms, Max %.2fms", stats.m_latencyP50.ToFloat(), stats.m_latencyP90.ToFloat(), stats.m_latencyP99.ToFloat(), stats.m_latencyMax.ToFloat() );
+
+        float frameBudget = pPathRequestService->GetFrameBudget().ToFloat();
+        if ( ImGui::SliderFloat( "Frame Budget (ms)", &frameBudget, 0.1f, 16.0f ) )
+        {
+            pPathRequestService->SetFrameBudget( frameBudget );
+        }
+    }
 }
 #endif
\ No newline at end of file
@@ -5,6 +5,10 @@
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
+namespace EE::Navmesh { class NavmeshWorldSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::AI
 {
     class AIManager;
@@ -27,11 +31,13 @@ namespace EE::AI
 
         void DrawMenu( EntityWorldUpdateContext const& context );
         void DrawOverviewWindow( EntityWorldUpdateContext const& context );
+        void DrawPathRequestStats();
 
     private:
 
         EntityWorld const*              m_pWorld = nullptr;
         AIManager*                      m_pAIManager = nullptr;
+        Navmesh::NavmeshWorldSystem*    m_pNavmeshSystem = nullptr;
         bool                            m_isOverviewWindowOpen = false;
     };
 }
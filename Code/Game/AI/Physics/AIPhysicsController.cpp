@@ -9,22 +9,21 @@
 
 namespace EE::AI
 {
-    bool CharacterPhysicsController::TryMoveCapsule( EntityWorldUpdateContext const& ctx, Physics::Scene* pPhysicsScene, Vector const& deltaTranslation, Quaternion const& deltaRotation )
+    void CharacterPhysicsController::AddMoveQueries( EntityWorldUpdateContext const& ctx, Physics::QueryBatch& queryBatch, Vector const& deltaTranslation )
     {
-        Transform capsuleWorldTransform = m_pCharacterComponent->GetCapsuleWorldTransform();
+        Transform const& capsuleWorldTransform = m_pCharacterComponent->GetCapsuleWorldTransform();
 
         // Create sphere to correct Z-position
         //-------------------------------------------------------------------------
 
         float const sphereRadiusReduction = 0.2f;
-        Vector const sphereOrigin = capsuleWorldTransform.GetTranslation();
+        m_sphereOrigin = capsuleWorldTransform.GetTranslation();
 
         // Attempt a sweep from current position to the bottom of the capsule including some "gravity"
         float const verticalDistanceAllowedToTravelThisFrame = ( ctx.GetDeltaTime() * 0.5f );
-        Vector halfHeightVector = Vector( 0, 0, m_pCharacterComponent->GetCapsuleHalfHeight() + sphereRadiusReduction );
-        Vector sweepStartPos = sphereOrigin + deltaTranslation + halfHeightVector;
-        Vector sweepEndPos = sweepStartPos - Vector( 0, 0, ( ( m_pCharacterComponent->GetCapsuleHalfHeight() + sphereRadiusReduction ) * 2 ) + verticalDistanceAllowedToTravelThisFrame );
-        Vector capsuleFinalPosition = sphereOrigin;
+        m_halfHeightVector = Vector( 0, 0, m_pCharacterComponent->GetCapsuleHalfHeight() + sphereRadiusReduction );
+        Vector const sweepStartPos = m_sphereOrigin + deltaTranslation + m_halfHeightVector;
+        m_sweepEndPos = sweepStartPos - Vector( 0, 0, ( ( m_pCharacterComponent->GetCapsuleHalfHeight() + sphereRadiusReduction ) * 2 ) + verticalDistanceAllowedToTravelThisFrame );
 
         #if EE_DEVELOPMENT_TOOLS
         auto drawingContext = ctx.GetDrawingContext();
@@ -38,10 +37,18 @@ namespace EE::AI
         filter.SetLayerMask( Physics::CreateLayerMask( Physics::Layers::Environment ) );
         filter.AddIgnoredEntity( m_pCharacterComponent->GetEntityID() );
 
-        pPhysicsScene->AcquireReadLock();
+        int32_t const filterIdx = queryBatch.AddFilter( filter );
+        m_sweepQueryIdx = queryBatch.AddSphereSweep( m_pCharacterComponent->GetCapsuleRadius(), sweepStartPos, m_sweepEndPos, filterIdx );
+    }
+
+    void CharacterPhysicsController::ApplyMove( EntityWorldUpdateContext const& ctx, Physics::QueryBatch const& queryBatch, Quaternion const& deltaRotation )
+    {
+        EE_ASSERT( m_sweepQueryIdx != InvalidIndex );
+
+        Vector capsuleFinalPosition = m_sphereOrigin;
 
-        Physics::SweepResults sweepResults;
-        if ( pPhysicsScene->SphereSweep( m_pCharacterComponent->GetCapsuleRadius(), sweepStartPos, sweepEndPos, filter, sweepResults ) )
+        Physics::QueryResult const& sweepResults = queryBatch.GetResult( m_sweepQueryIdx );
+        if ( sweepResults.HasBlock() )
         {
             if ( sweepResults.HadInitialOverlap() )
             {
@@ -53,29 +60,28 @@ namespace EE::AI
                 //drawingContext.DrawSphere( sweepResults.GetShapePosition(), Vector( sphereRadius ), Colors::Yellow, 2.0f );
                 #endif
 
-                capsuleFinalPosition = sweepResults.GetShapePosition() + halfHeightVector;
+                capsuleFinalPosition = sweepResults.GetShapePosition() + m_halfHeightVector;
             }
         }
         else
         {
-            capsuleFinalPosition = sweepEndPos + halfHeightVector;
+            capsuleFinalPosition = m_sweepEndPos + m_halfHeightVector;
 
             #if EE_DEVELOPMENT_TOOLS
             //drawingContext.DrawSphere( capsuleFinalPosition, Vector( sphereRadius ), Colors::LimeGreen, 2.0f );
             #endif
         }
 
-        pPhysicsScene->ReleaseReadLock();
+        m_sweepQueryIdx = InvalidIndex;
 
         //-------------------------------------------------------------------------
 
-        Transform finalCapsuleWorldTransform = capsuleWorldTransform;
+        Transform finalCapsuleWorldTransform = m_pCharacterComponent->GetCapsuleWorldTransform();
         finalCapsuleWorldTransform.SetTranslation( capsuleFinalPosition );
 
         // Apply rotation delta and move character
         Transform newCharacterTransform = m_pCharacterComponent->CalculateWorldTransformFromCapsuleTransform( finalCapsuleWorldTransform );
         newCharacterTransform.AddRotation( deltaRotation );
         m_pCharacterComponent->MoveCharacter( ctx.GetDeltaTime(), newCharacterTransform );
-        return true;
     }
 }
\ No newline at end of file
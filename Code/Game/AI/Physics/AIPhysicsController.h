@@ -1,4 +1,5 @@
 #pragma once
+#include "Engine/Physics/PhysicsQueryBatch.h"
 #include "System/Math/Quaternion.h"
 #include "System/Time/Time.h"
 
@@ -26,10 +27,24 @@ namespace EE::AI
             EE_ASSERT( m_pCharacterComponent != nullptr );
         }
 
-        bool TryMoveCapsule( EntityWorldUpdateContext const& ctx, Physics::Scene* pPhysicsScene, Vector const& deltaTranslation, Quaternion const& deltaRotation );
+        // Moves are split in two so that the queries for all characters can be executed as a single batch (see 'AIMovementSystem')
+        //-------------------------------------------------------------------------
+
+        // Add the queries needed to move the capsule by the specified delta to the batch
+        void AddMoveQueries( EntityWorldUpdateContext const& ctx, Physics::QueryBatch& queryBatch, Vector const& deltaTranslation );
+
+        // Move the character based on the results of the executed batch
+        void ApplyMove( EntityWorldUpdateContext const& ctx, Physics::QueryBatch const& queryBatch, Quaternion const& deltaRotation );
 
     public:
 
         Physics::CharacterComponent*        m_pCharacterComponent = nullptr;
+
+    private:
+
+        Vector                              m_sphereOrigin = Vector::Zero;
+        Vector                              m_sweepEndPos = Vector::Zero;
+        Vector                              m_halfHeightVector = Vector::Zero;
+        int32_t                             m_sweepQueryIdx = InvalidIndex;
     };
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "EntitySystem_AIController.h"
+#include "WorldSystem_AIMovement.h"
 #include "Game/AI/Physics/AIPhysicsController.h"
 #include "Game/AI/Animation/AIAnimationController.h"
 #include "Engine/AI/Components/Component_AI.h"
@@ -111,13 +112,6 @@ namespace EE::AI
         TScopedGuardValue const navmeshSystemGuardValue( m_behaviorContext.m_pNavmeshSystem, ctx.GetWorldSystem<Navmesh::NavmeshWorldSystem>() );
         TScopedGuardValue const physicsSystemGuard( m_behaviorContext.m_pPhysicsScene, ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->GetScene() );
 
-        #ifndef EE_ENABLE_NAVPOWER
-        if ( true )
-        {
-            return;
-        }
-        #endif
-
         if ( !m_behaviorContext.IsValid() )
         {
             return;
@@ -130,20 +124,27 @@ namespace EE::AI
         {
             m_behaviorSelector.Update();
 
-            // Update animation and get root motion delta (remember that root motion is in character space, so we need to convert the displacement to world space)
-            m_pAnimGraphComponent->EvaluateGraph( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform(), m_behaviorContext.m_pPhysicsScene );
-            Vector const& deltaTranslation = m_pCharacterMeshComponent->GetWorldTransform().RotateVector( m_pAnimGraphComponent->GetRootMotionDelta().GetTranslation() );
-            Quaternion const& deltaRotation = m_pAnimGraphComponent->GetRootMotionDelta().GetRotation();
-
-            // Move character
-            m_behaviorContext.m_pCharacterController->TryMoveCapsule( ctx, m_behaviorContext.m_pPhysicsScene, deltaTranslation, deltaRotation );
-
-            // Run animation pose tasks
-            m_pAnimGraphComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform() );
+            // Reduced rate LOD tiers skip the graph evaluation on some frames, the animation system interpolates the pose in between
+            // The root motion delta covers all the time since the last evaluation, so we only move the character when we evaluate
+            Seconds evaluationDeltaTime = 0.0f;
+            if ( m_pAnimGraphComponent->UpdateLODSchedule( ctx.GetDeltaTime(), evaluationDeltaTime ) )
+            {
+                // Update animation and get root motion delta (remember that root motion is in character space, so we need to convert the displacement to world space)
+                m_pAnimGraphComponent->EvaluateGraph( evaluationDeltaTime, m_pCharacterMeshComponent->GetWorldTransform(), m_behaviorContext.m_pPhysicsScene );
+                Vector const& deltaTranslation = m_pCharacterMeshComponent->GetWorldTransform().RotateVector( m_pAnimGraphComponent->GetRootMotionDelta().GetTranslation() );
+                Quaternion const& deltaRotation = m_pAnimGraphComponent->GetRootMotionDelta().GetRotation();
+
+                // Queue the character move, the moves of all characters are executed as a single query batch once all entities have been updated
+                // The animation pose tasks are queued once the character has been moved
+                ctx.GetWorldSystem<AIMovementSystem>()->QueueMove( m_behaviorContext.m_pCharacterController, deltaTranslation, deltaRotation, m_pAnimGraphComponent, m_pCharacterMeshComponent );
+            }
         }
         else if ( updateStage == UpdateStage::PostPhysics )
         {
-            m_pAnimGraphComponent->ExecutePostPhysicsTasks();
+            if ( m_pAnimGraphComponent->WasEvaluatedThisFrame() )
+            {
+                m_pAnimGraphComponent->ExecutePostPhysicsTasks();
+            }
         }
         else
         {
@@ -0,0 +1,71 @@
+#include "WorldSystem_AIMovement.h"
+#include "Game/AI/Physics/AIPhysicsController.h"
+#include "Engine/Animation/Systems/WorldSystem_Animation.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
+#include "Engine/Physics/PhysicsScene.h"
+#include "Engine/Render/Components/Component_SkeletalMesh.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::AI
+{
+    void AIMovementSystem::ShutdownSystem()
+    {
+        EE_ASSERT( m_queuedMoves.empty() );
+    }
+
+    WorldSystemDataAccessList const& AIMovementSystem::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( ReadsWorldSystem<Physics::PhysicsWorldSystem>(), WritesComponent<Physics::CharacterComponent>(), WritesWorldSystem<Animation::AnimationWorldSystem>() );
+        return accessList;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AIMovementSystem::QueueMove( CharacterPhysicsController* pCharacterController, Vector const& deltaTranslation, Quaternion const& deltaRotation, Animation::AnimationGraphComponent* pGraphComponent, Render::CharacterMeshComponent* pCharacterMeshComponent )
+    {
+        EE_ASSERT( pCharacterController != nullptr && pGraphComponent != nullptr && pCharacterMeshComponent != nullptr );
+
+        Threading::ScopeLock lock( m_queuedMovesMutex );
+        m_queuedMoves.push_back( { pCharacterController, pGraphComponent, pCharacterMeshComponent, deltaTranslation, deltaRotation } );
+    }
+
+    void AIMovementSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_AI( "AI Character Movement" );
+
+        if ( m_queuedMoves.empty() )
+        {
+            return;
+        }
+
+        // Gather the queries for all characters and execute them as a single batch
+        //-------------------------------------------------------------------------
+
+        Physics::Scene* pPhysicsScene = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->GetScene();
+        Physics::QueryBatch queryBatch( ctx.GetFrameArena(), (uint32_t) m_queuedMoves.size() );
+
+        for ( QueuedMove const& move : m_queuedMoves )
+        {
+            move.m_pCharacterController->AddMoveQueries( ctx, queryBatch, move.m_deltaTranslation );
+        }
+
+        pPhysicsScene->ExecuteQueryBatch( ctx.GetSystem<TaskSystem>(), queryBatch );
+
+        // Move the characters and queue their pose tasks with the moved transforms
+        //-------------------------------------------------------------------------
+
+        auto pAnimationWorldSystem = ctx.GetWorldSystem<Animation::AnimationWorldSystem>();
+        for ( QueuedMove const& move : m_queuedMoves )
+        {
+            move.m_pCharacterController->ApplyMove( ctx, queryBatch, move.m_deltaRotation );
+            pAnimationWorldSystem->QueuePrePhysicsTasks( move.m_pGraphComponent, move.m_pCharacterMeshComponent->GetWorldTransform() );
+        }
+
+        m_queuedMoves.clear();
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "System/Math/Quaternion.h"
+#include "System/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    class AnimationGraphComponent;
+}
+
+namespace EE::Render
+{
+    class CharacterMeshComponent;
+}
+
+//-------------------------------------------------------------------------
+// AI Movement System
+//-------------------------------------------------------------------------
+// The AI controllers queue their root motion moves here during the pre-physics entity update.
+// Once all entities have been updated, the move queries of all characters are executed as a single physics query batch.
+// The characters are then moved and their pre-physics pose tasks are queued with the moved character transforms.
+
+namespace EE::AI
+{
+    class CharacterPhysicsController;
+
+    //-------------------------------------------------------------------------
+
+    class EE_GAME_API AIMovementSystem : public IEntityWorldSystem
+    {
+        struct QueuedMove
+        {
+            CharacterPhysicsController*                     m_pCharacterController = nullptr;
+            Animation::AnimationGraphComponent*             m_pGraphComponent = nullptr;
+            Render::CharacterMeshComponent*                 m_pCharacterMeshComponent = nullptr;
+            Vector                                          m_deltaTranslation;
+            Quaternion                                      m_deltaRotation;
+        };
+
+    public:
+
+        // Note: the update lists are sorted by descending priority value, so this runs before the animation world system executes the queued pose tasks
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( AIMovementSystem, RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Low ) );
+
+        // Queue a character move, the character's pre-physics pose tasks are queued once the move has been applied
+        // This is thread-safe and can be called from entity system updates
+        void QueueMove( CharacterPhysicsController* pCharacterController, Vector const& deltaTranslation, Quaternion const& deltaRotation, Animation::AnimationGraphComponent* pGraphComponent, Render::CharacterMeshComponent* pCharacterMeshComponent );
+
+    private:
+
+        virtual void ShutdownSystem() override final;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final {}
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final {}
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemDataAccessList const& GetDataAccess() const override;
+
+    private:
+
+        Threading::Mutex                                    m_queuedMovesMutex;
+        TVector<QueuedMove>                                 m_queuedMoves;
+    };
+}
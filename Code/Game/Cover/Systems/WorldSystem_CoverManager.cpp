@@ -31,6 +31,12 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccessList const& CoverManager::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare();
+        return accessList;
+    }
+
     void CoverManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
     }
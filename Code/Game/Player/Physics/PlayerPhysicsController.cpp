@@ -19,28 +19,28 @@ namespace EE::Player
 
     //-------------------------------------------------------------------------
 
-    Vector CorrectOverlappingPosition( Physics::SweepResults const& sweepResults )
+    Vector CorrectOverlappingPosition( Physics::QueryResult const& sweepResults )
     {
-        EE_ASSERT( sweepResults.hasBlock && sweepResults.block.hadInitialOverlap() );
+        EE_ASSERT( sweepResults.HadInitialOverlap() );
 
         // Sometime PhysX will detect an initial overlap with 0.0 penetration depth,
         // this is due to the discrepancy between math of the scene query (sweep) and the geo query (use for penetration dept calculation).
         // Read this for more info : 
         // https://gameworksdocs.nvidia.com/PhysX/4.1/documentation/physxguide/Manual/BestPractices.html#character-controller-systems-using-scene-queries-and-penetration-depth-computation
 
-        Vector normal = Physics::FromPx( sweepResults.block.normal );
+        Vector normal = sweepResults.m_hitNormal;
 
-        if( sweepResults.block.distance == 0.0f )
+        if( sweepResults.m_hitDistance == 0.0f )
         {
             // When the distance is 0 the geometry query doesn't detect the penetration
             // and so the base behavior for the sweep is to set the normal as the opposite of the sweep
             // even if the collision is only touching on the side and not blocking.
             // In that case, we should push away from the collision using the collision point !
-            normal = Vector( sweepResults.m_sweepStart - Physics::FromPx( sweepResults.block.position ) ).GetNormalized3();
+            normal = Vector( sweepResults.m_start - sweepResults.m_hitPosition ).GetNormalized3();
         }
 
-        float const penetrationDistance = Math::Abs( sweepResults.block.distance ) + Physics::Scene::s_sweepSeperationDistance;
-        Vector const correctedStartPosition = sweepResults.m_sweepStart + ( normal * penetrationDistance );
+        float const penetrationDistance = Math::Abs( sweepResults.m_hitDistance ) + Physics::Scene::s_sweepSeperationDistance;
+        Vector const correctedStartPosition = sweepResults.m_start + ( normal * penetrationDistance );
         return correctedStartPosition;
     }
 
@@ -71,6 +71,18 @@ namespace EE::Player
         //-------------------------------------------------------------------------
 
         {
+            // All the sweeps for this move share a single filter and query batch
+            Physics::QueryFilter filter;
+            filter.SetLayerMask( m_settings.m_physicsLayerMask );
+            filter.AddIgnoredEntity( m_pCharacterComponent->GetEntityID() );
+            for ( auto const& ignoredActor : m_settings.m_ignoredActors )
+            {
+                filter.AddIgnoredEntity( ignoredActor );
+            }
+
+            m_queryBatch.Reset();
+            m_queryFilterIdx = m_queryBatch.AddFilter( filter );
+
             pPhysicsScene->AcquireReadLock();
             finalCapsuleWorldTransform = SweepCharacterThroughWorld( ctx, pPhysicsScene, capsuleOriginalWorldTransform, deltaTranslation );
             finalCapsuleWorldTransform = ApplyGravity( ctx, pPhysicsScene, finalCapsuleWorldTransform );
@@ -181,7 +193,7 @@ namespace EE::Player
         // Update ground state
         //-------------------------------------------------------------------------
 
-        if ( verticalMoveResult.GetSweepResults().hasBlock )
+        if ( verticalMoveResult.GetSweepResults().m_hasBlock )
         {
             // Collided with a "ceiling"
             if ( verticalAdjustment.m_z > Math::Epsilon )
@@ -193,7 +205,7 @@ namespace EE::Player
             }
             else // Collided with a "floor"
             {
-                Vector const normal = Physics::FromPx( verticalMoveResult.GetSweepResults().block.normal );
+                Vector const normal = verticalMoveResult.GetSweepResults().m_hitNormal;
                 if ( Math::GetAngleBetweenNormalizedVectors( normal, Vector::UnitZ ) < m_settings.m_maxNavigableSlopeAngle )
                 {
                     m_floorType = FloorType::Navigable;
@@ -253,19 +265,14 @@ namespace EE::Player
             onlyApplyDepenetration = true;
         }
 
-        // Initialize query filter
-        Physics::QueryFilter filter;
-        filter.SetLayerMask( m_settings.m_physicsLayerMask );
-        filter.AddIgnoredEntity( m_pCharacterComponent->GetEntityID() );
-        for( auto const& ignoredActor : m_settings.m_ignoredActors )
-        {
-            filter.AddIgnoredEntity( ignoredActor );
-        }
+        int32_t const sweepIdx = m_queryBatch.AddCylinderSweep( cylinderHalfHeight, cylinderRadius, m_pCharacterComponent->GetCapsuleOrientation(), startPosition, moveDirection, distance, m_queryFilterIdx );
+        pPhysicsScene->ExecuteQueryBatch( m_queryBatch );
 
-        Physics::SweepResults sweepResults;
-        if ( pPhysicsScene->CylinderSweep( cylinderHalfHeight, cylinderRadius, m_pCharacterComponent->GetCapsuleOrientation(), startPosition, moveDirection, distance, filter, sweepResults ) )
+        // Copy the result since the batch storage may grow during the recursive sweeps
+        Physics::QueryResult const sweepResults = m_queryBatch.GetResult( sweepIdx );
+        if ( sweepResults.m_hasBlock )
         {
-            if ( sweepResults.hasBlock && sweepResults.block.hadInitialOverlap() )
+            if ( sweepResults.HadInitialOverlap() )
             {
                 Vector const correctedStartPosition = CorrectOverlappingPosition( sweepResults );
 
@@ -289,11 +296,11 @@ namespace EE::Player
                     return moveResult;
                 }
 
-                EE_ASSERT( sweepResults.hasBlock );
+                EE_ASSERT( sweepResults.m_hasBlock );
 
                 float const initialHorizontalSpeed = deltaTranslation.GetLength2();
                 Vector const collisionPosition = sweepResults.GetShapePosition();
-                Vector const normal = Physics::FromPx( sweepResults.block.normal );
+                Vector const normal = sweepResults.m_hitNormal;
 
                 // Collision with the floor
                 Radians const slopeAngle = Math::GetAngleBetweenNormalizedVectors( normal, Vector::UnitZ );
@@ -413,20 +420,15 @@ namespace EE::Player
             float distance = 0.0f;
             deltaTranslation.ToDirectionAndLength3( moveDirection, distance );
 
-            // Initialize query filter
-            Physics::QueryFilter filter;
-            filter.SetLayerMask( m_settings.m_physicsLayerMask );
-            filter.AddIgnoredEntity( m_pCharacterComponent->GetEntityID() );
-            for( auto ignoredActor : m_settings.m_ignoredActors )
-            {
-                filter.AddIgnoredEntity( ignoredActor );
-            }
+            int32_t const sweepIdx = m_queryBatch.AddCapsuleSweep( cylinderHalfHeight, cylinderRadius, m_pCharacterComponent->GetCapsuleOrientation(), startPosition, moveDirection, distance, m_queryFilterIdx );
+            pPhysicsScene->ExecuteQueryBatch( m_queryBatch );
 
-            Physics::SweepResults sweepResults;
-            if( pPhysicsScene->CapsuleSweep( cylinderHalfHeight, cylinderRadius, m_pCharacterComponent->GetCapsuleOrientation(), startPosition, moveDirection, distance, filter, sweepResults ) )
+            // Copy the result since the batch storage may grow during the recursive sweeps
+            Physics::QueryResult const sweepResults = m_queryBatch.GetResult( sweepIdx );
+            if( sweepResults.m_hasBlock )
             {
                 // Initial overlap
-                if( sweepResults.hasBlock && sweepResults.block.hadInitialOverlap() )
+                if( sweepResults.HadInitialOverlap() )
                 {
                     // This should not happen since we swept vertically and resolved collision earlier, but we should handle it just in case I'm proved wrong
                     EE_ASSERT( false ); // this assumption need to be validated
@@ -495,19 +497,14 @@ namespace EE::Player
                 onlyApplyDepenetration = true;
             }
 
-            // Initialize query filter
-            Physics::QueryFilter filter;
-            filter.SetLayerMask( m_settings.m_physicsLayerMask );
-            filter.AddIgnoredEntity( m_pCharacterComponent->GetEntityID() );
-            for( auto IgnoredActor : m_settings.m_ignoredActors )
-            {
-                filter.AddIgnoredEntity( IgnoredActor );
-            }
+            int32_t const sweepIdx = m_queryBatch.AddCapsuleSweep( cylinderHalfHeight, cylinderRadius, m_pCharacterComponent->GetCapsuleOrientation(), startPosition, moveDirection, distance, m_queryFilterIdx );
+            pPhysicsScene->ExecuteQueryBatch( m_queryBatch );
 
-            Physics::SweepResults sweepResults;
-            if( pPhysicsScene->CapsuleSweep( cylinderHalfHeight, cylinderRadius, m_pCharacterComponent->GetCapsuleOrientation(), startPosition, moveDirection, distance, filter, sweepResults ) )
+            // Copy the result since the batch storage may grow during the recursive sweeps
+            Physics::QueryResult const sweepResults = m_queryBatch.GetResult( sweepIdx );
+            if( sweepResults.m_hasBlock )
             {
-                if( sweepResults.hasBlock && sweepResults.block.hadInitialOverlap() )
+                if( sweepResults.HadInitialOverlap() )
                 {
                     // This should not happen since we swept vertically and resolved collision earlier, but we should handle it just in case I'm proved wrong
                     //EE_ASSERT( false ); // this assumption need to be validated
@@ -552,7 +549,7 @@ namespace EE::Player
                     // Check if we collided in the extra floorDetectionDistance at the end of the sweep
                     // and adjust the position has if no collision had happen,
                     // but this will register the floor for the ground state.
-                    float const collisionDistanceWithEndOfRealSweep = sweepResults.block.distance - (distance - g_floorDetectionDistance);
+                    float const collisionDistanceWithEndOfRealSweep = sweepResults.m_hitDistance - (distance - g_floorDetectionDistance);
                     if( collisionDistanceWithEndOfRealSweep >= 0.f )
                     {
                         // Debug drawing
@@ -572,15 +569,16 @@ namespace EE::Player
                         // because of the round shape of the capsule we could detect sharp corner as slope 
                         // and invalidate a step-up move because of that.
 
-                        Vector const collisionPos = Physics::FromPx( sweepResults.block.position );
+                        Vector const collisionPos = sweepResults.m_hitPosition;
                         Vector const SeparationOffset( 0, 0, Physics::Scene::s_sweepSeperationDistance );
 
-                        Physics::RayCastResults rayCastResults;
-                        pPhysicsScene->RayCast( collisionPos + SeparationOffset, collisionPos - SeparationOffset, filter, rayCastResults );
+                        int32_t const rayCastIdx = m_queryBatch.AddRayCast( collisionPos + SeparationOffset, collisionPos - SeparationOffset, m_queryFilterIdx );
+                        pPhysicsScene->ExecuteQueryBatch( m_queryBatch );
 
-                        if( rayCastResults.hasBlock )
+                        Physics::QueryResult const& rayCastResults = m_queryBatch.GetResult( rayCastIdx );
+                        if( rayCastResults.m_hasBlock )
                         {
-                            Vector const rayCastNormal = Physics::FromPx( rayCastResults.block.normal );
+                            Vector const rayCastNormal = rayCastResults.m_hitNormal;
                             Radians const SlopeAngle = Math::GetAngleBetweenNormalizedVectors( rayCastNormal, Vector::UnitZ );
 
                             // Only reproject if the slope angle is not navigable
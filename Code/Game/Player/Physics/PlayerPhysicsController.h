@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntityIDs.h"
-#include "Engine/Physics/PhysicsQuery.h"
+#include "Engine/Physics/PhysicsQueryBatch.h"
 #include "Engine/Physics/PhysicsLayers.h"
 #include "System/Types/Arrays.h"
 #include "System/Time/Timers.h"
@@ -51,19 +51,19 @@ namespace EE::Player
             inline Vector const& GetInitialPosition() const { return m_initialPosition; }
             inline Vector const& GetFinalPosition() const { return m_finalPosition; }
             inline float GetRemainingDistance() const { return m_remainingDistance; }
-            inline Physics::SweepResults const& GetSweepResults() const { return m_sweepResults; }
+            inline Physics::QueryResult const& GetSweepResults() const { return m_sweepResults; }
 
-            inline void FinalizePosition( Physics::SweepResults sweepResults )
+            inline void FinalizePosition( Physics::QueryResult const& sweepResults )
             {
                 m_sweepResults = sweepResults;
-                if( sweepResults.hasBlock )
+                if( sweepResults.m_hasBlock )
                 {
                     m_finalPosition = sweepResults.GetShapePosition();
                     m_remainingDistance = sweepResults.GetRemainingDistance();
                 }
                 else
                 {
-                    m_finalPosition = sweepResults.m_sweepEnd;
+                    m_finalPosition = sweepResults.m_end;
                     m_remainingDistance = 0.0f;
                 }
             }
@@ -87,7 +87,7 @@ namespace EE::Player
             Vector                  m_initialPosition = Vector::Zero;
             Vector                  m_finalPosition = Vector::Zero;
             float                   m_remainingDistance = 0.0f;
-            Physics::SweepResults   m_sweepResults;
+            Physics::QueryResult    m_sweepResults;
         };
 
         #if EE_DEVELOPMENT_TOOLS
@@ -186,6 +186,9 @@ namespace EE::Player
         ManualTimer                         m_timeWithoutFloor;
         float                               m_verticalSpeed = 0.0f;
 
+        Physics::QueryBatch                 m_queryBatch;
+        int32_t                             m_queryFilterIdx = InvalidIndex;
+
         #if EE_DEVELOPMENT_TOOLS
         bool                                m_isInGhostMode = false;
         bool                                m_debug_characterCapsule = false;
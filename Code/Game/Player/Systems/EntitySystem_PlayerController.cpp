@@ -4,6 +4,7 @@
 #include "Game/Player/Camera/PlayerCameraController.h"
 #include "Game/Player/Animation/PlayerAnimationController.h"
 #include "Engine/Animation/Graph/Animation_RuntimeGraph_Controller.h"
+#include "Engine/Animation/Systems/WorldSystem_Animation.h"
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 #include "Engine/Camera/Components/Component_OrbitCamera.h"
@@ -74,6 +75,9 @@ namespace EE::Player
             // We only support one component ATM - animation graph comps are not singletons
             EE_ASSERT( m_pAnimGraphComponent == nullptr );
             m_pAnimGraphComponent = pGraphComponent;
+
+            // The player always needs to be evaluated at full rate
+            m_pAnimGraphComponent->SetLODEnabled( false );
         }
 
         //-------------------------------------------------------------------------
@@ -195,8 +199,8 @@ namespace EE::Player
 
             //-------------------------------------------------------------------------
 
-            // Run animation pose tasks
-            m_pAnimGraphComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform() );
+            // Queue the animation pose tasks, these are executed for all characters in parallel once all entities have been updated
+            ctx.GetWorldSystem<Animation::AnimationWorldSystem>()->QueuePrePhysicsTasks( m_pAnimGraphComponent, m_pCharacterMeshComponent->GetWorldTransform() );
 
             // Update camera position relative to new character position
             m_actionContext.m_pCameraController->FinalizeCamera();
@@ -51,6 +51,12 @@ namespace EE::Player
 
     //-------------------------------------------------------------------------
 
+    WorldSystemDataAccessList const& PlayerInteractionSystem::GetDataAccess() const
+    {
+        static WorldSystemDataAccessList const accessList = WorldSystemDataAccessList::Declare( WritesComponent<MainPlayerComponent>(), ReadsComponent<PlayerInteractibleComponent>() );
+        return accessList;
+    }
+
     void PlayerInteractionSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( !ctx.IsGameWorld() )
@@ -14,6 +14,8 @@ namespace EE::Hash
 
     namespace XXHash
     {
+        constexpr static uint32_t const g_hashSeed = 'EE8';
+
         EE_SYSTEM_API uint32_t GetHash32( void const* pData, size_t size );
 
         EE_FORCE_INLINE uint32_t GetHash32( String const& string )
@@ -49,6 +51,78 @@ namespace EE::Hash
         {
             return GetHash64( data.data(), data.size() );
         }
+
+        //-------------------------------------------------------------------------
+        // Constant expression version of the 32bit hash, this produces the same results as GetHash32 and allows hashes of literals to be calculated at compile time
+
+        namespace Internal
+        {
+            constexpr uint32_t const g_prime32_1 = 0x9E3779B1U;
+            constexpr uint32_t const g_prime32_2 = 0x85EBCA77U;
+            constexpr uint32_t const g_prime32_3 = 0xC2B2AE3DU;
+            constexpr uint32_t const g_prime32_4 = 0x27D4EB2FU;
+            constexpr uint32_t const g_prime32_5 = 0x165667B1U;
+
+            constexpr inline uint32_t RotateLeft32( uint32_t value, uint32_t amount ) { return ( value << amount ) | ( value >> ( 32 - amount ) ); }
+            constexpr inline uint32_t Read32( char const* pData ) { return uint32_t( uint8_t( pData[0] ) ) | ( uint32_t( uint8_t( pData[1] ) ) << 8 ) | ( uint32_t( uint8_t( pData[2] ) ) << 16 ) | ( uint32_t( uint8_t( pData[3] ) ) << 24 ); }
+            constexpr inline uint32_t Round32( uint32_t accumulator, uint32_t input ) { return RotateLeft32( accumulator + input * g_prime32_2, 13 ) * g_prime32_1; }
+        }
+
+        constexpr inline uint32_t GetConstHash32( char const* pData, size_t size )
+        {
+            using namespace Internal;
+
+            char const* const pEnd = pData + size;
+            uint32_t hash = 0;
+
+            if ( size >= 16 )
+            {
+                uint32_t v1 = g_hashSeed + g_prime32_1 + g_prime32_2;
+                uint32_t v2 = g_hashSeed + g_prime32_2;
+                uint32_t v3 = g_hashSeed;
+                uint32_t v4 = g_hashSeed - g_prime32_1;
+
+                char const* const pLimit = pEnd - 16;
+                do
+                {
+                    v1 = Round32( v1, Read32( pData ) );
+                    v2 = Round32( v2, Read32( pData + 4 ) );
+                    v3 = Round32( v3, Read32( pData + 8 ) );
+                    v4 = Round32( v4, Read32( pData + 12 ) );
+                    pData += 16;
+                }
+                while ( pData <= pLimit );
+
+                hash = RotateLeft32( v1, 1 ) + RotateLeft32( v2, 7 ) + RotateLeft32( v3, 12 ) + RotateLeft32( v4, 18 );
+            }
+            else
+            {
+                hash = g_hashSeed + g_prime32_5;
+            }
+
+            hash += uint32_t( size );
+
+            while ( ( pEnd - pData ) >= 4 )
+            {
+                hash += Read32( pData ) * g_prime32_3;
+                hash = RotateLeft32( hash, 17 ) * g_prime32_4;
+                pData += 4;
+            }
+
+            while ( pData < pEnd )
+            {
+                hash += uint32_t( uint8_t( *pData ) ) * g_prime32_5;
+                hash = RotateLeft32( hash, 11 ) * g_prime32_1;
+                pData++;
+            }
+
+            hash ^= hash >> 15;
+            hash *= g_prime32_2;
+            hash ^= hash >> 13;
+            hash *= g_prime32_3;
+            hash ^= hash >> 16;
+            return hash;
+        }
     }
 
     // FNV1a
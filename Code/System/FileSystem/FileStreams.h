@@ -69,5 +69,32 @@ namespace EE
 
             std::ofstream m_filestream;
         };
+
+        //-------------------------------------------------------------------------
+
+        // A read-only view of an entire file mapped into memory, the data is paged in on access by the OS
+        class EE_SYSTEM_API MemoryMappedFile
+        {
+        public:
+
+            MemoryMappedFile() = default;
+            MemoryMappedFile( MemoryMappedFile const& ) = delete;
+            MemoryMappedFile& operator=( MemoryMappedFile const& ) = delete;
+            ~MemoryMappedFile() { Close(); }
+
+            bool Open( Path const& filePath );
+            void Close();
+
+            inline bool IsValid() const { return m_pData != nullptr; }
+            inline uint8_t const* GetData() const { EE_ASSERT( IsValid() ); return m_pData; }
+            inline size_t GetSize() const { return m_size; }
+
+        private:
+
+            void*               m_pFileHandle = nullptr;
+            void*               m_pMappingHandle = nullptr;
+            uint8_t const*      m_pData = nullptr;
+            size_t              m_size = 0;
+        };
     }
 }
\ No newline at end of file
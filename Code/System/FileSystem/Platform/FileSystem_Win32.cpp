@@ -1,5 +1,6 @@
 #ifdef _WIN32
 #include "../FileSystem.h"
+#include "../FileStreams.h"
 #include "System/Platform/PlatformHelpers_Win32.h"
 #include "System/Algorithm/Hash.h"
 #include "System/Math/Math.h"
@@ -192,6 +193,70 @@ namespace EE::FileSystem
         CloseHandle( hFile );
         return true;
     }
+
+    //-------------------------------------------------------------------------
+
+    bool MemoryMappedFile::Open( Path const& filePath )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+        Close();
+
+        HANDLE hFile = CreateFile( filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr );
+        if ( hFile == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSizeLI;
+        if ( !GetFileSizeEx( hFile, &fileSizeLI ) || fileSizeLI.QuadPart == 0 )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        HANDLE hMapping = CreateFileMapping( hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( hMapping == nullptr )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        void* pView = MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+        if ( pView == nullptr )
+        {
+            CloseHandle( hMapping );
+            CloseHandle( hFile );
+            return false;
+        }
+
+        m_pFileHandle = hFile;
+        m_pMappingHandle = hMapping;
+        m_pData = (uint8_t const*) pView;
+        m_size = (size_t) fileSizeLI.QuadPart;
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if ( m_pData != nullptr )
+        {
+            UnmapViewOfFile( m_pData );
+            m_pData = nullptr;
+            m_size = 0;
+        }
+
+        if ( m_pMappingHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pMappingHandle );
+            m_pMappingHandle = nullptr;
+        }
+
+        if ( m_pFileHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pFileHandle );
+            m_pFileHandle = nullptr;
+        }
+    }
 }
 
 #endif
\ No newline at end of file
@@ -1,14 +1,49 @@
 #include "AABBTree.h"
 #include "System/Types/Color.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+#include <EASTL/sort.h>
 
 //-------------------------------------------------------------------------
 
 namespace EE::Math
 {
-    AABBTree::AABBTree()
+    static float GetSurfaceArea( Float3 const& min, Float3 const& max )
     {
+        Float3 const size( max.m_x - min.m_x, max.m_y - min.m_y, max.m_z - min.m_z );
+        return 2.0f * ( size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x );
+    }
+
+    static float GetSurfaceArea( AABB const& box )
+    {
+        Float3 const extents = box.m_extents.ToFloat3();
+        return 8.0f * ( extents.m_x * extents.m_y + extents.m_y * extents.m_z + extents.m_z * extents.m_x );
+    }
+
+    static void GrowMinMax( Float3& min, Float3& max, Float3 const& otherMin, Float3 const& otherMax )
+    {
+        min = Float3( Math::Min( min.m_x, otherMin.m_x ), Math::Min( min.m_y, otherMin.m_y ), Math::Min( min.m_z, otherMin.m_z ) );
+        max = Float3( Math::Max( max.m_x, otherMax.m_x ), Math::Max( max.m_y, otherMax.m_y ), Math::Max( max.m_z, otherMax.m_z ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    AABBTree::AABBTree( float fatMargin )
+        : m_fatMargin( fatMargin )
+    {
+        EE_ASSERT( fatMargin >= 0.0f );
+        m_nodes.resize( 100 );
+    }
+
+    void AABBTree::Clear()
+    {
+        m_nodes.clear();
         m_nodes.resize( 100 );
+        m_rootNodeIdx = InvalidIndex;
+        m_freeNodeIdx = 0;
+        m_leafNodeIndices.clear();
+        m_optimizationCursorIdx = 0;
     }
 
     //-------------------------------------------------------------------------
@@ -62,26 +97,34 @@ namespace EE::Math
         EE_ASSERT( newBox.IsValid() );
 
         // All boxes must have a non-zero unique userdata value as that is also used as the ID
-        auto const Comparator = [] ( Node const& node, uint64_t userData ) { return !node.m_isFree && node.IsLeafNode() && node.m_userData == userData; };
-        EE_ASSERT( userData != 0 && !VectorContains( m_nodes, userData, Comparator ) );
+        EE_ASSERT( userData != 0 && m_leafNodeIndices.find( userData ) == m_leafNodeIndices.end() );
+
+        m_leafNodeIndices[userData] = InsertLeaf( GetFatBox( newBox ), userData );
+    }
+
+    int32_t AABBTree::InsertLeaf( AABB const& fatBox, uint64_t userData )
+    {
+        int32_t leafNodeIdx = InvalidIndex;
 
         // First box
         if ( m_rootNodeIdx == InvalidIndex )
         {
-            RequestNode( newBox, userData );
-            m_rootNodeIdx = 0;
+            leafNodeIdx = RequestNode( fatBox, userData );
+            m_rootNodeIdx = leafNodeIdx;
         }
         // If the root node is a leaf, the new box is a sibling
         else if ( m_nodes[m_rootNodeIdx].IsLeafNode() )
         {
-            InsertNode( m_rootNodeIdx, newBox, userData );
+            leafNodeIdx = InsertNode( m_rootNodeIdx, fatBox, userData );
         }
         else // Find the best leaf node to create a sibling to
         {
-            uint32_t bestNodeIdx = FindBestLeafNodeToCreateSiblingFor( m_rootNodeIdx, newBox );
+            uint32_t bestNodeIdx = FindBestLeafNodeToCreateSiblingFor( m_rootNodeIdx, fatBox );
             EE_ASSERT( bestNodeIdx != InvalidIndex );
-            InsertNode( bestNodeIdx, newBox, userData );
+            leafNodeIdx = InsertNode( bestNodeIdx, fatBox, userData );
         }
+
+        return leafNodeIdx;
     }
 
     void AABBTree::UpdateBranchNodeBounds( int32_t nodeIdx )
@@ -93,7 +136,7 @@ namespace EE::Math
         currentNode.m_volume = currentNode.m_bounds.GetVolume();
     }
 
-    void AABBTree::InsertNode( int32_t originalLeafNodeIdx, AABB const& newSiblingBox, uint64_t userData )
+    int32_t AABBTree::InsertNode( int32_t originalLeafNodeIdx, AABB const& newSiblingBox, uint64_t userData )
     {
         EE_ASSERT( newSiblingBox.IsValid() );
 
@@ -136,21 +179,198 @@ namespace EE::Math
         }
 
         // Propagate changes up the hierarchy
-        int32_t parentIndex = grandparentIdx;
-        while ( parentIndex != InvalidIndex )
-        {
-            UpdateBranchNodeBounds( parentIndex );
-            parentIndex = m_nodes[parentIndex].m_parentNodeIdx;
-        }
+        RefitAncestors( grandparentIdx );
+
+        return newSiblingNodeIdx;
     }
 
     void AABBTree::RemoveBox( uint64_t userData )
     {
-        int32_t const nodeToRemoveIdx = VectorFindIndex( m_nodes, userData, [] ( Node const& node, uint64_t userData ) { return !node.m_isFree && node.IsLeafNode() && node.m_userData == userData; } );
-        EE_ASSERT( nodeToRemoveIdx != InvalidIndex && m_nodes[nodeToRemoveIdx].IsLeafNode() );
+        auto foundIter = m_leafNodeIndices.find( userData );
+        EE_ASSERT( foundIter != m_leafNodeIndices.end() );
+
+        int32_t const nodeToRemoveIdx = foundIter->second;
+        EE_ASSERT( m_nodes[nodeToRemoveIdx].IsLeafNode() && m_nodes[nodeToRemoveIdx].m_userData == userData );
+        m_leafNodeIndices.erase( foundIter );
         RemoveNode( nodeToRemoveIdx );
     }
 
+    bool AABBTree::UpdateBox( AABB const& newBox, uint64_t userData )
+    {
+        EE_ASSERT( newBox.IsValid() );
+
+        auto foundIter = m_leafNodeIndices.find( userData );
+        EE_ASSERT( foundIter != m_leafNodeIndices.end() );
+
+        int32_t const leafNodeIdx = foundIter->second;
+        Node& leafNode = m_nodes[leafNodeIdx];
+        EE_ASSERT( leafNode.IsLeafNode() && leafNode.m_userData == userData );
+
+        // Still within the fat bounds, nothing to do
+        if ( newBox.GetMin().IsGreaterThanEqual3( leafNode.m_bounds.GetMin() ) && newBox.GetMax().IsLessThanEqual3( leafNode.m_bounds.GetMax() ) )
+        {
+            return false;
+        }
+
+        // If the box has moved away from its previous position, refitting will drag the ancestors' bounds across the world so we reinsert it instead
+        if ( !newBox.Overlaps( leafNode.m_bounds ) )
+        {
+            RemoveNode( leafNodeIdx );
+            foundIter->second = InsertLeaf( GetFatBox( newBox ), userData );
+            return true;
+        }
+
+        // Refit in place
+        leafNode.m_bounds = GetFatBox( newBox );
+        leafNode.m_volume = leafNode.m_bounds.GetVolume();
+        RefitAncestors( leafNode.m_parentNodeIdx );
+        return true;
+    }
+
+    void AABBTree::RefitAncestors( int32_t nodeIdx )
+    {
+        while ( nodeIdx != InvalidIndex )
+        {
+            UpdateBranchNodeBounds( nodeIdx );
+            RotateNode( nodeIdx );
+            nodeIdx = m_nodes[nodeIdx].m_parentNodeIdx;
+        }
+    }
+
+    bool AABBTree::RotateNode( int32_t nodeIdx )
+    {
+        Node const& node = m_nodes[nodeIdx];
+        EE_ASSERT( !node.m_isFree && !node.IsLeafNode() );
+
+        int32_t const leftNodeIdx = node.m_leftNodeIdx;
+        int32_t const rightNodeIdx = node.m_rightNodeIdx;
+        Node const& leftNode = m_nodes[leftNodeIdx];
+        Node const& rightNode = m_nodes[rightNodeIdx];
+
+        // Each rotation swaps a child with one of its grandchildren (on the other side), this only changes the bounds of the other child
+        // We pick the rotation that reduces the surface area of that child the most
+        int32_t childToSwapIdx = InvalidIndex;
+        int32_t grandchildToSwapIdx = InvalidIndex;
+        float bestCostDelta = 0.0f;
+
+        if ( !rightNode.IsLeafNode() )
+        {
+            AABB const& rightLeftBounds = m_nodes[rightNode.m_leftNodeIdx].m_bounds;
+            AABB const& rightRightBounds = m_nodes[rightNode.m_rightNodeIdx].m_bounds;
+            float const rightArea = GetSurfaceArea( rightNode.m_bounds );
+
+            // Swap left with right-left
+            float const costDeltaRL = GetSurfaceArea( AABB::GetCombinedBox( leftNode.m_bounds, rightRightBounds ) ) - rightArea;
+            if ( costDeltaRL < bestCostDelta )
+            {
+                childToSwapIdx = leftNodeIdx;
+                grandchildToSwapIdx = rightNode.m_leftNodeIdx;
+                bestCostDelta = costDeltaRL;
+            }
+
+            // Swap left with right-right
+            float const costDeltaRR = GetSurfaceArea( AABB::GetCombinedBox( rightLeftBounds, leftNode.m_bounds ) ) - rightArea;
+            if ( costDeltaRR < bestCostDelta )
+            {
+                childToSwapIdx = leftNodeIdx;
+                grandchildToSwapIdx = rightNode.m_rightNodeIdx;
+                bestCostDelta = costDeltaRR;
+            }
+        }
+
+        if ( !leftNode.IsLeafNode() )
+        {
+            AABB const& leftLeftBounds = m_nodes[leftNode.m_leftNodeIdx].m_bounds;
+            AABB const& leftRightBounds = m_nodes[leftNode.m_rightNodeIdx].m_bounds;
+            float const leftArea = GetSurfaceArea( leftNode.m_bounds );
+
+            // Swap right with left-left
+            float const costDeltaLL = GetSurfaceArea( AABB::GetCombinedBox( rightNode.m_bounds, leftRightBounds ) ) - leftArea;
+            if ( costDeltaLL < bestCostDelta )
+            {
+                childToSwapIdx = rightNodeIdx;
+                grandchildToSwapIdx = leftNode.m_leftNodeIdx;
+                bestCostDelta = costDeltaLL;
+            }
+
+            // Swap right with left-right
+            float const costDeltaLR = GetSurfaceArea( AABB::GetCombinedBox( leftLeftBounds, rightNode.m_bounds ) ) - leftArea;
+            if ( costDeltaLR < bestCostDelta )
+            {
+                childToSwapIdx = rightNodeIdx;
+                grandchildToSwapIdx = leftNode.m_rightNodeIdx;
+                bestCostDelta = costDeltaLR;
+            }
+        }
+
+        if ( childToSwapIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        // Swap the nodes, the bounds of this node are unchanged
+        //-------------------------------------------------------------------------
+
+        int32_t const otherChildIdx = m_nodes[grandchildToSwapIdx].m_parentNodeIdx;
+        EE_ASSERT( otherChildIdx != childToSwapIdx && m_nodes[otherChildIdx].m_parentNodeIdx == nodeIdx );
+
+        Node& nodeToUpdate = m_nodes[nodeIdx];
+        if ( nodeToUpdate.m_leftNodeIdx == childToSwapIdx )
+        {
+            nodeToUpdate.m_leftNodeIdx = grandchildToSwapIdx;
+        }
+        else
+        {
+            nodeToUpdate.m_rightNodeIdx = grandchildToSwapIdx;
+        }
+
+        Node& otherChild = m_nodes[otherChildIdx];
+        if ( otherChild.m_leftNodeIdx == grandchildToSwapIdx )
+        {
+            otherChild.m_leftNodeIdx = childToSwapIdx;
+        }
+        else
+        {
+            otherChild.m_rightNodeIdx = childToSwapIdx;
+        }
+
+        m_nodes[childToSwapIdx].m_parentNodeIdx = otherChildIdx;
+        m_nodes[grandchildToSwapIdx].m_parentNodeIdx = nodeIdx;
+        UpdateBranchNodeBounds( otherChildIdx );
+
+        return true;
+    }
+
+    bool AABBTree::Optimize( int32_t numNodesToVisit )
+    {
+        EE_ASSERT( numNodesToVisit > 0 );
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        bool wasTreeModified = false;
+        int32_t const numNodes = (int32_t) m_nodes.size();
+        int32_t const numNodesToCheck = Math::Min( numNodes, numNodesToVisit * 2 );
+        int32_t numNodesVisited = 0;
+        for ( int32_t i = 0; i < numNodesToCheck && numNodesVisited < numNodesToVisit; i++ )
+        {
+            m_optimizationCursorIdx = ( m_optimizationCursorIdx + 1 ) % numNodes;
+
+            Node const& node = m_nodes[m_optimizationCursorIdx];
+            if ( node.m_isFree || node.IsLeafNode() )
+            {
+                continue;
+            }
+
+            wasTreeModified |= RotateNode( m_optimizationCursorIdx );
+            numNodesVisited++;
+        }
+
+        return wasTreeModified;
+    }
+
     void AABBTree::RemoveNode( int32_t nodeToRemoveIdx )
     {
         // Check if we are the root node
@@ -187,12 +407,7 @@ namespace EE::Math
                 m_nodes[siblingIdx].m_parentNodeIdx = grandparentNodeIdx;
 
                 // Propagate changes up the hierarchy
-                int32_t parentIndex = grandparentNodeIdx;
-                while ( parentIndex != InvalidIndex )
-                {
-                    UpdateBranchNodeBounds( parentIndex );
-                    parentIndex = m_nodes[parentIndex].m_parentNodeIdx;
-                }
+                RefitAncestors( grandparentNodeIdx );
             }
 
             // Release nodes and set free node index
@@ -240,6 +455,355 @@ namespace EE::Math
 
     //-------------------------------------------------------------------------
 
+    void AABBTree::Build( TVector<AABB> const& boxes, TVector<uint64_t> const& userData, TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_FUNCTION();
+        EE_ASSERT( boxes.size() == userData.size() );
+
+        Clear();
+
+        int32_t const numBoxes = (int32_t) boxes.size();
+        if ( numBoxes == 0 )
+        {
+            return;
+        }
+
+        // A binary tree with N leaves has exactly 2N-1 nodes, so we can lay out the nodes depth-first without any allocations during the build
+        // A node's left subtree starts directly after it and its right subtree starts after the 2L-1 nodes of the left subtree
+        int32_t const numNodes = 2 * numBoxes - 1;
+        m_nodes.clear();
+        m_nodes.resize( Math::Max( 100, Math::FloorToInt( numNodes * 1.25f ) ) );
+        m_rootNodeIdx = 0;
+        m_freeNodeIdx = numNodes;
+
+        TVector<BuildPrimitive> primitives;
+        primitives.resize( numBoxes );
+        for ( int32_t i = 0; i < numBoxes; i++ )
+        {
+            EE_ASSERT( boxes[i].IsValid() && userData[i] != 0 );
+            AABB const fatBox = GetFatBox( boxes[i] );
+            primitives[i].m_min = fatBox.GetMin().ToFloat3();
+            primitives[i].m_max = fatBox.GetMax().ToFloat3();
+            primitives[i].m_centroid = fatBox.m_center.ToFloat3();
+            primitives[i].m_userData = userData[i];
+        }
+
+        // Split the top levels of the tree serially until we have enough independent subtrees to distribute across the workers
+        //-------------------------------------------------------------------------
+
+        struct BuildRange
+        {
+            int32_t     m_startIdx;
+            int32_t     m_endIdx;
+            int32_t     m_nodeIdx;
+            int32_t     m_parentNodeIdx;
+        };
+
+        constexpr static int32_t const s_minPrimitivesPerTask = 1024;
+        uint32_t const numThreads = ( pTaskSystem != nullptr ) ? pTaskSystem->GetNumThreads() : 1;
+        size_t const targetNumRanges = ( numThreads > 1 ) ? numThreads * 4 : 1;
+
+        TVector<BuildRange> ranges;
+        TVector<int32_t> serialBranchNodes;
+        ranges.push_back( { 0, numBoxes, 0, InvalidIndex } );
+
+        while ( ranges.size() < targetNumRanges )
+        {
+            // Split the largest range
+            int32_t largestRangeIdx = 0;
+            for ( int32_t i = 1; i < (int32_t) ranges.size(); i++ )
+            {
+                if ( ( ranges[i].m_endIdx - ranges[i].m_startIdx ) > ( ranges[largestRangeIdx].m_endIdx - ranges[largestRangeIdx].m_startIdx ) )
+                {
+                    largestRangeIdx = i;
+                }
+            }
+
+            BuildRange const range = ranges[largestRangeIdx];
+            if ( ( range.m_endIdx - range.m_startIdx ) < s_minPrimitivesPerTask )
+            {
+                break;
+            }
+
+            int32_t const splitIdx = PartitionPrimitives( primitives, range.m_startIdx, range.m_endIdx );
+            int32_t const leftNodeIdx = range.m_nodeIdx + 1;
+            int32_t const rightNodeIdx = range.m_nodeIdx + 2 * ( splitIdx - range.m_startIdx );
+
+            // The bounds are set once the subtrees are built
+            CreateBuildNode( range.m_nodeIdx, range.m_parentNodeIdx, Float3::Zero, Float3::Zero, 0 );
+            m_nodes[range.m_nodeIdx].m_leftNodeIdx = leftNodeIdx;
+            m_nodes[range.m_nodeIdx].m_rightNodeIdx = rightNodeIdx;
+            serialBranchNodes.emplace_back( range.m_nodeIdx );
+
+            ranges[largestRangeIdx] = { range.m_startIdx, splitIdx, leftNodeIdx, range.m_nodeIdx };
+            ranges.push_back( { splitIdx, range.m_endIdx, rightNodeIdx, range.m_nodeIdx } );
+        }
+
+        // Build the subtrees
+        //-------------------------------------------------------------------------
+
+        if ( ranges.size() == 1 )
+        {
+            BuildSubtree( primitives, 0, numBoxes, 0, InvalidIndex );
+        }
+        else
+        {
+            struct SubtreeBuildTask final : public ITaskSet
+            {
+                SubtreeBuildTask( AABBTree* pTree, TVector<BuildPrimitive>& primitives, TVector<BuildRange> const& ranges )
+                    : m_pTree( pTree )
+                    , m_primitives( primitives )
+                    , m_ranges( ranges )
+                {
+                    m_SetSize = (uint32_t) ranges.size();
+                    m_MinRange = 1;
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    EE_PROFILE_SCOPE( "Build AABB Subtrees" );
+
+                    // Each range writes to its own section of the primitive and node arrays so no synchronization is needed
+                    for ( uint32_t i = range.start; i < range.end; i++ )
+                    {
+                        BuildRange const& buildRange = m_ranges[i];
+                        m_pTree->BuildSubtree( m_primitives, buildRange.m_startIdx, buildRange.m_endIdx, buildRange.m_nodeIdx, buildRange.m_parentNodeIdx );
+                    }
+                }
+
+            private:
+
+                AABBTree*                       m_pTree = nullptr;
+                TVector<BuildPrimitive>&        m_primitives;
+                TVector<BuildRange> const&      m_ranges;
+            };
+
+            SubtreeBuildTask buildTask( this, primitives, ranges );
+            pTaskSystem->ScheduleTask( &buildTask );
+            pTaskSystem->WaitForTask( &buildTask );
+
+            // Children always have a higher index than their parents, so we can update the bounds in reverse order
+            for ( int32_t i = (int32_t) serialBranchNodes.size() - 1; i >= 0; i-- )
+            {
+                UpdateBranchNodeBounds( serialBranchNodes[i] );
+            }
+        }
+
+        // Create the leaf lookup
+        //-------------------------------------------------------------------------
+
+        m_leafNodeIndices.reserve( numBoxes );
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            if ( m_nodes[i].IsLeafNode() )
+            {
+                EE_ASSERT( m_leafNodeIndices.find( m_nodes[i].m_userData ) == m_leafNodeIndices.end() );
+                m_leafNodeIndices[m_nodes[i].m_userData] = i;
+            }
+        }
+    }
+
+    void AABBTree::CreateBuildNode( int32_t nodeIdx, int32_t parentNodeIdx, Float3 const& min, Float3 const& max, uint64_t userData )
+    {
+        AABB bounds;
+        bounds.SetFromMinMax( Vector( min ), Vector( max ) );
+
+        Node& node = m_nodes[nodeIdx];
+        new ( &node ) Node( bounds, userData );
+        node.m_parentNodeIdx = parentNodeIdx;
+        node.m_isFree = false;
+    }
+
+    void AABBTree::BuildSubtree( TVector<BuildPrimitive>& primitives, int32_t startIdx, int32_t endIdx, int32_t nodeIdx, int32_t parentNodeIdx )
+    {
+        EE_ASSERT( endIdx > startIdx );
+
+        if ( ( endIdx - startIdx ) == 1 )
+        {
+            BuildPrimitive const& primitive = primitives[startIdx];
+            CreateBuildNode( nodeIdx, parentNodeIdx, primitive.m_min, primitive.m_max, primitive.m_userData );
+            return;
+        }
+
+        // Calculate the bounds for this node
+        Float3 min = primitives[startIdx].m_min;
+        Float3 max = primitives[startIdx].m_max;
+        for ( int32_t i = startIdx + 1; i < endIdx; i++ )
+        {
+            GrowMinMax( min, max, primitives[i].m_min, primitives[i].m_max );
+        }
+
+        CreateBuildNode( nodeIdx, parentNodeIdx, min, max, 0 );
+
+        int32_t const splitIdx = PartitionPrimitives( primitives, startIdx, endIdx );
+        int32_t const leftNodeIdx = nodeIdx + 1;
+        int32_t const rightNodeIdx = nodeIdx + 2 * ( splitIdx - startIdx );
+        m_nodes[nodeIdx].m_leftNodeIdx = leftNodeIdx;
+        m_nodes[nodeIdx].m_rightNodeIdx = rightNodeIdx;
+
+        BuildSubtree( primitives, startIdx, splitIdx, leftNodeIdx, nodeIdx );
+        BuildSubtree( primitives, splitIdx, endIdx, rightNodeIdx, nodeIdx );
+    }
+
+    int32_t AABBTree::PartitionPrimitives( TVector<BuildPrimitive>& primitives, int32_t startIdx, int32_t endIdx )
+    {
+        int32_t const numPrimitives = endIdx - startIdx;
+        EE_ASSERT( numPrimitives > 1 );
+        int32_t const medianIdx = startIdx + numPrimitives / 2;
+
+        // Split along the axis with the largest centroid spread
+        //-------------------------------------------------------------------------
+
+        Float3 centroidMin = primitives[startIdx].m_centroid;
+        Float3 centroidMax = primitives[startIdx].m_centroid;
+        for ( int32_t i = startIdx + 1; i < endIdx; i++ )
+        {
+            GrowMinMax( centroidMin, centroidMax, primitives[i].m_centroid, primitives[i].m_centroid );
+        }
+
+        Float3 const centroidSpread( centroidMax.m_x - centroidMin.m_x, centroidMax.m_y - centroidMin.m_y, centroidMax.m_z - centroidMin.m_z );
+        uint32_t axis = ( centroidSpread.m_x > centroidSpread.m_y ) ? 0 : 1;
+        axis = ( centroidSpread.m_z > centroidSpread[axis] ) ? 2 : axis;
+
+        // All centroids are at the same position, just split the range in half
+        if ( centroidSpread[axis] <= Math::Epsilon )
+        {
+            return medianIdx;
+        }
+
+        // Bin the primitives
+        //-------------------------------------------------------------------------
+
+        constexpr static int32_t const s_numBins = 16;
+
+        struct Bin
+        {
+            Float3      m_min = Float3( FLT_MAX );
+            Float3      m_max = Float3( -FLT_MAX );
+            int32_t     m_count = 0;
+        };
+
+        Bin bins[s_numBins];
+        float const binScale = s_numBins / centroidSpread[axis];
+        auto GetBinIdx = [&] ( BuildPrimitive const& primitive ) { return Math::Min( (int32_t) ( ( primitive.m_centroid[axis] - centroidMin[axis] ) * binScale ), s_numBins - 1 ); };
+
+        for ( int32_t i = startIdx; i < endIdx; i++ )
+        {
+            Bin& bin = bins[GetBinIdx( primitives[i] )];
+            GrowMinMax( bin.m_min, bin.m_max, primitives[i].m_min, primitives[i].m_max );
+            bin.m_count++;
+        }
+
+        // Find the split with the lowest SAH cost, i.e. the sum of each side's surface area weighted by its primitive count
+        //-------------------------------------------------------------------------
+
+        float rightAreas[s_numBins];
+        int32_t rightCounts[s_numBins];
+        {
+            Float3 min( FLT_MAX ), max( -FLT_MAX );
+            int32_t count = 0;
+            for ( int32_t i = s_numBins - 1; i > 0; i-- )
+            {
+                if ( bins[i].m_count > 0 )
+                {
+                    GrowMinMax( min, max, bins[i].m_min, bins[i].m_max );
+                    count += bins[i].m_count;
+                }
+
+                rightAreas[i] = ( count > 0 ) ? GetSurfaceArea( min, max ) : 0.0f;
+                rightCounts[i] = count;
+            }
+        }
+
+        int32_t bestSplitBinIdx = InvalidIndex;
+        float bestCost = FLT_MAX;
+        {
+            Float3 min( FLT_MAX ), max( -FLT_MAX );
+            int32_t count = 0;
+            for ( int32_t i = 0; i < s_numBins - 1; i++ )
+            {
+                if ( bins[i].m_count > 0 )
+                {
+                    GrowMinMax( min, max, bins[i].m_min, bins[i].m_max );
+                    count += bins[i].m_count;
+                }
+
+                // The split is between bin i and i + 1
+                if ( count == 0 || rightCounts[i + 1] == 0 )
+                {
+                    continue;
+                }
+
+                float const cost = GetSurfaceArea( min, max ) * count + rightAreas[i + 1] * rightCounts[i + 1];
+                if ( cost < bestCost )
+                {
+                    bestCost = cost;
+                    bestSplitBinIdx = i;
+                }
+            }
+        }
+
+        // Partition
+        //-------------------------------------------------------------------------
+
+        if ( bestSplitBinIdx != InvalidIndex )
+        {
+            int32_t leftIdx = startIdx;
+            int32_t rightIdx = endIdx - 1;
+            while ( leftIdx <= rightIdx )
+            {
+                if ( GetBinIdx( primitives[leftIdx] ) <= bestSplitBinIdx )
+                {
+                    leftIdx++;
+                }
+                else
+                {
+                    eastl::swap( primitives[leftIdx], primitives[rightIdx] );
+                    rightIdx--;
+                }
+            }
+
+            if ( leftIdx > startIdx && leftIdx < endIdx )
+            {
+                return leftIdx;
+            }
+        }
+
+        // Fallback to a median split if binning failed to separate the primitives
+        auto Comparator = [axis] ( BuildPrimitive const& a, BuildPrimitive const& b ) { return a.m_centroid[axis] < b.m_centroid[axis]; };
+        eastl::nth_element( primitives.begin() + startIdx, primitives.begin() + medianIdx, primitives.begin() + endIdx, Comparator );
+        return medianIdx;
+    }
+
+    //-------------------------------------------------------------------------
+
+    float AABBTree::CalculateSAHCost() const
+    {
+        if ( m_rootNodeIdx == InvalidIndex || m_nodes[m_rootNodeIdx].IsLeafNode() )
+        {
+            return 0.0f;
+        }
+
+        float const rootArea = GetSurfaceArea( m_nodes[m_rootNodeIdx].m_bounds );
+        if ( rootArea <= 0.0f )
+        {
+            return 0.0f;
+        }
+
+        float totalBranchArea = 0.0f;
+        for ( auto const& node : m_nodes )
+        {
+            if ( !node.m_isFree && !node.IsLeafNode() )
+            {
+                totalBranchArea += GetSurfaceArea( node.m_bounds );
+            }
+        }
+
+        return totalBranchArea / rootArea;
+    }
+
+    //-------------------------------------------------------------------------
+
     void AABBTree::FindAllOverlappingLeafNodes( int32_t currentNodeIdx, AABB const& queryBox, TVector<uint64_t>& outResults ) const
     {
         Node const& currentNode = m_nodes[currentNodeIdx];
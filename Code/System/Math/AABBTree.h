@@ -2,17 +2,40 @@
 
 #include "System/Math/BoundingVolumes.h"
 #include "System/Types/Arrays.h"
+#include "System/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
 namespace EE::Drawing { class DrawContext; }
 
 //-------------------------------------------------------------------------
 
+//-------------------------------------------------------------------------
+// AABB Tree
+//-------------------------------------------------------------------------
+// A binary tree of boxes, each leaf is identified by a unique non-zero user data value
+//
+// Leaves can optionally store "fat" bounds (the box grown by a margin), this allows small movements to be absorbed without touching the tree
+// Note: With a margin set, queries return all the leaves whose fat bounds overlap so callers needing exact results need to do their own tests
+//
+// Trees can be built incrementally (insert/remove/update) or in bulk from a full set of boxes
+// Incremental changes apply local tree rotations as they refit the tree and 'Optimize' can be called periodically to further improve the tree quality
+
 namespace EE::Math
 {
     class EE_SYSTEM_API AABBTree
     {
+        friend class CullingBVH;
+
+        struct BuildPrimitive
+        {
+            Float3          m_min;
+            Float3          m_max;
+            Float3          m_centroid;
+            uint64_t        m_userData = 0;
+        };
+
         struct Node
         {
         public:
@@ -38,15 +61,30 @@ namespace EE::Math
 
     public:
 
-        AABBTree();
+        AABBTree( float fatMargin = 0.0f );
 
         inline bool IsEmpty() const { return m_rootNodeIdx == InvalidIndex; }
+        inline int32_t GetNumLeaves() const { return (int32_t) m_leafNodeIndices.size(); }
+        inline float GetFatMargin() const { return m_fatMargin; }
+
+        // Build the tree from a full set of boxes using a binned SAH build, this will discard any existing data
+        // If a task system is supplied, the subtrees will be built in parallel
+        void Build( TVector<AABB> const& boxes, TVector<uint64_t> const& userData, TaskSystem* pTaskSystem = nullptr );
+        void Clear();
 
         void InsertBox( AABB const& aabb, uint64_t userData );
         void RemoveBox( uint64_t userData );
 
-        EE_FORCE_INLINE void InsertBox( AABB const& aabb, void* pUserData ) { InsertBox( aabb, reinterpret_cast<uint64_t>( pUserData ) ); }
-        EE_FORCE_INLINE void RemoveBox( void* pUserData ) { RemoveBox( reinterpret_cast<uint64_t>( pUserData ) ); }
+        // Update the bounds of an existing box, returns true if the tree was modified
+        // Boxes that are still within their fat bounds are ignored, boxes that moved slightly are refit in place and boxes that teleported are reinserted
+        bool UpdateBox( AABB const& aabb, uint64_t userData );
+
+        // Incrementally improve the tree quality by trying to rotate the next N branch nodes, returns true if the tree was modified
+        bool Optimize( int32_t numNodesToVisit );
+
+        EE_FORCE_INLINE void InsertBox( AABB const& aabb, void const* pUserData ) { InsertBox( aabb, reinterpret_cast<uint64_t>( pUserData ) ); }
+        EE_FORCE_INLINE void RemoveBox( void const* pUserData ) { RemoveBox( reinterpret_cast<uint64_t>( pUserData ) ); }
+        EE_FORCE_INLINE bool UpdateBox( AABB const& aabb, void const* pUserData ) { return UpdateBox( aabb, reinterpret_cast<uint64_t>( pUserData ) ); }
 
         bool FindOverlaps( AABB const& queryBox, TVector<uint64_t>& outResults ) const;
 
@@ -56,16 +94,33 @@ namespace EE::Math
             return FindOverlaps( queryBox, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
         }
 
+        // Get the SAH cost of the tree, i.e. the sum of the branch node surface areas relative to the root surface area. Lower is better.
+        float CalculateSAHCost() const;
+
         #if EE_DEVELOPMENT_TOOLS
         void DrawDebug( Drawing::DrawContext& drawingContext ) const;
         #endif
 
     private:
 
-        void InsertNode( int32_t leafNodeIdx, AABB const& newSiblingBox, uint64_t userData );
+        inline AABB GetFatBox( AABB const& box ) const { return AABB( box.m_center, box.m_extents + Vector( m_fatMargin ) ); }
+
+        int32_t InsertLeaf( AABB const& fatBox, uint64_t userData );
+        int32_t InsertNode( int32_t leafNodeIdx, AABB const& newSiblingBox, uint64_t userData );
         void RemoveNode( int32_t nodeToRemoveIdx );
         void UpdateBranchNodeBounds( int32_t nodeIdx );
 
+        // Update the bounds of the specified node and all its ancestors, rotating each node along the way
+        void RefitAncestors( int32_t nodeIdx );
+
+        // Try to swap a child of the specified node with one of its grandchildren to reduce the surface area of the tree, returns true if the tree was modified
+        bool RotateNode( int32_t nodeIdx );
+
+        // Bulk build
+        void BuildSubtree( TVector<BuildPrimitive>& primitives, int32_t startIdx, int32_t endIdx, int32_t nodeIdx, int32_t parentNodeIdx );
+        void CreateBuildNode( int32_t nodeIdx, int32_t parentNodeIdx, Float3 const& min, Float3 const& max, uint64_t userData );
+        static int32_t PartitionPrimitives( TVector<BuildPrimitive>& primitives, int32_t startIdx, int32_t endIdx );
+
         int32_t RequestNode( AABB const& box, uint64_t userData = 0 );
         void ReleaseNode( int32_t nodeIdx );
 
@@ -80,9 +135,12 @@ namespace EE::Math
 
     private:
 
-        TVector<Node>       m_nodes;
-        int32_t               m_rootNodeIdx = InvalidIndex;
-        int32_t               m_freeNodeIdx = 0;
+        TVector<Node>                   m_nodes;
+        int32_t                         m_rootNodeIdx = InvalidIndex;
+        int32_t                         m_freeNodeIdx = 0;
+        THashMap<uint64_t, int32_t>     m_leafNodeIndices;              // User data to leaf node lookup
+        float                           m_fatMargin = 0.0f;
+        int32_t                         m_optimizationCursorIdx = 0;    // The next node to try to rotate when optimizing
     };
 }
 
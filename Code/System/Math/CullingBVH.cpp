@@ -0,0 +1,346 @@
+#include "CullingBVH.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Math
+{
+    void CullingBVH::Clear()
+    {
+        m_nodes.clear();
+        m_leafUserData.clear();
+    }
+
+    void CullingBVH::Build( AABBTree const& tree )
+    {
+        Clear();
+
+        if ( tree.IsEmpty() )
+        {
+            return;
+        }
+
+        CreateNode( tree, tree.m_rootNodeIdx );
+    }
+
+    int32_t CullingBVH::CreateNode( AABBTree const& tree, int32_t treeNodeIdx )
+    {
+        auto const& treeNode = tree.m_nodes[treeNodeIdx];
+
+        // Collapse the binary tree by repeatedly opening the largest branch child until all slots are filled
+        //-------------------------------------------------------------------------
+
+        TInlineVector<int32_t, s_numNodeChildren> treeChildren;
+        if ( treeNode.IsLeafNode() )
+        {
+            // This only happens for a tree with a single leaf
+            treeChildren.emplace_back( treeNodeIdx );
+        }
+        else
+        {
+            treeChildren.emplace_back( treeNode.m_leftNodeIdx );
+            treeChildren.emplace_back( treeNode.m_rightNodeIdx );
+
+            while ( treeChildren.size() < s_numNodeChildren )
+            {
+                int32_t largestBranchIdx = InvalidIndex;
+                float largestBranchVolume = -1.0f;
+                for ( int32_t i = 0; i < (int32_t) treeChildren.size(); i++ )
+                {
+                    auto const& childTreeNode = tree.m_nodes[treeChildren[i]];
+                    if ( !childTreeNode.IsLeafNode() && childTreeNode.m_volume > largestBranchVolume )
+                    {
+                        largestBranchIdx = i;
+                        largestBranchVolume = childTreeNode.m_volume;
+                    }
+                }
+
+                if ( largestBranchIdx == InvalidIndex )
+                {
+                    break;
+                }
+
+                auto const& branchToOpen = tree.m_nodes[treeChildren[largestBranchIdx]];
+                treeChildren[largestBranchIdx] = branchToOpen.m_leftNodeIdx;
+                treeChildren.emplace_back( branchToOpen.m_rightNodeIdx );
+            }
+        }
+
+        // Create the node
+        //-------------------------------------------------------------------------
+        // Leaves are added in depth-first order, so all the leaves for this node are contiguous
+
+        int32_t const nodeIdx = (int32_t) m_nodes.size();
+        m_nodes.emplace_back();
+        m_nodes[nodeIdx].m_firstLeafIdx = (uint32_t) m_leafUserData.size();
+        m_nodes[nodeIdx].m_numChildren = (uint32_t) treeChildren.size();
+
+        for ( int32_t i = 0; i < s_numNodeChildren; i++ )
+        {
+            if ( i >= (int32_t) treeChildren.size() )
+            {
+                SetChildBounds( nodeIdx, i, AABB( Vector::Zero ) );
+                m_nodes[nodeIdx].m_children[i] = InvalidIndex;
+                continue;
+            }
+
+            auto const& childTreeNode = tree.m_nodes[treeChildren[i]];
+            SetChildBounds( nodeIdx, i, childTreeNode.m_bounds );
+
+            if ( childTreeNode.IsLeafNode() )
+            {
+                EE_ASSERT( childTreeNode.m_userData != 0 );
+                m_nodes[nodeIdx].m_children[i] = ~(int32_t) m_leafUserData.size();
+                m_leafUserData.emplace_back( childTreeNode.m_userData );
+            }
+            else
+            {
+                // Do not hold a reference to our node here, since the node array will grow
+                int32_t const childNodeIdx = CreateNode( tree, treeChildren[i] );
+                m_nodes[nodeIdx].m_children[i] = childNodeIdx;
+            }
+        }
+
+        m_nodes[nodeIdx].m_numLeaves = (uint32_t) m_leafUserData.size() - m_nodes[nodeIdx].m_firstLeafIdx;
+        return nodeIdx;
+    }
+
+    void CullingBVH::SetChildBounds( int32_t nodeIdx, int32_t childSlotIdx, AABB const& bounds )
+    {
+        Float3 const min = bounds.GetMin().ToFloat3();
+        Float3 const max = bounds.GetMax().ToFloat3();
+
+        Node& node = m_nodes[nodeIdx];
+        node.m_minX[childSlotIdx] = min.m_x;
+        node.m_minY[childSlotIdx] = min.m_y;
+        node.m_minZ[childSlotIdx] = min.m_z;
+        node.m_maxX[childSlotIdx] = max.m_x;
+        node.m_maxY[childSlotIdx] = max.m_y;
+        node.m_maxZ[childSlotIdx] = max.m_z;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CullingBVH::Frustum CullingBVH::CreateFrustum( ViewVolume const& viewVolume )
+    {
+        Frustum frustum;
+        for ( uint32_t i = 0; i < 6; i++ )
+        {
+            Float4 const plane = viewVolume.GetViewPlane( i ).ToFloat4();
+            frustum.m_planeA[i] = _mm_set1_ps( plane.m_x );
+            frustum.m_planeB[i] = _mm_set1_ps( plane.m_y );
+            frustum.m_planeC[i] = _mm_set1_ps( plane.m_z );
+            frustum.m_planeD[i] = _mm_set1_ps( plane.m_w );
+            frustum.m_isPositiveA[i] = plane.m_x >= 0.0f;
+            frustum.m_isPositiveB[i] = plane.m_y >= 0.0f;
+            frustum.m_isPositiveC[i] = plane.m_z >= 0.0f;
+        }
+
+        return frustum;
+    }
+
+    void CullingBVH::TestNodeChildren( Node const& node, Frustum const& frustum, int32_t& outVisibleMask, int32_t& outFullyInsideMask )
+    {
+        __m128 const minX = _mm_load_ps( node.m_minX );
+        __m128 const minY = _mm_load_ps( node.m_minY );
+        __m128 const minZ = _mm_load_ps( node.m_minZ );
+        __m128 const maxX = _mm_load_ps( node.m_maxX );
+        __m128 const maxY = _mm_load_ps( node.m_maxY );
+        __m128 const maxZ = _mm_load_ps( node.m_maxZ );
+        __m128 const zero = _mm_setzero_ps();
+
+        // The view planes point inwards, so a box is outside a plane if its corner furthest along the plane normal is behind it
+        // A box is fully inside the frustum only if its corner furthest against each plane normal is in front of all planes
+        __m128 isOutside = zero;
+        __m128 isIntersecting = zero;
+        for ( uint32_t i = 0; i < 6; i++ )
+        {
+            __m128 const positiveX = frustum.m_isPositiveA[i] ? maxX : minX;
+            __m128 const positiveY = frustum.m_isPositiveB[i] ? maxY : minY;
+            __m128 const positiveZ = frustum.m_isPositiveC[i] ? maxZ : minZ;
+            __m128 const negativeX = frustum.m_isPositiveA[i] ? minX : maxX;
+            __m128 const negativeY = frustum.m_isPositiveB[i] ? minY : maxY;
+            __m128 const negativeZ = frustum.m_isPositiveC[i] ? minZ : maxZ;
+
+            __m128 const positiveDistance = _mm_add_ps( _mm_add_ps( _mm_mul_ps( frustum.m_planeA[i], positiveX ), _mm_mul_ps( frustum.m_planeB[i], positiveY ) ), _mm_add_ps( _mm_mul_ps( frustum.m_planeC[i], positiveZ ), frustum.m_planeD[i] ) );
+            __m128 const negativeDistance = _mm_add_ps( _mm_add_ps( _mm_mul_ps( frustum.m_planeA[i], negativeX ), _mm_mul_ps( frustum.m_planeB[i], negativeY ) ), _mm_add_ps( _mm_mul_ps( frustum.m_planeC[i], negativeZ ), frustum.m_planeD[i] ) );
+
+            isOutside = _mm_or_ps( isOutside, _mm_cmplt_ps( positiveDistance, zero ) );
+            isIntersecting = _mm_or_ps( isIntersecting, _mm_cmplt_ps( negativeDistance, zero ) );
+
+            // Early out if all children are outside
+            if ( _mm_movemask_ps( isOutside ) == 0xF )
+            {
+                break;
+            }
+        }
+
+        int32_t const validChildrenMask = ( 1 << node.m_numChildren ) - 1;
+        outVisibleMask = ~_mm_movemask_ps( isOutside ) & validChildrenMask;
+        outFullyInsideMask = outVisibleMask & ~_mm_movemask_ps( isIntersecting );
+    }
+
+    void CullingBVH::AddLeaves( uint32_t firstLeafIdx, uint32_t numLeaves, TVector<uint64_t>& outResults ) const
+    {
+        EE_ASSERT( firstLeafIdx + numLeaves <= m_leafUserData.size() );
+        outResults.insert( outResults.end(), m_leafUserData.begin() + firstLeafIdx, m_leafUserData.begin() + firstLeafIdx + numLeaves );
+    }
+
+    template<typename NodeList>
+    void CullingBVH::CullNode( Node const& node, Frustum const& frustum, NodeList& nodesToVisit, TVector<uint64_t>& outResults ) const
+    {
+        int32_t visibleMask = 0, fullyInsideMask = 0;
+        TestNodeChildren( node, frustum, visibleMask, fullyInsideMask );
+
+        for ( int32_t i = 0; i < (int32_t) node.m_numChildren; i++ )
+        {
+            int32_t const childMask = 1 << i;
+            if ( ( visibleMask & childMask ) == 0 )
+            {
+                continue;
+            }
+
+            int32_t const childIdx = node.m_children[i];
+            if ( Node::IsLeafChild( childIdx ) )
+            {
+                outResults.emplace_back( m_leafUserData[Node::GetLeafIdx( childIdx )] );
+            }
+            else if ( fullyInsideMask & childMask )
+            {
+                Node const& childNode = m_nodes[childIdx];
+                AddLeaves( childNode.m_firstLeafIdx, childNode.m_numLeaves, outResults );
+            }
+            else
+            {
+                nodesToVisit.emplace_back( childIdx );
+            }
+        }
+    }
+
+    void CullingBVH::CullSubtree( int32_t rootNodeIdx, Frustum const& frustum, TVector<uint64_t>& outResults ) const
+    {
+        TInlineVector<int32_t, 64> nodeStack;
+        nodeStack.emplace_back( rootNodeIdx );
+
+        while ( !nodeStack.empty() )
+        {
+            int32_t const nodeIdx = nodeStack.back();
+            nodeStack.pop_back();
+            CullNode( m_nodes[nodeIdx], frustum, nodeStack, outResults );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CullingBVH::Cull( ViewVolume const& viewVolume, TVector<uint64_t>& outResults ) const
+    {
+        outResults.clear();
+
+        if ( m_nodes.empty() )
+        {
+            return;
+        }
+
+        Frustum const frustum = CreateFrustum( viewVolume );
+        CullSubtree( 0, frustum, outResults );
+    }
+
+    void CullingBVH::Cull( TaskSystem* pTaskSystem, ViewVolume const& viewVolume, TVector<uint64_t>& outResults )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+
+        outResults.clear();
+
+        if ( m_nodes.empty() )
+        {
+            return;
+        }
+
+        Frustum const frustum = CreateFrustum( viewVolume );
+        uint32_t const numThreads = pTaskSystem->GetNumThreads();
+
+        // Cull the top levels of the tree serially until we have enough independent subtrees to distribute across the workers
+        //-------------------------------------------------------------------------
+
+        size_t const targetNumWorkNodes = numThreads * 4;
+
+        m_workNodes.clear();
+        m_workNodes.emplace_back( 0 );
+
+        while ( !m_workNodes.empty() && m_workNodes.size() < targetNumWorkNodes )
+        {
+            m_nextWorkNodes.clear();
+            for ( int32_t nodeIdx : m_workNodes )
+            {
+                CullNode( m_nodes[nodeIdx], frustum, m_nextWorkNodes, outResults );
+            }
+            m_workNodes.swap( m_nextWorkNodes );
+        }
+
+        if ( m_workNodes.empty() )
+        {
+            return;
+        }
+
+        if ( numThreads <= 1 )
+        {
+            for ( int32_t nodeIdx : m_workNodes )
+            {
+                CullSubtree( nodeIdx, frustum, outResults );
+            }
+            return;
+        }
+
+        // Cull the subtrees in parallel
+        //-------------------------------------------------------------------------
+
+        m_threadResults.resize( numThreads );
+        for ( auto& threadResults : m_threadResults )
+        {
+            threadResults.clear();
+        }
+
+        struct SubtreeCullTask final : public ITaskSet
+        {
+            SubtreeCullTask( CullingBVH const* pBVH, Frustum const& frustum, TVector<int32_t> const& workNodes, TVector<TVector<uint64_t>>& threadResults )
+                : m_pBVH( pBVH )
+                , m_frustum( frustum )
+                , m_workNodes( workNodes )
+                , m_threadResults( threadResults )
+            {
+                m_SetSize = (uint32_t) workNodes.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_RENDER( "Cull Subtrees" );
+                EE_ASSERT( threadnum < m_threadResults.size() );
+
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    m_pBVH->CullSubtree( m_workNodes[i], m_frustum, m_threadResults[threadnum] );
+                }
+            }
+
+        private:
+
+            CullingBVH const*               m_pBVH = nullptr;
+            Frustum const&                  m_frustum;
+            TVector<int32_t> const&         m_workNodes;
+            TVector<TVector<uint64_t>>&     m_threadResults;
+        };
+
+        SubtreeCullTask cullTask( this, frustum, m_workNodes, m_threadResults );
+        pTaskSystem->ScheduleTask( &cullTask );
+        pTaskSystem->WaitForTask( &cullTask );
+
+        // Merge results
+        //-------------------------------------------------------------------------
+
+        for ( auto const& threadResults : m_threadResults )
+        {
+            outResults.insert( outResults.end(), threadResults.begin(), threadResults.end() );
+        }
+    }
+}
\ No newline at end of file
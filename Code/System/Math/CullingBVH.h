@@ -0,0 +1,117 @@
+#pragma once
+
+#include "System/Math/AABBTree.h"
+#include "System/Math/ViewVolume.h"
+#include "System/Math/SIMD.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+// Culling BVH
+//-------------------------------------------------------------------------
+// A read-only, flattened 4-wide BVH built from an AABB tree, used for frustum culling
+//
+// Each node stores the bounds of its (up to) four children in SoA form so that all children are tested against a frustum plane at once
+// Leaves are stored in depth-first order so that every node covers a contiguous range of leaves,
+// this lets us emit entire subtrees without any further tests once a node is found to be fully inside the frustum
+//
+// The BVH needs to be rebuilt whenever the source tree changes, it is intended for data that rarely changes (e.g. static mobility meshes)
+
+namespace EE::Math
+{
+    class EE_SYSTEM_API CullingBVH
+    {
+        constexpr static int32_t const s_numNodeChildren = 4;
+
+        struct alignas( 16 ) Node
+        {
+            inline static bool IsLeafChild( int32_t childIdx ) { return childIdx < 0; }
+            inline static int32_t GetLeafIdx( int32_t childIdx ) { EE_ASSERT( childIdx < 0 ); return ~childIdx; }
+
+        public:
+
+            float                   m_minX[s_numNodeChildren];
+            float                   m_minY[s_numNodeChildren];
+            float                   m_minZ[s_numNodeChildren];
+            float                   m_maxX[s_numNodeChildren];
+            float                   m_maxY[s_numNodeChildren];
+            float                   m_maxZ[s_numNodeChildren];
+            int32_t                 m_children[s_numNodeChildren];  // Node index for branches, inverted leaf index for leaves
+            uint32_t                m_firstLeafIdx = 0;
+            uint32_t                m_numLeaves = 0;
+            uint32_t                m_numChildren = 0;
+        };
+
+        // The frustum planes with the components splatted across all lanes
+        struct Frustum
+        {
+            __m128                  m_planeA[6];
+            __m128                  m_planeB[6];
+            __m128                  m_planeC[6];
+            __m128                  m_planeD[6];
+            bool                    m_isPositiveA[6];
+            bool                    m_isPositiveB[6];
+            bool                    m_isPositiveC[6];
+        };
+
+    public:
+
+        // Flatten the supplied tree, this will discard any existing data
+        void Build( AABBTree const& tree );
+        void Clear();
+
+        inline bool IsEmpty() const { return m_nodes.empty(); }
+        inline int32_t GetNumNodes() const { return (int32_t) m_nodes.size(); }
+        inline int32_t GetNumLeaves() const { return (int32_t) m_leafUserData.size(); }
+
+        // Find all leaves whose bounds are not fully outside the view volume's planes
+        void Cull( ViewVolume const& viewVolume, TVector<uint64_t>& outResults ) const;
+
+        // Find all leaves whose bounds are not fully outside the view volume's planes, the traversal is split across the task system workers
+        // Note: This uses internal scratch memory so only a single threaded cull can run per BVH at any given time
+        void Cull( TaskSystem* pTaskSystem, ViewVolume const& viewVolume, TVector<uint64_t>& outResults );
+
+        template<typename T>
+        void Cull( ViewVolume const& viewVolume, TVector<T*>& outResults ) const
+        {
+            Cull( viewVolume, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
+        template<typename T>
+        void Cull( TaskSystem* pTaskSystem, ViewVolume const& viewVolume, TVector<T*>& outResults )
+        {
+            Cull( pTaskSystem, viewVolume, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
+    private:
+
+        int32_t CreateNode( AABBTree const& tree, int32_t treeNodeIdx );
+        void SetChildBounds( int32_t nodeIdx, int32_t childSlotIdx, AABB const& bounds );
+
+        static Frustum CreateFrustum( ViewVolume const& viewVolume );
+
+        // Test all the children of a node against the frustum, returns the lanes that are not fully outside and the lanes that are fully inside
+        static void TestNodeChildren( Node const& node, Frustum const& frustum, int32_t& outVisibleMask, int32_t& outFullyInsideMask );
+
+        // Cull a single node, emits all visible leaves and adds all intersecting branch children to the list of nodes to visit
+        template<typename NodeList>
+        void CullNode( Node const& node, Frustum const& frustum, NodeList& nodesToVisit, TVector<uint64_t>& outResults ) const;
+
+        // Cull a subtree with an explicit stack
+        void CullSubtree( int32_t rootNodeIdx, Frustum const& frustum, TVector<uint64_t>& outResults ) const;
+
+        void AddLeaves( uint32_t firstLeafIdx, uint32_t numLeaves, TVector<uint64_t>& outResults ) const;
+
+    private:
+
+        TVector<Node>               m_nodes;
+        TVector<uint64_t>           m_leafUserData;
+
+        // Scratch memory for the threaded culls
+        TVector<int32_t>            m_workNodes;
+        TVector<int32_t>            m_nextWorkNodes;
+        TVector<TVector<uint64_t>>  m_threadResults;
+    };
+}
\ No newline at end of file
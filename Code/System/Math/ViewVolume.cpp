@@ -504,6 +504,7 @@ namespace EE::Math
         Vector const center( aabb.GetCenter() );
         Vector const extents( aabb.GetExtents() );
 
+        bool isIntersecting = false;
         for ( auto i = 0u; i < 6; i++ )
         {
             Plane plane( m_viewPlanes[i] );
@@ -518,14 +519,14 @@ namespace EE::Math
                 return IntersectionResult::FullyOutside;
             }
 
-            // Intersects
+            // Intersects - we still need to check the remaining planes since the box can be outside one of them
             if ( ( distance - radius ).IsLessThan4( Vector::Zero ) )
             {
-                return IntersectionResult::Intersects;
+                isIntersecting = true;
             }
         }
 
-        return IntersectionResult::FullyInside;
+        return isIntersecting ? IntersectionResult::Intersects : IntersectionResult::FullyInside;
     }
 
     ViewVolume::IntersectionResult ViewVolume::Intersect( Vector const& point ) const
@@ -0,0 +1,100 @@
+#include "FrameArena.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Memory
+{
+    FrameArena::~FrameArena()
+    {
+        EE_ASSERT( m_pMemory == nullptr );
+    }
+
+    void FrameArena::Initialize( size_t capacity )
+    {
+        EE_ASSERT( m_pMemory == nullptr && capacity > 0 );
+        m_pMemory = (uint8_t*) EE::Alloc( capacity, 64 );
+        m_capacity = capacity;
+    }
+
+    void FrameArena::Shutdown()
+    {
+        Reset();
+        EE::Free( (void*&) m_pMemory );
+        m_capacity = 0;
+        m_highWaterMark = 0;
+    }
+
+    void* FrameArena::AllocateOverflow( size_t size, size_t alignment )
+    {
+        // Store the overflow allocation link in front of the returned memory
+        size_t const headerSize = std::max( sizeof( OverflowAllocation ), alignment );
+        auto pOverflowAllocation = (OverflowAllocation*) EE::Alloc( headerSize + size, std::max( alignment, alignof( OverflowAllocation ) ) );
+        pOverflowAllocation->m_pNext = m_pOverflowAllocations;
+        m_pOverflowAllocations = pOverflowAllocation;
+
+        m_stats.m_overflowBytes += size;
+        m_stats.m_numOverflowAllocations++;
+
+        return reinterpret_cast<uint8_t*>( pOverflowAllocation ) + headerSize;
+    }
+
+    void FrameArena::Reset()
+    {
+        while ( m_pOverflowAllocations != nullptr )
+        {
+            void* pAllocation = m_pOverflowAllocations;
+            m_pOverflowAllocations = m_pOverflowAllocations->m_pNext;
+            EE::Free( pAllocation );
+        }
+
+        m_highWaterMark = std::max( m_highWaterMark, m_stats.m_usedBytes + m_stats.m_overflowBytes );
+        m_lastFrameStats = m_stats;
+        m_stats = Stats();
+    }
+
+    //-------------------------------------------------------------------------
+
+    FrameArenaSet::~FrameArenaSet()
+    {
+        EE_ASSERT( m_pArenas == nullptr );
+    }
+
+    void FrameArenaSet::Initialize( uint32_t numThreads, size_t capacityPerThread )
+    {
+        EE_ASSERT( m_pArenas == nullptr && numThreads > 0 );
+
+        m_numArenas = numThreads;
+        m_pArenas = EE::NewArray<FrameArena>( m_numArenas );
+        for ( uint32_t i = 0; i < m_numArenas; i++ )
+        {
+            m_pArenas[i].Initialize( capacityPerThread );
+        }
+    }
+
+    void FrameArenaSet::Shutdown()
+    {
+        if ( m_pArenas == nullptr )
+        {
+            return;
+        }
+
+        for ( uint32_t i = 0; i < m_numArenas; i++ )
+        {
+            m_pArenas[i].Shutdown();
+        }
+
+        EE::DeleteArray( m_pArenas );
+        m_numArenas = 0;
+    }
+
+    void FrameArenaSet::Reset()
+    {
+        EE_PROFILE_FUNCTION();
+
+        for ( uint32_t i = 0; i < m_numArenas; i++ )
+        {
+            m_pArenas[i].Reset();
+        }
+    }
+}
\ No newline at end of file
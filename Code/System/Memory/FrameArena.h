@@ -0,0 +1,232 @@
+#pragma once
+
+#include "Memory.h"
+#include "System/Types/Arrays.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Frame Arena
+//-------------------------------------------------------------------------
+// A linear allocator for temporary per-frame allocations. All memory is released in bulk when the arena is reset,
+// individual deallocations are ignored. Each arena is owned by a single thread so no synchronization is needed.
+// When an arena runs out of space, we fall back to the global allocator and release those allocations on reset.
+//
+// Never hold on to frame arena memory across a reset!
+
+namespace EE::Memory
+{
+    class EE_SYSTEM_API alignas( 64 ) FrameArena
+    {
+        struct OverflowAllocation
+        {
+            OverflowAllocation*                     m_pNext = nullptr;
+        };
+
+    public:
+
+        struct Stats
+        {
+            size_t                                  m_usedBytes = 0;                // Bytes allocated from the arena itself
+            size_t                                  m_overflowBytes = 0;            // Bytes allocated via the global allocator due to the arena being full
+            uint32_t                                m_numAllocations = 0;
+            uint32_t                                m_numOverflowAllocations = 0;
+        };
+
+    public:
+
+        FrameArena() = default;
+        FrameArena( FrameArena const& ) = delete;
+        FrameArena& operator=( FrameArena const& ) = delete;
+        ~FrameArena();
+
+        void Initialize( size_t capacity );
+        void Shutdown();
+        inline bool IsInitialized() const { return m_pMemory != nullptr; }
+
+        // Allocate a block of memory - this memory is only valid until the next reset
+        [[nodiscard]] EE_FORCE_INLINE void* Allocate( size_t size, size_t alignment = EE_DEFAULT_ALIGNMENT )
+        {
+            EE_ASSERT( m_pMemory != nullptr );
+            EE_ASSERT( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+
+            m_stats.m_numAllocations++;
+
+            size_t const padding = CalculatePaddingForAlignment( m_pMemory + m_stats.m_usedBytes, alignment );
+            size_t const requiredBytes = padding + size;
+            if ( m_stats.m_usedBytes + requiredBytes > m_capacity )
+            {
+                return AllocateOverflow( size, alignment );
+            }
+
+            void* pAllocation = m_pMemory + m_stats.m_usedBytes + padding;
+            m_stats.m_usedBytes += requiredBytes;
+            return pAllocation;
+        }
+
+        template<typename T>
+        [[nodiscard]] EE_FORCE_INLINE T* AllocateArray( size_t numElements )
+        {
+            return reinterpret_cast<T*>( Allocate( sizeof( T ) * numElements, alignof( T ) ) );
+        }
+
+        // Release all allocations made since the last reset
+        void Reset();
+
+        // Does the supplied address belong to this arena's memory block (overflow allocations are not included)
+        inline bool Owns( void const* pAddress ) const { return pAddress >= m_pMemory && pAddress < ( m_pMemory + m_capacity ); }
+
+        inline size_t GetCapacity() const { return m_capacity; }
+
+        // Get the stats for the current frame so far
+        inline Stats const& GetCurrentStats() const { return m_stats; }
+
+        // Get the stats for the last completed frame i.e. at the last reset
+        inline Stats const& GetLastFrameStats() const { return m_lastFrameStats; }
+
+        // Get the largest total number of bytes (arena + overflow) requested over a single frame
+        inline size_t GetHighWaterMark() const { return m_highWaterMark; }
+
+    private:
+
+        void* AllocateOverflow( size_t size, size_t alignment );
+
+    private:
+
+        uint8_t*                                    m_pMemory = nullptr;
+        size_t                                      m_capacity = 0;
+        OverflowAllocation*                         m_pOverflowAllocations = nullptr;
+        Stats                                       m_stats;
+        Stats                                       m_lastFrameStats;
+        size_t                                      m_highWaterMark = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Frame Arena Set
+    //-------------------------------------------------------------------------
+    // A set of frame arenas, one per thread. The thread index is expected to be a dense index (i.e. the task system thread index).
+    // Arena 0 belongs to the main thread, threads without a valid index do not get an arena.
+
+    class EE_SYSTEM_API FrameArenaSet
+    {
+    public:
+
+        FrameArenaSet() = default;
+        FrameArenaSet( FrameArenaSet const& ) = delete;
+        FrameArenaSet& operator=( FrameArenaSet const& ) = delete;
+        ~FrameArenaSet();
+
+        void Initialize( uint32_t numThreads, size_t capacityPerThread );
+        void Shutdown();
+
+        inline uint32_t GetNumArenas() const { return m_numArenas; }
+
+        inline FrameArena* GetArena( uint32_t threadIdx ) { EE_ASSERT( threadIdx < m_numArenas ); return &m_pArenas[threadIdx]; }
+        inline FrameArena const* GetArena( uint32_t threadIdx ) const { EE_ASSERT( threadIdx < m_numArenas ); return &m_pArenas[threadIdx]; }
+
+        // Reset all arenas - this must not be called while any thread is using an arena
+        void Reset();
+
+    private:
+
+        FrameArena*                                 m_pArenas = nullptr;
+        uint32_t                                    m_numArenas = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Allocator Adapters
+    //-------------------------------------------------------------------------
+    // Allow containers to opt in to using a frame arena.
+    // If no arena is supplied, we fall back to the global allocator so default constructed containers behave as expected.
+
+    class EE_SYSTEM_API FrameArenaAllocator
+    {
+    public:
+
+        explicit FrameArenaAllocator( char const* pName = "EE Frame Arena" ) {}
+        FrameArenaAllocator( FrameArena* pArena, char const* pName = "EE Frame Arena" ) : m_pArena( pArena ) {}
+        FrameArenaAllocator( FrameArenaAllocator const& x, char const* pName ) : m_pArena( x.m_pArena ) {}
+        FrameArenaAllocator( FrameArenaAllocator const& ) = default;
+        FrameArenaAllocator& operator=( FrameArenaAllocator const& ) = default;
+
+        inline void* allocate( size_t n, int flags = 0 )
+        {
+            return ( m_pArena != nullptr ) ? m_pArena->Allocate( n ) : EE::Alloc( n );
+        }
+
+        inline void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
+        {
+            EE_ASSERT( offset == 0 );
+            return ( m_pArena != nullptr ) ? m_pArena->Allocate( n, alignment ) : EE::Alloc( n, alignment );
+        }
+
+        inline void deallocate( void* p, size_t n )
+        {
+            if ( m_pArena == nullptr )
+            {
+                EE::Free( p );
+            }
+        }
+
+        inline char const* get_name() const { return "EE Frame Arena"; }
+        inline void set_name( char const* pName ) {}
+
+        inline FrameArena* GetArena() const { return m_pArena; }
+
+        inline bool operator==( FrameArenaAllocator const& rhs ) const { return m_pArena == rhs.m_pArena; }
+        inline bool operator!=( FrameArenaAllocator const& rhs ) const { return m_pArena != rhs.m_pArena; }
+
+    private:
+
+        FrameArena*                                 m_pArena = nullptr;
+    };
+
+    //-------------------------------------------------------------------------
+
+    template<typename T>
+    class TFrameArenaSTLAllocator
+    {
+        template<typename U> friend class TFrameArenaSTLAllocator;
+
+    public:
+
+        using value_type = T;
+
+        TFrameArenaSTLAllocator() noexcept = default;
+        TFrameArenaSTLAllocator( FrameArena* pArena ) noexcept : m_pArena( pArena ) {}
+        template<typename U> TFrameArenaSTLAllocator( TFrameArenaSTLAllocator<U> const& other ) noexcept : m_pArena( other.m_pArena ) {}
+
+        [[nodiscard]] inline T* allocate( size_t n )
+        {
+            return reinterpret_cast<T*>( ( m_pArena != nullptr ) ? m_pArena->Allocate( sizeof( T ) * n, alignof( T ) ) : EE::Alloc( sizeof( T ) * n, alignof( T ) ) );
+        }
+
+        inline void deallocate( T* p, size_t n )
+        {
+            if ( m_pArena == nullptr )
+            {
+                EE::Free( p );
+            }
+        }
+
+        inline FrameArena* GetArena() const { return m_pArena; }
+
+        template<typename U> inline bool operator==( TFrameArenaSTLAllocator<U> const& rhs ) const { return m_pArena == rhs.m_pArena; }
+        template<typename U> inline bool operator!=( TFrameArenaSTLAllocator<U> const& rhs ) const { return m_pArena != rhs.m_pArena; }
+
+    private:
+
+        FrameArena*                                 m_pArena = nullptr;
+    };
+}
+
+//-------------------------------------------------------------------------
+// Frame arena container aliases
+//-------------------------------------------------------------------------
+// Usage: TFrameVector<Transform> transforms( Memory::FrameArenaAllocator( context.GetFrameArena() ) );
+
+namespace EE
+{
+    template<typename T> using TFrameVector = eastl::vector<T, Memory::FrameArenaAllocator>;
+    template<typename T, eastl_size_t S> using TFrameInlineVector = eastl::fixed_vector<T, S, true, Memory::FrameArenaAllocator>;
+    template<typename K, typename V> using TFrameHashMap = eastl::hash_map<K, V, eastl::hash<K>, eastl::equal_to<K>, Memory::FrameArenaAllocator>;
+}
\ No newline at end of file
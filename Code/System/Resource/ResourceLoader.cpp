@@ -7,10 +7,10 @@
 
 namespace EE::Resource
 {
-    bool ResourceLoader::Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const
+    bool ResourceLoader::Load( ResourceID const& resourceID, uint8_t const* pRawData, size_t rawDataSize, ResourceRecord* pResourceRecord ) const
     {
         Serialization::BinaryInputArchive archive;
-        archive.ReadFromBlob( rawData );
+        archive.ReadFromData( pRawData, rawDataSize );
 
         // Read resource header
         Resource::ResourceHeader header;
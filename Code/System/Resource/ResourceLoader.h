@@ -54,7 +54,9 @@ namespace EE
             TVector<ResourceTypeID> const& GetLoadableTypes() const { return m_loadableTypes; }
 
             // This function loads is responsible to deserialize the compiled resource data, read the resource header for install dependencies and to create the new runtime resource object
-            bool Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const;
+            // The raw data only needs to stay valid for the duration of this call
+            bool Load( ResourceID const& resourceID, uint8_t const* pRawData, size_t rawDataSize, ResourceRecord* pResourceRecord ) const;
+            inline bool Load( ResourceID const& resourceID, Blob const& rawData, ResourceRecord* pResourceRecord ) const { return Load( resourceID, rawData.data(), rawData.size(), pResourceRecord ); }
 
             // This function will destroy the created resource object
             void Unload( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const;
@@ -0,0 +1,180 @@
+#include "ResourcePackage.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/Algorithm/Hash.h"
+#include "System/Math/Math.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ResourcePackage::Open( FileSystem::Path const& packagePath )
+    {
+        Close();
+
+        if ( !m_file.Open( packagePath ) )
+        {
+            return false;
+        }
+
+        // Validate header
+        //-------------------------------------------------------------------------
+
+        using Format = ResourcePackageFormat;
+
+        uint8_t const* pPackageData = m_file.GetData();
+        size_t const packageSize = m_file.GetSize();
+
+        auto pHeader = reinterpret_cast<Format::Header const*>( pPackageData );
+        if ( packageSize < sizeof( Format::Header ) || pHeader->m_fourCC != Format::s_fourCC || pHeader->m_version != Format::s_version )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Package", "Invalid resource package: %s", packagePath.c_str() );
+            m_file.Close();
+            return false;
+        }
+
+        size_t const indexSize = sizeof( Format::IndexEntry ) * pHeader->m_numEntries;
+        if ( packageSize < sizeof( Format::Header ) + indexSize )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Package", "Truncated resource package index: %s", packagePath.c_str() );
+            m_file.Close();
+            return false;
+        }
+
+        // Build lookup
+        //-------------------------------------------------------------------------
+
+        auto pEntries = reinterpret_cast<Format::IndexEntry const*>( pPackageData + sizeof( Format::Header ) );
+        m_index.reserve( pHeader->m_numEntries );
+
+        for ( uint32_t i = 0; i < pHeader->m_numEntries; i++ )
+        {
+            Format::IndexEntry const& entry = pEntries[i];
+            if ( entry.m_dataOffset + entry.m_dataSize > packageSize )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Package", "Resource package entry out of bounds: %s", packagePath.c_str() );
+                Close();
+                return false;
+            }
+
+            m_index[entry.m_resourcePathID] = &entry;
+        }
+
+        return true;
+    }
+
+    void ResourcePackage::Close()
+    {
+        m_index.clear();
+        m_file.Close();
+    }
+
+    bool ResourcePackage::TryGetResourceData( ResourceID const& resourceID, uint8_t const*& pOutData, size_t& outDataSize ) const
+    {
+        auto iter = m_index.find( resourceID.GetPathID() );
+        if ( iter == m_index.end() )
+        {
+            return false;
+        }
+
+        auto const pEntry = iter->second;
+        pOutData = m_file.GetData() + pEntry->m_dataOffset;
+        outDataSize = (size_t) pEntry->m_dataSize;
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( Hash::XXHash::GetHash32( pOutData, outDataSize ) != pEntry->m_dataHash )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Package", "Corrupted package data for resource: %s", resourceID.c_str() );
+            return false;
+        }
+        #endif
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourcePackageWriter::AddResource( ResourceID const& resourceID, FileSystem::Path const& compiledResourcePath )
+    {
+        EE_ASSERT( resourceID.IsValid() && compiledResourcePath.IsFilePath() );
+
+        for ( auto const& resource : m_resources )
+        {
+            if ( resource.m_resourceID == resourceID )
+            {
+                return;
+            }
+        }
+
+        m_resources.push_back( { resourceID, compiledResourcePath } );
+    }
+
+    bool ResourcePackageWriter::Write( FileSystem::Path const& packagePath ) const
+    {
+        using Format = ResourcePackageFormat;
+
+        FileSystem::OutputFileStream packageFile( packagePath );
+        if ( !packageFile.IsValid() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Package", "Failed to create resource package: %s", packagePath.c_str() );
+            return false;
+        }
+
+        // The index is written last once all the payload offsets are known, so reserve the space for it
+        //-------------------------------------------------------------------------
+
+        Format::Header header;
+        header.m_numEntries = (uint32_t) m_resources.size();
+
+        TVector<Format::IndexEntry> index;
+        index.resize( m_resources.size() );
+
+        uint64_t const indexEndOffset = sizeof( Format::Header ) + ( sizeof( Format::IndexEntry ) * index.size() );
+        uint64_t currentOffset = 0;
+
+        TVector<uint8_t> padding;
+        auto WritePadding = [&] ( uint64_t targetOffset )
+        {
+            EE_ASSERT( targetOffset >= currentOffset );
+            padding.resize( (size_t) ( targetOffset - currentOffset ), 0 );
+            packageFile.Write( padding.data(), padding.size() );
+            currentOffset = targetOffset;
+        };
+
+        WritePadding( indexEndOffset );
+
+        // Payloads
+        //-------------------------------------------------------------------------
+
+        Blob resourceData;
+        for ( size_t i = 0; i < m_resources.size(); i++ )
+        {
+            auto const& resource = m_resources[i];
+            if ( !FileSystem::LoadFile( resource.m_compiledResourcePath, resourceData ) || resourceData.empty() )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Package", "Failed to read compiled resource: %s", resource.m_compiledResourcePath.c_str() );
+                return false;
+            }
+
+            WritePadding( Math::RoundUpToNearestMultiple64( currentOffset, Format::s_payloadAlignment ) );
+
+            index[i].m_resourcePathID = resource.m_resourceID.GetPathID();
+            index[i].m_dataHash = Hash::XXHash::GetHash32( resourceData.data(), resourceData.size() );
+            index[i].m_dataOffset = currentOffset;
+            index[i].m_dataSize = resourceData.size();
+
+            packageFile.Write( resourceData.data(), resourceData.size() );
+            currentOffset += resourceData.size();
+        }
+
+        // Header and index
+        //-------------------------------------------------------------------------
+
+        packageFile.GetStream().seekp( 0 );
+        packageFile.Write( &header, sizeof( Format::Header ) );
+        packageFile.Write( index.data(), sizeof( Format::IndexEntry ) * index.size() );
+        packageFile.Close();
+
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "ResourceID.h"
+#include "System/FileSystem/FileStreams.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Resource Package
+//-------------------------------------------------------------------------
+// A single file container for all the compiled resources needed by a packaged build
+//
+// Layout: [Header][Index: one entry per resource][Payloads: compiled resource data, each aligned to s_payloadAlignment]
+//
+// The package is memory mapped at runtime and loaders are handed a view directly into the mapped data,
+// so a resource load costs a page fault rather than an open/read/close and a heap copy.
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    struct ResourcePackageFormat
+    {
+        constexpr static uint32_t const s_fourCC = 'eepk';
+        constexpr static uint32_t const s_version = 1;
+        constexpr static uint64_t const s_payloadAlignment = 4096;
+        constexpr static char const* const s_defaultFileName = "Resources.eepk";
+
+        struct Header
+        {
+            uint32_t                    m_fourCC = s_fourCC;
+            uint32_t                    m_version = s_version;
+            uint32_t                    m_numEntries = 0;
+            uint32_t                    m_padding = 0;
+        };
+
+        struct IndexEntry
+        {
+            uint32_t                    m_resourcePathID = 0;   // The resource ID path hash
+            uint32_t                    m_dataHash = 0;         // XXHash of the payload
+            uint64_t                    m_dataOffset = 0;       // From the start of the package
+            uint64_t                    m_dataSize = 0;
+        };
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_SYSTEM_API ResourcePackage
+    {
+    public:
+
+        ResourcePackage() = default;
+        ResourcePackage( ResourcePackage const& ) = delete;
+        ResourcePackage& operator=( ResourcePackage const& ) = delete;
+
+        bool Open( FileSystem::Path const& packagePath );
+        void Close();
+
+        inline bool IsOpen() const { return m_file.IsValid(); }
+        inline int32_t GetNumResources() const { return (int32_t) m_index.size(); }
+        inline bool Contains( ResourceID const& resourceID ) const { return m_index.find( resourceID.GetPathID() ) != m_index.end(); }
+
+        // Get a view of the compiled data for a resource, the view is only valid while the package is open
+        bool TryGetResourceData( ResourceID const& resourceID, uint8_t const*& pOutData, size_t& outDataSize ) const;
+
+    private:
+
+        FileSystem::MemoryMappedFile                                    m_file;
+        THashMap<uint32_t, ResourcePackageFormat::IndexEntry const*>    m_index;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_SYSTEM_API ResourcePackageWriter
+    {
+        struct PendingResource
+        {
+            ResourceID                  m_resourceID;
+            FileSystem::Path            m_compiledResourcePath;
+        };
+
+    public:
+
+        void AddResource( ResourceID const& resourceID, FileSystem::Path const& compiledResourcePath );
+
+        // Write all added resources to a package, fails if any of the compiled resource files cannot be read
+        bool Write( FileSystem::Path const& packagePath ) const;
+
+    private:
+
+        TVector<PendingResource>        m_resources;
+    };
+}
\ No newline at end of file
@@ -14,11 +14,37 @@ namespace EE::Resource
 
     bool PackagedResourceProvider::Initialize()
     {
+        // The package is optional, we fall back to loose files for anything it doesn't contain
+        FileSystem::Path const packagePath = m_settings.m_compiledResourcePath + ResourcePackageFormat::s_defaultFileName;
+        if ( FileSystem::Exists( packagePath ) )
+        {
+            if ( !m_package.Open( packagePath ) )
+            {
+                EE_LOG_ERROR( "Resource", "Packaged Resource Provider", "Failed to open resource package: %s", packagePath.c_str() );
+                return false;
+            }
+
+            EE_LOG_MESSAGE( "Resource", "Packaged Resource Provider", "Mapped resource package with %d resources: %s", m_package.GetNumResources(), packagePath.c_str() );
+        }
+
         return true;
     }
 
+    void PackagedResourceProvider::Shutdown()
+    {
+        m_package.Close();
+    }
+
     void PackagedResourceProvider::RequestRawResource( ResourceRequest* pRequest )
     {
+        uint8_t const* pResourceData = nullptr;
+        size_t resourceDataSize = 0;
+        if ( m_package.IsOpen() && m_package.TryGetResourceData( pRequest->GetResourceID(), pResourceData, resourceDataSize ) )
+        {
+            pRequest->OnRawResourceRequestComplete( pResourceData, resourceDataSize );
+            return;
+        }
+
         FileSystem::Path const resourceFilePath = pRequest->GetResourceID().GetResourcePath().ToFileSystemPath( m_settings.m_compiledResourcePath );
         pRequest->OnRawResourceRequestComplete( resourceFilePath.c_str() );
     }
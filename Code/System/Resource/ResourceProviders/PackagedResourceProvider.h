@@ -1,6 +1,7 @@
 #pragma once
 
 #include "System/Resource/ResourceProvider.h"
+#include "System/Resource/ResourcePackage.h"
 
 //-------------------------------------------------------------------------
 
@@ -10,6 +11,7 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    // Serves resources from the memory mapped resource package if present, otherwise from the loose compiled resource files
     class EE_SYSTEM_API PackagedResourceProvider final : public ResourceProvider
     {
 
@@ -21,7 +23,12 @@ namespace EE::Resource
     private:
 
         virtual bool Initialize() override;
+        virtual void Shutdown() override;
         virtual void RequestRawResource( ResourceRequest* pRequest ) override;
         virtual void CancelRequest( ResourceRequest* pRequest ) override;
+
+    private:
+
+        ResourcePackage                     m_package;
     };
 }
\ No newline at end of file
@@ -14,7 +14,6 @@ namespace EE::Resource
         , m_pResourceLoader( pResourceLoader )
         , m_type( type )
     {
-        EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( m_pResourceRecord != nullptr && m_pResourceRecord->IsValid() );
         EE_ASSERT( m_pResourceLoader != nullptr );
         EE_ASSERT( m_type != Type::Invalid );
@@ -56,10 +55,21 @@ namespace EE::Resource
         else // Continue the load operation
         {
             m_rawResourcePath = filePath;
+            m_pRawResourceDataView = nullptr;
+            m_rawResourceDataViewSize = 0;
             m_stage = ResourceRequest::Stage::LoadResource;
         }
     }
 
+    void ResourceRequest::OnRawResourceRequestComplete( uint8_t const* pRawData, size_t rawDataSize )
+    {
+        EE_ASSERT( pRawData != nullptr && rawDataSize > 0 );
+        m_rawResourcePath.Clear();
+        m_pRawResourceDataView = pRawData;
+        m_rawResourceDataViewSize = rawDataSize;
+        m_stage = ResourceRequest::Stage::LoadResource;
+    }
+
     void ResourceRequest::SwitchToLoadTask()
     {
         EE_ASSERT( m_type == Type::Unload );
@@ -269,11 +279,12 @@ namespace EE::Resource
     {
         EE_PROFILE_FUNCTION_RESOURCE();
         EE_ASSERT( m_stage == ResourceRequest::Stage::LoadResource );
-        EE_ASSERT( m_rawResourcePath.IsValid() );
+        EE_ASSERT( m_rawResourcePath.IsValid() || m_pRawResourceDataView != nullptr );
 
-        // Read file
+        // Read file - not needed if the provider gave us a view of the data
         //-------------------------------------------------------------------------
 
+        if ( m_pRawResourceDataView == nullptr )
         {
             EE_PROFILE_SCOPE_IO( "Read File" );
             EE_PROFILE_TAG( "filename", m_rawResourcePath.GetFilename().c_str() );
@@ -304,13 +315,22 @@ namespace EE::Resource
             #endif
 
             // Load the resource
-            EE_ASSERT( !m_rawResourceData.empty() );
+            uint8_t const* pRawData = ( m_pRawResourceDataView != nullptr ) ? m_pRawResourceDataView : m_rawResourceData.data();
+            size_t const rawDataSize = ( m_pRawResourceDataView != nullptr ) ? m_rawResourceDataViewSize : m_rawResourceData.size();
+            EE_ASSERT( pRawData != nullptr && rawDataSize > 0 );
 
             #if EE_DEVELOPMENT_TOOLS
             ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_loadTime );
             #endif
 
-            if ( !m_pResourceLoader->Load( GetResourceID(), m_rawResourceData, m_pResourceRecord ) )
+            bool const wasLoaded = m_pResourceLoader->Load( GetResourceID(), pRawData, rawDataSize, m_pResourceRecord );
+
+            // Release raw data
+            m_rawResourceData.clear();
+            m_pRawResourceDataView = nullptr;
+            m_rawResourceDataViewSize = 0;
+
+            if ( !wasLoaded )
             {
                 EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load compiled resource data (%s)", m_pResourceRecord->GetResourceID().c_str() );
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
@@ -318,9 +338,6 @@ namespace EE::Resource
                 m_stage = ResourceRequest::Stage::Complete;
                 return;
             }
-
-            // Release raw data
-            m_rawResourceData.clear();
         }
 
         // Load dependencies
@@ -89,6 +89,10 @@ namespace EE::Resource
         // Called by the resource provider once the request operation completes and provides the raw resource data
         void OnRawResourceRequestComplete( String const& filePath );
 
+        // Called by the resource provider once the request completes with a view of the raw resource data (e.g. from a mapped package)
+        // The provider must keep the viewed data valid until the request completes
+        void OnRawResourceRequestComplete( uint8_t const* pRawData, size_t rawDataSize );
+
         // This will interrupt a load task and convert it into an unload task
         void SwitchToLoadTask();
 
@@ -114,6 +118,8 @@ namespace EE::Resource
         ResourceLoader*                         m_pResourceLoader = nullptr;
         FileSystem::Path                        m_rawResourcePath;
         Blob                                    m_rawResourceData;
+        uint8_t const*                          m_pRawResourceDataView = nullptr;
+        size_t                                  m_rawResourceDataViewSize = 0;
         InstallDependencyList                   m_pendingInstallDependencies;
         InstallDependencyList                   m_installDependencies;
         Type                                    m_type = Type::Invalid;
@@ -97,6 +97,21 @@ namespace EE::Resource
                 return false;
             }
 
+            // Compiled Resource Cache - Optional, caching is disabled if not set
+            //-------------------------------------------------------------------------
+
+            if ( ini.TryGetString( "Resource:CompiledResourceCacheDirectoryName", tmp ) && !tmp.empty() )
+            {
+                m_compiledResourceCachePath = m_workingDirectoryPath + tmp;
+                if ( !m_compiledResourceCachePath.IsValid() )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid compiled resource cache path: %s", tmp.c_str() );
+                    return false;
+                }
+
+                m_compiledResourceCachePath.MakeIntoDirectoryPath();
+            }
+
             // Resource Compiler
             //-------------------------------------------------------------------------
 
@@ -115,6 +130,9 @@ namespace EE::Resource
                 return false;
             }
 
+            // Optional, defaults to using persistent compiler workers
+            ini.TryGetBool( "Resource:UseResourceCompilerWorkers", m_useResourceCompilerWorkers );
+
             // Resource Server
             //-------------------------------------------------------------------------
 
@@ -29,8 +29,10 @@ namespace EE::Resource
         uint16_t                m_resourceServerPort;
         FileSystem::Path        m_rawResourcePath;
         FileSystem::Path        m_compiledResourceDatabasePath;
+        FileSystem::Path        m_compiledResourceCachePath;
         FileSystem::Path        m_resourceServerExecutablePath;
         FileSystem::Path        m_resourceCompilerExecutablePath;
+        bool                    m_useResourceCompilerWorkers = true;
         #endif
     };
 }
\ No newline at end of file
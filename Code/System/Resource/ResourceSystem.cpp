@@ -46,12 +46,8 @@ namespace EE::Resource
             return true;
         }
 
-        if ( !m_pendingRequests.empty() )
-        {
-            return true;
-        }
-
-        return false;
+        Threading::ScopeLock lock( m_pendingRequestsLock );
+        return !m_pendingRequests.empty();
     }
 
     //-------------------------------------------------------------------------
@@ -184,7 +180,7 @@ namespace EE::Resource
 
     void ResourceSystem::AddPendingRequest( PendingRequest&& request )
     {
-        Threading::RecursiveScopeLock lock( m_accessLock );
+        Threading::ScopeLock lock( m_pendingRequestsLock );
 
         // Try find a pending request for this resource ID
         auto predicate = [] ( PendingRequest const& request, ResourceID const& resourceID ) { return request.m_pRecord->GetResourceID() == resourceID; };
@@ -204,9 +200,8 @@ namespace EE::Resource
     ResourceRequest* ResourceSystem::TryFindActiveRequest( ResourceRecord const* pResourceRecord ) const
     {
         EE_ASSERT( pResourceRecord != nullptr );
-        EE_ASSERT( !m_isAsyncTaskRunning );
 
-        Threading::RecursiveScopeLock lock( m_accessLock );
+        // No lock needed, the active requests are only ever accessed by the main thread or by the async task
         auto predicate = [] ( ResourceRequest const* pRequest, ResourceRecord const* pResourceRecord ) { return pRequest->GetResourceRecord() == pResourceRecord; };
         int32_t const foundIdx = VectorFindIndex( m_activeRequests, pResourceRecord, predicate );
 
@@ -218,6 +213,27 @@ namespace EE::Resource
         return nullptr;
     }
 
+    bool ResourceSystem::CanReleaseResourceRecord( ResourceRecord const* pRecord ) const
+    {
+        EE_ASSERT( pRecord != nullptr );
+
+        if ( !pRecord->IsUnloaded() || pRecord->HasReferences() )
+        {
+            return false;
+        }
+
+        // We may have received a new request for this record since it was unloaded
+        if ( TryFindActiveRequest( pRecord ) != nullptr )
+        {
+            return false;
+        }
+
+        // A load and unload may have been queued since we last processed the pending requests, so the request refers to this record without referencing it
+        Threading::ScopeLock lock( m_pendingRequestsLock );
+        auto predicate = [] ( PendingRequest const& request, ResourceRecord const* pRecord ) { return request.m_pRecord == pRecord; };
+        return !VectorContains( m_pendingRequests, pRecord, predicate );
+    }
+
     //-------------------------------------------------------------------------
 
     void ResourceSystem::UpdateResourceProvider()
@@ -266,70 +282,21 @@ namespace EE::Resource
         // Process and Update requests
         //-------------------------------------------------------------------------
 
-        {
-            Threading::RecursiveScopeLock lock( m_accessLock );
+        ProcessPendingRequests();
 
-            for ( auto& pendingRequest : m_pendingRequests )
-            {
-                // Get existing active request
-                auto pActiveRequest = TryFindActiveRequest( pendingRequest.m_pRecord );
-
-                // Load request
-                if ( pendingRequest.m_type == PendingRequest::Type::Load )
-                {
-                    if ( pActiveRequest != nullptr )
-                    {
-                        if ( pActiveRequest->IsUnloadRequest() )
-                        {
-                            pActiveRequest->SwitchToLoadTask();
-                        }
-                    }
-                    else if ( pendingRequest.m_pRecord->IsLoaded() ) // Can occur due to multiple requests for the same resource in the same frame
-                    {
-                        // Do Nothing
-                    }
-                    else // Create new request
-                    {
-                        auto loaderIter = m_resourceLoaders.find( pendingRequest.m_pRecord->GetResourceTypeID() );
-                        EE_ASSERT( loaderIter != m_resourceLoaders.end() );
-                        m_activeRequests.emplace_back( EE::New<ResourceRequest>( pendingRequest.m_requesterID, ResourceRequest::Type::Load, pendingRequest.m_pRecord, loaderIter->second ) );
-                    }
-                }
-                else // Unload request
-                {
-                    if ( pActiveRequest != nullptr )
-                    {
-                        if ( pActiveRequest->IsLoadRequest() )
-                        {
-                            pActiveRequest->SwitchToUnloadTask();
-                        }
-                    }
-                    else if ( pendingRequest.m_pRecord->IsUnloaded() ) // Can occur due to multiple requests for the same resource in the same frame
-                    {
-                        if ( !pendingRequest.m_pRecord->HasReferences() )
-                        {
-                            auto recordIter = m_resourceRecords.find( pendingRequest.m_pRecord->m_resourceID );
-                            EE_ASSERT( recordIter != m_resourceRecords.end() );
-                            EE_ASSERT( recordIter->second == pendingRequest.m_pRecord );
-
-                            EE::Delete( pendingRequest.m_pRecord );
-                            m_resourceRecords.erase( recordIter );
-                        }
-                    }
-                    else // Create new request
-                    {
-                        auto loaderIter = m_resourceLoaders.find( pendingRequest.m_pRecord->GetResourceTypeID() );
-                        EE_ASSERT( loaderIter != m_resourceLoaders.end() );
-                        m_activeRequests.emplace_back( EE::New<ResourceRequest>( pendingRequest.m_requesterID, ResourceRequest::Type::Unload, pendingRequest.m_pRecord, loaderIter->second ) );
-                    }
-                }
-            }
+        // Process completed requests
+        //-------------------------------------------------------------------------
 
-            m_pendingRequests.clear();
+        #if EE_DEVELOPMENT_TOOLS
+        int32_t const numCompletedRequests = (int32_t) m_completedRequests.size();
+        #endif
 
-            // Process completed requests
-            //-------------------------------------------------------------------------
+        {
+            Threading::RecursiveScopeLock lock( m_accessLock );
 
+            // Release the records of any unloaded resources, we may have had a load request for them in the meantime
+            // Note: a resource can have had multiple requests completed during a single async task
+            TVector<ResourceID> completedResourceIDs;
             for ( auto pCompletedRequest : m_completedRequests )
             {
                 ResourceID const resourceID = pCompletedRequest->GetResourceID();
@@ -339,31 +306,71 @@ namespace EE::Resource
                 m_history.emplace_back( CompletedRequestLog( pCompletedRequest->IsLoadRequest() ? PendingRequest::Type::Load : PendingRequest::Type::Unload, resourceID ) );
                 #endif
 
-                if ( pCompletedRequest->IsUnloadRequest() )
+                if ( !VectorContains( completedResourceIDs, resourceID ) )
                 {
-                    // Check if we can remove the record, we may have had a load request for it in the meantime
-                    if ( !pCompletedRequest->GetResourceRecord()->HasReferences() )
-                    {
-                        auto recordIter = m_resourceRecords.find( resourceID );
-                        EE_ASSERT( recordIter != m_resourceRecords.end() );
-                        EE_ASSERT( recordIter->second == pCompletedRequest->GetResourceRecord() );
+                    completedResourceIDs.emplace_back( resourceID );
+                }
+            }
 
-                        EE::Delete( recordIter->second );
-                        m_resourceRecords.erase( recordIter );
-                    }
+            for ( auto const& resourceID : completedResourceIDs )
+            {
+                auto recordIter = m_resourceRecords.find( resourceID );
+                if ( recordIter != m_resourceRecords.end() && CanReleaseResourceRecord( recordIter->second ) )
+                {
+                    EE::Delete( recordIter->second );
+                    m_resourceRecords.erase( recordIter );
                 }
+            }
 
-                // Delete request
+            // Delete requests
+            for ( auto& pCompletedRequest : m_completedRequests )
+            {
                 EE::Delete( pCompletedRequest );
             }
 
             m_completedRequests.clear();
         }
 
+        // Stats
+        //-------------------------------------------------------------------------
+
+        bool hasPendingRequests = false;
+        {
+            Threading::ScopeLock lock( m_pendingRequestsLock );
+            hasPendingRequests = !m_pendingRequests.empty();
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        bool const isBusy = hasPendingRequests || !m_activeRequests.empty();
+        if ( isBusy )
+        {
+            if ( !m_wasBusy )
+            {
+                m_busyPeriodTimer.Start();
+                m_stats.m_peakRequestsInFlight = 0;
+                m_stats.m_numRequestsCompletedInBusyPeriod = 0;
+            }
+
+            m_stats.m_currentBusyPeriodTime = m_busyPeriodTimer.GetElapsedTimeMilliseconds();
+            m_stats.m_numRequestsCompletedInBusyPeriod += numCompletedRequests;
+        }
+        else if ( m_wasBusy )
+        {
+            m_stats.m_lastBusyPeriodTime = m_busyPeriodTimer.GetElapsedTimeMilliseconds();
+            m_stats.m_currentBusyPeriodTime = 0;
+            m_stats.m_numRequestsCompletedInBusyPeriod += numCompletedRequests;
+            m_busyPeriodHistory.push_back( { m_stats.m_lastBusyPeriodTime, m_stats.m_numRequestsCompletedInBusyPeriod, m_isSerialProcessingEnabled } );
+        }
+
+        m_wasBusy = isBusy;
+        m_stats.m_numRequestsInFlight = (int32_t) m_activeRequests.size();
+        m_stats.m_peakRequestsInFlight = Math::Max( m_stats.m_peakRequestsInFlight, m_stats.m_numRequestsInFlight );
+        #endif
+
         // Kick off new async task
         //-------------------------------------------------------------------------
 
-        if ( !m_activeRequests.empty() )
+        if ( !m_activeRequests.empty() || hasPendingRequests )
         {
             m_taskSystem.ScheduleTask( &m_asyncProcessingTask );
             m_isAsyncTaskRunning = true;
@@ -378,44 +385,251 @@ namespace EE::Resource
         }
     }
 
-    void ResourceSystem::ProcessResourceRequests()
+    //-------------------------------------------------------------------------
+
+    bool ResourceSystem::ProcessPendingRequests()
     {
         EE_PROFILE_FUNCTION_RESOURCE();
 
+        // The access lock needs to be held from before the swap, otherwise a load and unload for a record we're about to release could be queued in between
+        Threading::RecursiveScopeLock lock( m_accessLock );
+
+        // Take the current set of pending requests, this allows new requests to be queued (e.g. by loading workers) while we process these
+        {
+            Threading::ScopeLock pendingLock( m_pendingRequestsLock );
+            EE_ASSERT( m_pendingRequestsToProcess.empty() );
+            m_pendingRequestsToProcess.swap( m_pendingRequests );
+        }
+
+        if ( m_pendingRequestsToProcess.empty() )
+        {
+            return false;
+        }
+
         //-------------------------------------------------------------------------
 
-        // We dont have to worry about this loop even if the m_activeRequests array is modified from another thread since we only access the array in 2 places and both use locks
-        for ( int32_t i = (int32_t) m_activeRequests.size() - 1; i >= 0; i-- )
+        bool wereActiveRequestsModified = false;
+
+        for ( auto& pendingRequest : m_pendingRequestsToProcess )
         {
-            ResourceRequest::RequestContext context;
-            context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
-            context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
-            context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
-            context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
+            // Get existing active request
+            auto pActiveRequest = TryFindActiveRequest( pendingRequest.m_pRecord );
 
-            //-------------------------------------------------------------------------
+            // Load request
+            if ( pendingRequest.m_type == PendingRequest::Type::Load )
+            {
+                if ( pActiveRequest != nullptr )
+                {
+                    if ( pActiveRequest->IsUnloadRequest() )
+                    {
+                        pActiveRequest->SwitchToLoadTask();
+                        wereActiveRequestsModified = true;
+                    }
+                }
+                else if ( pendingRequest.m_pRecord->IsLoaded() ) // Can occur due to multiple requests for the same resource in the same frame
+                {
+                    // Do Nothing
+                }
+                else // Create new request
+                {
+                    auto loaderIter = m_resourceLoaders.find( pendingRequest.m_pRecord->GetResourceTypeID() );
+                    EE_ASSERT( loaderIter != m_resourceLoaders.end() );
+                    m_activeRequests.emplace_back( EE::New<ResourceRequest>( pendingRequest.m_requesterID, ResourceRequest::Type::Load, pendingRequest.m_pRecord, loaderIter->second ) );
+                    wereActiveRequestsModified = true;
+                }
+            }
+            else // Unload request
+            {
+                if ( pActiveRequest != nullptr )
+                {
+                    if ( pActiveRequest->IsLoadRequest() )
+                    {
+                        pActiveRequest->SwitchToUnloadTask();
+                        wereActiveRequestsModified = true;
+                    }
+                }
+                else if ( pendingRequest.m_pRecord->IsUnloaded() ) // Can occur due to multiple requests for the same resource in the same frame
+                {
+                    // If a completed request still refers to this record, it will be released when the completed requests are processed
+                    auto predicate = [] ( ResourceRequest const* pRequest, ResourceRecord const* pResourceRecord ) { return pRequest->GetResourceRecord() == pResourceRecord; };
+                    if ( CanReleaseResourceRecord( pendingRequest.m_pRecord ) && !VectorContains( m_completedRequests, pendingRequest.m_pRecord, predicate ) )
+                    {
+                        auto recordIter = m_resourceRecords.find( pendingRequest.m_pRecord->m_resourceID );
+                        EE_ASSERT( recordIter != m_resourceRecords.end() );
+                        EE_ASSERT( recordIter->second == pendingRequest.m_pRecord );
 
-            bool isRequestComplete = false;
+                        EE::Delete( pendingRequest.m_pRecord );
+                        m_resourceRecords.erase( recordIter );
+                    }
+                }
+                else // Create new request
+                {
+                    auto loaderIter = m_resourceLoaders.find( pendingRequest.m_pRecord->GetResourceTypeID() );
+                    EE_ASSERT( loaderIter != m_resourceLoaders.end() );
+                    m_activeRequests.emplace_back( EE::New<ResourceRequest>( pendingRequest.m_requesterID, ResourceRequest::Type::Unload, pendingRequest.m_pRecord, loaderIter->second ) );
+                    wereActiveRequestsModified = true;
+                }
+            }
+        }
 
-            ResourceRequest* pRequest = m_activeRequests[i];
-            if ( pRequest->IsActive() )
+        m_pendingRequestsToProcess.clear();
+
+        return wereActiveRequestsModified;
+    }
+
+    bool ResourceSystem::UpdateActiveRequests()
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+
+        ResourceRequest::RequestContext context;
+        context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
+        context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
+        context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
+        context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
+
+        // The read/load and install stages are independent per request, so they are the ones we run in parallel
+        // All other stages are cheap or talk to the resource provider, so they are run serially
+        auto IsParallelStage = [] ( ResourceRequest::Stage stage )
+        {
+            return stage == ResourceRequest::Stage::LoadResource || stage == ResourceRequest::Stage::InstallResource;
+        };
+
+        bool haveRequestsAdvanced = false;
+
+        // Serial stages
+        //-------------------------------------------------------------------------
+        // Requests that have just received their raw data or whose dependencies have just completed will immediately join the parallel stages
+
+        m_parallelStageRequests.clear();
+
+        for ( auto pRequest : m_activeRequests )
+        {
+            ResourceRequest::Stage const initialStage = pRequest->GetStage();
+            if ( pRequest->IsActive() && !IsParallelStage( initialStage ) )
             {
-                isRequestComplete = pRequest->Update( context );
+                pRequest->Update( context );
+                haveRequestsAdvanced |= ( pRequest->GetStage() != initialStage );
             }
-            else
+
+            if ( IsParallelStage( pRequest->GetStage() ) )
             {
-                isRequestComplete = true;
+                m_parallelStageRequests.emplace_back( pRequest );
             }
+        }
+
+        // Parallel stages
+        //-------------------------------------------------------------------------
+        // Any install dependencies requested here will be added to the pending requests, this is thread-safe
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_isSerialProcessingEnabled )
+        {
+            for ( auto pRequest : m_parallelStageRequests )
+            {
+                pRequest->Update( context );
+            }
+
+            haveRequestsAdvanced |= !m_parallelStageRequests.empty();
+            m_parallelStageRequests.clear();
+        }
+        #endif
+
+        if ( !m_parallelStageRequests.empty() )
+        {
+            struct ParallelStageTask final : public ITaskSet
+            {
+                ParallelStageTask( TVector<ResourceRequest*> const& requests, ResourceRequest::RequestContext& context )
+                    : m_requests( requests )
+                    , m_context( context )
+                {
+                    m_SetSize = (uint32_t) requests.size();
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    EE_PROFILE_SCOPE_RESOURCE( "Load/Install Resources" );
+
+                    for ( uint64_t i = range.start; i < range.end; ++i )
+                    {
+                        m_requests[i]->Update( m_context );
+                    }
+                }
+
+            private:
+
+                TVector<ResourceRequest*> const&            m_requests;
+                ResourceRequest::RequestContext&            m_context;
+            };
 
             //-------------------------------------------------------------------------
 
-            if ( isRequestComplete )
+            ParallelStageTask parallelStageTask( m_parallelStageRequests, context );
+            m_taskSystem.ScheduleTask( &parallelStageTask );
+            m_taskSystem.WaitForTask( &parallelStageTask );
+
+            // Both parallel stages always advance the request
+            haveRequestsAdvanced = true;
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_stats.m_numParallelStageRequests += (int32_t) m_parallelStageRequests.size();
+            #endif
+        }
+
+        // Remove completed requests
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = (int32_t) m_activeRequests.size() - 1; i >= 0; i-- )
+        {
+            ResourceRequest* pRequest = m_activeRequests[i];
+            if ( pRequest->IsComplete() )
             {
                 // We need to process and remove completed requests at the next update stage since unload task may have queued unload requests which refer to the request's allocated memory
                 m_completedRequests.emplace_back( pRequest );
                 m_activeRequests.erase_unsorted( m_activeRequests.begin() + i );
             }
         }
+
+        return haveRequestsAdvanced;
+    }
+
+    void ResourceSystem::ProcessResourceRequests()
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_stats.m_numProcessingPasses = 0;
+        m_stats.m_numParallelStageRequests = 0;
+        #endif
+
+        // Keep stepping the requests while they make progress, this allows a request to move on as soon as its dependencies have completed
+        for ( int32_t i = 0; i < s_maxProcessingPassesPerUpdate; i++ )
+        {
+            ProcessPendingRequests();
+            bool const haveRequestsAdvanced = UpdateActiveRequests();
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_stats.m_numProcessingPasses++;
+            #endif
+
+            bool hasPendingRequests = false;
+            {
+                Threading::ScopeLock lock( m_pendingRequestsLock );
+                hasPendingRequests = !m_pendingRequests.empty();
+            }
+
+            if ( !haveRequestsAdvanced && !hasPendingRequests )
+            {
+                break;
+            }
+
+            // Serial processing only steps the requests once per update
+            #if EE_DEVELOPMENT_TOOLS
+            if ( m_isSerialProcessingEnabled )
+            {
+                break;
+            }
+            #endif
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "System/Systems.h"
 #include "System/Types/Event.h"
 #include "System/Time/TimeStamp.h"
+#include "System/Time/Timers.h"
 #include "System/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
@@ -60,6 +61,33 @@ namespace EE::Resource
         };
         #endif
 
+        // The max number of times we will step the active requests in a single async task
+        // Each pass allows requests to move forward once their install dependencies have completed without waiting for the next update
+        constexpr static int32_t const s_maxProcessingPassesPerUpdate = 8;
+
+    public:
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct Stats
+        {
+            int32_t                 m_numRequestsInFlight = 0;
+            int32_t                 m_peakRequestsInFlight = 0;
+            int32_t                 m_numProcessingPasses = 0;
+            int32_t                 m_numParallelStageRequests = 0;
+            Milliseconds            m_currentBusyPeriodTime = 0;
+            Milliseconds            m_lastBusyPeriodTime = 0; // The time taken to service the last burst of requests (e.g. a map load)
+            int32_t                 m_numRequestsCompletedInBusyPeriod = 0;
+        };
+
+        // A completed burst of requests (e.g. a map load), recorded so that the serial and pipelined processing can be compared
+        struct BusyPeriod
+        {
+            Milliseconds            m_time = 0;
+            int32_t                 m_numCompletedRequests = 0;
+            bool                    m_wasSerialProcessing = false;
+        };
+        #endif
+
     public:
 
         EE_SYSTEM_ID( ResourceSystem );
@@ -115,6 +143,18 @@ namespace EE::Resource
         void ClearHotReloadRequests();
         #endif
 
+        // Stats
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline Stats const& GetStats() const { return m_stats; }
+        inline TVector<BusyPeriod> const& GetBusyPeriodHistory() const { return m_busyPeriodHistory; }
+
+        // Process the requests one stage per update with no parallel stages (i.e. the pre-pipelining behavior), used for comparisons
+        inline bool IsSerialProcessingEnabled() const { return m_isSerialProcessingEnabled; }
+        inline void SetSerialProcessingEnabled( bool isEnabled ) { m_isSerialProcessingEnabled = isEnabled; }
+        #endif
+
     private:
 
         void UpdateResourceProvider();
@@ -137,18 +177,32 @@ namespace EE::Resource
         // Process all queued resource requests
         void ProcessResourceRequests();
 
+        // Create or switch the active requests for all pending requests
+        // Returns true if any active requests were created or modified
+        bool ProcessPendingRequests();
+
+        // Step all active requests once, the expensive stages (read/load and install) are executed in parallel
+        // Returns true if any request advanced a stage
+        bool UpdateActiveRequests();
+
+        // Can we release the record for an unloaded resource, active and pending requests may still be referencing it
+        bool CanReleaseResourceRecord( ResourceRecord const* pRecord ) const;
+
     private:
 
         TaskSystem&                                             m_taskSystem;
         ResourceProvider*                                       m_pResourceProvider = nullptr;
         THashMap<ResourceTypeID, ResourceLoader*>               m_resourceLoaders;
         THashMap<ResourceID, ResourceRecord*>                   m_resourceRecords;
-        mutable Threading::RecursiveMutex                       m_accessLock;
+        mutable Threading::RecursiveMutex                       m_accessLock; // Guards the resource records and their references
 
         // Requests
+        mutable Threading::Mutex                                m_pendingRequestsLock; // Always acquired after the access lock if both are needed
         TVector<PendingRequest>                                 m_pendingRequests;
-        TVector<ResourceRequest*>                               m_activeRequests;
+        TVector<PendingRequest>                                 m_pendingRequestsToProcess;
+        TVector<ResourceRequest*>                               m_activeRequests; // Only accessed by the main thread or the async task, never both at once
         TVector<ResourceRequest*>                               m_completedRequests;
+        TVector<ResourceRequest*>                               m_parallelStageRequests;
 
         // ASync
         AsyncTask                                               m_asyncProcessingTask;
@@ -158,6 +212,11 @@ namespace EE::Resource
         TVector<ResourceRequesterID>                            m_usersThatRequireReload;
         TVector<ResourceID>                                     m_externallyUpdatedResources;
         TVector<CompletedRequestLog>                            m_history;
+        Stats                                                   m_stats;
+        TVector<BusyPeriod>                                     m_busyPeriodHistory;
+        Timer<PlatformClock>                                    m_busyPeriodTimer;
+        bool                                                    m_wasBusy = false;
+        bool                                                    m_isSerialProcessingEnabled = false;
         #endif
     };
 }
\ No newline at end of file
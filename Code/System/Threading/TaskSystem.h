@@ -3,6 +3,7 @@
 #include "../_Module/API.h"
 #include "System/Types/Arrays.h"
 #include "System/Systems.h"
+#include "System/Threading/Threading.h"
 #include "System/ThirdParty/EnkiTS/TaskScheduler.h"
 
 //-------------------------------------------------------------------------
@@ -43,6 +44,17 @@ namespace EE
         inline bool IsBusy() const { return m_taskScheduler.GetIsRunning(); }
         inline uint32_t GetNumWorkers() const { return m_numWorkers; }
 
+        // Get the total number of threads that can execute tasks (workers + main thread)
+        inline uint32_t GetNumThreads() const { return m_numWorkers + 1; }
+
+        // Get the index of the current thread - the main thread is index 0 and the workers are [1, GetNumThreads())
+        // Threads that are not owned by the task system share the main thread's scheduler index, so they return InvalidIndex instead
+        inline uint32_t GetCurrentThreadIdx() const
+        {
+            uint32_t const threadNum = m_taskScheduler.GetThreadNum();
+            return ( threadNum == 0 && !Threading::IsMainThread() ) ? uint32_t( InvalidIndex ) : threadNum;
+        }
+
         inline void WaitForAll() { m_taskScheduler.WaitforAll(); }
 
         inline void ScheduleTask( ITaskSet* pTask )
@@ -1,5 +1,7 @@
 #include "TypeDescriptors.h"
 #include "TypeRegistry.h"
+#include "EnumInfo.h"
+#include "System/Resource/ResourcePtr.h"
 #include "System/Math/Math.h"
 #include "System/Log.h"
 
@@ -77,6 +79,92 @@ namespace EE::TypeSystem
 
             return resolvedPath;
         }
+
+        // Resolves a given property path to a byte offset from the start of the type instance
+        // This will fail for any paths that go through a dynamic array, since those elements do not have a fixed address
+        static PropertyInfo const* ResolvePropertyOffset( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, PropertyPath const& path, uint32_t& outOffset )
+        {
+            outOffset = 0;
+
+            TypeInfo const* pResolvedTypeInfo = pTypeInfo;
+            PropertyInfo const* pFoundPropertyInfo = nullptr;
+
+            size_t const numPathElements = path.GetNumElements();
+            for ( size_t i = 0; i < numPathElements; i++ )
+            {
+                if ( pResolvedTypeInfo == nullptr )
+                {
+                    return nullptr;
+                }
+
+                pFoundPropertyInfo = pResolvedTypeInfo->GetPropertyInfo( path[i].m_propertyID );
+                if ( pFoundPropertyInfo == nullptr || pFoundPropertyInfo->IsDynamicArrayProperty() )
+                {
+                    return nullptr;
+                }
+
+                outOffset += pFoundPropertyInfo->m_offset;
+
+                if ( pFoundPropertyInfo->IsStaticArrayProperty() )
+                {
+                    if ( path[i].m_arrayElementIdx < 0 || path[i].m_arrayElementIdx >= pFoundPropertyInfo->m_arraySize )
+                    {
+                        return nullptr;
+                    }
+
+                    outOffset += path[i].m_arrayElementIdx * pFoundPropertyInfo->m_arrayElementSize;
+                }
+
+                pResolvedTypeInfo = IsCoreType( pFoundPropertyInfo->m_typeID ) ? nullptr : typeRegistry.GetTypeInfo( pFoundPropertyInfo->m_typeID );
+            }
+
+            return pFoundPropertyInfo;
+        }
+
+        // Can the native value of this core type simply be copied into place
+        static bool IsTriviallyCopyableCoreType( CoreTypeID coreType )
+        {
+            switch ( coreType )
+            {
+                case CoreTypeID::Bool:
+                case CoreTypeID::Uint8:
+                case CoreTypeID::Int8:
+                case CoreTypeID::Uint16:
+                case CoreTypeID::Int16:
+                case CoreTypeID::Uint32:
+                case CoreTypeID::Int32:
+                case CoreTypeID::Uint64:
+                case CoreTypeID::Int64:
+                case CoreTypeID::Float:
+                case CoreTypeID::Double:
+                case CoreTypeID::UUID:
+                case CoreTypeID::StringID:
+                case CoreTypeID::Tag:
+                case CoreTypeID::TypeID:
+                case CoreTypeID::Color:
+                case CoreTypeID::Float2:
+                case CoreTypeID::Float3:
+                case CoreTypeID::Float4:
+                case CoreTypeID::Vector:
+                case CoreTypeID::Quaternion:
+                case CoreTypeID::Matrix:
+                case CoreTypeID::Transform:
+                case CoreTypeID::Microseconds:
+                case CoreTypeID::Milliseconds:
+                case CoreTypeID::Seconds:
+                case CoreTypeID::Percentage:
+                case CoreTypeID::Degrees:
+                case CoreTypeID::Radians:
+                case CoreTypeID::EulerAngles:
+                case CoreTypeID::IntRange:
+                case CoreTypeID::FloatRange:
+                case CoreTypeID::ResourceTypeID:
+                return true;
+
+                default:
+                return false;
+            }
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -200,22 +288,139 @@ namespace EE::TypeSystem
 
         for ( auto const& propertyValue : m_properties )
         {
+            SetPropertyValue( typeRegistry, pTypeInfo, pTypeInstance, propertyValue );
+        }
+
+        return pTypeInstance;
+    }
+
+    void TypeDescriptor::SetPropertyValue( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, PropertyDescriptor const& propertyValue ) const
+    {
+        EE_ASSERT( propertyValue.IsValid() );
+
+        // Resolve a property path for a given instance
+        auto resolvedPath = ResolvePropertyPath( typeRegistry, pTypeInfo, (uint8_t*) pTypeInstance, propertyValue.m_path );
+        if ( !resolvedPath.IsValid() )
+        {
+            EE_LOG_ERROR( "TypeSystem", "Type Descriptor", "Tried to set the value for an invalid property (%s) for type (%s)", propertyValue.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+            return;
+        }
+
+        // Set actual property value
+        auto const& resolvedProperty = resolvedPath.m_pathElements.back();
+        Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyValue.m_byteValue, resolvedProperty.m_pAddress );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void TypeInstantiationProgram::Reset()
+    {
+        m_pTypeInfo = nullptr;
+        m_copyPatches.clear();
+        m_resourcePtrFixups.clear();
+        m_fallbackPropertyIndices.clear();
+        m_data.clear();
+    }
+
+    void TypeDescriptor::CreateInstantiationProgram( TypeRegistry const& typeRegistry, TypeInstantiationProgram& outProgram ) const
+    {
+        EE_ASSERT( IsValid() );
+
+        outProgram.Reset();
+        outProgram.m_pTypeInfo = typeRegistry.GetTypeInfo( m_typeID );
+        EE_ASSERT( outProgram.m_pTypeInfo != nullptr );
+
+        //-------------------------------------------------------------------------
+
+        int32_t const numProperties = (int32_t) m_properties.size();
+        for ( int32_t i = 0; i < numProperties; i++ )
+        {
+            PropertyDescriptor const& propertyValue = m_properties[i];
             EE_ASSERT( propertyValue.IsValid() );
 
-            // Resolve a property path for a given instance
-            auto resolvedPath = ResolvePropertyPath( typeRegistry, pTypeInfo, (uint8_t*) pTypeInstance, propertyValue.m_path );
-            if ( !resolvedPath.IsValid() )
+            uint32_t offset = 0;
+            PropertyInfo const* pPropertyInfo = ResolvePropertyOffset( typeRegistry, outProgram.m_pTypeInfo, propertyValue.m_path, offset );
+            if ( pPropertyInfo == nullptr )
             {
-                EE_LOG_ERROR( "TypeSystem", "Type Descriptor", "Tried to set the value for an invalid property (%s) for type (%s)", propertyValue.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+                outProgram.m_fallbackPropertyIndices.emplace_back( i );
                 continue;
             }
 
-            // Set actual property value
-            auto const& resolvedProperty = resolvedPath.m_pathElements.back();
-            Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyValue.m_byteValue, resolvedProperty.m_pAddress );
+            // Get the native size of the value, if we can copy it
+            //-------------------------------------------------------------------------
+
+            size_t nativeSize = 0;
+
+            if ( pPropertyInfo->IsEnumProperty() )
+            {
+                EnumInfo const* pEnumInfo = typeRegistry.GetEnumInfo( pPropertyInfo->m_typeID );
+                EE_ASSERT( pEnumInfo != nullptr );
+                nativeSize = CoreTypeRegistry::GetTypeSize( pEnumInfo->m_underlyingType );
+            }
+            else if ( IsCoreType( pPropertyInfo->m_typeID ) )
+            {
+                CoreTypeID const coreType = GetCoreType( pPropertyInfo->m_typeID );
+                if ( coreType == CoreTypeID::ResourcePtr || coreType == CoreTypeID::TResourcePtr )
+                {
+                    Resource::ResourcePtr resourcePtr;
+                    Conversion::ConvertBinaryToNativeType( typeRegistry, *pPropertyInfo, propertyValue.m_byteValue, &resourcePtr );
+
+                    auto& fixup = outProgram.m_resourcePtrFixups.emplace_back();
+                    fixup.m_offset = offset;
+                    fixup.m_resourceID = resourcePtr.GetResourceID();
+                    continue;
+                }
+
+                if ( IsTriviallyCopyableCoreType( coreType ) )
+                {
+                    nativeSize = CoreTypeRegistry::GetTypeSize( coreType );
+                }
+            }
+
+            // Everything else (strings, curves, flags, etc...) needs to be set via the regular path
+            if ( nativeSize == 0 )
+            {
+                outProgram.m_fallbackPropertyIndices.emplace_back( i );
+                continue;
+            }
+
+            // Convert to native form and store the result
+            //-------------------------------------------------------------------------
+
+            alignas( 16 ) uint8_t nativeValue[64];
+            EE_ASSERT( nativeSize <= sizeof( nativeValue ) );
+            memset( nativeValue, 0, sizeof( nativeValue ) );
+            Conversion::ConvertBinaryToNativeType( typeRegistry, *pPropertyInfo, propertyValue.m_byteValue, nativeValue );
+
+            auto& patch = outProgram.m_copyPatches.emplace_back();
+            patch.m_offset = offset;
+            patch.m_dataOffset = (uint32_t) outProgram.m_data.size();
+            patch.m_size = (uint32_t) nativeSize;
+            outProgram.m_data.insert( outProgram.m_data.end(), nativeValue, nativeValue + nativeSize );
         }
+    }
 
-        return pTypeInstance;
+    void TypeDescriptor::ExecuteInstantiationProgram( TypeRegistry const& typeRegistry, TypeInstantiationProgram const& program, void* pTypeInstance ) const
+    {
+        EE_ASSERT( program.IsValid() && program.m_pTypeInfo->m_ID == m_typeID );
+        EE_ASSERT( ( program.m_copyPatches.size() + program.m_resourcePtrFixups.size() + program.m_fallbackPropertyIndices.size() ) == m_properties.size() );
+
+        uint8_t* pTypeInstanceAddress = reinterpret_cast<uint8_t*>( pTypeInstance );
+
+        for ( auto const& patch : program.m_copyPatches )
+        {
+            memcpy( pTypeInstanceAddress + patch.m_offset, program.m_data.data() + patch.m_dataOffset, patch.m_size );
+        }
+
+        for ( auto const& fixup : program.m_resourcePtrFixups )
+        {
+            *reinterpret_cast<Resource::ResourcePtr*>( pTypeInstanceAddress + fixup.m_offset ) = Resource::ResourcePtr( fixup.m_resourceID );
+        }
+
+        for ( int32_t const propertyIdx : program.m_fallbackPropertyIndices )
+        {
+            SetPropertyValue( typeRegistry, program.m_pTypeInfo, pTypeInstance, m_properties[propertyIdx] );
+        }
     }
 
     //-------------------------------------------------------------------------
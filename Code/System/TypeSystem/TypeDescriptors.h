@@ -5,6 +5,7 @@
 #include "CoreTypeIDs.h"
 #include "CoreTypeConversions.h"
 #include "TypeRegistry.h"
+#include "System/Resource/ResourceID.h"
 
 //-------------------------------------------------------------------------
 // Basic descriptor of a reflected property
@@ -91,6 +92,46 @@ namespace EE::TypeSystem
         #endif
     };
 
+    //-------------------------------------------------------------------------
+    // Type Instantiation Program
+    //-------------------------------------------------------------------------
+    // A precomputed form of a type descriptor's property values that allows us to instantiate the type without resolving any property paths
+    // All properties with a fixed address in the type (i.e. not contained in a dynamic array) are resolved to byte offsets:
+    // * trivially copyable values are converted to their native form once and are then simply copied into place
+    // * resource ptrs are stored as fixups that only need to set the resource ID
+    // All remaining properties fall back to the regular path resolution
+    //
+    // Since this relies on the type layouts, a program is only valid for the build it was created in and so it is never serialized
+
+    struct EE_SYSTEM_API TypeInstantiationProgram
+    {
+        struct CopyPatch
+        {
+            uint32_t                                                m_offset = 0;
+            uint32_t                                                m_dataOffset = 0;
+            uint32_t                                                m_size = 0;
+        };
+
+        struct ResourcePtrFixup
+        {
+            uint32_t                                                m_offset = 0;
+            ResourceID                                              m_resourceID;
+        };
+
+    public:
+
+        inline bool IsValid() const { return m_pTypeInfo != nullptr; }
+        void Reset();
+
+    public:
+
+        TypeInfo const*                                             m_pTypeInfo = nullptr;
+        TVector<CopyPatch>                                          m_copyPatches;
+        TVector<ResourcePtrFixup>                                   m_resourcePtrFixups;
+        TInlineVector<int32_t, 2>                                   m_fallbackPropertyIndices; // Indices of the descriptor properties that need to be resolved when instantiating
+        Blob                                                        m_data;
+    };
+
     //-------------------------------------------------------------------------
     // Type Descriptor
     //-------------------------------------------------------------------------
@@ -140,6 +181,22 @@ namespace EE::TypeSystem
             return CreateTypeInstance<T>( typeRegistry, pTypeInfo );
         }
 
+        // Create a new instance of the described type using a precomputed instantiation program for this descriptor
+        template<typename T>
+        [[nodiscard]] inline T* CreateTypeInstance( TypeRegistry const& typeRegistry, TypeInstantiationProgram const& program ) const
+        {
+            EE_ASSERT( program.IsValid() && program.m_pTypeInfo->m_ID == m_typeID );
+            EE_ASSERT( program.m_pTypeInfo->IsDerivedFrom<T>() );
+
+            // Create new instance
+            void* pTypeInstance = program.m_pTypeInfo->CreateType();
+            EE_ASSERT( pTypeInstance != nullptr );
+
+            // Set properties
+            ExecuteInstantiationProgram( typeRegistry, program, pTypeInstance );
+            return reinterpret_cast<T*>( pTypeInstance );
+        }
+
         // This will create a new instance of the described type in the memory block provided
         // WARNING! Do not use this function on an existing type instance of type T since it will not call the destructor and so will leak, only use on uninitialized memory
         template<typename T>
@@ -183,9 +240,17 @@ namespace EE::TypeSystem
         inline PropertyDescriptor const* GetProperty( PropertyPath const& path ) const { return const_cast<TypeDescriptor*>( this )->GetProperty( path ); }
         void RemovePropertyValue( PropertyPath const& path );
 
+        // Instantiation Program
+        //-------------------------------------------------------------------------
+
+        // Precompute the program needed to instantiate this descriptor, this program is invalidated by any changes to the descriptor's properties
+        void CreateInstantiationProgram( TypeRegistry const& typeRegistry, TypeInstantiationProgram& outProgram ) const;
+
     private:
 
         void* SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const;
+        void SetPropertyValue( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, PropertyDescriptor const& propertyValue ) const;
+        void ExecuteInstantiationProgram( TypeRegistry const& typeRegistry, TypeInstantiationProgram const& program, void* pTypeInstance ) const;
 
     public:
 
@@ -1,101 +1,226 @@
 #include "StringID.h"
-#include "System/Memory/Memory.h"
-#include "System/Algorithm/Hash.h"
-#include "System/Threading/Threading.h"
 #include "String.h"
-#include "EASTL/hash_map.h"
+#include <atomic>
+#include <thread>
 
 //-------------------------------------------------------------------------
+// String Cache
+//-------------------------------------------------------------------------
+// A lock-free, insert-only, open addressing hash table (linear probing) mapping IDs to strings
+//
+// IDs are claimed with a CAS and the string is published afterwards, readers that find an ID whose string is not yet published will spin until it is
+// Once a table is half full, a new table with double the capacity is created. Previous tables are never freed and are still searched,
+// this means that readers never need to synchronize with the growth and that existing string pointers remain valid forever
+//
+// Note: StringIDs are created during static initialization so nothing here can rely on the engine allocators or on dynamic initialization
 
 namespace EE
 {
-    class StringID_CustomAllocator
+    struct StringIDTable
     {
-    public:
+        uint32_t                            m_capacity = 0;
+        std::atomic<uint32_t>*              m_pIDs = nullptr;
+        std::atomic<char const*>*           m_pStrings = nullptr;
+        std::atomic<uint32_t>               m_numEntries = 0;
+        StringIDTable*                      m_pPreviousTable = nullptr;
+    };
 
-        EASTL_ALLOCATOR_EXPLICIT StringID_CustomAllocator( const char* pName = EASTL_NAME_VAL( EASTL_ALLOCATOR_DEFAULT_NAME ) ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x, const char* pName ) {}
-        StringID_CustomAllocator& operator=( const StringID_CustomAllocator& x ) { return *this; }
-        const char* get_name() const { return "StringID"; }
-        void set_name( const char* pName ) {}
+    struct StringID::DebuggerInfo
+    {
+        std::atomic<StringIDTable*> const*  m_pCurrentTable = nullptr;
+    };
 
-        void* allocate( size_t n, int flags = 0 )
+    //-------------------------------------------------------------------------
+
+    constexpr static uint32_t const g_initialStringTableCapacity = 8192;
+
+    static std::atomic<StringIDTable*> g_pStringTable = nullptr;
+
+    // Natvis/Debugger info to print out human-readable strings
+    static StringID::DebuggerInfo const g_debuggerInfo = { &g_pStringTable };
+    StringID::DebuggerInfo const* StringID::s_pDebuggerInfo = &g_debuggerInfo;
+
+    //-------------------------------------------------------------------------
+
+    static StringIDTable* CreateTable( uint32_t capacity, StringIDTable* pPreviousTable )
+    {
+        EE_ASSERT( ( capacity & ( capacity - 1 ) ) == 0 );
+
+        auto pTable = new StringIDTable();
+        pTable->m_capacity = capacity;
+        pTable->m_pIDs = new std::atomic<uint32_t>[capacity];
+        pTable->m_pStrings = new std::atomic<char const*>[capacity];
+        pTable->m_pPreviousTable = pPreviousTable;
+
+        for ( uint32_t i = 0; i < capacity; i++ )
         {
-            return allocate( n, EASTL_SYSTEM_ALLOCATOR_MIN_ALIGNMENT, 0, flags );
+            pTable->m_pIDs[i].store( 0, std::memory_order_relaxed );
+            pTable->m_pStrings[i].store( nullptr, std::memory_order_relaxed );
         }
 
-        void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
+        return pTable;
+    }
+
+    static void DestroyTable( StringIDTable* pTable )
+    {
+        delete[] pTable->m_pIDs;
+        delete[] pTable->m_pStrings;
+        delete pTable;
+    }
+
+    static StringIDTable* GetCurrentTable()
+    {
+        StringIDTable* pTable = g_pStringTable.load( std::memory_order_acquire );
+        if ( pTable == nullptr )
         {
-            size_t adjustedAlignment = ( alignment > EA_PLATFORM_PTR_SIZE ) ? alignment : EA_PLATFORM_PTR_SIZE;
+            StringIDTable* pNewTable = CreateTable( g_initialStringTableCapacity, nullptr );
+            if ( g_pStringTable.compare_exchange_strong( pTable, pNewTable, std::memory_order_acq_rel ) )
+            {
+                pTable = pNewTable;
+            }
+            else // Someone else created the table
+            {
+                DestroyTable( pNewTable );
+            }
+        }
 
-            void* p = new char[n + adjustedAlignment + EA_PLATFORM_PTR_SIZE];
-            void* pPlusPointerSize = (void*) ( (uintptr_t) p + EA_PLATFORM_PTR_SIZE );
-            void* pAligned = (void*) ( ( (uintptr_t) pPlusPointerSize + adjustedAlignment - 1 ) & ~( adjustedAlignment - 1 ) );
+        return pTable;
+    }
 
-            void** pStoredPtr = (void**) pAligned - 1;
-            EASTL_ASSERT( pStoredPtr >= p );
-            *( pStoredPtr ) = p;
+    // Replace the supplied table with a larger one, returns the new current table
+    static StringIDTable* GrowTable( StringIDTable* pTable )
+    {
+        StringIDTable* pCurrentTable = g_pStringTable.load( std::memory_order_acquire );
+        if ( pCurrentTable != pTable )
+        {
+            return pCurrentTable;
+        }
 
-            EASTL_ASSERT( ( (size_t) pAligned & ~( alignment - 1 ) ) == (size_t) pAligned );
-            return pAligned;
+        StringIDTable* pNewTable = CreateTable( pTable->m_capacity * 2, pTable );
+        if ( g_pStringTable.compare_exchange_strong( pCurrentTable, pNewTable, std::memory_order_acq_rel ) )
+        {
+            return pNewTable;
         }
 
-        void deallocate( void* p, size_t n )
+        DestroyTable( pNewTable );
+        return pCurrentTable;
+    }
+
+    // Returns the slot for the ID in the specified table or InvalidIndex if it is not present
+    static int32_t FindSlot( StringIDTable const* pTable, uint32_t ID )
+    {
+        uint32_t const mask = pTable->m_capacity - 1;
+        uint32_t slotIdx = ID & mask;
+        for ( uint32_t i = 0; i < pTable->m_capacity; i++ )
         {
-            if ( p != nullptr )
+            uint32_t const slotID = pTable->m_pIDs[slotIdx].load( std::memory_order_acquire );
+            if ( slotID == ID )
             {
-                void* pOriginalAllocation = *( (void**) p - 1 );
-                delete[]( char* )pOriginalAllocation;
+                return (int32_t) slotIdx;
             }
-        }
-    };
 
-    inline bool operator==( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return true; }
-    inline bool operator!=( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return false; }
+            if ( slotID == 0 )
+            {
+                break;
+            }
 
-    //-------------------------------------------------------------------------
+            slotIdx = ( slotIdx + 1 ) & mask;
+        }
 
-    using CachedString = eastl::basic_string<char, StringID_CustomAllocator>;
+        return InvalidIndex;
+    }
 
-    class StringIDHashMap : public eastl::hash_map<uint32_t, CachedString, eastl::hash<uint32_t>, eastl::equal_to<uint32_t>, StringID_CustomAllocator>
+    static bool IsRegistered( uint32_t ID )
     {
-    public:
-      
-        eastl::hash_node<value_type, false> const* const* GetBuckets() const { return mpBucketArray; }
-    };
+        for ( StringIDTable const* pTable = g_pStringTable.load( std::memory_order_acquire ); pTable != nullptr; pTable = pTable->m_pPreviousTable )
+        {
+            if ( FindSlot( pTable, ID ) != InvalidIndex )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
 
     //-------------------------------------------------------------------------
 
-    StringIDHashMap g_stringCache;
-    Threading::Mutex g_stringCacheMutex;
+    uint32_t StringID::RegisterString( char const* pStr )
+    {
+        return ( pStr != nullptr ) ? RegisterString( pStr, strlen( pStr ) ) : 0;
+    }
 
-    // Natvis/Debugger info to print out human-readable strings
-    StringID::DebuggerInfo g_debuggerInfo;
-    EE::StringID::DebuggerInfo const* StringID::s_pDebuggerInfo = &g_debuggerInfo;
+    uint32_t StringID::RegisterString( char const* pStr, size_t length )
+    {
+        if ( length == 0 )
+        {
+            return 0;
+        }
 
-    //-------------------------------------------------------------------------
+        uint32_t const ID = Hash::XXHash::GetHash32( pStr, length );
+        RegisterString( ID, pStr, length );
+        return ID;
+    }
 
-    StringID::StringID( char const* pStr )
+    void StringID::RegisterString( uint32_t ID, char const* pStr, size_t length )
     {
-        if ( pStr != nullptr && strlen( pStr ) > 0 )
+        if ( ID == 0 )
+        {
+            return;
+        }
+
+        // Fast path, the vast majority of strings are already registered
+        if ( IsRegistered( ID ) )
         {
-            m_ID = Hash::GetHash32( pStr );
+            return;
+        }
+
+        // Insert into the current table
+        //-------------------------------------------------------------------------
+        // If another thread grows the table while we are inserting, we might end up with a duplicate entry in the new table which is harmless
 
-            // Cache the string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter == g_stringCache.end() )
+        StringIDTable* pTable = GetCurrentTable();
+        while ( true )
+        {
+            uint32_t const mask = pTable->m_capacity - 1;
+            uint32_t slotIdx = ID & mask;
+            for ( uint32_t i = 0; i < pTable->m_capacity; i++ )
             {
-                g_stringCache[m_ID] = CachedString( pStr );
-                g_debuggerInfo.m_pBuckets = g_stringCache.GetBuckets();
-                g_debuggerInfo.m_numBuckets = g_stringCache.bucket_count();
+                uint32_t slotID = pTable->m_pIDs[slotIdx].load( std::memory_order_acquire );
+                if ( slotID == 0 && pTable->m_pIDs[slotIdx].compare_exchange_strong( slotID, ID, std::memory_order_acq_rel ) )
+                {
+                    // Copy and publish the string
+                    char* pCachedString = new char[length + 1];
+                    memcpy( pCachedString, pStr, length );
+                    pCachedString[length] = 0;
+                    pTable->m_pStrings[slotIdx].store( pCachedString, std::memory_order_release );
+
+                    if ( ( pTable->m_numEntries.fetch_add( 1, std::memory_order_relaxed ) + 1 ) > ( pTable->m_capacity / 2 ) )
+                    {
+                        GrowTable( pTable );
+                    }
+
+                    return;
+                }
+
+                // Someone else is registering the same string
+                if ( slotID == ID )
+                {
+                    return;
+                }
+
+                slotIdx = ( slotIdx + 1 ) & mask;
             }
+
+            // The table is full, this can only happen if a lot of threads insert into a table that is already being replaced
+            pTable = GrowTable( pTable );
         }
     }
 
+    //-------------------------------------------------------------------------
+
     StringID::StringID( String const& str )
-        : StringID( str.c_str() )
+        : m_ID( RegisterString( str.c_str(), str.length() ) )
     {}
 
     char const* StringID::c_str() const
@@ -105,17 +230,25 @@ namespace EE
             return nullptr;
         }
 
+        // Get cached string
+        for ( StringIDTable const* pTable = g_pStringTable.load( std::memory_order_acquire ); pTable != nullptr; pTable = pTable->m_pPreviousTable )
         {
-            // Get cached string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter != g_stringCache.end() )
+            int32_t const slotIdx = FindSlot( pTable, m_ID );
+            if ( slotIdx != InvalidIndex )
             {
-                return iter->second.c_str();
+                // The ID might have been claimed but the string not yet published
+                char const* pString = pTable->m_pStrings[slotIdx].load( std::memory_order_acquire );
+                while ( pString == nullptr )
+                {
+                    std::this_thread::yield();
+                    pString = pTable->m_pStrings[slotIdx].load( std::memory_order_acquire );
+                }
+
+                return pString;
             }
         }
 
-        // ID likely directly created via uint32_t
+        // ID likely directly created via uint32_t (or from a literal in a shipping build)
         return nullptr;
     }
-}
\ No newline at end of file
+}
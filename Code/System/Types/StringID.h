@@ -2,7 +2,9 @@
 
 #include "System/_Module/API.h"
 #include "System/Types/Containers_ForwardDecl.h"
+#include "System/Algorithm/Hash.h"
 #include "System/Esoterica.h"
+#include <type_traits>
 
 //-------------------------------------------------------------------------
 // String ID
@@ -10,47 +12,42 @@
 // Deterministic numeric ID generated from a string
 // StringIDs are CASE-SENSITIVE!
 // Uses the 32bit default hash
-
-namespace eastl
-{
-    template <typename Value, bool bCacheHashCode>
-    struct hash_node;
-
-    template <typename T1, typename T2>
-    struct pair;
-}
-
-//-------------------------------------------------------------------------
+//
+// IDs created from string literals/arrays are hashed with the constant expression version of the hash
+// In shipping builds these are constexpr and never touch the string cache, in development builds the string is still registered so it can be looked up
 
 namespace EE
 {
-    class StringID_CustomAllocator;
-
-    //-------------------------------------------------------------------------
-
     // 用作 ID 的数字字符串
     class EE_SYSTEM_API StringID
     {
-    public:
-
-        using StringIDHashNode = eastl::hash_node<eastl::pair<const uint32_t, eastl::basic_string<char, EE::StringID_CustomAllocator>>, false>;
+        template<typename T>
+        using EnableIfStringPointer = std::enable_if_t<std::is_convertible_v<T const&, char const*> && !std::is_array_v<T>>;
 
-        struct DebuggerInfo
-        {
-            StringIDHashNode const* const*  m_pBuckets = nullptr;
-            size_t                          m_numBuckets = 0;
-        };
+    public:
 
+        // Natvis/Debugger info to print out human-readable strings
+        struct DebuggerInfo;
         static DebuggerInfo const*          s_pDebuggerInfo;
 
     public:
 
         StringID() = default;
         explicit StringID( nullptr_t ) : m_ID( 0 ) {}
-        explicit StringID( char const* pStr );
         explicit StringID( uint32_t ID ) : m_ID( ID ) {}
         explicit StringID( String const& str );
 
+        template<typename T, typename = EnableIfStringPointer<T>>
+        explicit StringID( T const& pStr ) : m_ID( RegisterString( static_cast<char const*>( pStr ) ) ) {}
+
+        #if EE_DEVELOPMENT_TOOLS
+        template<size_t N>
+        explicit StringID( char const ( &str )[N] ) : m_ID( CalculateID( str, N ) ) { RegisterString( m_ID, str, GetLength( str, N ) ); }
+        #else
+        template<size_t N>
+        constexpr explicit StringID( char const ( &str )[N] ) : m_ID( CalculateID( str, N ) ) {}
+        #endif
+
         inline bool IsValid() const { return m_ID != 0; }
         inline uint32_t GetID() const { return m_ID; }
         inline operator uint32_t() const { return m_ID; }
@@ -62,6 +59,32 @@ namespace EE
         inline bool operator==( StringID const& rhs ) const { return m_ID == rhs.m_ID; }
         inline bool operator!=( StringID const& rhs ) const { return m_ID != rhs.m_ID; }
 
+    private:
+
+        // Arrays are not necessarily string literals (i.e. char buffers) so we need to find the actual string length
+        constexpr static size_t GetLength( char const* pStr, size_t maxLength )
+        {
+            size_t length = 0;
+            while ( length < maxLength && pStr[length] != 0 )
+            {
+                length++;
+            }
+            return length;
+        }
+
+        constexpr static uint32_t CalculateID( char const* pStr, size_t maxLength )
+        {
+            size_t const length = GetLength( pStr, maxLength );
+            return ( length > 0 ) ? Hash::XXHash::GetConstHash32( pStr, length ) : 0;
+        }
+
+        // Hash and register a string with the string cache, returns the ID
+        static uint32_t RegisterString( char const* pStr );
+        static uint32_t RegisterString( char const* pStr, size_t length );
+
+        // Register a string with an already calculated ID with the string cache
+        static void RegisterString( uint32_t ID, char const* pStr, size_t length );
+
     private:
         // ID 数值
         uint32_t                            m_ID = 0;
@@ -79,4 +102,4 @@ namespace eastl
     {
         size_t operator()( EE::StringID const& ID ) const { return (uint32_t) ID; }
     };
-}
\ No newline at end of file
+}